@@ -11,7 +11,7 @@ import warnings
 from sofia import __version__ as version
 
 # Dependency checking
-dependencies = [['numpy', '1.7'], ['scipy', None], ['pyfits', None]]
+dependencies = [['numpy', '1.7'], ['scipy', None], ['pyfits', None], ['Cython', '0.29.31']]
 
 for (pkg, minversion) in dependencies:
     try:
@@ -33,6 +33,7 @@ for (pkg, minversion) in dependencies:
         sys.exit(1)
 
 import numpy
+from Cython.Build import cythonize
 
 # Define include directories
 include_dirs = []
@@ -59,15 +60,36 @@ if sys.platform == 'darwin':
     ext_include_dirs = [ext_include_dir for ext_include_dir in ext_include_dirs if not 'bin'
                         in ext_include_dir]
 
+# OpenMP is used by the parallel linking engine; the default compiler on Mac OS does not support
+# it, in which case the engine runs on a single thread
+openmp_args = []
+if sys.platform != 'darwin':
+    openmp_args = ['-fopenmp']
+
+# The linker uses C++11 for its clock, threads and thread-local counters, which compilers before
+# GCC 6 don't enable by default
+linker_args = ['-std=c++11']
+
 # C/C++ source code files
 # Object linking code
 linker_src_base = 'src/linker/'
 linker_src_files = [
-    'linker.cpp',
+    'linker.pyx',
     'RJJ_ObjGen_CreateObjs.cpp',
+    'RJJ_ObjGen_UnionFind.cpp',
+    'RJJ_ObjGen_SlabLink.cpp',
+    'RJJ_ObjGen_SparseReps.cpp',
+    'RJJ_ObjGen_AddObjs.cpp',
+    'RJJ_ObjGen_ObjIDs.cpp',
+    'RJJ_ObjGen_ObjStore.cpp',
+    'RJJ_ObjGen_Arena.cpp',
     'RJJ_ObjGen_DetectDefn.cpp',
     'RJJ_ObjGen_MemManage.cpp',
     'RJJ_ObjGen_ThreshObjs.cpp',
+    'RJJ_ObjGen_Label.cpp',
+    'RJJ_ObjGen_FitsMask.cpp',
+    'RJJ_ObjGen_Maps.cpp',
+    'RJJ_ObjGen_TaskPool.cpp',
     'RJJ_ObjGen_Dmetric.cpp'
     ]
 linker_src = [linker_src_base + f for f in linker_src_files]
@@ -76,7 +98,7 @@ linker_src = [linker_src_base + f for f in linker_src_files]
 parametrizer_src_base = 'src/parametrizer/'
 parametrizer_src_files = [
     'BusyFit.cpp',
-    'cparametrizer.cpp',
+    'cparametrizer.pyx',
     'DataCube.cpp',
     'helperFunctions.cpp',
     'MaskOptimization.cpp',
@@ -94,21 +116,24 @@ setup(
     name='sofia',
     version=version,
     ext_package='sofia',
-    ext_modules=[
+    ext_modules=cythonize([
         Extension(
             'linker',
             linker_src,
-            extra_compile_args=['-O3'],
+            language='c++',
+            extra_compile_args=['-O3'] + linker_args + openmp_args,
+            extra_link_args=openmp_args,
             include_dirs=include_dirs),
         Extension(
             'cparametrizer',
             parametrizer_src,
+            language='c++',
             extra_compile_args=['-O3'],
             include_dirs=include_dirs + ext_include_dirs,
             library_dirs=ext_library_dirs + ext_include_dirs,
             libraries=['gsl', 'gslcblas']
             )
-        ],
+        ]),
     package_dir={'sofia': 'sofia'},
     packages=['sofia']  #,"cfitsio", "wcs"
     )
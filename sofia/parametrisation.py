@@ -158,3 +158,39 @@ def parametrise(
     return (cube, mask, objects, cathead, catformt, catparunits)
 
 
+
+def parametrise_object(cube, mask, bbox, optimiseMask=False, fitBusyFunction=False):
+    # parametrise a single object, given the data and the boolean mask of its bounding box, e.g.
+    # as the stream function of linker.link_objects, which calls it in worker threads while the
+    # rest of the cube is linked; the parametriser releases the GIL while it runs. The parameters
+    # are returned by name, with the positions in the pixels of the whole cube. The optimised
+    # mask can't grow beyond the bounding box.
+    nz, ny, nx = mask.shape
+    initcatalog = cp.PySourceCatalog()
+    newSource = cp.PySource()
+    newSource.setSourceID(1)
+    newSource.setParameters({
+        'X': cp.PyMeasurement('X', 0.5 * (nx - 1), 0., ''),
+        'Y': cp.PyMeasurement('Y', 0.5 * (ny - 1), 0., ''),
+        'Z': cp.PyMeasurement('Z', 0.5 * (nz - 1), 0., ''),
+        'BBOX_X_MIN': cp.PyMeasurement('BBOX_X_MIN', 0, 0., ''),
+        'BBOX_X_MAX': cp.PyMeasurement('BBOX_X_MAX', nx, 0., ''),
+        'BBOX_Y_MIN': cp.PyMeasurement('BBOX_Y_MIN', 0, 0., ''),
+        'BBOX_Y_MAX': cp.PyMeasurement('BBOX_Y_MAX', ny, 0., ''),
+        'BBOX_Z_MIN': cp.PyMeasurement('BBOX_Z_MIN', 0, 0., ''),
+        'BBOX_Z_MAX': cp.PyMeasurement('BBOX_Z_MAX', nz, 0., ''),
+        })
+    initcatalog.insert(newSource)
+
+    moduleParametrizer = cp.PyModuleParametrisation()
+    moduleParametrizer.setFlags(optimiseMask, fitBusyFunction)
+    moduleParametrizer.run(np.ascontiguousarray(cube, dtype='<f4'), np.ascontiguousarray(mask, dtype='<i2'), initcatalog)
+
+    # shift the positions from the bounding box to the whole cube
+    offsets = {'X': bbox[0], 'Y': bbox[2], 'Z': bbox[4]}
+    parameters = {}
+    for source in moduleParametrizer.getCatalog().getSources().values():
+        for name, measurement in source.getParameters().items():
+            axis = name[5] if name.startswith('BBOX_') else name
+            parameters[name] = measurement.getValue() + offsets.get(axis, 0)
+    return parameters
@@ -91,6 +91,8 @@ def readPipelineOptions(filename = "pipeline.options"):
                  "merge.minSizeX": "int", \
                  "merge.minSizeY": "int", \
                  "merge.minSizeZ": "int", \
+                 "merge.engine": "string", \
+                 "merge.threads": "int", \
                  "reliability.parSpace": "array", \
                  "reliability.kernel": "array", \
                  "reliability.fMin": "float", \
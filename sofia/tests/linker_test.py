@@ -0,0 +1,608 @@
+#! /usr/bin/env python
+# -*- coding: utf-8 -*-
+
+import os
+import shutil
+import tempfile
+import unittest
+import numpy as np
+from sofia import linker
+
+
+def make_cube(seed, density, shape=(20, 30, 40)):
+    rng = np.random.RandomState(seed)
+    data = rng.randn(*shape).astype(np.single)
+    mask = (rng.rand(*shape) < density).astype(np.intc)
+    return data, mask
+
+
+def read_fits(filename):
+    # minimal reader of the primary HDU of a FITS file, returning its header cards and data
+    with open(filename, 'rb') as f:
+        contents = f.read()
+    cards = []
+    while not cards or cards[-1] != 'END':
+        cards.append(contents[len(cards) * 80:len(cards) * 80 + 80].decode('ascii').rstrip())
+    header = dict((card[:8].strip(), card[10:].strip()) for card in cards if card[8:10] == '= ')
+    start = ((len(cards) * 80 + 2879) // 2880) * 2880
+    dtype = {'8': '>u1', '16': '>i2', '32': '>i4', '64': '>i8'}[header['BITPIX']]
+    shape = tuple(int(header['NAXIS%d' % axis]) for axis in (3, 2, 1))
+    size = int(np.prod(shape)) * np.dtype(dtype).itemsize
+    assert (len(contents) - start) == ((size + 2879) // 2880) * 2880
+    return cards, header, np.frombuffer(contents, dtype=dtype, count=int(np.prod(shape)), offset=start).reshape(shape)
+
+
+class LinkObjectsTests(unittest.TestCase):
+    """This tests the object linking interface and its labelling engines"""
+
+    merge_params = [
+        dict(mergeX=1, mergeY=1, mergeZ=1),
+        dict(mergeX=2, mergeY=2, mergeZ=3, minSizeX=2, minSizeY=2, minSizeZ=2),
+        dict(mergeX=3, mergeY=3, mergeZ=5, minSizeX=3, minSizeY=3, minSizeZ=2, min_LOS=2),
+        ]
+
+    def assertSameCatalogue(self, result1, result2):
+        objects1, mask1 = result1
+        objects2, mask2 = result2
+        self.assertEqual(len(objects1), len(objects2))
+        self.assertTrue((mask1 == mask2).all())
+        for obj1, obj2 in zip(objects1, objects2):
+            np.testing.assert_allclose(obj1, obj2, rtol=1e-4, atol=1e-3)
+
+    def assertSameObjects(self, result1, result2):
+        # the objects are the same, but may be numbered differently
+        objects1, mask1 = result1
+        objects2, mask2 = result2
+        self.assertEqual(len(objects1), len(objects2))
+        self.assertTrue(((mask1 > 0) == (mask2 > 0)).all())
+        pairs = dict(zip(mask1[mask1 > 0].tolist(), mask2[mask1 > 0].tolist()))
+        self.assertEqual(len(set(pairs.values())), len(objects1))
+        for obj in objects1:
+            np.testing.assert_allclose(obj[1:], objects2[pairs[obj[0]] - 1][1:], rtol=1e-4, atol=1e-3)
+
+    def testCatalogue(self):
+        print('Testing link_objects: object properties against the labelled mask')
+        data, mask = make_cube(1, 0.1)
+        # use positive fluxes, so that the centres of mass are simple weighted means
+        data = np.abs(data) + 0.1
+        objects, labels = linker.link_objects(data, mask.copy(), mergeX=2, mergeY=2, mergeZ=2)
+        self.assertTrue(len(objects) > 0)
+        self.assertEqual(labels.max(), len(objects))
+        for obj in objects:
+            z, y, x = np.nonzero(labels == obj[0])
+            flux = data[z, y, x].astype(np.double)
+            self.assertEqual(obj[13], len(x))
+            self.assertEqual([obj[7], obj[8], obj[9], obj[10], obj[11], obj[12]],
+                             [x.min(), x.max() + 1, y.min(), y.max() + 1, z.min(), z.max() + 1])
+            np.testing.assert_allclose(obj[16], flux.sum(), rtol=1e-4, atol=1e-3)
+            np.testing.assert_allclose(obj[4:7],
+                                       [(x * flux).sum() / flux.sum(), (y * flux).sum() / flux.sum(), (z * flux).sum() / flux.sum()],
+                                       rtol=1e-3, atol=1e-2)
+
+    def testPostageStamps(self):
+        print('Testing link_objects: postage stamp products against the labelled mask')
+        data, mask = make_cube(2, 0.1, shape=(23, 30, 40))
+        objects, labels, stamps = linker.link_objects(data, mask.copy(), mergeX=2, mergeY=2, mergeZ=2, minSizeZ=2, products=linker.PRODUCT_ALL)
+        self.assertEqual(len(stamps), len(objects))
+        for obj, stamp in zip(objects, stamps):
+            box = (slice(obj[11], obj[12]), slice(obj[9], obj[10]), slice(obj[7], obj[8]))
+            flux = np.where(labels[box] == obj[0], data[box], 0.0).astype(np.double)
+            np.testing.assert_allclose(stamp['mom0'], flux.sum(axis=0), rtol=1e-4, atol=1e-4)
+            np.testing.assert_allclose(stamp['rapv'], flux.sum(axis=1), rtol=1e-4, atol=1e-4)
+            np.testing.assert_allclose(stamp['decpv'], flux.sum(axis=2), rtol=1e-4, atol=1e-4)
+            np.testing.assert_allclose(stamp['spec'], flux.sum(axis=(1, 2)), rtol=1e-4, atol=1e-4)
+            self.assertEqual(stamp['vfield'].shape, stamp['mom0'].shape)
+
+        # only the requested products are built, and the chunked linker builds the same ones
+        objects, labels, stamps = linker.link_objects(data, mask.copy(), mergeX=2, mergeY=2, mergeZ=2, minSizeZ=2, products=linker.PRODUCT_SPEC)
+        self.assertEqual(set(stamps[0].keys()), set(['spec']))
+        objects_c, labels_c, stamps_c = linker.link_objects_chunked(data, mask, chunkZ=7, mergeX=2, mergeY=2, mergeZ=2, minSizeZ=2, products=linker.PRODUCT_SPEC)
+        self.assertSameObjects((objects, labels), (objects_c, labels_c))
+        pairs = dict(zip(labels[labels > 0].tolist(), labels_c[labels > 0].tolist()))
+        for obj, stamp in zip(objects, stamps):
+            np.testing.assert_allclose(stamp['spec'], stamps_c[pairs[obj[0]] - 1]['spec'], rtol=1e-4, atol=1e-4)
+
+        with self.assertRaises(ValueError):
+            linker.link_objects(data, mask.copy(), products=linker.PRODUCT_VFIELD)
+
+    def testLineOfSightThreshold(self):
+        print('Testing link_objects: line of sight threshold against the labelled mask')
+        data, mask = make_cube(3, 0.04, shape=(23, 30, 40))
+        objects, labels = linker.link_objects(data, mask.copy(), mergeX=2, mergeY=2, mergeZ=2)
+        counts = dict((obj[0], len(set(zip(*np.nonzero((labels == obj[0]).any(axis=0)))))) for obj in objects)
+        for min_LOS in (2, 5, 12):
+            expected = sorted(count for count in counts.values() if count >= min_LOS)
+            for kwargs in (dict(), dict(engine='parallel', threads=3)):
+                result = linker.link_objects(data, mask.copy(), mergeX=2, mergeY=2, mergeZ=2, min_LOS=min_LOS, **kwargs)
+                self.assertEqual(sorted(len(set(zip(*np.nonzero((result[1] == obj[0]).any(axis=0))))) for obj in result[0]), expected)
+            result_c = linker.link_objects_chunked(data, mask, chunkZ=7, mergeX=2, mergeY=2, mergeZ=2, min_LOS=min_LOS)
+            self.assertSameObjects(result, result_c)
+
+    def testCompactRecords(self):
+        print('Testing link_objects: small objects are demoted to compact records')
+        data, mask = make_cube(4, 0.04, shape=(23, 30, 40))
+        params = dict(mergeX=2, mergeY=2, mergeZ=2, minSizeZ=2)
+        objects, labels = linker.link_objects(data, mask.copy(), **params)
+        records = []
+        kept = []
+        for obj in objects:
+            peak = obj[15] if obj[16] > 0 else obj[14]
+            if obj[13] < 6 and abs(peak) < 2.5:
+                records.append([obj[16], peak, obj[13], 1 if obj[16] > 0 else -1])
+            else:
+                kept.append(obj[0])
+        self.assertTrue(len(records) > 0 and len(kept) > 0)
+        records = np.array(sorted(records))
+
+        results = [linker.link_objects(data, mask.copy(), compactVoxels=6, compactPeak=2.5, engine=engine, **params)
+                   for engine in ('scan', 'unionfind', 'parallel', 'dilate')]
+        results.append(linker.link_objects_chunked(data, mask, chunkZ=7, compactVoxels=6, compactPeak=2.5, **params))
+        for objects_c, labels_c, compact in results:
+            self.assertEqual(len(objects_c), len(kept))
+            self.assertTrue(((labels_c > 0) == np.isin(labels, kept)).all())
+            np.testing.assert_allclose(np.array(sorted(compact.tolist())), records, rtol=1e-4, atol=1e-3)
+
+    def testProgress(self):
+        print('Testing link_objects: progress reports and cancellation')
+        data, mask = make_cube(0, 0.1, shape=(23, 30, 40))
+        params = dict(mergeX=2, mergeY=2, mergeZ=2)
+        result = linker.link_objects(data, mask.copy(), **params)
+        calls = [lambda **kwargs: linker.link_objects(data, mask.copy(), **kwargs),
+                 lambda **kwargs: linker.link_objects(data, mask.copy(), engine='unionfind', **kwargs),
+                 lambda **kwargs: linker.link_objects(data, mask.copy(), engine='parallel', threads=3, **kwargs),
+                 lambda **kwargs: linker.link_objects(data, mask.copy(), engine='dilate', **kwargs),
+                 lambda **kwargs: linker.link_objects_chunked(data, mask, chunkZ=7, **kwargs)]
+        for call in calls:
+            fractions = []
+            self.assertSameObjects(result, call(progress=fractions.append, **params))
+            self.assertTrue(len(fractions) > 1)
+            self.assertTrue((np.diff(fractions) > 0).all())
+            self.assertAlmostEqual(fractions[-1], 1.0)
+
+            fractions = []
+            with self.assertRaises(linker.LinkingCancelled):
+                call(progress=lambda fraction: fractions.append(fraction) or fraction > 0.3, **params)
+            self.assertTrue(fractions[-1] < 1.0)
+
+            def fail(fraction):
+                raise KeyError(fraction)
+            with self.assertRaises(KeyError):
+                call(progress=fail, **params)
+
+    def testStructuredCatalogue(self):
+        print('Testing link_objects: structured catalogue and runs of the objects')
+        data, mask = make_cube(1, 0.1, shape=(23, 30, 40))
+        params = dict(mergeX=2, mergeY=2, mergeZ=2, minSizeZ=2)
+        calls = [lambda **kwargs: linker.link_objects(data, mask.copy(), **kwargs),
+                 lambda **kwargs: linker.link_objects_chunked(data, mask, chunkZ=7, **kwargs)]
+        for call in calls:
+            objects, labels = call(**params)
+            catalogue, labels_s, runs, offsets = call(structured=True, objectRuns=True, **params)
+            self.assertEqual(catalogue.dtype, linker.CATALOGUE_DTYPE)
+            self.assertTrue((labels_s == labels).all())
+            np.testing.assert_allclose(np.array([list(row) for row in catalogue.tolist()]), np.array(objects), rtol=1e-4, atol=1e-3)
+
+            # the runs of each object are a view of the runs array, and cover the voxels of the object
+            self.assertEqual(offsets.size, len(objects) + 1)
+            self.assertEqual(offsets[-1], runs.shape[0])
+            rebuilt = np.zeros_like(labels)
+            for k in range(1, len(objects) + 1):
+                view = runs[offsets[k - 1]:offsets[k]]
+                self.assertTrue(view.base is runs)
+                self.assertEqual((view[:, 3] - view[:, 2] + 1).sum(), catalogue['NRvox'][k - 1])
+                for x, y, z_start, z_end in view:
+                    rebuilt[z_start:z_end + 1, y, x] = k
+            self.assertTrue((rebuilt == labels).all())
+
+    def testStatistics(self):
+        print('Testing link_objects: linker statistics')
+        data, mask = make_cube(0, 0.1, shape=(23, 30, 40))
+        params = dict(mergeX=2, mergeY=2, mergeZ=2)
+        self.assertEqual(len(linker.link_objects(data, mask.copy(), **params)), 2)
+        stats = dict((engine, linker.link_objects(data, mask.copy(), engine=engine, stats=True, **params)[2])
+                     for engine in ('scan', 'unionfind', 'parallel', 'dilate'))
+        stats['chunked'] = linker.link_objects_chunked(data, mask, chunkZ=7, stats=True, **params)[2]
+        for engine, info in stats.items():
+            self.assertEqual(info['voxels_scanned'], mask.sum())
+            self.assertTrue(info['merges'] > 0 and info['peak_objects'] > 0 and info['arena_bytes'] > 0)
+            self.assertTrue(0.0 <= info['merge_time'] <= info['sweep_time'] <= info['total_time'])
+            self.assertTrue(min(info['sparse_reps_time'], info['threshold_time'], info['catalogue_time']) >= 0.0)
+        for key in ('merges', 'ids_recycled', 'peak_objects'):
+            self.assertEqual(stats['scan'][key], stats['unionfind'][key])
+            self.assertEqual(stats['scan'][key], stats['chunked'][key])
+        self.assertTrue(stats['scan']['voxels_rewritten'] > 0)
+        self.assertEqual(stats['unionfind']['voxels_rewritten'], 0)
+
+    def testUnionFindEngine(self):
+        print('Testing link_objects: union-find engine reproduces the scanning engine')
+        for seed in range(3):
+            for density in (0.02, 0.1, 0.3):
+                data, mask = make_cube(seed, density)
+                for params in self.merge_params:
+                    self.assertSameCatalogue(
+                        linker.link_objects(data, mask.copy(), **params),
+                        linker.link_objects(data, mask.copy(), engine='unionfind', **params))
+
+    def testUnitMerge(self):
+        print('Testing link_objects: merging lengths of 1 link the nearest neighbours only')
+        data = np.ones((3, 3, 3), dtype=np.single)
+        for offset, linked in (((0, 0, 1), True), ((0, 1, 0), True), ((1, 0, 0), True), ((1, 1, 0), True),
+                               ((0, 1, 1), False), ((1, 1, 1), False), ((0, 0, 2), False)):
+            mask = np.zeros((3, 3, 3), dtype=np.intc)
+            mask[0, 0, 0] = mask[offset] = 1
+            objects, labels = linker.link_objects(data, mask, mergeX=1, mergeY=1, mergeZ=1)
+            self.assertEqual(len(objects), 1 if linked else 2)
+
+        for seed in range(3):
+            for density in (0.4, 0.6):
+                data, mask = make_cube(seed, density)
+                self.assertSameCatalogue(
+                    linker.link_objects(data, mask.copy(), mergeX=1, mergeY=1, mergeZ=1),
+                    linker.link_objects(data, mask.copy(), engine='unionfind', mergeX=1, mergeY=1, mergeZ=1))
+
+    def testParallelEngine(self):
+        print('Testing link_objects: parallel engine is independent of the number of threads')
+        for seed in range(3):
+            for density in (0.02, 0.1, 0.3):
+                data, mask = make_cube(seed, density)
+                for params in self.merge_params:
+                    objects, labels = linker.link_objects(data, mask.copy(), engine='parallel', **params)
+                    for threads in (2, 3, 7, 25):
+                        self.assertSameCatalogue(
+                            (objects, labels),
+                            linker.link_objects(data, mask.copy(), engine='parallel', threads=threads, **params))
+
+                    self.assertSameObjects((objects, labels), linker.link_objects(data, mask.copy(), **params))
+
+    def testThreads(self):
+        print('Testing link_objects: thresholding and labelling on multiple threads with every engine')
+        data, mask = make_cube(1, 0.1)
+        params = dict(mergeX=2, mergeY=2, mergeZ=3, minSizeZ=2, min_LOS=2)
+        for engine in ('scan', 'unionfind', 'dilate'):
+            result = linker.link_objects(data, mask.copy(), engine=engine, **params)
+            self.assertSameCatalogue(result, linker.link_objects(data, mask.copy(), engine=engine, threads=3, **params))
+            self.assertSameCatalogue(result[:2], linker.link_objects_chunked(data, mask, chunkZ=7, engine=engine, threads=3, **params)[:2])
+
+    def testDilateEngine(self):
+        print('Testing link_objects: dilation engine reproduces the parallel engine')
+        for seed in range(3):
+            for density in (0.02, 0.1, 0.3):
+                data, mask = make_cube(seed, density)
+                for params in self.merge_params + [dict(), dict(mergeX=0, mergeY=2, mergeZ=12), dict(mergeX=4, mergeY=0, mergeZ=1)]:
+                    self.assertSameCatalogue(
+                        linker.link_objects(data, mask.copy(), engine='parallel', **params),
+                        linker.link_objects(data, mask.copy(), engine='dilate', **params))
+
+    def testChunkedLinking(self):
+        print('Testing link_objects_chunked: chunked linking reproduces link_objects')
+        for seed in range(3):
+            for density in (0.02, 0.1, 0.3):
+                data, mask = make_cube(seed, density, shape=(23, 30, 40))
+                for params in self.merge_params:
+                    result = linker.link_objects(data, mask.copy(), **params)
+                    for chunkZ in (params['mergeZ'] + 1, 7, 30):
+                        self.assertSameObjects(result, linker.link_objects_chunked(data, mask, chunkZ=chunkZ, **params))
+                        self.assertSameObjects(result, linker.link_objects_chunked(data, mask, chunkZ=chunkZ, engine='unionfind', **params))
+                        self.assertSameObjects(result, linker.link_objects_chunked(data, mask, chunkZ=chunkZ, engine='parallel', threads=3, **params))
+                        self.assertSameObjects(result, linker.link_objects_chunked(data, mask, chunkZ=chunkZ, engine='dilate', **params))
+
+    def testChunkedLinkingMemmap(self):
+        print('Testing link_objects_chunked: memory-mapped input and output')
+        tmpdir = tempfile.mkdtemp()
+        try:
+            data, mask = make_cube(0, 0.1, shape=(40, 30, 40))
+            data_map = np.memmap(os.path.join(tmpdir, 'data.dat'), dtype=np.single, mode='w+', shape=data.shape)
+            mask_map = np.memmap(os.path.join(tmpdir, 'mask.dat'), dtype=np.int8, mode='w+', shape=mask.shape)
+            labels = np.memmap(os.path.join(tmpdir, 'labels.dat'), dtype=np.intc, mode='w+', shape=mask.shape)
+            data_map[:] = data
+            mask_map[:] = mask
+            objects, labels_out = linker.link_objects_chunked(data_map, mask_map, labels, chunkZ=8, mergeX=2, mergeY=2, mergeZ=3)
+            self.assertTrue(labels_out is labels)
+            self.assertSameObjects(linker.link_objects(data, mask.copy(), mergeX=2, mergeY=2, mergeZ=3), (objects, np.asarray(labels)))
+            del data_map, mask_map, labels, labels_out
+        finally:
+            shutil.rmtree(tmpdir)
+
+    def testFitsMask(self):
+        print('Testing link_objects: writing the labelled mask to a FITS file')
+        tmpdir = tempfile.mkdtemp()
+        try:
+            filename = os.path.join(tmpdir, 'mask.fits')
+            history = 'HISTORY SOURCE FINDING'.ljust(80)
+            data, mask = make_cube(1, 0.1, shape=(23, 30, 37))
+            for params, bitpix in ((dict(mergeX=2, mergeY=2, mergeZ=2, minSizeZ=2), '8'), (dict(mergeX=1, mergeY=1, mergeZ=1), '16')):
+                calls = [lambda **kwargs: linker.link_objects(data, mask.copy(), **kwargs),
+                         lambda **kwargs: linker.link_objects_chunked(data, mask, chunkZ=7, **kwargs)]
+                for call in calls:
+                    objects, labels = call(maskFile=filename, maskHeader=history, **params)
+                    cards, header, labels_fits = read_fits(filename)
+                    self.assertEqual(header['BITPIX'], bitpix)
+                    self.assertEqual(int(header['DATAMAX']), len(objects))
+                    self.assertTrue(history.rstrip() in cards)
+                    self.assertTrue((labels_fits == labels).all())
+            with self.assertRaises(IOError):
+                linker.link_objects(data, mask.copy(), maskFile=os.path.join(tmpdir, 'missing', 'mask.fits'))
+        finally:
+            shutil.rmtree(tmpdir)
+
+    def testNativeCatalogue(self):
+        print('Testing link_objects: writing the catalogue natively')
+        tmpdir = tempfile.mkdtemp()
+        try:
+            filename = os.path.join(tmpdir, 'cat.ascii')
+            # the formats and header of the pipeline's ASCII catalogues, as written by store_ascii
+            names = linker.CATALOGUE_DTYPE.names
+            units = ('-', 'pix', 'pix', 'chan', 'pix', 'pix', 'chan', 'pix', 'pix', 'pix', 'pix', 'chan', 'chan', '-', 'Jy', 'Jy', 'Jy')
+            formats = ('%10i', '%10.3f', '%10.3f', '%10.3f', '%10.3f', '%10.3f', '%10.3f', '%7i', '%7i', '%7i', '%7i', '%7i', '%7i', '%8i', '%12.3e', '%12.3e', '%12.3e')
+            data, mask = make_cube(1, 0.1, shape=(23, 30, 37))
+            params = dict(mergeX=2, mergeY=2, mergeZ=2)
+            calls = [lambda **kwargs: linker.link_objects(data, mask.copy(), **kwargs),
+                     lambda **kwargs: linker.link_objects_chunked(data, mask, chunkZ=7, **kwargs)]
+            for call in calls:
+                catalogue, labels = call(structured=True, **params)
+                for columns in (None, ['ID', 'Zm', 'NRvox', 'Ftot']):
+                    call(catalogueFile=filename, catalogueColumns=columns, fluxUnit='Jy', **params)
+                    index = [names.index(name) for name in (columns or names)]
+                    widths = [int(formats[i][1:].split('.')[0].rstrip('ie')) + 1 for i in index]
+                    header = ['SoFia catalogue']
+                    header += [''.join(field.rjust(width) for field, width in zip(fields, widths))[3:]
+                               for fields in ([names[i] for i in index], [units[i] for i in index], ['(%i)' % k for k in range(len(index))])]
+                    rows = ''.join(''.join(formats[i] % row[i] + ' ' for i in index) + '\n' for row in catalogue.tolist())
+                    with open(filename) as f:
+                        self.assertEqual(f.read(), ''.join('# ' + line + '\n' for line in header) + rows)
+                call(catalogueFile=filename, catalogueBinary=True, **params)
+                self.assertTrue((np.fromfile(filename, dtype=linker.CATALOGUE_DTYPE) == catalogue).all())
+            with self.assertRaises(ValueError):
+                linker.link_objects(data, mask.copy(), catalogueFile=filename, catalogueColumns=['RA'])
+            with self.assertRaises(ValueError):
+                linker.link_objects(data, mask.copy(), catalogueFile=filename, catalogueColumns=['Ftot'] * 20)
+            with self.assertRaises(IOError):
+                linker.link_objects(data, mask.copy(), catalogueFile=os.path.join(tmpdir, 'missing', 'cat.ascii'))
+        finally:
+            shutil.rmtree(tmpdir)
+
+    def testMomentMaps(self):
+        print('Testing moment_maps')
+        data, mask = make_cube(2, 0.1, shape=(23, 30, 37))
+        data[5, 3:9, 4:20] = np.nan
+        catalogue, labels, runs, offsets = linker.link_objects(data, mask.copy(), mergeX=2, mergeY=2, mergeZ=2, objectRuns=True)
+        z = np.arange(data.shape[0], dtype=np.double).reshape((-1, 1, 1))
+        for ids in (None, list(range(1, len(catalogue) + 1, 3))):
+            selected = labels > 0 if ids is None else np.in1d(labels, ids).reshape(labels.shape)
+            flux = np.nan_to_num(data.astype(np.double) * selected)
+            mom0 = flux.sum(axis=0)
+            with np.errstate(divide='ignore', invalid='ignore'):
+                mom1 = (flux * z).sum(axis=0) / mom0
+                mom2 = np.sqrt(np.maximum((flux * z * z).sum(axis=0) / mom0 - mom1 * mom1, 0))
+            expected = {'mom0': mom0, 'mom1': mom1, 'mom2': mom2, 'rapv': flux.sum(axis=1), 'decpv': flux.sum(axis=2)}
+            # the data and masks of other layouts and types are read through their strides
+            for maps in (linker.moment_maps(data, runs, offsets, ids),
+                         linker.moment_maps(data.astype(np.double), mask=selected.astype(np.int64)),
+                         linker.moment_maps(np.asfortranarray(data), mask=selected),
+                         linker.moment_maps(data.astype('>f4'), mask=np.asfortranarray(selected.astype(np.uint16))),
+                         linker.moment_maps(np.asfortranarray(data), runs, offsets, ids)):
+                self.assertEqual(sorted(maps), sorted(expected))
+                for name in expected:
+                    self.assertEqual(maps[name].dtype, np.single)
+                    self.assertTrue(np.allclose(maps[name], expected[name], rtol=1e-4, atol=1e-4, equal_nan=True), name)
+                self.assertTrue((np.isnan(maps['mom1']) == (mom0 == 0)).all())
+        maps = linker.moment_maps(data, mask=labels == 1, maps=('rapv',))
+        self.assertEqual(list(maps), ['rapv'])
+        with self.assertRaises(ValueError):
+            linker.moment_maps(data, runs, mask=labels)
+        with self.assertRaises(ValueError):
+            linker.moment_maps(data, runs + np.array([0, 0, 0, data.shape[0]], dtype=np.intc))
+        with self.assertRaises(ValueError):
+            linker.moment_maps(data, runs, maps=('mom3',))
+
+    def testSubmit(self):
+        print('Testing submit')
+        cubes = [make_cube(seed, 0.1) for seed in range(6)]
+        expected = [linker.link_objects(data, mask.copy(), mergeX=2, mergeY=2, mergeZ=2, structured=True) for data, mask in cubes]
+        linker.start_pool(3)
+        self.assertEqual(linker.pool_workers()[0], 3)
+        futures = [linker.submit(linker.link_objects, data, mask.copy(), mergeX=2, mergeY=2, mergeZ=2, structured=True) for data, mask in cubes]
+        futures += [linker.submit(linker.link_objects_chunked, data, mask, chunkZ=7, mergeX=2, mergeY=2, mergeZ=2, structured=True) for data, mask in cubes]
+        for future, (catalogue, labels) in zip(futures, expected + expected):
+            self.assertTrue((future.result()[0] == catalogue).all())
+            self.assertTrue((future.result()[1] == labels).all())
+            self.assertTrue(future.done())
+            self.assertEqual(future.exception(), None)
+        future = linker.submit(linker.link_objects, cubes[0][0], cubes[0][1], engine='unknown')
+        self.assertTrue(isinstance(future.exception(), ValueError))
+        with self.assertRaises(ValueError):
+            future.result()
+        with self.assertRaises(ValueError):
+            linker.start_pool(0)
+
+    def testStreaming(self):
+        print('Testing link_objects: streaming the objects to worker threads')
+        data, mask = make_cube(2, 0.1)
+        params = dict(mergeX=2, mergeY=2, mergeZ=2, minSizeZ=2, min_LOS=2)
+
+        def measure(cube, voxels, bbox):
+            return voxels.sum(), cube[voxels].sum(), bbox
+
+        def expected(labels):
+            measured = {}
+            for k in range(1, labels.max() + 1):
+                z, y, x = np.nonzero(labels == k)
+                bbox = (x.min(), x.max() + 1, y.min(), y.max() + 1, z.min(), z.max() + 1)
+                voxels = labels[bbox[4]:bbox[5], bbox[2]:bbox[3], bbox[0]:bbox[1]] == k
+                measured[k] = measure(data[bbox[4]:bbox[5], bbox[2]:bbox[3], bbox[0]:bbox[1]], voxels, bbox)
+            return measured
+
+        for engine in ('scan', 'unionfind', 'parallel'):
+            result = linker.link_objects(data, mask.copy(), engine=engine, stream=measure, streamWorkers=2, streamQueue=3, **params)
+            self.assertSameObjects(result[:2], linker.link_objects(data, mask.copy(), engine=engine, **params))
+            self.assertEqual(result[2], expected(result[1]))
+        result = linker.link_objects_chunked(data, mask, chunkZ=7, stream=measure, stats=True, **params)
+        self.assertEqual(len(result), 4)
+        self.assertEqual(result[2], expected(result[1]))
+
+        # with a queue of one object, the objects that are streamed during the sweep are handled
+        # before it ends --- the cube is long enough for the sweep to wait for the first of them
+        fractions = [0.0]
+        seen = []
+        long_data, long_mask = make_cube(2, 0.1, shape=(60, 30, 40))
+        linker.link_objects(long_data, long_mask, progress=fractions.append, stream=lambda cube, voxels, bbox: seen.append(fractions[-1]), streamQueue=1, **params)
+        self.assertTrue(min(seen) < 1.0)
+
+        def fail(cube, voxels, bbox):
+            raise KeyError('stream')
+        for call in (linker.link_objects, linker.link_objects_chunked):
+            with self.assertRaises(KeyError):
+                call(data, mask.copy(), stream=fail, **params)
+        with self.assertRaises(ValueError):
+            linker.link_objects(data, mask.copy(), stream=measure, streamQueue=0)
+
+    def testChunkedLinkingArguments(self):
+        print('Testing link_objects_chunked: invalid arguments')
+        data, mask = make_cube(0, 0.1)
+        with self.assertRaises(ValueError):
+            linker.link_objects_chunked(data, mask, chunkZ=3, mergeZ=3)
+        with self.assertRaises(ValueError):
+            linker.link_objects_chunked(data, mask[:-1])
+        with self.assertRaises(ValueError):
+            linker.link_objects_chunked(data, mask, np.zeros(mask.shape, dtype=np.double))
+
+    def testLongLabels(self):
+        print('Testing link_objects: 64-bit object IDs and labels')
+        data, mask = make_cube(1, 0.1, shape=(23, 30, 40))
+        for engine in ('scan', 'unionfind', 'parallel'):
+            result = linker.link_objects(data, mask.copy(), mergeX=2, mergeY=2, mergeZ=2, engine=engine)
+            result_long = linker.link_objects(data, mask.astype(np.int64), mergeX=2, mergeY=2, mergeZ=2, engine=engine)
+            self.assertEqual(result_long[1].dtype, np.int64)
+            self.assertSameCatalogue(result, result_long)
+        labels = np.zeros(mask.shape, dtype=np.int64)
+        self.assertSameObjects(result, linker.link_objects_chunked(data, mask, labels, chunkZ=7, mergeX=2, mergeY=2, mergeZ=2))
+
+    def testMaskTypes(self):
+        print('Testing link_objects: boolean and packed masks, and narrow labels')
+        data, mask = make_cube(1, 0.1, shape=(23, 30, 37))
+        params = dict(mergeX=2, mergeY=2, mergeZ=2, minSizeZ=2)
+        result = linker.link_objects(data, mask.copy(), **params)
+        result_c = linker.link_objects_chunked(data, mask, chunkZ=7, **params)
+        packed = np.packbits(mask.astype(bool), axis=2)
+        for source, kwargs in ((mask.astype(bool), {}), (mask.astype(np.uint8), {}), (packed, dict(packed=True))):
+            source_copy = source.copy()
+            for labelType, dtype in ((None, np.intc), ('auto', np.uint16), (np.uint32, np.uint32), (np.uint64, np.uint64), (np.int64, np.int64)):
+                result_t = linker.link_objects(data, source, labelType=labelType, **dict(params, **kwargs))
+                self.assertEqual(result_t[1].dtype, dtype)
+                self.assertSameCatalogue(result, result_t)
+                result_t = linker.link_objects_chunked(data, source, chunkZ=7, labelType=labelType, **dict(params, **kwargs))
+                self.assertEqual(result_t[1].dtype, dtype)
+                self.assertSameCatalogue(result_c, result_t)
+            self.assertTrue((source == source_copy).all())
+        labels = np.zeros(mask.shape, dtype=np.uint16)
+        self.assertSameCatalogue(result_c, linker.link_objects_chunked(data, packed, labels, chunkZ=7, packed=True, **params))
+        # a mask of more channels than are expanded at a time is linked chunk by chunk
+        data, mask = make_cube(2, 0.1, shape=(150, 20, 25))
+        params['products'] = linker.PRODUCT_ALL
+        result = linker.link_objects(data, mask.copy(), **params)
+        for source, kwargs in ((mask.astype(bool), {}), (np.packbits(mask.astype(bool), axis=2), dict(packed=True))):
+            result_t = linker.link_objects(data, source, **dict(params, **kwargs))
+            self.assertSameObjects(result[:2], result_t[:2])
+            # the postage stamps are still built from the whole data cube
+            pairs = dict(zip(result[1][mask > 0].tolist(), result_t[1][mask > 0].tolist()))
+            for label, stamps in enumerate(result[2], 1):
+                np.testing.assert_allclose(stamps['ref_spec'], result_t[2][pairs[label] - 1]['ref_spec'], rtol=1e-4, atol=1e-3)
+        with self.assertRaises(ValueError):
+            linker.link_objects(data, mask, labelType=np.uint8)
+        with self.assertRaises(ValueError):
+            linker.link_objects(data, mask, packed=True)
+
+    def testSparseInput(self):
+        print('Testing link_objects_sparse: linking from voxel coordinates')
+        for seed, density in ((1, 0.005), (2, 0.05), (3, 0.3)):
+            data, mask = make_cube(seed, density)
+            for params in self.merge_params:
+                result = linker.link_objects(data, mask.copy(), **params)
+                self.assertSameCatalogue(result, linker.link_objects_sparse(data, np.nonzero(mask), **params))
+                self.assertSameCatalogue(result, linker.link_objects_sparse(data, np.argwhere(mask), engine='unionfind', **params))
+        data, mask = make_cube(1, 0.0)
+        objects, labels = linker.link_objects_sparse(data, np.zeros((0, 3), dtype=int))
+        self.assertEqual(len(objects), 0)
+        self.assertFalse(labels.any())
+
+    @unittest.skipUnless(os.environ.get('SOFIA_LARGE_TESTS'), 'needs about 18 GB of disk space')
+    def testLargeCube(self):
+        print('Testing link_objects: cube of more than 2**31 voxels')
+        tmpdir = tempfile.mkdtemp()
+        try:
+            # a sparse cube with a few objects, some of them beyond voxel 2**31
+            shape = (8200, 512, 512)
+            data = np.memmap(os.path.join(tmpdir, 'data.dat'), dtype=np.single, mode='w+', shape=shape)
+            mask = np.memmap(os.path.join(tmpdir, 'mask.dat'), dtype=np.intc, mode='w+', shape=shape)
+            boxes = [(slice(2, 5), slice(10, 14), slice(20, 23)),
+                     (slice(8191, 8194), slice(500, 504), slice(3, 9)),
+                     (slice(8196, 8200), slice(0, 2), slice(508, 512))]
+            for n, box in enumerate(boxes):
+                data[box] = n + 1.0
+                mask[box] = 1
+            objects, labels = linker.link_objects(data, mask, mergeX=2, mergeY=2, mergeZ=2)
+            self.assertEqual(len(objects), len(boxes))
+            for obj, box in zip(objects, boxes):
+                self.assertEqual([obj[7], obj[8], obj[9], obj[10], obj[11], obj[12]],
+                                 [box[2].start, box[2].stop, box[1].start, box[1].stop, box[0].start, box[0].stop])
+                self.assertTrue((labels[box] == obj[0]).all())
+                self.assertEqual(obj[13], labels[box].size)
+                np.testing.assert_allclose(obj[16], data[box].sum(dtype=np.double))
+            self.assertEqual(np.count_nonzero(labels[8190:]), sum(labels[box].size for box in boxes[1:]))
+            del data, mask, labels
+        finally:
+            shutil.rmtree(tmpdir)
+
+    def testAllocatorStatistics(self):
+        print('Testing link_objects: object ID allocator statistics')
+        data, mask = make_cube(0, 0.1)
+        params = dict(mergeX=1, mergeY=1, mergeZ=1, minSizeX=2, minSizeY=2, minSizeZ=2)
+        objects, labels, info = linker.link_objects(data, mask.copy(), stats=True, **params)
+        self.assertTrue(info['allocator_time'] >= 0.0)
+        # every object takes an ID, and at least one ID has been freed again by the size threshold
+        self.assertTrue(info['allocator_calls'] > len(objects))
+        self.assertTrue(info['ids_recycled'] > 0)
+        # each linker keeps its own counters
+        self.assertEqual(linker.link_objects(data, mask.copy(), stats=True, **params)[2]['allocator_calls'], info['allocator_calls'])
+
+    def testCentreOfMass(self):
+        print('Testing link_objects: centre of mass of merged objects')
+        # two objects in the first channel that are merged by a voxel in the second channel
+        data = np.zeros((3, 2, 3), dtype=np.single)
+        mask = np.zeros(data.shape, dtype=np.intc)
+        for z, y, x, flux in ((0, 0, 0, 1.0), (0, 0, 2, 3.0), (1, 0, 1, 2.0), (2, 1, 1, 5.0)):
+            data[z, y, x] = flux
+            mask[z, y, x] = 1
+        objects, labels = linker.link_objects(data, mask, mergeX=1, mergeY=1, mergeZ=1)[:2]
+        self.assertEqual(len(objects), 1)
+        np.testing.assert_allclose(objects[0][4:7], [13.0 / 11.0, 5.0 / 11.0, 12.0 / 11.0], rtol=1e-6)
+
+    def testRecycledID(self):
+        print('Testing link_objects: recycled IDs of objects that fail the size threshold')
+        # the voxel in the first channel fails minSizeZ and its ID is taken by the voxel in
+        # channel 5, which is then merged over the old bounding box by the column at x = 4
+        data = np.ones((9, 1, 6), dtype=np.single)
+        mask = np.zeros(data.shape, dtype=np.intc)
+        for z, y, x in [(0, 0, 2), (5, 0, 2), (6, 0, 3)] + [(z, 0, 4) for z in range(9)]:
+            mask[z, y, x] = 1
+        expected = mask.copy()
+        expected[0, 0, 2] = 0
+        for engine in ('scan', 'unionfind'):
+            objects, labels = linker.link_objects(data, mask.copy(), mergeX=1, mergeY=1, mergeZ=1, minSizeZ=2, engine=engine)[:2]
+            self.assertEqual(len(objects), 1)
+            self.assertTrue(((labels > 0) == (expected > 0)).all())
+
+    def testUnknownEngine(self):
+        print('Testing link_objects: unknown engine')
+        data, mask = make_cube(0, 0.1)
+        with self.assertRaises(ValueError):
+            linker.link_objects(data, mask, engine='none')
+        with self.assertRaises(ValueError):
+            linker.link_objects(data, mask, threads=0)
+
+
+def main():
+    unittest.main()
+
+if __name__ == '__main__':
+    main()
@@ -21,7 +21,11 @@ def recursion(dictionary,optionsList,optionsDepth,counter=0):
     counter = 0
 
 
-def writeMask(cube,header,dictionary,filename):
+# keywords that the native mask writer of the linker sets itself
+structuralKeywords = ['SIMPLE','BITPIX','NAXIS','NAXIS1','NAXIS2','NAXIS3','NAXIS4','EXTEND','BSCALE','BZERO','BLANK','BUNIT','DATAMIN','DATAMAX','END']
+
+
+def addHistory(header,dictionary):
   header.add_history('SOURCE FINDING')
   optionsList = []
   optionsDepth = []
@@ -41,7 +45,20 @@ def writeMask(cube,header,dictionary,filename):
       headerList.append(tmpString)
   for option in headerList:
     header.add_history(option)
-  if cube.max()<65535: cube=cube.astype('int16')
+
+
+def maskCards(header,dictionary):
+  # header cards for the maskFile of linker.link_objects, which writes the mask plane by plane
+  header = header.copy()
+  addHistory(header,dictionary)
+  cards = header.tostring(sep='',endcard=False,padding=False)
+  cards = [cards[i:i+80] for i in range(0,len(cards),80)]
+  return ''.join([card for card in cards if card[:8].strip() not in structuralKeywords])
+
+
+def writeMask(cube,header,dictionary,filename):
+  addHistory(header,dictionary)
+  if cube.max()<32768: cube=cube.astype('int16')
   hdu = pyfits.PrimaryHDU(data=cube,header=header)
   hdu.header['bunit']='source_ID'
   hdu.header['datamin']=cube.min()
@@ -2,6 +2,7 @@
 import pyfits
 import os
 import numpy as np
+from sofia import linker
 
 def removeOptions(dictionary):
   modDictionary = dictionary
@@ -23,7 +24,8 @@ def recursion(dictionary,optionsList,optionsDepth,counter=0):
 
 def writeMoment0(datacube,maskcube,filename,debug,header):
   print 'Writing moment-0' # in units of header['bunit']*km/s
-  m0=np.nan_to_num(datacube*maskcube.astype(bool)).sum(axis=0)
+  # the map is summed natively over the masked voxels, without making copies of the cube
+  m0=linker.moment_maps(datacube,mask=maskcube,maps=('mom0',))['mom0']
   op=0
   if 'vopt' in header['ctype3'].lower() or 'vrad' in header['ctype3'].lower() or 'velo' in header['ctype3'].lower() or 'felo' in header['ctype3'].lower():
     if not 'cunit3' in header: dkms=abs(header['cdelt3'])/1e+3 # assuming m/s
@@ -46,8 +48,10 @@ def writeMoment0(datacube,maskcube,filename,debug,header):
 
 def writeMoment1(datacube,maskcube,filename,debug,header,m0):
   print 'Writing moment-1'
-  # create array of axis3 coordinates
-  m1=(np.arange(datacube.shape[0]).reshape((datacube.shape[0],1,1))*np.ones(datacube.shape)-header['crpix3']+1)*header['cdelt3']+header['crval3'] # in axis3 units
+  # the intensity-weighted mean channel is found natively over the masked voxels, and is NaN where
+  # moment 0 is 0; as the axis3 coordinates are linear in the channel, it is converted afterwards
+  m1=linker.moment_maps(datacube,mask=maskcube,maps=('mom1',))['mom1'].astype(np.double)
+  m1=(m1-header['crpix3']+1)*header['cdelt3']+header['crval3'] # in axis3 units
   # convert it to km/s (using radio velocity definition to go from Hz to km/s)
   if 'vopt' in header['ctype3'].lower() or 'vrad' in header['ctype3'].lower() or 'velo' in header['ctype3'].lower() or 'felo' in header['ctype3'].lower():
     if not 'cunit3' in header: m1/=1e+3 # assuming m/s
@@ -55,9 +59,6 @@ def writeMoment1(datacube,maskcube,filename,debug,header,m0):
   elif 'freq' in header['ctype3'].lower():
     if not 'cunit3' in header or header['cunit3'].lower()=='hz': m1*=2.99792458e+5/1.42040575177e+9 # assuming Hz
     elif header['cunit3'].lower()=='khz': m1*=2.99792458e+5/1.42040575177e+6
-  # calculate moment 1
-  m0[m0==0]=np.nan
-  m1=np.divide(np.array(np.nan_to_num(m1*datacube*maskcube.astype('bool')).sum(axis=0)),m0)
   hdu = pyfits.PrimaryHDU(data=m1,header=header)
   hdu.header['bunit']='km/s'
   hdu.header['datamin']=np.nanmin(m1)
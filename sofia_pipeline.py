@@ -172,7 +172,17 @@ if Parameters['steps']['doMerge'] and NRdet:
 	print "\n--- SoFiA: Merging detections ---"
 	sys.stdout.flush()
 	
-	objects, mask = linker.link_objects(np_Cube, mask, **Parameters['merge'])
+	# the all-source mask for debugging is written by the linker, straight from the objects, and
+	# so is the all-source catalogue, unless the reliability columns are to be added to it
+	merge_outputs = {}
+	if Parameters['steps']['doDebug']:
+		merge_outputs['maskFile'] = '%s_mask.debug_all.fits'%outroot
+		merge_outputs['maskHeader'] = writemask.maskCards(dict_Header, Parameters)
+		if not Parameters['steps']['doReliability']:
+			merge_outputs['catalogueFile'] = outroot+'_cat.debug.ascii'
+			if Parameters['writeCat']['parameters'] != ['*']: merge_outputs['catalogueColumns'] = Parameters['writeCat']['parameters']
+			if 'bunit' in dict_Header: merge_outputs['fluxUnit'] = str(dict_Header['bunit'])
+	objects, mask = linker.link_objects(np_Cube, mask, **dict(Parameters['merge'], **merge_outputs))
 	
 	print 'Merging complete'
 	print
@@ -183,7 +193,7 @@ if Parameters['steps']['doMerge'] and NRdet:
 # ---- OUTPUT FOR DEBUGGING (MASK) ----
 # -------------------------------------
 
-if Parameters['steps']['doDebug'] and NRdet:
+if Parameters['steps']['doDebug'] and NRdet and not Parameters['steps']['doMerge']:
 	print "\n--- SoFiA: Writing all-source mask cube for debugging ---"
 	sys.stdout.flush()
 	writemask.writeMask(mask, dict_Header, Parameters, '%s_mask.debug_all.fits'%outroot)
@@ -221,7 +231,7 @@ if Parameters['steps']['doMerge'] and NRdet:
 		catParNames = tuple(list(catParNames) + ['NRpos',  'NRneg',  'Rel'])
 		catParUnits = tuple(list(catParUnits) + ['-','-','-'])
 		catParFormt = tuple(list(catParFormt) + ['%12.3e', '%12.3e', '%12.6f'])
-	if Parameters['steps']['doDebug']:
+	if Parameters['steps']['doDebug'] and Parameters['steps']['doReliability']:
 		print "\n--- SoFiA: Writing all-source catalogue for debugging ---"
 		#sys.stdout.flush()
 		store_ascii.make_ascii_from_array(objects, catParNames, catParUnits, catParFormt, Parameters['writeCat']['parameters'], outroot+'_cat.debug.ascii')
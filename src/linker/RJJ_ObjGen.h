@@ -8,12 +8,30 @@
 #include<ctype.h>
 #include<vector>
 #include<algorithm>
+#include<deque>
+#include<thread>
+#include<mutex>
+#include<condition_variable>
 
 #ifndef RJJ_ObjGen 
 #define RJJ_ObjGen
 
 using namespace std;
 
+// postage stamp products that can be built alongside the sparse representation of each object ---
+// these are combined into a bitmask, and the velocity field is normalised by the moment-0 map, so it
+// needs SREP_MOM0 as well
+#define SREP_MOM0 1
+#define SREP_RAPV 2
+#define SREP_DECPV 4
+#define SREP_OSPEC 8
+#define SREP_RSPEC 16
+#define SREP_VFIELD 32
+#define SREP_ALL 63
+
+template <typename T> struct object_store;
+template <typename T> class srep_arena;
+
 // float precision class definition
 
 class object_props {
@@ -25,10 +43,11 @@ class object_props {
   float dec, dec_i, dec_min, dec_max;
   float freq, freq_i, freq_min, freq_max;
   float tot_intens, avg_intens, min_intens, max_intens, sigma_intens, rms;
-  int srep_size[6], * srep_grid, * srep_strings, srep_update;
+  int srep_size[6], * srep_grid, * srep_strings, srep_update, srep_NOlos;
   float * mini_mom0, * mini_RAPV, * mini_DECPV, * mini_obj_spec, * mini_ref_spec, * mini_vfield;
   float w_max, w20_min, w20_max, w50_min, w50_max;
   float cw_max, cw20_min, cw20_max, cw50_min, cw50_max;
+  srep_arena<float> * arena;
 
   // new parameters --- multiple central moment calculations
   float p_tot_intens, n_tot_intens;
@@ -53,6 +72,12 @@ class object_props {
   bool operator <= (const object_props & compareTo);
   bool operator >= (const object_props & compareTo); 
 
+  // allocate and release the arrays of this object, using its arena if it has one
+  int * NewInts(int size);
+  float * NewVals(int size);
+  void Release(int * block);
+  void Release(float * block);
+
  public:
   
   object_props();
@@ -71,6 +96,7 @@ class object_props {
   void AddSigmaItens(float value);
   void AdjustRange(float value);
   void CalcProps();  
+  void CalcMiniProps();
   void ShowAll_file_WCS(int id, std::fstream& output_file, int cat_mode, double wcs_vals[6]);
   void ShowAll_file(int id, std::fstream& output_file, int cat_mode);
   void ShowProps_file_WCS(int id, std::fstream& output_file, double wcs_vals[6]);
@@ -115,6 +141,7 @@ class object_props {
   void AddPoint(float x_pos, float y_pos, float z_pos, float value);
   void AddObject(object_props & merged);
   void AddObject(object_props & merged,vector<int> & temp_sparse_reps_grid,vector<int> & temp_sparse_reps_strings,vector<float> & temp_mom0,vector<float> & temp_RAPV,vector<float> & temp_DECPV,vector<float> & temp_ref_spec,vector<float> & temp_obj_spec,vector<float> & temp_vfield);
+  void MergeSreps(object_props & merged,vector<int> & temp_sparse_reps_grid,vector<int> & temp_sparse_reps_strings,vector<float> & temp_mom0,vector<float> & temp_RAPV,vector<float> & temp_DECPV,vector<float> & temp_ref_spec,vector<float> & temp_obj_spec,vector<float> & temp_vfield);
 
   void Set_w_max(float value);
   float Get_w_max();
@@ -140,6 +167,7 @@ class object_props {
   
   void Set_srep_update(int value);
   int Get_srep_update();
+  int Get_products();
 
   void Set_srep_size(int index, int value);
   int Get_srep_size(int index);
@@ -148,6 +176,7 @@ class object_props {
   void Set_srep_grid(int index, int value);
   int Get_srep_grid(int index);
   void Free_srep_grid();
+  int Get_srep_NOlos();
 
   void Create_srep_strings(int value);
   void Set_srep_strings(int index, int value);
@@ -194,6 +223,12 @@ class object_props {
   void ReInit_mini();
   void ReInit_size();
 
+  void ToStore(object_store<float> & store, long int id);
+  void FromStore(object_store<float> & store, long int id);
+
+  void SetArena(srep_arena<float> * value);
+  srep_arena<float> * GetArena();
+
   // define operators that make sense for this type of object
   object_props & operator = (const object_props & copied);
 
@@ -216,10 +251,11 @@ class object_props_dbl {
   double dec, dec_i, dec_min, dec_max;
   double freq, freq_i, freq_min, freq_max;
   double tot_intens, avg_intens, min_intens, max_intens, sigma_intens, rms;
-  int srep_size[6], * srep_grid, * srep_strings, srep_update;
+  int srep_size[6], * srep_grid, * srep_strings, srep_update, srep_NOlos;
   double * mini_mom0, * mini_RAPV, * mini_DECPV, * mini_obj_spec, * mini_ref_spec, * mini_vfield;
   double w_max, w20_min, w20_max, w50_min, w50_max;
   double cw_max, cw20_min, cw20_max, cw50_min, cw50_max;
+  srep_arena<double> * arena;
 
   // new parameters --- multiple central moment calculations
   double p_tot_intens, n_tot_intens;
@@ -244,6 +280,12 @@ class object_props_dbl {
   bool operator <= (const object_props_dbl & compareTo);
   bool operator >= (const object_props_dbl & compareTo);
 
+  // allocate and release the arrays of this object, using its arena if it has one
+  int * NewInts(int size);
+  double * NewVals(int size);
+  void Release(int * block);
+  void Release(double * block);
+
 public:
   
   object_props_dbl();
@@ -262,6 +304,7 @@ public:
   void AddSigmaItens(double value);
   void AdjustRange(double value);
   void CalcProps();  
+  void CalcMiniProps();
   void ShowAll_file_WCS(int id, std::fstream& output_file, int cat_mode, double wcs_vals[6]);
   void ShowAll_file(int id, std::fstream& output_file, int cat_mode);
   void ShowProps_file_WCS(int id, std::fstream& output_file, double wcs_vals[6]);
@@ -306,6 +349,7 @@ public:
   void AddPoint(double x_pos, double y_pos, double z_pos, double value);
   void AddObject(object_props_dbl & merged);
   void AddObject(object_props_dbl & merged,vector<int> & temp_sparse_reps_grid,vector<int> & temp_sparse_reps_strings,vector<double> & temp_mom0,vector<double> & temp_RAPV,vector<double> & temp_DECPV,vector<double> & temp_ref_spec,vector<double> & temp_obj_spec,vector<double> & temp_vfield);
+  void MergeSreps(object_props_dbl & merged,vector<int> & temp_sparse_reps_grid,vector<int> & temp_sparse_reps_strings,vector<double> & temp_mom0,vector<double> & temp_RAPV,vector<double> & temp_DECPV,vector<double> & temp_ref_spec,vector<double> & temp_obj_spec,vector<double> & temp_vfield);
 
   void Set_w_max(double value);
   double Get_w_max();
@@ -331,6 +375,7 @@ public:
   
   void Set_srep_update(int value);
   int Get_srep_update();
+  int Get_products();
 
   void Set_srep_size(int index, int value);
   int Get_srep_size(int index);
@@ -339,6 +384,7 @@ public:
   void Set_srep_grid(int index, int value);
   int Get_srep_grid(int index);
   void Free_srep_grid();
+  int Get_srep_NOlos();
 
   void Create_srep_strings(int value);
   void Set_srep_strings(int index, int value);
@@ -385,6 +431,12 @@ public:
   void ReInit_mini();
   void ReInit_size();
 
+  void ToStore(object_store<double> & store, long int id);
+  void FromStore(object_store<double> & store, long int id);
+
+  void SetArena(srep_arena<double> * value);
+  srep_arena<double> * GetArena();
+
   // define operators that make sense for this type of object
   object_props_dbl & operator = (const object_props_dbl & copied);
 
@@ -396,20 +448,224 @@ public:
   // end of class definition
 };
 
-extern void PrintCatalogueHeader(std::fstream& output_file, int cat_mode);
+extern void PrintCatalogueHeader(std::string & header, int * columns, int NOcolumns, std::string flux_unit, int cat_mode);
+
+extern void CreateMetric(long int * data_metric, int * xyz_order, int NOx, int NOy, int NOz);
+
+extern int ReorderAxis(int * vals, int order, int axis);
+
+// an offset within the spatial part of the merging box, and its displacement in the flag_vals array
+struct link_offset {
+
+  int dx, dy;
+  long int index;
+
+};
+
+// the offsets within the spatial ellipse (or box) of the merging lengths, in scanning order --- the
+// offsets that precede a voxel in its own plane come first, and their number is returned
+extern int CreateStencil(vector<link_offset> & stencil, int ss_mode, int merge_x, int merge_y, long int stride_x, long int stride_y);
+
+// moment-0, moment-1 and moment-2 maps and position-velocity images of the runs of voxels of objects,
+// or of the flagged voxels of a mask of any integer type, with the moments 1 and 2 in channels; the
+// data and flags are read through their own metrics
+extern int CreateMomentMaps(float * data_vals, long int * data_metric, unsigned char * flag_vals, long int * flag_metric, int * runs, long int NOruns, int NOx, int NOy, int NOz, float * mom0, float * mom1, float * mom2, float * RAPV, float * DECPV);
+extern int CreateMomentMaps(float * data_vals, long int * data_metric, unsigned short * flag_vals, long int * flag_metric, int * runs, long int NOruns, int NOx, int NOy, int NOz, float * mom0, float * mom1, float * mom2, float * RAPV, float * DECPV);
+extern int CreateMomentMaps(float * data_vals, long int * data_metric, int * flag_vals, long int * flag_metric, int * runs, long int NOruns, int NOx, int NOy, int NOz, float * mom0, float * mom1, float * mom2, float * RAPV, float * DECPV);
+extern int CreateMomentMaps(float * data_vals, long int * data_metric, long int * flag_vals, long int * flag_metric, int * runs, long int NOruns, int NOx, int NOy, int NOz, float * mom0, float * mom1, float * mom2, float * RAPV, float * DECPV);
+extern int CreateMomentMaps(double * data_vals, long int * data_metric, unsigned char * flag_vals, long int * flag_metric, int * runs, long int NOruns, int NOx, int NOy, int NOz, float * mom0, float * mom1, float * mom2, float * RAPV, float * DECPV);
+extern int CreateMomentMaps(double * data_vals, long int * data_metric, unsigned short * flag_vals, long int * flag_metric, int * runs, long int NOruns, int NOx, int NOy, int NOz, float * mom0, float * mom1, float * mom2, float * RAPV, float * DECPV);
+extern int CreateMomentMaps(double * data_vals, long int * data_metric, int * flag_vals, long int * flag_metric, int * runs, long int NOruns, int NOx, int NOy, int NOz, float * mom0, float * mom1, float * mom2, float * RAPV, float * DECPV);
+extern int CreateMomentMaps(double * data_vals, long int * data_metric, long int * flag_vals, long int * flag_metric, int * runs, long int NOruns, int NOx, int NOy, int NOz, float * mom0, float * mom1, float * mom2, float * RAPV, float * DECPV);
+
+// the objects that can still grow: the position of each object ID in the check_obj_ids list (or -1),
+// and a min-heap of the objects ordered by their maximum channel
+struct check_id_set {
+
+  vector<long int> pos;
+  vector<int> key;
+  vector< pair<int, long int> > queue;
+
+};
+
+// columnar store of the accumulated properties of the objects: each property is held in a contiguous
+// array indexed directly by object ID, so that adding voxels and merging objects don't have to chase
+// the object batches of the detections array
+template <typename T>
+struct object_store {
+
+  vector<int> NOvox;
+  vector<T> ra, dec, freq, ra_min, ra_max, dec_min, dec_max, freq_min, freq_max;
+  vector<T> ra_i, dec_i, freq_i, p_ra_i, p_dec_i, p_freq_i, n_ra_i, n_dec_i, n_freq_i;
+  vector<T> tot_intens, p_tot_intens, n_tot_intens, avg_intens, sigma_intens, rms, min_intens, max_intens;
+
+  long int Size();
+  void Resize(long int size);
+  void ReInit(long int id);
+  void AddPoint(long int id, T x_pos, T y_pos, T z_pos, T value);
+  void AddObject(long int id, long int merged);
+
+};
+
+// compact record of an object that is only kept for the reliability calculation: its total intensity,
+// its peak intensity --- the maximum for objects with a positive total intensity and the minimum
+// otherwise --- its number of voxels and the sign of its total intensity
+template <typename T>
+struct compact_props {
+
+  T tot_intens, peak;
+  int NOvox, sign;
+
+};
+
+// a row of the catalogue of the objects, laid out in the same manner as the structured array of
+// link_objects --- the maxima of the bounding box are one beyond the last voxel of the object
+struct catalogue_record {
+
+  long int ID;
+  double Xg, Yg, Zg, Xm, Ym, Zm;
+  long int Xmin, Xmax, Ymin, Ymax, Zmin, Zmax, NRvox;
+  double Fmin, Fmax, Ftot;
+
+};
+
+// counters and wall times in seconds of the phases of a linker and of its object ID allocator,
+// accumulated over all of its chunks ---
+// the times are only measured while collect is set, and the merging time is part of the sweep time
+struct link_stats {
+
+  bool collect;
+  double sweep_time, merge_time, srep_time, threshold_time, alloc_time;
+  long int voxels_scanned, merges, voxels_rewritten, ids_recycled, peak_objects, arena_bytes, alloc_calls;
+
+};
+
+// per-linker memory arena that owns the sparse representations and postage stamp images of the objects,
+// together with the scratch arrays used to merge them. Blocks are carved from large slabs and recycled
+// through a free list per power-of-two size class, and all of the memory is released in one go when the
+// arena is deleted by FreeObjGen.
+template <typename T>
+class srep_arena {
+
+ private:
+
+  vector<char *> slabs;
+  char * slab_next;
+  size_t slab_left, NObytes;
+  vector<char *> free_blocks;
+
+  void * Take(size_t size);
 
-extern void CreateMetric(int * data_metric, int * xyz_order, int NOx, int NOy, int NOz);
+  // the arena can't be copied
+  srep_arena(const srep_arena & copied);
+  srep_arena & operator = (const srep_arena & copied);
+
+ public:
+
+  srep_arena();
+  ~srep_arena();
+
+  int * TakeInts(long int size);
+  T * TakeVals(long int size);
+  void Give(void * block);
+  size_t ShowBytes();
+
+  // scratch arrays for combining sparse representations, shared by all merges of the linker
+  vector<int> temp_sparse_reps_grid, temp_sparse_reps_strings;
+  vector<T> temp_mom0, temp_RAPV, temp_DECPV, temp_ref_spec, temp_obj_spec, temp_vfield;
+
+  // objects with fewer than compact_voxels voxels and an absolute peak below compact_peak are demoted
+  // to compact records once they can no longer grow, and the records are kept here
+  int compact_voxels;
+  T compact_peak;
+  vector< compact_props<T> > compact;
+
+  // the linking engines report the fraction of the planes linked to progress_func, if it is set, and
+  // stop linking once it returns a non-zero value
+  int (* progress_func)(void * context, double fraction);
+  void * progress_context;
+  bool cancelled;
+  bool Progress(long int done, long int total);
+
+  // the objects that can no longer grow and have passed the size thresholds during the sweep are handed
+  // to finalise_func, if it is set, together with their bounding boxes, while the linking continues;
+  // a non-zero value returned by finalise_func cancels the linking
+  int (* finalise_func)(void * context, long int obj_id, int * bbox);
+  void * finalise_context;
+  bool Finalise(long int obj_id, int * bbox);
+
+  // the statistics of the linker
+  link_stats stats;
+
+};
+
+// pool of native worker threads that run the tasks submitted to it, in the order of submission. A task
+// is a function that is called with its context, and the tasks that are still queued are run before the
+// pool is deleted
+class task_pool {
+
+ private:
+
+  vector<thread> workers;
+  deque< pair<void (*)(void *), void *> > tasks;
+  mutex tasks_lock;
+  condition_variable tasks_ready;
+  bool stopping;
+
+  static void Work(task_pool * pool);
+
+  // the pool can't be copied
+  task_pool(const task_pool & copied);
+  task_pool & operator = (const task_pool & copied);
+
+ public:
+
+  task_pool(int NOthreads);
+  ~task_pool();
+
+  void Submit(void (* task)(void * context), void * context);
+  int ShowThreads();
+  long int ShowQueued();
+
+};
+
+extern void InitObjIDs(vector<int> & obj_ids, vector<char> & free_ids, link_stats & stats);
+extern void InitObjIDs(vector<long int> & obj_ids, vector<char> & free_ids, link_stats & stats);
+
+extern void FreeObjID(vector<int> & obj_ids, vector<char> & free_ids, int obj_id, link_stats & stats);
+extern void FreeObjID(vector<long int> & obj_ids, vector<char> & free_ids, long int obj_id, link_stats & stats);
+
+extern double WallTime();
 
 // functions using floats
 
-extern int CreateObjects(float * data_vals, int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, float intens_thresh_min, float intens_thresh_max, int flag_value, int start_obj, vector<object_props *> & detections, vector<int> & obj_ids, vector<int> & check_obj_ids, int obj_limit, int max_x_val, int max_y_val, int max_z_val, int ss_mode, int * data_metric, int * xyz_order);
-extern long int CreateObjects(float * data_vals, long int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, float intens_thresh_min, float intens_thresh_max, long int flag_value, long int start_obj, vector<object_props *> & detections, vector<long int> & obj_ids, vector<long int> & check_obj_ids, int obj_limit, int max_x_val, int max_y_val, int max_z_val, int ss_mode, int * data_metric, int * xyz_order);
+extern int CreateObjects(float * data_vals, int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, float intens_thresh_min, float intens_thresh_max, int flag_value, int start_obj, vector<object_props *> & detections, vector<int> & obj_ids, vector<int> & check_obj_ids, int obj_limit, int max_x_val, int max_y_val, int max_z_val, int ss_mode, long int * data_metric, int * xyz_order, int products);
+extern long int CreateObjects(float * data_vals, long int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, float intens_thresh_min, float intens_thresh_max, long int flag_value, long int start_obj, vector<object_props *> & detections, vector<long int> & obj_ids, vector<long int> & check_obj_ids, int obj_limit, int max_x_val, int max_y_val, int max_z_val, int ss_mode, long int * data_metric, int * xyz_order, int products);
+// the runs of source voxels are given as z, y, first x and last x, in the chunk's x,y,z order and sorted by z, y and x
+extern int CreateObjectsRuns(float * data_vals, int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, float intens_thresh_min, float intens_thresh_max, int flag_value, int start_obj, vector<object_props *> & detections, vector<int> & obj_ids, vector<int> & check_obj_ids, int obj_limit, int max_x_val, int max_y_val, int max_z_val, int ss_mode, long int * data_metric, int * xyz_order, int products, const int * runs, long int NOruns);
+extern long int CreateObjectsRuns(float * data_vals, long int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, float intens_thresh_min, float intens_thresh_max, long int flag_value, long int start_obj, vector<object_props *> & detections, vector<long int> & obj_ids, vector<long int> & check_obj_ids, int obj_limit, int max_x_val, int max_y_val, int max_z_val, int ss_mode, long int * data_metric, int * xyz_order, int products, const int * runs, long int NOruns);
+
+extern int CreateObjectsUF(float * data_vals, int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, float intens_thresh_min, float intens_thresh_max, int flag_value, int start_obj, vector<object_props *> & detections, vector<int> & obj_ids, vector<int> & check_obj_ids, int obj_limit, int max_x_val, int max_y_val, int max_z_val, int ss_mode, long int * data_metric, int * xyz_order, int products);
+extern int CreateObjectsMT(float * data_vals, int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, float intens_thresh_min, float intens_thresh_max, int flag_value, int start_obj, vector<object_props *> & detections, vector<int> & obj_ids, vector<int> & check_obj_ids, int obj_limit, int max_x_val, int max_y_val, int max_z_val, int ss_mode, long int * data_metric, int * xyz_order, int NOthreads, int products);
+extern int CreateObjectsDil(float * data_vals, int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, float intens_thresh_min, float intens_thresh_max, int flag_value, int start_obj, vector<object_props *> & detections, vector<int> & obj_ids, vector<int> & check_obj_ids, int obj_limit, int max_x_val, int max_y_val, int max_z_val, int ss_mode, long int * data_metric, int * xyz_order, int products);
+extern long int CreateObjectsUF(float * data_vals, long int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, float intens_thresh_min, float intens_thresh_max, long int flag_value, long int start_obj, vector<object_props *> & detections, vector<long int> & obj_ids, vector<long int> & check_obj_ids, int obj_limit, int max_x_val, int max_y_val, int max_z_val, int ss_mode, long int * data_metric, int * xyz_order, int products);
+extern long int CreateObjectsMT(float * data_vals, long int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, float intens_thresh_min, float intens_thresh_max, long int flag_value, long int start_obj, vector<object_props *> & detections, vector<long int> & obj_ids, vector<long int> & check_obj_ids, int obj_limit, int max_x_val, int max_y_val, int max_z_val, int ss_mode, long int * data_metric, int * xyz_order, int NOthreads, int products);
+extern long int CreateObjectsDil(float * data_vals, long int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, float intens_thresh_min, float intens_thresh_max, long int flag_value, long int start_obj, vector<object_props *> & detections, vector<long int> & obj_ids, vector<long int> & check_obj_ids, int obj_limit, int max_x_val, int max_y_val, int max_z_val, int ss_mode, long int * data_metric, int * xyz_order, int products);
+
+extern void CreateSparseReps(float * data_vals, int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int obj, vector<object_props *> & detections, int obj_limit, long int * data_metric, int products);
+extern void CreateSparseReps(float * data_vals, long int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, long int obj, vector<object_props *> & detections, int obj_limit, long int * data_metric, int products);
 
-extern int AddObjsToChunk(int * flag_vals, vector<object_props *> & detections, int NOobj, int obj_limit, int chunk_x_start, int chunk_y_start, int chunk_z_start, int chunk_x_size, int chunk_y_size, int chunk_z_size, vector<int> & check_obj_ids, int * data_metric, int * xyz_order);
-extern int AddObjsToChunk(long int * flag_vals, vector<object_props *> & detections, long int NOobj, int obj_limit, int chunk_x_start, int chunk_y_start, int chunk_z_start, int chunk_x_size, int chunk_y_size, int chunk_z_size, vector<long int> & check_obj_ids, int * data_metric, int * xyz_order);
+extern void BuildPostageStamps(float * data_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, vector<int> & obj_ids, vector<object_props *> & detections, int obj_limit, long int * data_metric, int products);
+extern void BuildPostageStamps(float * data_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, vector<long int> & obj_ids, vector<object_props *> & detections, int obj_limit, long int * data_metric, int products);
 
-extern void ThresholdObjs(vector<object_props *> & detections, int NOobj, int obj_limit, int min_x_size, int min_y_size, int min_z_size, int min_v_size, float intens_thresh_min, float intens_thresh_max, int min_LoS_count);
-extern void ThresholdObjs(vector<object_props *> & detections, long int NOobj, int obj_limit, int min_x_size, int min_y_size, int min_z_size, int min_v_size, float intens_thresh_min, float intens_thresh_max, int min_LoS_count);
+extern int AddObjsToChunk(int * flag_vals, vector<object_props *> & detections, int NOobj, int obj_limit, int chunk_x_start, int chunk_y_start, int chunk_z_start, int chunk_x_size, int chunk_y_size, int chunk_z_size, vector<int> & check_obj_ids, long int * data_metric, int * xyz_order);
+extern int AddObjsToChunk(long int * flag_vals, vector<object_props *> & detections, long int NOobj, int obj_limit, int chunk_x_start, int chunk_y_start, int chunk_z_start, int chunk_x_size, int chunk_y_size, int chunk_z_size, vector<long int> & check_obj_ids, long int * data_metric, int * xyz_order);
+
+extern void ThresholdObjs(vector<object_props *> & detections, int NOobj, int obj_limit, int min_x_size, int min_y_size, int min_z_size, int min_v_size, float intens_thresh_min, float intens_thresh_max, int min_LoS_count, int NOthreads);
+extern void ThresholdObjs(vector<object_props *> & detections, long int NOobj, int obj_limit, int min_x_size, int min_y_size, int min_z_size, int min_v_size, float intens_thresh_min, float intens_thresh_max, int min_LoS_count, int NOthreads);
+
+extern bool CompactObj(object_props & obj);
+extern bool CompactObj(object_store<float> & store, long int obj_id, srep_arena<float> & arena);
 
 extern float CreateMoment0Map(float * plot_array, int NOobj, vector<object_props *> & detections, int NOx, int NOy, int obj_limit);
 extern float CreateMoment0Map(float * plot_array, long int NOobj, vector<object_props *> & detections, int NOx, int NOy, int obj_limit);
@@ -429,27 +685,87 @@ extern int CreateRAPVBounds(vector<object_props *> & detections, int size_x, int
 extern int CreateDecPVBounds(vector<object_props *> & detections, int size_x, int size_y, int size_z, int min_y, int min_z, float * plot_x, float * plot_y, int obj, int obj_limit);
 extern int CreateDecPVBounds(vector<object_props *> & detections, int size_x, int size_y, int size_z, int min_y, int min_z, float * plot_x, float * plot_y, long int obj, int obj_limit);
 
-extern int CreateCatalogue(std::fstream& output_file, vector<object_props *> & detections, int NOobj, int obj_limit, int cat_mode);
-extern long int CreateCatalogue(std::fstream& output_file, vector<object_props *> & detections, long int NOobj, int obj_limit, int cat_mode);
+extern int CreateCatalogue(std::string output_file, std::string flux_unit, vector<object_props *> & detections, int NOobj, int obj_limit, int * columns, int NOcolumns, int cat_mode);
+extern long int CreateCatalogue(std::string output_file, std::string flux_unit, vector<object_props *> & detections, long int NOobj, int obj_limit, int * columns, int NOcolumns, int cat_mode);
+
+extern int NewObjID(vector<int> & obj_ids, vector<char> & free_ids, int & obj, vector<object_props *> & detections, int obj_limit);
+extern long int NewObjID(vector<long int> & obj_ids, vector<char> & free_ids, long int & obj, vector<object_props *> & detections, int obj_limit);
+
+extern void InitCheckIDs(vector<int> & check_obj_ids, check_id_set & check_set, vector<object_props *> & detections, int obj_limit);
+extern void InitCheckIDs(vector<long int> & check_obj_ids, check_id_set & check_set, vector<object_props *> & detections, int obj_limit);
+
+extern void AddCheckID(vector<int> & check_obj_ids, check_id_set & check_set, int obj_id, vector<object_props *> & detections, int obj_limit);
+extern void AddCheckID(vector<long int> & check_obj_ids, check_id_set & check_set, long int obj_id, vector<object_props *> & detections, int obj_limit);
 
-extern void InitObjGen(vector<object_props *> & detections, int & NOobj, int obj_limit, vector<int> & obj_ids, vector<int> & check_obj_ids, int *& data_metric, int *& xyz_order);
-extern void InitObjGen(vector<object_props *> & detections, long int & NOobj, int obj_limit, vector<long int> & obj_ids, vector<long int> & check_obj_ids, int *& data_metric, int *& xyz_order);
+extern int NextRetiredID(vector<int> & check_obj_ids, check_id_set & check_set, vector<object_props *> & detections, int obj_limit, int freq_limit);
+extern long int NextRetiredID(vector<long int> & check_obj_ids, check_id_set & check_set, vector<object_props *> & detections, int obj_limit, int freq_limit);
 
-extern void FreeObjGen(vector<object_props *> & detections, int * & data_metric, int * & xyz_order);
+extern void AddCheckID(vector<int> & check_obj_ids, check_id_set & check_set, int obj_id, object_store<float> & store);
+extern void AddCheckID(vector<long int> & check_obj_ids, check_id_set & check_set, long int obj_id, object_store<float> & store);
 
-extern void CreateFitsMask(std::string output_code, int NOx, int NOy, int NOf, vector<object_props *> & detections, int NOobj, int obj_limit, int * flag_vals, int chunk_x_size, int chunk_y_size, int temp_chunk_x_size, int temp_chunk_y_size, int * data_metric, int * xyz_order);
-extern void CreateFitsMask(std::string output_code, int NOx, int NOy, int NOf, vector<object_props *> & detections, long int NOobj, int obj_limit, long int * flag_vals, int chunk_x_size, int chunk_y_size, int temp_chunk_x_size, int temp_chunk_y_size, int * data_metric, int * xyz_order);
+extern int NextRetiredID(vector<int> & check_obj_ids, check_id_set & check_set, object_store<float> & store, int freq_limit);
+extern long int NextRetiredID(vector<long int> & check_obj_ids, check_id_set & check_set, object_store<float> & store, int freq_limit);
+
+extern void CalcObjProps(vector<object_props *> & detections, int NOobj, int obj_limit);
+extern void CalcObjProps(vector<object_props *> & detections, long int NOobj, int obj_limit);
+
+extern int LabelObjs(vector<object_props *> & detections, int NOobj, int obj_limit, int * label_vals, long int * data_metric, vector<int> & new_ids, int NOthreads);
+extern long int LabelObjs(vector<object_props *> & detections, long int NOobj, int obj_limit, long int * label_vals, long int * data_metric, vector<long int> & new_ids, int NOthreads);
+extern int LabelObjs(vector<object_props *> & detections, int NOobj, int obj_limit, unsigned short * label_vals, long int * data_metric, vector<int> & new_ids, int NOthreads);
+extern long int LabelObjs(vector<object_props *> & detections, long int NOobj, int obj_limit, unsigned short * label_vals, long int * data_metric, vector<long int> & new_ids, int NOthreads);
+extern int LabelObjs(vector<object_props *> & detections, int NOobj, int obj_limit, unsigned int * label_vals, long int * data_metric, vector<int> & new_ids, int NOthreads);
+extern long int LabelObjs(vector<object_props *> & detections, long int NOobj, int obj_limit, unsigned int * label_vals, long int * data_metric, vector<long int> & new_ids, int NOthreads);
+extern int LabelObjs(vector<object_props *> & detections, int NOobj, int obj_limit, unsigned long int * label_vals, long int * data_metric, vector<int> & new_ids, int NOthreads);
+extern long int LabelObjs(vector<object_props *> & detections, long int NOobj, int obj_limit, unsigned long int * label_vals, long int * data_metric, vector<long int> & new_ids, int NOthreads);
+
+extern void CopyCatalogue(vector<object_props *> & detections, int NOobj, int obj_limit, vector<int> & new_ids, catalogue_record * records, int NOthreads);
+extern void CopyCatalogue(vector<object_props *> & detections, long int NOobj, int obj_limit, vector<long int> & new_ids, catalogue_record * records, int NOthreads);
+extern long int CopyRuns(vector<object_props *> & detections, int NOobj, int obj_limit, vector<int> & new_ids, long int * offsets, int * runs, int NOthreads);
+extern long int CopyRuns(vector<object_props *> & detections, long int NOobj, int obj_limit, vector<long int> & new_ids, long int * offsets, int * runs, int NOthreads);
+
+extern void InitObjGen(vector<object_props *> & detections, int & NOobj, int obj_limit, vector<int> & obj_ids, vector<int> & check_obj_ids, long int *& data_metric, int *& xyz_order);
+extern void InitObjGen(vector<object_props *> & detections, long int & NOobj, int obj_limit, vector<long int> & obj_ids, vector<long int> & check_obj_ids, long int *& data_metric, int *& xyz_order);
+
+extern void FreeObjGen(vector<object_props *> & detections, long int * & data_metric, int * & xyz_order);
+
+extern void SetCompactLimits(vector<object_props *> & detections, int compact_voxels, float compact_peak);
+extern long int CopyCompactObjs(vector<object_props *> & detections, float * vals);
+extern void SetProgress(vector<object_props *> & detections, int (* progress_func)(void * context, double fraction), void * progress_context);
+extern void SetFinalise(vector<object_props *> & detections, int (* finalise_func)(void * context, long int obj_id, int * bbox), void * finalise_context);
+extern void SetLinkStats(vector<object_props *> & detections, bool collect);
+extern link_stats * GetLinkStats(vector<object_props *> & detections);
+
+extern int CreateFitsMask(std::string output_file, std::string header_cards, int NOx, int NOy, int NOf, vector<object_props *> & detections, int NOobj, int obj_limit);
+extern long int CreateFitsMask(std::string output_file, std::string header_cards, int NOx, int NOy, int NOf, vector<object_props *> & detections, long int NOobj, int obj_limit);
 
 // functions using doubles
 
-extern int CreateObjects(double * data_vals, int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, double intens_thresh_min, double intens_thresh_max, int flag_value, int start_obj, vector<object_props_dbl *> & detections, vector<int> & obj_ids, vector<int> & check_obj_ids, int obj_limit, int max_x_val, int max_y_val, int max_z_val, int ss_mode, int * data_metric, int * xyz_order);
-extern long int CreateObjects(double * data_vals, long int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, double intens_thresh_min, double intens_thresh_max, long int flag_value, long int start_obj, vector<object_props_dbl *> & detections, vector<long int> & obj_ids, vector<long int> & check_obj_ids, int obj_limit, int max_x_val, int max_y_val, int max_z_val, int ss_mode, int * data_metric, int * xyz_order);
+extern int CreateObjects(double * data_vals, int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, double intens_thresh_min, double intens_thresh_max, int flag_value, int start_obj, vector<object_props_dbl *> & detections, vector<int> & obj_ids, vector<int> & check_obj_ids, int obj_limit, int max_x_val, int max_y_val, int max_z_val, int ss_mode, long int * data_metric, int * xyz_order, int products);
+extern long int CreateObjects(double * data_vals, long int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, double intens_thresh_min, double intens_thresh_max, long int flag_value, long int start_obj, vector<object_props_dbl *> & detections, vector<long int> & obj_ids, vector<long int> & check_obj_ids, int obj_limit, int max_x_val, int max_y_val, int max_z_val, int ss_mode, long int * data_metric, int * xyz_order, int products);
+extern int CreateObjectsRuns(double * data_vals, int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, double intens_thresh_min, double intens_thresh_max, int flag_value, int start_obj, vector<object_props_dbl *> & detections, vector<int> & obj_ids, vector<int> & check_obj_ids, int obj_limit, int max_x_val, int max_y_val, int max_z_val, int ss_mode, long int * data_metric, int * xyz_order, int products, const int * runs, long int NOruns);
+extern long int CreateObjectsRuns(double * data_vals, long int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, double intens_thresh_min, double intens_thresh_max, long int flag_value, long int start_obj, vector<object_props_dbl *> & detections, vector<long int> & obj_ids, vector<long int> & check_obj_ids, int obj_limit, int max_x_val, int max_y_val, int max_z_val, int ss_mode, long int * data_metric, int * xyz_order, int products, const int * runs, long int NOruns);
+
+extern int CreateObjectsUF(double * data_vals, int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, double intens_thresh_min, double intens_thresh_max, int flag_value, int start_obj, vector<object_props_dbl *> & detections, vector<int> & obj_ids, vector<int> & check_obj_ids, int obj_limit, int max_x_val, int max_y_val, int max_z_val, int ss_mode, long int * data_metric, int * xyz_order, int products);
+extern int CreateObjectsMT(double * data_vals, int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, double intens_thresh_min, double intens_thresh_max, int flag_value, int start_obj, vector<object_props_dbl *> & detections, vector<int> & obj_ids, vector<int> & check_obj_ids, int obj_limit, int max_x_val, int max_y_val, int max_z_val, int ss_mode, long int * data_metric, int * xyz_order, int NOthreads, int products);
+extern int CreateObjectsDil(double * data_vals, int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, double intens_thresh_min, double intens_thresh_max, int flag_value, int start_obj, vector<object_props_dbl *> & detections, vector<int> & obj_ids, vector<int> & check_obj_ids, int obj_limit, int max_x_val, int max_y_val, int max_z_val, int ss_mode, long int * data_metric, int * xyz_order, int products);
+extern long int CreateObjectsUF(double * data_vals, long int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, double intens_thresh_min, double intens_thresh_max, long int flag_value, long int start_obj, vector<object_props_dbl *> & detections, vector<long int> & obj_ids, vector<long int> & check_obj_ids, int obj_limit, int max_x_val, int max_y_val, int max_z_val, int ss_mode, long int * data_metric, int * xyz_order, int products);
+extern long int CreateObjectsMT(double * data_vals, long int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, double intens_thresh_min, double intens_thresh_max, long int flag_value, long int start_obj, vector<object_props_dbl *> & detections, vector<long int> & obj_ids, vector<long int> & check_obj_ids, int obj_limit, int max_x_val, int max_y_val, int max_z_val, int ss_mode, long int * data_metric, int * xyz_order, int NOthreads, int products);
+extern long int CreateObjectsDil(double * data_vals, long int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, double intens_thresh_min, double intens_thresh_max, long int flag_value, long int start_obj, vector<object_props_dbl *> & detections, vector<long int> & obj_ids, vector<long int> & check_obj_ids, int obj_limit, int max_x_val, int max_y_val, int max_z_val, int ss_mode, long int * data_metric, int * xyz_order, int products);
+
+extern void CreateSparseReps(double * data_vals, int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int obj, vector<object_props_dbl *> & detections, int obj_limit, long int * data_metric, int products);
+extern void CreateSparseReps(double * data_vals, long int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, long int obj, vector<object_props_dbl *> & detections, int obj_limit, long int * data_metric, int products);
+
+extern void BuildPostageStamps(double * data_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, vector<int> & obj_ids, vector<object_props_dbl *> & detections, int obj_limit, long int * data_metric, int products);
+extern void BuildPostageStamps(double * data_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, vector<long int> & obj_ids, vector<object_props_dbl *> & detections, int obj_limit, long int * data_metric, int products);
+
+extern int AddObjsToChunk(int * flag_vals, vector<object_props_dbl *> & detections, int NOobj, int obj_limit, int chunk_x_start, int chunk_y_start, int chunk_z_start, int chunk_x_size, int chunk_y_size, int chunk_z_size, vector<int> & check_obj_ids, long int * data_metric, int * xyz_order);
+extern int AddObjsToChunk(long int * flag_vals, vector<object_props_dbl *> & detections, long int NOobj, int obj_limit, int chunk_x_start, int chunk_y_start, int chunk_z_start, int chunk_x_size, int chunk_y_size, int chunk_z_size, vector<long int> & check_obj_ids, long int * data_metric, int * xyz_order);
 
-extern int AddObjsToChunk(int * flag_vals, vector<object_props_dbl *> & detections, int NOobj, int obj_limit, int chunk_x_start, int chunk_y_start, int chunk_z_start, int chunk_x_size, int chunk_y_size, int chunk_z_size, vector<int> & check_obj_ids, int * data_metric, int * xyz_order);
-extern int AddObjsToChunk(long int * flag_vals, vector<object_props_dbl *> & detections, long int NOobj, int obj_limit, int chunk_x_start, int chunk_y_start, int chunk_z_start, int chunk_x_size, int chunk_y_size, int chunk_z_size, vector<long int> & check_obj_ids, int * data_metric, int * xyz_order);
+extern void ThresholdObjs(vector<object_props_dbl *> & detections, int NOobj, int obj_limit, int min_x_size, int min_y_size, int min_z_size, int min_v_size, double intens_thresh_min, double intens_thresh_max, int min_LoS_count, int NOthreads);
+extern void ThresholdObjs(vector<object_props_dbl *> & detections, long int NOobj, int obj_limit, int min_x_size, int min_y_size, int min_z_size, int min_v_size, double intens_thresh_min, double intens_thresh_max, int min_LoS_count, int NOthreads);
 
-extern void ThresholdObjs(vector<object_props_dbl *> & detections, int NOobj, int obj_limit, int min_x_size, int min_y_size, int min_z_size, int min_v_size, double intens_thresh_min, double intens_thresh_max, int min_LoS_count);
-extern void ThresholdObjs(vector<object_props_dbl *> & detections, long int NOobj, int obj_limit, int min_x_size, int min_y_size, int min_z_size, int min_v_size, double intens_thresh_min, double intens_thresh_max, int min_LoS_count);
+extern bool CompactObj(object_props_dbl & obj);
+extern bool CompactObj(object_store<double> & store, long int obj_id, srep_arena<double> & arena);
 
 extern float CreateMoment0Map(float * plot_array, int NOobj, vector<object_props_dbl *> & detections, int NOx, int NOy, int obj_limit);
 extern float CreateMoment0Map(float * plot_array, long int NOobj, vector<object_props_dbl *> & detections, int NOx, int NOy, int obj_limit);
@@ -469,16 +785,58 @@ extern int CreateRAPVBounds(vector<object_props_dbl *> & detections, int size_x,
 extern int CreateDecPVBounds(vector<object_props_dbl *> & detections, int size_x, int size_y, int size_z, int min_y, int min_z, float * plot_x, float * plot_y, int obj, int obj_limit);
 extern int CreateDecPVBounds(vector<object_props_dbl *> & detections, int size_x, int size_y, int size_z, int min_y, int min_z, float * plot_x, float * plot_y, long int obj, int obj_limit);
 
-extern int CreateCatalogue(std::fstream& output_file, vector<object_props_dbl *> & detections, int NOobj, int obj_limit, int cat_mode);
-extern long int CreateCatalogue(std::fstream& output_file, vector<object_props_dbl *> & detections, long int NOobj, int obj_limit, int cat_mode);
+extern int CreateCatalogue(std::string output_file, std::string flux_unit, vector<object_props_dbl *> & detections, int NOobj, int obj_limit, int * columns, int NOcolumns, int cat_mode);
+extern long int CreateCatalogue(std::string output_file, std::string flux_unit, vector<object_props_dbl *> & detections, long int NOobj, int obj_limit, int * columns, int NOcolumns, int cat_mode);
+
+extern int NewObjID(vector<int> & obj_ids, vector<char> & free_ids, int & obj, vector<object_props_dbl *> & detections, int obj_limit);
+extern long int NewObjID(vector<long int> & obj_ids, vector<char> & free_ids, long int & obj, vector<object_props_dbl *> & detections, int obj_limit);
+
+extern void InitCheckIDs(vector<int> & check_obj_ids, check_id_set & check_set, vector<object_props_dbl *> & detections, int obj_limit);
+extern void InitCheckIDs(vector<long int> & check_obj_ids, check_id_set & check_set, vector<object_props_dbl *> & detections, int obj_limit);
+
+extern void AddCheckID(vector<int> & check_obj_ids, check_id_set & check_set, int obj_id, vector<object_props_dbl *> & detections, int obj_limit);
+extern void AddCheckID(vector<long int> & check_obj_ids, check_id_set & check_set, long int obj_id, vector<object_props_dbl *> & detections, int obj_limit);
+
+extern int NextRetiredID(vector<int> & check_obj_ids, check_id_set & check_set, vector<object_props_dbl *> & detections, int obj_limit, int freq_limit);
+extern long int NextRetiredID(vector<long int> & check_obj_ids, check_id_set & check_set, vector<object_props_dbl *> & detections, int obj_limit, int freq_limit);
+
+extern void AddCheckID(vector<int> & check_obj_ids, check_id_set & check_set, int obj_id, object_store<double> & store);
+extern void AddCheckID(vector<long int> & check_obj_ids, check_id_set & check_set, long int obj_id, object_store<double> & store);
+
+extern int NextRetiredID(vector<int> & check_obj_ids, check_id_set & check_set, object_store<double> & store, int freq_limit);
+extern long int NextRetiredID(vector<long int> & check_obj_ids, check_id_set & check_set, object_store<double> & store, int freq_limit);
+
+extern void CalcObjProps(vector<object_props_dbl *> & detections, int NOobj, int obj_limit);
+extern void CalcObjProps(vector<object_props_dbl *> & detections, long int NOobj, int obj_limit);
+
+extern int LabelObjs(vector<object_props_dbl *> & detections, int NOobj, int obj_limit, int * label_vals, long int * data_metric, vector<int> & new_ids, int NOthreads);
+extern long int LabelObjs(vector<object_props_dbl *> & detections, long int NOobj, int obj_limit, long int * label_vals, long int * data_metric, vector<long int> & new_ids, int NOthreads);
+extern int LabelObjs(vector<object_props_dbl *> & detections, int NOobj, int obj_limit, unsigned short * label_vals, long int * data_metric, vector<int> & new_ids, int NOthreads);
+extern long int LabelObjs(vector<object_props_dbl *> & detections, long int NOobj, int obj_limit, unsigned short * label_vals, long int * data_metric, vector<long int> & new_ids, int NOthreads);
+extern int LabelObjs(vector<object_props_dbl *> & detections, int NOobj, int obj_limit, unsigned int * label_vals, long int * data_metric, vector<int> & new_ids, int NOthreads);
+extern long int LabelObjs(vector<object_props_dbl *> & detections, long int NOobj, int obj_limit, unsigned int * label_vals, long int * data_metric, vector<long int> & new_ids, int NOthreads);
+extern int LabelObjs(vector<object_props_dbl *> & detections, int NOobj, int obj_limit, unsigned long int * label_vals, long int * data_metric, vector<int> & new_ids, int NOthreads);
+extern long int LabelObjs(vector<object_props_dbl *> & detections, long int NOobj, int obj_limit, unsigned long int * label_vals, long int * data_metric, vector<long int> & new_ids, int NOthreads);
+
+extern void CopyCatalogue(vector<object_props_dbl *> & detections, int NOobj, int obj_limit, vector<int> & new_ids, catalogue_record * records, int NOthreads);
+extern void CopyCatalogue(vector<object_props_dbl *> & detections, long int NOobj, int obj_limit, vector<long int> & new_ids, catalogue_record * records, int NOthreads);
+extern long int CopyRuns(vector<object_props_dbl *> & detections, int NOobj, int obj_limit, vector<int> & new_ids, long int * offsets, int * runs, int NOthreads);
+extern long int CopyRuns(vector<object_props_dbl *> & detections, long int NOobj, int obj_limit, vector<long int> & new_ids, long int * offsets, int * runs, int NOthreads);
+
+extern void InitObjGen(vector<object_props_dbl *> & detections, int & NOobj, int obj_limit, vector<int> & obj_ids, vector<int> & check_obj_ids, long int *& data_metric, int *& xyz_order);
+extern void InitObjGen(vector<object_props_dbl *> & detections, long int & NOobj, int obj_limit, vector<long int> & obj_ids, vector<long int> & check_obj_ids, long int *& data_metric, int *& xyz_order);
 
-extern void InitObjGen(vector<object_props_dbl *> & detections, int & NOobj, int obj_limit, vector<int> & obj_ids, vector<int> & check_obj_ids, int *& data_metric, int *& xyz_order);
-extern void InitObjGen(vector<object_props_dbl *> & detections, long int & NOobj, int obj_limit, vector<long int> & obj_ids, vector<long int> & check_obj_ids, int *& data_metric, int *& xyz_order);
+extern void FreeObjGen(vector<object_props_dbl *> & detections, long int * & data_metric, int * & xyz_order);
 
-extern void FreeObjGen(vector<object_props_dbl *> & detections, int * & data_metric, int * & xyz_order);
+extern void SetCompactLimits(vector<object_props_dbl *> & detections, int compact_voxels, double compact_peak);
+extern long int CopyCompactObjs(vector<object_props_dbl *> & detections, double * vals);
+extern void SetProgress(vector<object_props_dbl *> & detections, int (* progress_func)(void * context, double fraction), void * progress_context);
+extern void SetFinalise(vector<object_props_dbl *> & detections, int (* finalise_func)(void * context, long int obj_id, int * bbox), void * finalise_context);
+extern void SetLinkStats(vector<object_props_dbl *> & detections, bool collect);
+extern link_stats * GetLinkStats(vector<object_props_dbl *> & detections);
 
-extern void CreateFitsMask(std::string output_code, int NOx, int NOy, int NOf, vector<object_props_dbl *> & detections, int NOobj, int obj_limit, int * flag_vals, int chunk_x_size, int chunk_y_size, int temp_chunk_x_size, int temp_chunk_y_size, int * data_metric, int * xyz_order);
-extern void CreateFitsMask(std::string output_code, int NOx, int NOy, int NOf, vector<object_props_dbl *> & detections, long int NOobj, int obj_limit, long int * flag_vals, int chunk_x_size, int chunk_y_size, int temp_chunk_x_size, int temp_chunk_y_size, int * data_metric, int * xyz_order);
+extern int CreateFitsMask(std::string output_file, std::string header_cards, int NOx, int NOy, int NOf, vector<object_props_dbl *> & detections, int NOobj, int obj_limit);
+extern long int CreateFitsMask(std::string output_file, std::string header_cards, int NOx, int NOy, int NOf, vector<object_props_dbl *> & detections, long int NOobj, int obj_limit);
 
 #endif
 
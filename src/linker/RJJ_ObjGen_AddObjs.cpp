@@ -0,0 +1,103 @@
+#include<iostream>
+#include "RJJ_ObjGen.h"
+
+using namespace std;
+
+// write the object IDs of the objects that are still being linked, i.e. those listed in check_obj_ids,
+// into the flag_vals array of a new chunk using their sparse representations --- this fills the part of
+// the chunk that overlaps previously processed chunks, so that CreateObjects can link new voxels to
+// these objects
+template <typename FlagT, typename PropsT>
+static int WriteObjsToChunk(FlagT * flag_vals, vector<PropsT *> & detections, FlagT NOobj, int obj_limit, int chunk_x_start, int chunk_y_start, int chunk_z_start, int chunk_x_size, int chunk_y_size, int chunk_z_size, vector<FlagT> & check_obj_ids, long int * data_metric, int * xyz_order){
+
+  FlagT obj_batch;
+  int x,y,z,x_start,x_finish,y_start,y_finish,z_start,z_finish,g,g_start,g_finish,i,NOadded;
+  int temp_vals[3];
+
+  // reorder the chunk limits to be in x,y,z order
+  temp_vals[0] = chunk_x_start; temp_vals[1] = chunk_y_start; temp_vals[2] = chunk_z_start;
+  chunk_x_start = ReorderAxis(temp_vals,xyz_order[0],0);
+  chunk_y_start = ReorderAxis(temp_vals,xyz_order[1],1);
+  chunk_z_start = ReorderAxis(temp_vals,xyz_order[2],2);
+  temp_vals[0] = chunk_x_size; temp_vals[1] = chunk_y_size; temp_vals[2] = chunk_z_size;
+  chunk_x_size = ReorderAxis(temp_vals,xyz_order[0],0);
+  chunk_y_size = ReorderAxis(temp_vals,xyz_order[1],1);
+  chunk_z_size = ReorderAxis(temp_vals,xyz_order[2],2);
+
+  NOadded = 0;
+  for(i = 0; i < ((int) check_obj_ids.size()); ++i){
+
+    if((check_obj_ids[i] < 0) || (check_obj_ids[i] >= NOobj)){ continue; }
+    obj_batch = check_obj_ids[i] / obj_limit;
+    PropsT & existing = detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))];
+
+    // move on if this object has been re-initialised or doesn't have a sparse representation yet
+    if((existing.ShowVoxels() < 1) || (existing.Get_srep_size(0) < 0)){ continue; }
+
+    // calculate the overlap of the sparse representation's bounding box with the chunk
+    x_start = existing.Get_srep_size(0) - chunk_x_start;
+    if(x_start < 0){ x_start = 0; }
+    x_finish = existing.Get_srep_size(1) - chunk_x_start;
+    if(x_finish >= chunk_x_size){ x_finish = chunk_x_size - 1; }
+    y_start = existing.Get_srep_size(2) - chunk_y_start;
+    if(y_start < 0){ y_start = 0; }
+    y_finish = existing.Get_srep_size(3) - chunk_y_start;
+    if(y_finish >= chunk_y_size){ y_finish = chunk_y_size - 1; }
+    if((x_start > x_finish) || (y_start > y_finish) || ((existing.Get_srep_size(5) - chunk_z_start) < 0) || ((existing.Get_srep_size(4) - chunk_z_start) >= chunk_z_size)){ continue; }
+
+    // write the object ID along each object string that lies within the chunk
+    for(y = y_start; y <= y_finish; ++y){
+      for(x = x_start; x <= x_finish; ++x){
+
+	g_start = existing.Get_srep_grid((((y + chunk_y_start - existing.Get_srep_size(2)) * (existing.Get_srep_size(1) - existing.Get_srep_size(0) + 1)) + x + chunk_x_start - existing.Get_srep_size(0)));
+	g_finish = existing.Get_srep_grid((((y + chunk_y_start - existing.Get_srep_size(2)) * (existing.Get_srep_size(1) - existing.Get_srep_size(0) + 1)) + x + chunk_x_start - existing.Get_srep_size(0) + 1));
+	for(g = g_start; g < g_finish; ++g){
+
+	  z_start = existing.Get_srep_strings((2 * g)) - chunk_z_start;
+	  if(z_start < 0){ z_start = 0; }
+	  z_finish = existing.Get_srep_strings(((2 * g) + 1)) - chunk_z_start;
+	  if(z_finish >= chunk_z_size){ z_finish = chunk_z_size - 1; }
+	  for(z = z_start; z <= z_finish; ++z){ flag_vals[(((long int) z * data_metric[2]) + ((long int) y * data_metric[1]) + ((long int) x * data_metric[0]))] = check_obj_ids[i]; }
+
+	}
+
+      }
+    }
+
+    ++NOadded;
+
+    // for(i = 0; i < check_obj_ids.size(); ++i)
+  }
+
+  // return the number of objects written to the chunk
+  return NOadded;
+
+}
+
+// functions using floats
+
+int AddObjsToChunk(int * flag_vals, vector<object_props *> & detections, int NOobj, int obj_limit, int chunk_x_start, int chunk_y_start, int chunk_z_start, int chunk_x_size, int chunk_y_size, int chunk_z_size, vector<int> & check_obj_ids, long int * data_metric, int * xyz_order){
+
+  return WriteObjsToChunk(flag_vals,detections,NOobj,obj_limit,chunk_x_start,chunk_y_start,chunk_z_start,chunk_x_size,chunk_y_size,chunk_z_size,check_obj_ids,data_metric,xyz_order);
+
+}
+
+int AddObjsToChunk(long int * flag_vals, vector<object_props *> & detections, long int NOobj, int obj_limit, int chunk_x_start, int chunk_y_start, int chunk_z_start, int chunk_x_size, int chunk_y_size, int chunk_z_size, vector<long int> & check_obj_ids, long int * data_metric, int * xyz_order){
+
+  return WriteObjsToChunk(flag_vals,detections,NOobj,obj_limit,chunk_x_start,chunk_y_start,chunk_z_start,chunk_x_size,chunk_y_size,chunk_z_size,check_obj_ids,data_metric,xyz_order);
+
+}
+
+// functions using doubles
+
+int AddObjsToChunk(int * flag_vals, vector<object_props_dbl *> & detections, int NOobj, int obj_limit, int chunk_x_start, int chunk_y_start, int chunk_z_start, int chunk_x_size, int chunk_y_size, int chunk_z_size, vector<int> & check_obj_ids, long int * data_metric, int * xyz_order){
+
+  return WriteObjsToChunk(flag_vals,detections,NOobj,obj_limit,chunk_x_start,chunk_y_start,chunk_z_start,chunk_x_size,chunk_y_size,chunk_z_size,check_obj_ids,data_metric,xyz_order);
+
+}
+
+int AddObjsToChunk(long int * flag_vals, vector<object_props_dbl *> & detections, long int NOobj, int obj_limit, int chunk_x_start, int chunk_y_start, int chunk_z_start, int chunk_x_size, int chunk_y_size, int chunk_z_size, vector<long int> & check_obj_ids, long int * data_metric, int * xyz_order){
+
+  return WriteObjsToChunk(flag_vals,detections,NOobj,obj_limit,chunk_x_start,chunk_y_start,chunk_z_start,chunk_x_size,chunk_y_size,chunk_z_size,check_obj_ids,data_metric,xyz_order);
+
+}
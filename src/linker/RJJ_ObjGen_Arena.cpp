@@ -0,0 +1,139 @@
+#include<iostream>
+#include<cstdlib>
+#include "RJJ_ObjGen.h"
+
+using namespace std;
+
+// The srep_arena hands out the arrays of the objects' sparse representations and postage stamp images.
+// Every block is preceded by a header that records its size class, so that a block can be given back
+// without its size. Size classes are powers of two starting at 16 bytes, and a freed block is pushed
+// onto the free list of its class, with the link stored in the block itself. Blocks larger than a slab
+// are given a slab of their own.
+
+#define ARENA_SLAB_SIZE 4194304
+#define ARENA_HEADER 16
+#define ARENA_MIN_CLASS 4
+
+template <typename T>
+srep_arena<T>::srep_arena(){
+
+  slab_next = NULL;
+  slab_left = 0;
+  NObytes = 0;
+  compact_voxels = 0;
+  compact_peak = 0;
+  progress_func = NULL;
+  progress_context = NULL;
+  cancelled = false;
+  finalise_func = NULL;
+  finalise_context = NULL;
+  stats = link_stats();
+
+}
+
+template <typename T>
+srep_arena<T>::~srep_arena(){
+
+  size_t i;
+
+  for(i = 0; i < slabs.size(); ++i){ free(slabs[i]); }
+  slabs.clear();
+
+}
+
+template <typename T>
+void * srep_arena<T>::Take(size_t size){
+
+  size_t size_class, block_size;
+  char * block;
+
+  // find the size class of the block, including its header and room for the free list link
+  if(size < sizeof(char *)){ size = sizeof(char *); }
+  size_class = ARENA_MIN_CLASS;
+  while(((size_t) 1 << size_class) < (size + ARENA_HEADER)){ ++size_class; }
+  block_size = (size_t) 1 << size_class;
+  if(size_class >= free_blocks.size()){ free_blocks.resize((size_class + 1),NULL); }
+
+  // re-use a free block of this size class if there is one
+  if(free_blocks[size_class] != NULL){
+
+    block = free_blocks[size_class];
+    free_blocks[size_class] = *((char **) (block + ARENA_HEADER));
+    return (void *) (block + ARENA_HEADER);
+
+  }
+
+  // otherwise, carve a new block from the current slab, starting a new slab if required
+  if(block_size > slab_left){
+
+    if(block_size > ARENA_SLAB_SIZE){
+
+      block = (char *) malloc(block_size);
+      if(block == NULL){ throw bad_alloc(); }
+      slabs.push_back(block);
+      NObytes+=block_size;
+      *((size_t *) block) = size_class;
+      return (void *) (block + ARENA_HEADER);
+
+    }
+
+    slab_next = (char *) malloc(ARENA_SLAB_SIZE);
+    if(slab_next == NULL){ throw bad_alloc(); }
+    slabs.push_back(slab_next);
+    slab_left = ARENA_SLAB_SIZE;
+    NObytes+=ARENA_SLAB_SIZE;
+
+  }
+  block = slab_next;
+  slab_next+=block_size;
+  slab_left-=block_size;
+  *((size_t *) block) = size_class;
+  return (void *) (block + ARENA_HEADER);
+
+}
+
+template <typename T>
+int * srep_arena<T>::TakeInts(long int size){ return (int *) Take((size * sizeof(int))); }
+
+template <typename T>
+T * srep_arena<T>::TakeVals(long int size){ return (T *) Take((size * sizeof(T))); }
+
+template <typename T>
+void srep_arena<T>::Give(void * block){
+
+  char * header;
+  size_t size_class;
+
+  if(block == NULL){ return; }
+  header = ((char *) block) - ARENA_HEADER;
+  size_class = *((size_t *) header);
+  *((char **) block) = free_blocks[size_class];
+  free_blocks[size_class] = header;
+
+}
+
+template <typename T>
+size_t srep_arena<T>::ShowBytes(){ return NObytes; }
+
+// report the fraction of the work done, and return true if the linking has been cancelled
+template <typename T>
+bool srep_arena<T>::Progress(long int done, long int total){
+
+  if((progress_func == NULL) || cancelled || (total <= 0)){ return cancelled; }
+  if(progress_func(progress_context,((double) done / (double) total)) != 0){ cancelled = true; }
+  return cancelled;
+
+}
+
+// hand an object that can no longer grow to finalise_func, and return true if the linking has been cancelled
+template <typename T>
+bool srep_arena<T>::Finalise(long int obj_id, int * bbox){
+
+  if((finalise_func == NULL) || cancelled){ return cancelled; }
+  if(finalise_func(finalise_context,obj_id,bbox) != 0){ cancelled = true; }
+  return cancelled;
+
+}
+
+template class srep_arena<float>;
+template class srep_arena<double>;
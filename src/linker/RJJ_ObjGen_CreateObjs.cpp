@@ -3,4081 +3,228 @@
 
 using namespace std;
 
-// functions using floats
-
-int CreateObjects(float * data_vals, int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, float intens_thresh_min, float intens_thresh_max, int flag_value, int start_obj, vector<object_props *> & detections, vector<int> & obj_ids, vector<int> & check_obj_ids, int obj_limit, int max_x_val, int max_y_val, int max_z_val, int ss_mode, int * data_metric, int * xyz_order){
- 
-  int x,y,z,obj,existing,sx,sy,sz,sx_start,sy_start,sz_start,sx_finish,sy_finish,sz_finish,init_limit,g;
-  int i,j,k,NOi, obj_batch, obj_batch_2,NO_obj_ids,NO_check_obj_ids;
-  int prev,x_start,y_start,temp_x[3],temp_y[3],temp_z[3];
-  float progress;
-  vector<float> temp_mom0, temp_RAPV, temp_DECPV, temp_obj_spec, temp_ref_spec, temp_vfield;
-  vector<int> match_init, temp_sparse_reps_grid, temp_sparse_reps_strings;
-
-  // convert the merging lengths from distances (in pixels/voxels) to empty space between linked detections (in pixels/voxels) --- subtract 1 --- this is a more naturual
-  // definition when processing a large file in chunks, because it makes it easier to build up sources that need to be retained for the rest of the input file
-  --merge_x;
-  --merge_y;
-  --merge_z;
-
-  // reorder the datacube and subcube limits to be in x,y,z order
-  temp_x[0] = chunk_x_start;
-  temp_y[0] = chunk_y_start;
-  temp_z[0] = chunk_z_start;
-  temp_x[1] = size_x;
-  temp_y[1] = size_y;
-  temp_z[1] = size_z;
-  temp_x[2] = max_x_val;
-  temp_y[2] = max_y_val;
-  temp_z[2] = max_z_val;
-  switch(xyz_order[0]){
-  case 1:
-    chunk_x_start = temp_x[0];
-    size_x = temp_x[1];
-    max_x_val = temp_x[2];
-    break;
-  case 2:
-    chunk_x_start = temp_y[0];
-    size_x = temp_y[1];
-    max_x_val = temp_y[2];
-    break;
-  case 3:
-    chunk_x_start = temp_z[0];
-    size_x = temp_z[1];
-    max_x_val = temp_z[2];
-    break;
-  default:
-    chunk_x_start = temp_x[0];
-    size_x = temp_x[1];
-    max_x_val = temp_x[2];
-    break;
-  }
-  switch(xyz_order[1]){
-  case 1:
-    chunk_y_start = temp_x[0];
-    size_y = temp_x[1];
-    max_y_val = temp_x[2];
-    break;
-  case 2:
-    chunk_y_start = temp_y[0];
-    size_y = temp_y[1];
-    max_y_val = temp_y[2];
-    break;
-  case 3:
-    chunk_y_start = temp_z[0];
-    size_y = temp_z[1];
-    max_y_val = temp_z[2];
-    break;
-  default:
-    chunk_y_start = temp_y[0];
-    size_y = temp_y[1];
-    max_y_val = temp_y[2];
-    break;
-  }
-  switch(xyz_order[2]){
-  case 1:
-    chunk_z_start = temp_x[0];
-    size_z = temp_x[1];
-    max_z_val = temp_x[2];
-    break;
-  case 2:
-    chunk_z_start = temp_y[0];
-    size_z = temp_y[1];
-    max_z_val = temp_y[2];
-    break;
-  case 3:
-    chunk_z_start = temp_z[0];
-    size_z = temp_z[1];
-    max_z_val = temp_z[2];
-    break;
-  default:
-    chunk_z_start = temp_z[0];
-    size_z = temp_z[1];
-    max_z_val = temp_z[2];
-    break;
-  }
-
-  // create temporary arrays
-  if(10000 > (((2 * merge_x) + 3) * ((2 * merge_y) + 3) * ((2 * merge_z) + 3))){
-    
-    init_limit = 10000;
-    
-  } else {
-    
-    init_limit = ((2 * merge_x) + 3) * ((2 * merge_y) + 3) * ((2 * merge_z) + 3) + 10;
-    
-  }
-  match_init.reserve(init_limit);
-  match_init.resize(0);
-
-  temp_sparse_reps_grid.reserve(1000000);
-  temp_sparse_reps_grid.resize(0);
-  temp_sparse_reps_strings.reserve(1000000);
-  temp_sparse_reps_strings.resize(0);
-  temp_mom0.reserve(1000000);
-  temp_mom0.resize(0);
-  temp_RAPV.reserve(1000000);
-  temp_RAPV.resize(0);
-  temp_DECPV.reserve(1000000);
-  temp_DECPV.resize(0);
-  temp_obj_spec.reserve(1000000);
-  temp_obj_spec.resize(0);
-  temp_ref_spec.reserve(1000000);
-  temp_ref_spec.resize(0);
-  temp_vfield.reserve(1000000);
-  temp_vfield.resize(0);
- 
-  // 0. initialise variables and arrays
-  obj = start_obj;
-  x_start = 0;
-  y_start = 0;
-  if(chunk_x_start > 0){ x_start = merge_x + 1; }
-  if(chunk_y_start > 0){ y_start = merge_y + 1; }
-  NO_obj_ids = obj_ids.size();
-  NO_check_obj_ids = check_obj_ids.size();
-
-  // 1. Create list of `coherent' objects from neighbouring voxels
-  
-  // for each grid point, check if it has been flagged as a source voxel, and assign
-  // it an object ID if it is. If a neighbouring voxel has already been flagged, assign 
-  // that ID to the grid point, otherwise, assign current value of obj and increment obj.
-  std::cout << "0 | |:| | : | |:| | 100% complete" << std::endl;
-  progress = 0.0;
-  for(z = 0; ((z < size_z) && ((z + chunk_z_start) < max_z_val)); ++z){
-
-    // if the z value is sufficiently large that objects have started to pop out of the merging box,
-    // then check if the objects outside of the merging box are sufficiently large
-    if(z > (merge_z + 1)){
-      
-      // initialise NOi to store the number of current check_obj_ids values that haven't moved outside of 
-      // the merging volume, and that form the basis for the new check_obj_ids list
-      NOi = 0;
-      
-      // apply size threshold to objects added since last size thresholding
-      for(i = 0; i < NO_check_obj_ids; ++i){
-	
-	// calculate the obj_batch value for the existing object
-	obj_batch = (int) floorf(((float) check_obj_ids[i] / (float) obj_limit));
-	
-	// move to the next object if this one has been re-initialised
-	if(detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].ShowVoxels() < 1){ continue; }
-	
-	// check if this object has moved outside of the merging box available to the next plane, if it 
-	// has apply a size threshold, otherwise use it to seed the new list of objects to be size thresholded
-	// the next time
-	if(detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetFREQmax() < (chunk_z_start + z - merge_z - 1)){
-	  
-	  // apply the size threshold, and if it fails re-initialise the object and pop its id to the list
-	  // of available obj_ids
-	  if((((detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetRAmax() - detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetRAmin() + 1) < min_x_size) || ((detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetDECmax() - detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetDECmin() + 1) < min_y_size) || ((detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetFREQmax() - detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetFREQmin() + 1) < min_z_size) || (detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].ShowVoxels() < min_v_size)) && (((detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetRAmin() - chunk_x_start) > merge_x) || (chunk_x_start == 0)) && ((((chunk_x_start + size_x - 1 - detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetRAmax()) > merge_x) || ((chunk_x_start + size_x) >= max_x_val)) && (((detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetDECmin() - chunk_y_start) > merge_y) || (chunk_y_start == 0)) && (((chunk_y_start + size_y - 1 - detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetDECmax()) > merge_y) || ((chunk_y_start + size_y) >= max_y_val)) && (((detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetFREQmin() - chunk_z_start) > merge_z) || (chunk_z_start == 0)) && (((chunk_z_start + size_z - 1 - detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetFREQmax()) > merge_z) || ((chunk_z_start + size_z) >= max_z_val)))){
-	    
-	    // re-initialise object
-	    detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].ReInit();
-	    if((detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].Get_srep_update() != 0) && (detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].Get_srep_size(0) >= 0)){
-	      
-	      detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].ReInit_srep();
-	      detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].ReInit_mini();
-
-	    }
-	    detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].ReInit_size();
-	    detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].Set_srep_update(0);
-
-	    // flag the `object' values within the bounding box and remove it from the flag_vals array
-	    sx_start = detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetRAmin() - chunk_x_start;
-	    if(sx_start < 0){ sx_start = 0; }
-	    sy_start = detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetDECmin() - chunk_y_start;
-	    if(sy_start < 0){ sy_start = 0; }
-	    sz_start = detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetFREQmin() - chunk_z_start;
-	    if(sz_start < 0){ sz_start = 0; }
-	    for(sz = sz_start; ((sz <= (detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetFREQmax() - chunk_z_start)) && (sz < size_z)); ++sz){
-	      
-	      for(sy = sy_start; ((sy <= (detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetDECmax() - chunk_y_start)) && (sy < size_y)); ++sy){
-		
-		for(sx = sx_start; ((sx <= (detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetRAmax() - chunk_x_start)) && (sx < size_x)); ++sx){
-		  
-		  if(flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx * data_metric[0]))] == check_obj_ids[i]){ flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx * data_metric[0]))] = -99; }
-		  
-		  // for(sx = x_start[(match_init[i] - (obj_batch_2 * obj_limit))]; sx <= x_finish[(match_init[i] - (obj_batch_2 * obj_limit))]; ++sx)
-		}
-		
-		// for(sy = y_start[(match_init[i] - (obj_batch_2 * obj_limit))]; sy <= y_finish[(match_init[i] - (obj_batch_2 * obj_limit))]; ++sy)
-	      }
-	      
-	      // for(sz = z_start[(match_init[i] - (obj_batch_2 * obj_limit))]; sz <= z_finish[(match_init[i] - (obj_batch_2 * obj_limit))]; ++sz)
-	    }
-	    
-	    // add object id to list of available ids
-	    j = -1;
-	    for(g = 0; g < NO_obj_ids; ++g){ if(obj_ids[g] == check_obj_ids[i]){ j = 1; break; } }
-	    if(j == -1){
-	      ++NO_obj_ids;
-	      obj_ids.push_back(check_obj_ids[i]);
-	    }
-
-	  }
-	  
-	  // if(z_finish[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))] < (z - merge_z - 1))
-	} else {
-	  
-	  check_obj_ids[NOi] = check_obj_ids[i];
-	  ++NOi;
-	  
-	  // else . . . if(z_finish[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))] < (z - merge_z - 1))
-	}
-	
-	// for(i = 0; i < NO_check_obj_ids; ++i)
-      }
-
-      // update NO_check_obj_ids
-      NO_check_obj_ids = NOi;
-      check_obj_ids.resize(NOi);
-      
-      // if(z > (merge_z + 2))
-    }
-    
-    for(y = y_start; (y < size_y) && ((chunk_y_start + y) < max_y_val); ++y){
-      
-      for(x = x_start; (x < size_x) && ((chunk_x_start + x) < max_x_val); ++x){
-	
-	// if this is a source voxel, check if it is associated with a previously identified
-	// source voxel
-	if(flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (x*data_metric[0]))] == flag_value){ 
-	  
-	  // 1.  initialise variables
-	  existing = flag_value;
-	  NOi = 0;
-	  match_init.resize(0);
-	  
-	  // 3. initial pass, check the voxels within the merging distance to see if any have been
-	  // identified as previous objects
-	  
-	  // 3a. set limits of region to be searched
-	  sx_start = x - merge_x - 1;
-	  if(sx_start < 0){ sx_start = 0; }
-	  sy_start = y - merge_y - 1;
-	  if(sy_start < 0){ sy_start = 0; }
-	  sz_start = z - merge_z - 1;
-	  if(sz_start < 0){ sz_start = 0; }
-	  
-	  // 3b. search through previous region and modify existing flag if required
-
-	  if(ss_mode == 1){
-	    
-	    // use a rectangular paralleliped to do the linking
-
-	    for(sz = sz_start; (sz < z); ++sz){
-	    
-	      for(sy = sy_start; (sy <= (y + merge_y + 1)) && (sy < size_y); ++sy){
-	      
-		for(sx = sx_start; (sx <= (x + merge_x + 1)) && (sx < size_x); ++sx){
-		
-		  // check if this test voxel is source
-		  if((flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] == flag_value) || (flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] >= 0)){
-		    
-		    // check if this is a new objid
-		    prev = -1;
-		    for(i = 0; (i < NOi) && (i < init_limit); ++i){
-		      
-		      if(match_init[i] == flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))]){
-			
-			prev = 1;
-			break;
-			
-		      }
-		      
-		    }
-		    if(prev == -1){ 
-		      
-		      // add current object to list of previous matches
-		      match_init.push_back(flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))]);
-		      ++NOi;
-
-		    }
-		    
-		    // update existing flag
-		    if(((flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] < existing) && (flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] >= 0)) || (existing == flag_value)){ existing = flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))]; }
-		    
-		  }
-		  
-		  // for(sx = x_start; (sx < (x + merge_x + 1)) && (sx < size_x); ++sx)
-		}
-		
-		// for(sy = y_start; (sy < (y + merge_y + 1)) && (sy < size_y); ++sy)
-	      }
-	      
-	      // for(sz = z_start; (sz < z); ++sz)
-	    }
-	    for(sy = sy_start; (sy < y); ++sy){
-	      
-	      for(sx = sx_start; (sx <= (x + merge_x + 1)) && (sx < size_x); ++sx){
-		
-		// check if this test voxel is source
-		if((flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] == flag_value) || (flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] >= 0)){
-		  
-		  // check if this is a new objid, move on if not
-		  prev = -1;
-		  for(i = 0; (i < NOi) && (i < init_limit); ++i){
-		    
-		    if(match_init[i] == flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))]){
-		      
-		      prev = 1;
-		      break;
-		      
-		    }
-		    
-		  }
-		  if(prev == -1){ 
-		    
-		    // add current object to list of previous matches
-		    ++NOi;
-		    match_init.push_back(flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))]);
-
-		  }
-		  
-		  // update existing flag
-		  if(((flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] < existing) && (flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] >= 0)) || (existing == flag_value)){ existing = flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))]; }
-		  
-		}		
-		
-		// for(sx = x_start; (sx < = (x + merge_x + 1)) && (sx < size_x); ++sx)
-	      }
-	      
-	      // for(sy = y_start; (sy < y) && (sy < size_y); ++sy)
-	    }
-	    for(sx = sx_start; sx < x; ++sx){
-	      
-	      // check if this test voxel is source
-	      if((flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))] == flag_value) || (flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))] >= 0)){
-		
-		// check if this is a new objid, move on if not
-		prev = -1;
-		for(i = 0; (i < NOi) && (i < init_limit); ++i){
-		  
-		  if(match_init[i] == flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))]){
-		    
-		    prev = 1;
-		    break;
-		    
-		  }
-		  
-		}
-		if(prev == -1){ 
-		  
-		  // add current object to list of previous matches
-		  ++NOi;
-		  match_init.push_back(flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))]);
-
-		}
-		
-		// update existing flag
-		if(((flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))] < existing) && (flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))] >= 0)) || (existing == flag_value)){ existing = flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))]; }
-		
-	      }	  
-	      
-	      // for(sx = x_start; sx <= x; ++sx)
-	    }
-	  
-	    // if(ss_mode == 1)
-	  } else {
-
-	    // use a cylinder for the linking lengths
-
-	    for(sz = sz_start; (sz < z); ++sz){
-	    
-	      for(sy = sy_start; (sy <= (y + merge_y + 1)) && (sy < size_y); ++sy){
-	      
-		for(sx = sx_start; (sx <= (x + merge_x + 1)) && (sx < size_x); ++sx){
-		
-		  // check if the test voxel is within the boundaries of the spatial ellipse
-		  if(((((float) (x - sx)) * ((float) (x - sx)) / (((float) (merge_x + 1)) * ((float) (merge_x + 1)))) + (((float) (y - sy)) * ((float) (y - sy)) / (((float) (merge_y + 1)) * ((float) (merge_y + 1))))) > 1.0){ continue; }
-
-		  // check if this test voxel is source
-		  if((flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] == flag_value) || (flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] >= 0)){
-
-		    // check if this is a new objid
-		    prev = -1;
-		    for(i = 0; (i < NOi) && (i < init_limit); ++i){
-		      
-		      if(match_init[i] == flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))]){
-			
-			prev = 1;
-			break;
-			
-		      }
-		      
-		    }
-		    if(prev == -1){ 
-		      
-		      // add current object to list of previous matches
-		      ++NOi;
-		      match_init.push_back(flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))]);
-
-		    }
-		    
-		    // update existing flag
-		    if(((flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] < existing) && (flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] >= 0)) || (existing == flag_value)){ existing = flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))]; }
-		    
-		  }
-		  
-		  // for(sx = x_start; (sx < (x + merge_x + 1)) && (sx < size_x); ++sx)
-		}
-		
-		// for(sy = y_start; (sy < (y + merge_y + 1)) && (sy < size_y); ++sy)
-	      }
-	      
-	      // for(sz = z_start; (sz < z); ++sz)
-	    }
-	    for(sy = sy_start; (sy < y); ++sy){
-	      
-	      for(sx = sx_start; (sx <= (x + merge_x + 1)) && (sx < size_x); ++sx){
-		
-		// check if the test voxel is within the boundaries of the spatial ellipse
-		if(((((float) (x - sx)) * ((float) (x - sx)) / (((float) (merge_x + 1)) * ((float) (merge_x + 1)))) + (((float) (y - sy)) * ((float) (y - sy)) / (((float) (merge_y + 1)) * ((float) (merge_y + 1))))) > 1.0){ continue; }
-
-		// check if this test voxel is source
-		if((flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] == flag_value) || (flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] >= 0)){
-		  
-		  // check if this is a new objid, move on if not
-		  prev = -1;
-		  for(i = 0; (i < NOi) && (i < init_limit); ++i){
-		    
-		    if(match_init[i] == flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))]){
-		      
-		      prev = 1;
-		      break;
-		      
-		    }
-		    
-		  }
-		  if(prev == -1){ 
-		    
-		    // add current object to list of previous matches
-		    ++NOi;
-		    match_init.push_back(flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))]);
-
-		  }
-		  
-		  // update existing flag
-		  if(((flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] < existing) && (flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] >= 0)) || (existing == flag_value)){ existing = flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))]; }
-		  
-		}		
-		
-		// for(sx = x_start; (sx < = (x + merge_x + 1)) && (sx < size_x); ++sx)
-	      }
-	      
-	      // for(sy = y_start; (sy < y) && (sy < size_y); ++sy)
-	    }
-	    for(sx = sx_start; sx < x; ++sx){
-	      
-	      // check if this test voxel is source
-	      if((flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))] == flag_value) || (flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))] >= 0)){
-		
-		// check if this is a new objid, move on if not
-		prev = -1;
-		for(i = 0; (i < NOi) && (i < init_limit); ++i){
-		  
-		  if(match_init[i] == flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))]){
-		    
-		    prev = 1;
-		    break;
-		    
-		  }
-		  
-		}
-		if(prev == -1){ 
-		  
-		  // add current object to list of previous matches
-		  ++NOi;
-		  match_init.push_back(flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))]);
-		  
-		}
-		
-		// update existing flag
-		if(((flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))] < existing) && (flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))] >= 0)) || (existing == flag_value)){ existing = flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))]; }
-		
-	      }	  
-	      
-	      // for(sx = x_start; sx <= x; ++sx)
-	    }
-
-	    // else . . . if(ss_mode == 1)
-	  }
-
-	  // 3c. assign an object number to this voxel, depending upon the value of the existing flag,
-	  // and if this is part of an existing object or objects, then daisy chain from this voxel to all the others
-	  if(existing == flag_value){
-	    
-	    // get obj value from array of obj_ids, then replace it with an incremented obj value
-	    
-	    // ensure that the obj_ids array is sorted
-	    sort(obj_ids.begin(),obj_ids.end());
-	    
-	    // assign value to array
-	    flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (x*data_metric[0]))] = obj_ids[0]; 
-	    
-	    // calculate the obj_batch value for this obj_id
-	    obj_batch = (int) floorf(((float) obj_ids[0] / (float) obj_limit));
-	    
-	    // add this initial point to the object
-	    detections[obj_batch][(obj_ids[0] - (obj_batch * obj_limit))].AddPoint(((float) (chunk_x_start + x)),((float) (chunk_y_start + y)),((float) (chunk_z_start + z)),data_vals[((z*data_metric[2]) + (y*data_metric[1]) + (x*data_metric[0]))]);
-
-	    // push id to list of objects that need to be size thresholded
-	    i = -1;
-	    for(g = 0; g < NO_check_obj_ids; ++g){ if(check_obj_ids[g] == obj_ids[0]){ i = 1; break; } }
-	    if(i == -1){
-
-	      ++NO_check_obj_ids;
-	      check_obj_ids.push_back(obj_ids[0]);
-	      
-	    }
-
-	    // adjust obj and obj_ids
-	    if(NO_obj_ids > 1){
-	      
-	      for(i = 0; i < (NO_obj_ids - 1); ++i){ obj_ids[i] = obj_ids[(i + 1)]; }
-	      --NO_obj_ids;
-	      obj_ids.resize(NO_obj_ids);
-
-	    } else {
-	      
-	      ++obj;
-
-	      obj_ids[0] = obj;
-	      
-	      // if this obj_id modulo obj_limit == 0, then it's the first obj of a new batch
-	      // so create a new batch of objects
-	      if((obj % obj_limit) == 0){ 
-				
-		detections.push_back(new object_props[obj_limit]);
-				
-		// if((obj % obj_limit) == 0)
-	      }
-			      
-	      // if(NO_obj_ids > 1) { } else 
-	    }
-	    
-	    // if(existing == -1)
-	  } else if(existing >= 0){
-	    
-	    // assign the current voxel being processed the correct flag value, and update
-	    // the bounding box
-	    
-	    // add object to list of objects within the merging box, provided that it hasn't been added already
-	    i = -1;
-	    for(g = 0; g < NO_check_obj_ids; ++g){ if(check_obj_ids[g] == existing){ i = 1; break; } }
-	    if(i == -1){
-
-	      ++NO_check_obj_ids;
-	      check_obj_ids.push_back(existing);
-
-	    }
-
-	    // assign value to array
-	    flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (x*data_metric[0]))] = existing;
-	    
-	    // calculate the obj_batch value for the existing object
-	    obj_batch = (int) floorf(((float) existing / (float) obj_limit));
-	    
-	    // add this point to the existing object
-	    detections[obj_batch][(existing - (obj_batch * obj_limit))].AddPoint((chunk_x_start + x),(chunk_y_start + y),(chunk_z_start + z),data_vals[((z*data_metric[2]) + (y*data_metric[1]) + (x*data_metric[0]))]);
-	    
-	    // for each object detected within the merging volume, update all of the values within the bounding box of this object
-	    // to be the same as the other part of this object, and update the bounding box at the same time
-	    if(NOi > 1){
-	      
-	      for(i = 0; i < NOi; ++i){
-		
-		// move on if this is the existing object
-		if(match_init[i] == existing){ 
-
-		  continue; 
-
-		}
-		
-		// calculate a temporary obj_batch value
-		obj_batch_2 = (int) floorf(((float) match_init[i] / (float) obj_limit));		
-		
-		// add this object to an existing object
-		//detections[obj_batch][(existing - (obj_batch * obj_limit))].AddObject(detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))]);
-		detections[obj_batch][(existing - (obj_batch * obj_limit))].AddObject(detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))],temp_sparse_reps_grid,temp_sparse_reps_strings,temp_mom0,temp_RAPV,temp_DECPV,temp_ref_spec,temp_obj_spec,temp_vfield);
-		
-		// flag the `object' values within the bounding box to merge it with the base object
-		sx_start = detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))].GetRAmin() - chunk_x_start;
-		if(sx_start < 0){ sx_start = 0; }
-		sy_start = detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))].GetDECmin() - chunk_y_start;
-		if(sy_start < 0){ sy_start = 0; }
-		sz_start = detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))].GetFREQmin() - chunk_z_start;
-		if(sz_start < 0){ sz_start = 0; }
-		for(sz = sz_start; (sz <= detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))].GetFREQmax() - chunk_z_start) && (sz < size_z); ++sz){
-		  
-		  for(sy = sy_start; (sy <= detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))].GetDECmax() - chunk_y_start) && (sy < size_y); ++sy){
-		    
-		    for(sx = sx_start; (sx <= detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))].GetRAmax() - chunk_x_start) && (sx < size_x); ++sx){
-		      
-		      if(flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] == match_init[i]){ flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] = existing; }
-		      
-		      // for(sx = x_start[(match_init[i] - (obj_batch_2 * obj_limit))]; sx <= x_finish[(match_init[i] - (obj_batch_2 * obj_limit))]; ++sx)
-		    }
-		    
-		    // for(sy = y_start[(match_init[i] - (obj_batch_2 * obj_limit))]; sy <= y_finish[(match_init[i] - (obj_batch_2 * obj_limit))]; ++sy)
-		  }
-		  
-		  // for(sz = z_start[(match_init[i] - (obj_batch_2 * obj_limit))]; sz <= z_finish[(match_init[i] - (obj_batch_2 * obj_limit))]; ++sz)
-		}
-		
-		// re-initialise the `object' values for the match_init[i] object that has just been merged into the existing object, 
-		// and push the obj value (match_init[i]) to the top of the array of values
-		detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))].ReInit();
-		if((detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))].Get_srep_update() != 0) && (detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))].Get_srep_size(0) >= 0)){
-		  
-		  detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))].ReInit_srep();
-		  detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))].ReInit_mini();
-
-		}
-		detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))].ReInit_size();
-		detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))].Set_srep_update(0);
-
-		j = -1;
-		for(g = 0; g < NO_obj_ids; ++g){ if(obj_ids[g] == match_init[i]){ j = 1; break; } }
-		if(j == -1){
-		  
-		  ++NO_obj_ids;
-		  obj_ids.push_back(match_init[i]);
-		  		  
-		}
-		
-		// for(i = 0; i < NOi; ++i)
-	      }
-	      
-	      // if(NOi > 1)
-	    }
-	    
-	    // else . . . if(existing == -1)
-	  }
-	  
-	  // if(flag_vals[((z*size_x*size_y) + (y*size_x) + x)] == -1)
-	}
-	
-	// update progress on display
-	while(progress <= (((float) ((z * size_x * size_y) + (y * size_x) + x + 1)) / ((float) (size_x * size_y * size_z)))){ std::cout << "*"; std::cout.flush(); progress+=0.05; }
-	
-	// for(x = 0; x < size_x; ++x)
-      }
-      
-      // for(y = 0; y < size_y; ++y)
-    }
-    
-    // for(z = 0; z < size_z; ++z)
-  }
-  std::cout << "* done." << std::endl;
-  
-  // 4. generate sparse representations of coherent objects that are retained after
-  // this `chunk' of the datacube is processed
-  std::cout << "Generating/updating sparse representations of sources . . . " << std::endl;
-  std::cout << "0 | |:| | : | |:| | 100% complete" << std::endl;
-  progress = 0.0;
-  for(i = 0; i < obj; ++i){
-    
-    // calculate the obj_batch value for this object
-    obj_batch = floorf(((float) i / (float) obj_limit));
-    
-    // move on if this object has been re-initialised
-    if(detections[obj_batch][(i - (obj_batch * obj_limit))].ShowVoxels() < 1){ 
-      
-      // update progress on display
-      while(progress <= (((float) (i + 1) / ((float) obj)))){ std::cout << "*"; std::cout.flush(); progress+=0.05; }  
-      continue; 
-      
-    }
-    
-    // move on if this object is not within the boundaries of the current chunk, in other words,
-    // move on if this object doesn't need to have it's sparse representation and postage stamp images updated
-    if((detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmax() < chunk_x_start) || (detections[obj_batch][(i - (obj_batch * obj_limit))].GetDECmax() < chunk_y_start) || (detections[obj_batch][(i - (obj_batch * obj_limit))].GetFREQmax() < chunk_z_start) || (detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmin() >= (chunk_x_start + size_x)) || (detections[obj_batch][(i - (obj_batch * obj_limit))].GetDECmin() >= (chunk_y_start + size_y)) || (detections[obj_batch][(i - (obj_batch * obj_limit))].GetFREQmin() >= (chunk_z_start + size_z))){ 
-
-      // update progress on display
-      while(progress <= (((float) (i + 1) / ((float) obj)))){ std::cout << "*"; std::cout.flush(); progress+=0.05; }  
-      continue; 
-      
-    }
-    
-    // move on if this object's sparse representation and postage stamp images don't need updating
-    if((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) >= 0) && (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_update() == -1)){
-      
-      // update progress on display
-      while(progress <= (((float) (i + 1) / ((float) obj)))){ std::cout << "*"; std::cout.flush(); progress+=0.05; }  
-      continue; 
-	
-    }
-          
-    // update the sparse representation for this object
-    
-    // 0. if there is no existing sparse representation and postage stamp images, create them from scratch, 
-    // otherwise concatenate the existing sparse representation and postage stamp images with the updates
-    if((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) < 0) && (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_update() >= 0)){
-      
-      // branch for creating a brand new sparse representation
-      
-      // update the sparse_reps_update array
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_update(-1);
-
-      // initialise the number of object sections that make up this object
-      NOi = 0;   
-      
-      // calculate the edge of the bounding box in `chunk' co-ordinates
-      sx_start = detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmin() - chunk_x_start;
-      if(sx_start < 0){ sx_start = 0; }
-      sx_finish = detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmax() - chunk_x_start;
-      sy_start = detections[obj_batch][(i - (obj_batch * obj_limit))].GetDECmin() - chunk_y_start;
-      if(sy_start < 0){ sy_start = 0; }
-      sy_finish = detections[obj_batch][(i - (obj_batch * obj_limit))].GetDECmax() - chunk_y_start;
-      sz_start = detections[obj_batch][(i - (obj_batch * obj_limit))].GetFREQmin() - chunk_z_start;
-      if(sz_start < 0){ sz_start = 0; }
-      sz_finish = detections[obj_batch][(i - (obj_batch * obj_limit))].GetFREQmax() - chunk_z_start;
-      
-      // count the number of object sections that make up this object
-      for(sy = sy_start; (sy <= sy_finish) && (sy < size_y); ++sy){
-	
-	for(sx = sx_start; (sx <= sx_finish) && (sx < size_x); ++sx){
-	  
-	  // initialise the dummy integer j
-	  j = -1;
-	  
-	  for(sz = sz_start; (sz <= sz_finish) && (sz < size_z); ++sz){
-	    
-	    // change j to reflect if this voxel in the flag_vals array belongs to the source
-	    if(flag_vals[((sz * data_metric[2]) + (sy * data_metric[1]) + (sx * data_metric[0]))] == i){ 
-	      
-	      // if previously this was not part of an object string, j == -1, then increment the number of object strings and
-	      // adjust the value of j
-	      if(j == -1){ ++NOi; }
-	      
-	      // change j to reflect that this voxel belongs to the object
-	      j = 1; 
-	      
-	    } else { j = -1; }
-	    
-	    // for(sz = detections[obj_batch][(obj - (obj_batch * obj_limit))].GetFREQmin() - chunk_z_size; sz <= (detections[obj_batch][(obj - (obj_batch * obj_limit))].GetFREQmax() - chunk_z_size); ++sz)
-	  }
-	  
-	  // for(sx = detections[obj_batch][(obj - (obj_batch * obj_limit))].GetRAmin() - chunk_x_size; sx <= (detections[obj_batch][(obj - (obj_batch * obj_limit))].GetRAmax() - chunk_x_size); ++sx)
-	}
-	
-	// for(sy = detections[obj_batch][(obj - (obj_batch * obj_limit))].GetDECmin() - chunk_y_size; sy <= (detections[obj_batch][(obj - (obj_batch * obj_limit))].GetDECmax() - chunk_y_size); ++sy)
-      }
-
-      // create an array element to store this sparse representation
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_size(0,detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmin());
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_size(1,detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmax());
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_size(2,detections[obj_batch][(i - (obj_batch * obj_limit))].GetDECmin());
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_size(3,detections[obj_batch][(i - (obj_batch * obj_limit))].GetDECmax());
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_size(4,detections[obj_batch][(i - (obj_batch * obj_limit))].GetFREQmin());
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_size(5,detections[obj_batch][(i - (obj_batch * obj_limit))].GetFREQmax());
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Create_srep_grid((((detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmax() - detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmin() + 1) * (detections[obj_batch][(i - (obj_batch * obj_limit))].GetDECmax() - detections[obj_batch][(i - (obj_batch * obj_limit))].GetDECmin() + 1)) + 1));
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Create_srep_strings((2 * NOi));
-      
-      // calculate the extent of the sparse_rep volume
-      sx_finish = detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmax() - detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmin() + 1;
-      sy_finish = detections[obj_batch][(i - (obj_batch * obj_limit))].GetDECmax() - detections[obj_batch][(i - (obj_batch * obj_limit))].GetDECmin() + 1;
-      sz_finish = detections[obj_batch][(i - (obj_batch * obj_limit))].GetFREQmax() - detections[obj_batch][(i - (obj_batch * obj_limit))].GetFREQmin() + 1;
-      
-      // create arrays to store the postage stamp images and initialise them
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Create_mom0((sx_finish * sy_finish));
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Create_RAPV((sx_finish * sz_finish));
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Create_DECPV((sy_finish * sz_finish));
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Create_ospec(sz_finish);
-      if(sz_finish >= 10){
-
-	detections[obj_batch][(i - (obj_batch * obj_limit))].Create_rspec((2 * sz_finish));
-
-      } else {
-
-	detections[obj_batch][(i - (obj_batch * obj_limit))].Create_rspec((10 + sz_finish));
-
-      }
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Create_vfield((sx_finish * sy_finish));
-      
-      // initialise the mini_mom0 values
-      for(sy = 0; sy < sy_finish; ++sy){
-	for(sx = 0; sx < sx_finish; ++sx){
-	  detections[obj_batch][(i - (obj_batch * obj_limit))].Set_mom0(((sy * sx_finish) + sx),0.0);
-	}
-      }
-
-      // initialise the mini_RAPV values
-      for(sz = 0; sz < sz_finish; ++sz){
-	for(sx = 0; sx < sx_finish; ++sx){
-	  detections[obj_batch][(i - (obj_batch * obj_limit))].Set_RAPV(((sz * sx_finish) + sx),0.0);
-	}
-      }
-      
-      // initialise the mini_DECPV values
-      for(sz = 0; sz < sz_finish; ++sz){
-	for(sy = 0; sy < sy_finish; ++sy){
-	  detections[obj_batch][(i - (obj_batch * obj_limit))].Set_DECPV(((sz * sy_finish) + sy),0.0);
-	}
-      }
-      
-      // initialise the mini_spec values
-      for(sz = 0; sz < sz_finish; ++sz){ detections[obj_batch][(i - (obj_batch * obj_limit))].Set_ospec(sz,0.0); }
-      if(sz_finish >= 10){
-
-	for(sz = 0; sz < (2 * sz_finish); ++sz){ detections[obj_batch][(i - (obj_batch * obj_limit))].Set_rspec(sz,0.0); }
-
-      } else {
-
-	for(sz = 0; sz < (10 + sz_finish); ++sz){ detections[obj_batch][(i - (obj_batch * obj_limit))].Set_rspec(sz,0.0); }
-
-      }
-            
-      // initialise the mini_vfield values
-      for(sy = 0; sy < sy_finish; ++sy){
-	for(sx = 0; sx < sx_finish; ++sx){
-	  detections[obj_batch][(i - (obj_batch * obj_limit))].Set_vfield(((sy * sx_finish) + sx),0.0);
-	}
-      }
-
-      // populate the sparse array representation and postage stamp images
-      NOi = 0;
-      for(sy = 0; sy < sy_finish; ++sy){
-	
-	for(sx = 0; sx < sx_finish; ++sx){
-	  
-	  // write the current number of object strings to the grid
-	  detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_grid(((sy * sx_finish) + sx),NOi);
-	  
-	  // initialise the dummy integer j 
-	  j = -1;
-	  
-	  for(sz = 0; sz < sz_finish; ++sz){
-	    
-	    // change j to reflect if this voxel in the flag_vals array belongs to the source
-	    if(flag_vals[(((sz + sz_start) * data_metric[2]) + ((sy + sy_start) * data_metric[1]) + ((sx + sx_start) * data_metric[0]))] == i){ 
-	      
-	      // update mini_mom0
-	      detections[obj_batch][(i - (obj_batch * obj_limit))].Add_mom0(((sy * sx_finish) + sx),data_vals[(((sz + sz_start) * data_metric[2]) + ((sy + sy_start) * data_metric[1]) + ((sx + sx_start) * data_metric[0]))]);
-	      
-	      // update mini_RAPV
-	      detections[obj_batch][(i - (obj_batch * obj_limit))].Add_RAPV(((sz * sx_finish) + sx),data_vals[(((sz + sz_start) * data_metric[2]) + ((sy + sy_start) * data_metric[1]) + ((sx + sx_start) * data_metric[0]))]);
-	      
-	      // update mini_DECPV
-	      detections[obj_batch][(i - (obj_batch * obj_limit))].Add_DECPV(((sz * sy_finish) + sy),data_vals[(((sz + sz_start) * data_metric[2]) + ((sy + sy_start) * data_metric[1]) + ((sx + sx_start) * data_metric[0]))]);
-	      
-	      // update mini_obj_spec
-	      detections[obj_batch][(i - (obj_batch * obj_limit))].Add_ospec(sz,data_vals[(((sz + sz_start) * data_metric[2]) + ((sy + sy_start) * data_metric[1]) + ((sx + sx_start) * data_metric[0]))]);
-  
-	      // update mini_vfield
-	      detections[obj_batch][(i - (obj_batch * obj_limit))].Add_vfield(((sy * sx_finish) + sx),(((float) (sz + sz_start + chunk_z_start)) * data_vals[(((sz + sz_start) * data_metric[2]) + ((sy + sy_start) * data_metric[1]) + ((sx + sx_start) * data_metric[0]))]));
-	      
-	      // if previously this was not part of an object string, j == -1, then increment the number of object strings and
-	      // write the position to the sparse_reps array
-	      if(j == -1){ 
-		
-		// write the beginning of the object string to sparse_reps
-		detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_strings((2 * NOi),(sz_start + chunk_z_start + sz));
-		
-		// increment NOi
-		++NOi; 
-		
-		// initialise the end of the object string in sparse_reps
-		detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_strings(((2 * NOi) - 1),(sz_start + chunk_z_start + sz));
-
-	      } else {
-		
-		// update the end of the object string in sparse_reps
-		detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_strings(((2 * NOi) - 1),(sz_start + chunk_z_start + sz));
-		
-	      }
-	      
-	      // change j to reflect that this voxel belongs to the object
-	      j = 1; 
-	      
-	    } else { 
-	      
-	      // change j to reflect that this voxel doesn't belong to the object
-	      j = -1; 
-	      
-	    }
-	    
-	    // for(sz = detections[obj_batch][(obj - (obj_batch * obj_limit))].GetFREmin() - chunk_z_start + 1; sz <= (detections[obj_batch][(obj - (obj_batch * obj_limit))].GetFREQmax() - chunk_z_start + 1); ++sz)
-	  }
-	  
-	  // for(sx = detections[obj_batch][(obj - (obj_batch * obj_limit))].GetRAmin() - chunk_x_start + 1; sx <= (detections[obj_batch][(obj - (obj_batch * obj_limit))].GetRAmax() - chunk_x_start + 1); ++sx)
-	}
-	
-	//for(sy = detections[obj_batch][(obj - (obj_batch * obj_limit))].GetDECmin() - chunk_y_start + 1; sy <= (detections[obj_batch][(obj - (obj_batch * obj_limit))].GetDECmax() - chunk_y_start + 1); ++sy)
-      }
-            
-      // update sparse_reps with the final value of NOi
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_grid((sx_finish * sy_finish),NOi);
-            
-      // create the reference spectrum
-      if(sz_finish >= 10){
-	
-	for(sz = -1 * (int) floorf((0.5 * (float) sz_finish)); sz < (sz_finish + ((int) floorf((0.5 * (float) sz_finish)))); ++sz){
-	  
-	  for(sy = 0; sy < sy_finish; ++sy){
-	  
-	    for(sx = 0; sx < sx_finish; ++sx){
-	    
-	      if(((sz + sz_start) >= 0) && ((sz + sz_start) < size_z)){
-		
-		// update mini_ref_spec	
-		detections[obj_batch][(i - (obj_batch * obj_limit))].Add_rspec((sz + ((int) floorf((0.5 * (float) sz_finish)))),data_vals[(((sz + sz_start) * data_metric[2]) + ((sy + sy_start) * data_metric[1]) + ((sx + sx_start) * data_metric[0]))]);	
-		
-	      }
-	      
-	    }
-	    
-	  }
-      
-	}
-
-	// if(sz_finish >= 10)
-      } else {
-
-	for(sz = -5; sz < (sz_finish + 5); ++sz){
-	  
-	  for(sy = 0; sy < sy_finish; ++sy){
-	  
-	    for(sx = 0; sx < sx_finish; ++sx){
-	    
-	      if(((sz + sz_start) >= 0) && ((sz + sz_start) < size_z)){
-		
-		// update mini_ref_spec
-		detections[obj_batch][(i - (obj_batch * obj_limit))].Add_rspec((sz + 5),data_vals[(((sz + sz_start) * data_metric[2]) + ((sy + sy_start) * data_metric[1]) + ((sx + sx_start) * data_metric[0]))]);	
-		
-	      }
-	      
-	    }
-	    
-	  }
-      
-	}
-
-	// else . . . if(sz_finish >= 10)
-      }
-      
-     // if(sparse_reps[obj_batch][(obj - (obj_batch * obj_limit))][0] < 0) . . . else
-    } else {
-            
-      // branch for updating an existing sparse representation
-      
-      // count the number of object strings comprising the object
-      
-      // 1. initialise the number of object strings
-      NOi = 0;
-      
-      // 2. convert the new bounding box of the object into `chunk' co-ordinates
-      sx_start = detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmin() - chunk_x_start;
-      sx_finish = detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmax() - chunk_x_start;
-      sy_start = detections[obj_batch][(i - (obj_batch * obj_limit))].GetDECmin() - chunk_y_start;
-      sy_finish = detections[obj_batch][(i - (obj_batch * obj_limit))].GetDECmax() - chunk_y_start;
-      sz_start = detections[obj_batch][(i - (obj_batch * obj_limit))].GetFREQmin() - chunk_z_start;
-      if(sz_start < 0){ sz_start = 0; }
-      sz_finish = detections[obj_batch][(i - (obj_batch * obj_limit))].GetFREQmax() - chunk_z_start;
-      
-      // 3. search through the bounding box, and do one of the following
-      // 3.a if inside the chunk and outside the existing sparse rep grid, run the routine to count the number
-      //     of object strings along the current line of sight
-      // 3.b otherwise use the grid value to increment NOi
-      for(sy = sy_start; sy <= sy_finish; ++sy){
-	
-	for(sx = sx_start; sx <= sx_finish; ++sx){
-	  	  
-	  // case 3.a triggered
-	  if(((sx > merge_x) || (chunk_x_start == 0)) && ((sy > merge_y) || (chunk_y_start == 0))){
-	    	    
-	    // initialise the dummy integer j 
-	    j = -1;
-	    
-	    for(sz = sz_start; sz <= sz_finish; ++sz){
-	      
-	      // change i to reflect if this voxel in the flag_vals array belongs to the source
-	      if(flag_vals[((sz * data_metric[2]) + (sy * data_metric[1]) + (sx * data_metric[0]))] == i){ 
-		
-		// if previously this was not part of an object string, i == -1, then increment the number of object strings and
-		// write the position to the sparse_reps array
-		if(j == -1){ 
-		  
-		  // increment NOi
-		  ++NOi; 
-		  
-		} 
-		
-		// change j to reflect that this voxel belongs to the object
-		j = 1; 
-		
-	      } else { j = -1; }
-	      
-	      // for(sz = sz_start; sz <= sz_finish; ++sz)
-	    }
-	    
-	  } else {
-	    
-	    // case 3.b triggered  
-	    NOi+=(detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_grid((((sy + chunk_y_start - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2)) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) + sx + chunk_x_start - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_grid((((sy + chunk_y_start - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2)) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) + sx + chunk_x_start - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0))));
-	    
-	  }     
-	  
-	  // for(sx = sx_start; sx <= sx_finish; ++sx)
-	}
-	
-	// for(sy = sy_start; sy <= sy_finish; ++sy)
-      }
-      
-      // 4. allocate memory to store temporary sparse representation and postage stamp images, then
-      //    initialise the postage stamp image arrays
-      temp_mom0.resize(0);
-      for(sy = 0; sy < (sy_finish - sy_start + 1); ++sy){
-	for(sx = 0; sx < (sx_finish - sx_start + 1); ++sx){
-	  temp_mom0.push_back(0.0);
-	}
-      }
-      temp_RAPV.resize(0);
-      for(sz = 0; sz < (sz_finish - sz_start + 1); ++sz){
-	for(sx = 0; sx < (sx_finish - sx_start + 1); ++sx){
-	  temp_RAPV.push_back(0.0);
-	}
-      }
-      temp_DECPV.resize(0);
-      for(sz = 0; sz < (sz_finish - sz_start + 1); ++sz){
-	for(sy = 0; sy < (sy_finish - sy_start + 1); ++sy){
-	  temp_DECPV.push_back(0.0);
-	}
-      }
-      temp_obj_spec.resize(0);
-      for(sz = 0; sz < (sz_finish - sz_start + 1); ++sz){ temp_obj_spec.push_back(0.0); }
-      if((sz_finish - sz_start + 1) >= 10){
-
-	temp_ref_spec.resize(0);
-	for(sz = 0; sz < (2 * (sz_finish - sz_start + 1)); ++sz){ temp_ref_spec.push_back(0.0); }
-
-      } else {
-
-	temp_ref_spec.resize(0);
-	for(sz = 0; sz < (sz_finish - sz_start + 11); ++sz){ temp_ref_spec.push_back(0.0); }
-
-      }
-      temp_vfield.resize(0);
-      for(sy = 0; sy < (sy_finish - sy_start + 1); ++sy){
-	for(sx = 0; sx < (sx_finish - sx_start + 1); ++sx){
-	  temp_vfield.push_back(0.0);
-	}
-      }
-     
-      // 5. populate temp_sparse_rep arrays
-      // 5.a if inside the chunk and outside the existing sparse rep grid, run the routine to count the number
-      //     of object strings along the current line of sight, populate new strings array and add values to new 
-      //     postage stamp images
-      // 5.b if outside of the chunk, use the grid value to increment NOi, populate strings array from previous version and 
-      //     fill in valuese for postage stamp images
-
-      // initialise number of object strings
-      NOi = 0;
-      
-      // initialise RA PV image
-      for(sz = 0; sz < (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1); ++sz){
-
-	for(sx = 0; sx < (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1); ++sx){
-	
-	  temp_RAPV[(((sz + detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) - sz_start - chunk_z_start) * (sx_finish - sx_start + 1)) + sx + detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) - sx_start - chunk_x_start)]+=detections[obj_batch][(i - (obj_batch * obj_limit))].Get_RAPV(((sz * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) + sx));
-	  
-	}
-
-      }
-
-      // initialise Dec PV image
-      for(sz = 0; sz < (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1); ++sz){
-
-	for(sy = 0; sy < (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2) + 1); ++sy){
-	
-	  temp_DECPV[(((sz + detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) - sz_start - chunk_z_start) * (sy_finish - sy_start + 1)) + sy + detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2) - sy_start - chunk_y_start)]+=detections[obj_batch][(i - (obj_batch * obj_limit))].Get_DECPV(((sz * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2) + 1)) + sy));
-	  
-	}
-
-      }
-
-      // initialise mini spec's
-      for(sz = 0; sz < (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1); ++sz){ temp_obj_spec[(sz + detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) - sz_start - chunk_z_start)]+=detections[obj_batch][(i - (obj_batch * obj_limit))].Get_ospec(sz); }
-
-      if((sz_finish - sz_start + 1) >= 10){
-
-	j = sz_start + chunk_z_start - ((int) floorf((0.5 * (float) (sz_finish - sz_start + 1))));
-
-	if((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1) >= 10){
-
-	  k = detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) - ((int) floorf((0.5 * (float) (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1))));
-
-	  for(sz = 0; sz < (2 * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1)); ++sz){
-
-	    temp_ref_spec[(sz + k - j)]+=detections[obj_batch][(i - (obj_batch * obj_limit))].Get_rspec(sz);
-
-	  }
-
-	} else {
-	  
-	  k = detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) - 5;
-
-	  for(sz = 0; sz < (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 11); ++sz){
-	    
-	    temp_ref_spec[(sz + k - j)]+=detections[obj_batch][(i - (obj_batch * obj_limit))].Get_rspec(sz);
-
-	  }
-	  
-	}
-
-      } else {
-
-	j = sz_start + chunk_z_start - 5;
-
-	if((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1) >= 10){
-
-	  k = detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) - ((int) floorf((0.5 * (float) (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1))));
-
-	  for(sz = 0; sz < (2 * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1)); ++sz){
-
-	    temp_ref_spec[(sz + k - j)]+=detections[obj_batch][(i - (obj_batch * obj_limit))].Get_rspec(sz);
-
-	  }
-
-	} else {
-	  
-	  k = detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) - 5;
-
-	  for(sz = 0; sz < (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 11); ++sz){
-	    
-	    temp_ref_spec[(sz + k - j)]+=detections[obj_batch][(i - (obj_batch * obj_limit))].Get_rspec(sz);
-
-	  }
-	  
-	}
-
-      }
-      
-      // search through LoS's of updated bounding box and take action as dictated by case 5.a or 5.b
-      for(sy = sy_start; sy <= sy_finish; ++sy){
-	
-	for(sx = sx_start; sx <= sx_finish; ++sx){
-	  	  
-	  // add value to temp_sparse_rep_grid
-	  temp_sparse_reps_grid[(((sy - sy_start) * (sx_finish - sx_start + 1)) + sx - sx_start)] = NOi;
-	  
-	  // case 5.a triggered for moment-0 image and sparse representation
-	  if(((sx > merge_x) || (chunk_x_start == 0)) && ((sy > merge_y) || (chunk_y_start == 0))){
-	    
-	    // initialise the dummy integer j 
-	    j = -1;
-	    
-	    for(sz = sz_start; sz <= sz_finish; ++sz){
-	      
-	      // change j to reflect if this voxel in the flag_vals array belongs to the source
-	      if(flag_vals[((sz * data_metric[2]) + (sy * data_metric[1]) + (sx * data_metric[0]))] == i){ 
-		
-		// update mini_mom0
-		temp_mom0[(((sy - sy_start) * (sx_finish - sx_start + 1)) + sx - sx_start)]+=data_vals[((sz * data_metric[2]) + (sy * data_metric[1]) + (sx * data_metric[0]))];
-		
-		// update mini_RAPV
-		temp_RAPV[(((sz - sz_start) * (sx_finish - sx_start + 1)) + sx - sx_start)]+=data_vals[((sz * data_metric[2]) + (sy * data_metric[1]) + (sx * data_metric[0]))];
-		
-		// update mini_DECPV
-		temp_DECPV[(((sz - sz_start) * (sy_finish - sy_start + 1)) + sy - sy_start)]+=data_vals[((sz * data_metric[2]) + (sy * data_metric[1]) + (sx * data_metric[0]))];
-		
-		// update mini_obj_spec
-		temp_obj_spec[(sz - sz_start)]+=data_vals[((sz * data_metric[2]) + (sy * data_metric[1]) + (sx * data_metric[0]))];
-		
-		// update mini_vfield
-		temp_vfield[(((sy - sy_start) * (sx_finish - sx_start + 1)) + sx - sx_start)]+=(((float) (sz + chunk_z_start)) * data_vals[((sz * data_metric[2]) + (sy * data_metric[1]) + (sx * data_metric[0]))]);
-		
-		// if previously this was not part of an object string, j == -1, then increment the number of object strings and
-		// write the position to the sparse_reps array
-		if(j == -1){ 
-		  
-		  // write the beginning of the object string to sparse_reps
-		  temp_sparse_reps_strings[(2 * NOi)] = chunk_z_start + sz;
-		  
-		  // increment NOi
-		  ++NOi; 
-		  		  
-		  // initialise the end of the object string in sparse_reps
-		  temp_sparse_reps_strings[((2 * NOi) - 1)] = chunk_z_start + sz;
-		  
-		} else {
-		  
-		  // update the end of the object string in sparse_reps
-		  temp_sparse_reps_strings[((2 * NOi) - 1)] = chunk_z_start + sz;
-		  
-		}
-		
-		// change j to reflect that this voxel belongs to the object
-		j = 1; 
-		
-	      } else { 
-		
-		// change j to reflect that this voxel doesn't belong to the object
-		j = -1; 
-		
-	      }
-	      
-	      // for(sz = sz_start; sz <= sz_finish; ++sz)
-	    }
-	    
-	    // add values to temp_ref_spec
-	    if((sz_finish - sz_start + 1) >= 10){
-	      
-	      k = (int) floorf((0.5 * (float) (sz_finish - sz_start + 1)));
-	      
-	      for(sz = 0; sz < (2 * (sz_finish - sz_start + 1)); ++sz){
-	  	
-		if(((sz + sz_start - k) >= 0) && ((sz + sz_start - k) < size_z)){
-		  
-		  // update mini_ref_spec
-		  temp_ref_spec[(sz + sz_start - k)]+=data_vals[(((sz + sz_start - k) * data_metric[2]) + (sy * data_metric[1]) + (sx * data_metric[0]))];	
-		  
-		}
-		
-	      }
-	      
-	      // if(sz_finish >= 10)
-	    } else {
-	      
-	      for(sz = 0; sz < (sz_finish - sz_start + 11); ++sz){
-		
-		if(((sz + sz_start - 5) >= 0) && ((sz + sz_start - 5) < size_z)){
-		  
-		  // update mini_ref_spec
-		  temp_ref_spec[(sz + sz_start - 5)]+=data_vals[(((sz + sz_start - 5) * data_metric[2]) + (sy * data_metric[1]) + (sx * data_metric[0]))];	
-		  
-		}
-		
-	      }
-	      
-	      // else . . . if(sz_finish >= 10)
-	    }
-	    
-	  } else {
-	    // case 5.b triggered  
-	    	    
-	    // update temp_sparse_rep_strings
-	    j = 0;
-	    if(((sx + chunk_x_start) >= detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0)) && ((sx + chunk_x_start) <= (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) + 1)) && ((sy + chunk_y_start) >= detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2)) && ((sy + chunk_y_start) <= (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(3) + 1))){
-	      
-	      for(g = detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_grid((((sy + chunk_y_start - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2)) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) + sx + chunk_x_start - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0))); g < detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_grid((((sy + chunk_y_start - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2)) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) + sx + chunk_x_start - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1)); ++g){
-		
-		temp_sparse_reps_strings[(NOi + j)] = detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_strings((2 * g));
-		temp_sparse_reps_strings[(NOi + j + 1)] = detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_strings(((2 * g) + 1));
-		++j;
-		
-	      }
-	      
-	      // update moment 0 postage stamp image
-	      temp_mom0[(((sy - sy_start) * (detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmax() - detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmin() + 1)) + sx - sx_start)] = detections[obj_batch][(i - (obj_batch * obj_limit))].Get_mom0((((sy + chunk_y_start - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2)) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) + sx + chunk_x_start - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0)));
-	      
-	      // update vfield postage stamp image
-	      temp_vfield[(((sy - sy_start) * (detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmax() - detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmin() + 1)) + sx - sx_start)] = detections[obj_batch][(i - (obj_batch * obj_limit))].Get_vfield((((sy + chunk_y_start - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2)) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) + sx + chunk_x_start - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0)));
-
-	      // update NOi
-	      NOi+=(detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_grid((((sy + chunk_y_start - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2)) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) + sx + chunk_x_start - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_grid((((sy + chunk_y_start - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2)) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) + sx + chunk_x_start - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0))));
-	      	      
-	    }
-	    
-	    // else . . . case 5.b
-	  }
-	    
-	  // for(sx = sx_start; sx <= sx_finish; ++sx)
-	}
-		
-	// for(sy = sy_start; sy <= sy_finish; ++sy)
-      }
-            
-      temp_sparse_reps_grid[((sx_finish - sx_start + 1) * (sy_finish - sy_start + 1))] = NOi;
-
-      // 6. replace the current sparse representation with the new sparse representation
-      detections[obj_batch][(i - (obj_batch * obj_limit))].ReInit_srep();
-      detections[obj_batch][(i - (obj_batch * obj_limit))].ReInit_mini();
- 
-      // update the sparse_reps_size array with the new bounding box
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_size(0,detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmin());
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_size(1,detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmax());
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_size(2,detections[obj_batch][(i - (obj_batch * obj_limit))].GetDECmin());
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_size(3,detections[obj_batch][(i - (obj_batch * obj_limit))].GetDECmax());
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_size(4,detections[obj_batch][(i - (obj_batch * obj_limit))].GetFREQmin());
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_size(5,detections[obj_batch][(i - (obj_batch * obj_limit))].GetFREQmax());
-
-      // update the sparse_reps_update array
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_update(-1);
-          
-      // populate the new sparse_reps and postage stamps
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Create_srep_grid((1 + ((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2) + 1))));
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Create_srep_strings((2 * NOi));
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Create_mom0(((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2) + 1)));
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Create_RAPV(((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1)));
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Create_DECPV(((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2) + 1) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1)));
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Create_vfield(((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2) + 1)));
-  
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Create_ospec((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1));
-      if((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1) >= 10){
-       
-	detections[obj_batch][(i - (obj_batch * obj_limit))].Create_rspec((2 * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1)));
-	
-      } else {
-	
-	detections[obj_batch][(i - (obj_batch * obj_limit))].Create_rspec((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 11));
-
-      }
-   
-      for(j = 0; j < (1 + ((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2) + 1))); ++j){ detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_grid(j,temp_sparse_reps_grid[j]); }
-      for(j = 0; j < (2 * NOi); ++j){ detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_strings(j,temp_sparse_reps_strings[j]); }
-      for(j = 0; j < ((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2) + 1)); ++j){ detections[obj_batch][(i - (obj_batch * obj_limit))].Set_mom0(j,temp_mom0[j]); }
-      for(j = 0; j < ((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1)); ++j){ detections[obj_batch][(i - (obj_batch * obj_limit))].Set_RAPV(j,temp_RAPV[j]); }
-      for(j = 0; j < ((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2) + 1) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1)); ++j){ detections[obj_batch][(i - (obj_batch * obj_limit))].Set_DECPV(j,temp_DECPV[j]); }
-      for(j = 0; j < ((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2) + 1)); ++j){ detections[obj_batch][(i - (obj_batch * obj_limit))].Set_vfield(j,temp_vfield[j]); }
-
-      for(j = 0; j < (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1); ++j){ detections[obj_batch][(i - (obj_batch * obj_limit))].Set_ospec(j,temp_obj_spec[j]); }
-      if((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1) >= 10){
-
-	for(j = 0; j < (2 * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1)); ++j){ detections[obj_batch][(i - (obj_batch * obj_limit))].Set_rspec(j,temp_ref_spec[j]); }
-	
-      } else {
-
-	for(j = 0; j < (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 11); ++j){ detections[obj_batch][(i - (obj_batch * obj_limit))].Set_rspec(j,temp_ref_spec[j]); }
-
-      }
-      
-      // else . . . if(sparse_reps[obj_batch][(obj - (obj_batch * obj_limit))][0] < 0)
-    }
-    
-    // update progress on display
-    while(progress <= (((float) (i + 1) / ((float) obj)))){ std::cout << "*"; std::cout.flush(); progress+=0.05; }  
-   
-    // for(i = 0; i < obj; ++i)
-  }
-  std::cout << "* done." << std::endl;
-    
-  // 5. return the number of coherent objects 
-  return obj;
-  
-}
-
-long int CreateObjects(float * data_vals, long int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, float intens_thresh_min, float intens_thresh_max, long int flag_value, long int start_obj, vector<object_props *> & detections, vector<long int> & obj_ids, vector<long int> & check_obj_ids, int obj_limit, int max_x_val, int max_y_val, int max_z_val, int ss_mode, int * data_metric, int * xyz_order){
- 
-  long int o,obj,existing,obj_batch,obj_batch_2;
-  int x,y,z,sx,sy,sz,sx_start,sy_start,sz_start,sx_finish,sy_finish,sz_finish;
-  int g,i,j,k,NO_obj_ids,NO_check_obj_ids,NOi;
-  int init_limit,prev,x_start,y_start,temp_x[3],temp_y[3],temp_z[3];
-  float progress;
-  vector<float> temp_mom0, temp_RAPV, temp_DECPV, temp_obj_spec, temp_ref_spec, temp_vfield;
-  vector<long int> match_init;
-  vector<int> temp_sparse_reps_grid, temp_sparse_reps_strings;
-
-  // convert the merging lengths from distances (in pixels/voxels) to empty space between linked detections (in pixels/voxels) --- subtract 1 --- this is a more naturual
-  // definition when processing a large file in chunks, because it makes it easier to build up sources that need to be retained for the rest of the input file
-  --merge_x;
-  --merge_y;
-  --merge_z;
-
-  // reorder the datacube and subcube limits to be in x,y,z order
-  temp_x[0] = chunk_x_start;
-  temp_y[0] = chunk_y_start;
-  temp_z[0] = chunk_z_start;
-  temp_x[1] = size_x;
-  temp_y[1] = size_y;
-  temp_z[1] = size_z;
-  temp_x[2] = max_x_val;
-  temp_y[2] = max_y_val;
-  temp_z[2] = max_z_val;
-  switch(xyz_order[0]){
-  case 1:
-    chunk_x_start = temp_x[0];
-    size_x = temp_x[1];
-    max_x_val = temp_x[2];
-    break;
-  case 2:
-    chunk_x_start = temp_y[0];
-    size_x = temp_y[1];
-    max_x_val = temp_y[2];
-    break;
-  case 3:
-    chunk_x_start = temp_z[0];
-    size_x = temp_z[1];
-    max_x_val = temp_z[2];
-    break;
-  default:
-    chunk_x_start = temp_x[0];
-    size_x = temp_x[1];
-    max_x_val = temp_x[2];
-    break;
-  }
-  switch(xyz_order[1]){
-  case 1:
-    chunk_y_start = temp_x[0];
-    size_y = temp_x[1];
-    max_y_val = temp_x[2];
-    break;
-  case 2:
-    chunk_y_start = temp_y[0];
-    size_y = temp_y[1];
-    max_y_val = temp_y[2];
-    break;
-  case 3:
-    chunk_y_start = temp_z[0];
-    size_y = temp_z[1];
-    max_y_val = temp_z[2];
-    break;
-  default:
-    chunk_y_start = temp_y[0];
-    size_y = temp_y[1];
-    max_y_val = temp_y[2];
-    break;
-  }
-  switch(xyz_order[2]){
-  case 1:
-    chunk_z_start = temp_x[0];
-    size_z = temp_x[1];
-    max_z_val = temp_x[2];
-    break;
-  case 2:
-    chunk_z_start = temp_y[0];
-    size_z = temp_y[1];
-    max_z_val = temp_y[2];
-    break;
-  case 3:
-    chunk_z_start = temp_z[0];
-    size_z = temp_z[1];
-    max_z_val = temp_z[2];
-    break;
-  default:
-    chunk_z_start = temp_z[0];
-    size_z = temp_z[1];
-    max_z_val = temp_z[2];
-    break;
-  }
-
-  // create temporary arrays
-  if(10000 > (((2 * merge_x) + 3) * ((2 * merge_y) + 3) * ((2 * merge_z) + 3))){
-    
-    init_limit = 10000;
-    
-  } else {
-    
-    init_limit = ((2 * merge_x) + 3) * ((2 * merge_y) + 3) * ((2 * merge_z) + 3) + 10;
-    
-  }
-  match_init.reserve(init_limit);
-  match_init.resize(0);
-
-  temp_sparse_reps_grid.reserve(1000000);
-  temp_sparse_reps_grid.resize(0);
-  temp_sparse_reps_strings.reserve(1000000);
-  temp_sparse_reps_strings.resize(0);
-  temp_mom0.reserve(1000000);
-  temp_mom0.resize(0);
-  temp_RAPV.reserve(1000000);
-  temp_RAPV.resize(0);
-  temp_DECPV.reserve(1000000);
-  temp_DECPV.resize(0);
-  temp_obj_spec.reserve(1000000);
-  temp_obj_spec.resize(0);
-  temp_ref_spec.reserve(1000000);
-  temp_ref_spec.resize(0);
-  temp_vfield.reserve(1000000);
-  temp_vfield.resize(0);
- 
-  // 0. initialise variables and arrays
-  obj = start_obj;
-  x_start = 0;
-  y_start = 0;
-  if(chunk_x_start > 0){ x_start = merge_x + 1; }
-  if(chunk_y_start > 0){ y_start = merge_y + 1; }
-  NO_obj_ids = obj_ids.size();
-  NO_check_obj_ids = check_obj_ids.size();
-
-  // 1. Create list of `coherent' objects from neighbouring voxels
-  
-  // for each grid point, check if it has been flagged as a source voxel, and assign
-  // it an object ID if it is. If a neighbouring voxel has already been flagged, assign 
-  // that ID to the grid point, otherwise, assign current value of obj and increment obj.
-  std::cout << "0 | |:| | : | |:| | 100% complete" << std::endl;
-  progress = 0.0;
-  for(z = 0; ((z < size_z) && ((z + chunk_z_start) < max_z_val)); ++z){
-
-    // if the z value is sufficiently large that objects have started to pop out of the merging box,
-    // then check if the objects outside of the merging box are sufficiently large
-    if(z > (merge_z + 1)){
-      
-      // initialise NOi to store the number of current check_obj_ids values that haven't moved outside of 
-      // the merging volume, and that form the basis for the new check_obj_ids list
-      NOi = 0;
-      
-      // apply size threshold to objects added since last size thresholding
-      for(i = 0; i < NO_check_obj_ids; ++i){
-	
-	// calculate the obj_batch value for the existing object
-	obj_batch = (long int) floor(((double) check_obj_ids[i] / (double) obj_limit));
-	
-	// move to the next object if this one has been re-initialised
-	if(detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].ShowVoxels() < 1){ continue; }
-	
-	// check if this object has moved outside of the merging box available to the next plane, if it 
-	// has apply a size threshold, otherwise use it to seed the new list of objects to be size thresholded
-	// the next time
-	if(detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetFREQmax() < (chunk_z_start + z - merge_z - 1)){
-	  
-	  // apply the size threshold, and if it fails re-initialise the object and pop its id to the list
-	  // of available obj_ids
-	  if((((detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetRAmax() - detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetRAmin() + 1) < min_x_size) || ((detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetDECmax() - detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetDECmin() + 1) < min_y_size) || ((detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetFREQmax() - detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetFREQmin() + 1) < min_z_size) || (detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].ShowVoxels() < min_v_size)) && (((detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetRAmin() - chunk_x_start) > merge_x) || (chunk_x_start == 0)) && ((((chunk_x_start + size_x - 1 - detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetRAmax()) > merge_x) || ((chunk_x_start + size_x) >= max_x_val)) && (((detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetDECmin() - chunk_y_start) > merge_y) || (chunk_y_start == 0)) && (((chunk_y_start + size_y - 1 - detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetDECmax()) > merge_y) || ((chunk_y_start + size_y) >= max_y_val)) && (((detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetFREQmin() - chunk_z_start) > merge_z) || (chunk_z_start == 0)) && (((chunk_z_start + size_z - 1 - detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetFREQmax()) > merge_z) || ((chunk_z_start + size_z) >= max_z_val)))){
-	    
-	    // re-initialise object
-	    detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].ReInit();
-	    if((detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].Get_srep_update() != 0) && (detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].Get_srep_size(0) >= 0)){
-	      
-	      detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].ReInit_srep();
-	      detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].ReInit_mini();
-
-	    }
-	    detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].ReInit_size();
-	    detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].Set_srep_update(0);
-
-	    // flag the `object' values within the bounding box and remove it from the flag_vals array
-	    sx_start = detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetRAmin() - chunk_x_start;
-	    if(sx_start < 0){ sx_start = 0; }
-	    sy_start = detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetDECmin() - chunk_y_start;
-	    if(sy_start < 0){ sy_start = 0; }
-	    sz_start = detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetFREQmin() - chunk_z_start;
-	    if(sz_start < 0){ sz_start = 0; }
-	    for(sz = sz_start; ((sz <= (detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetFREQmax() - chunk_z_start)) && (sz < size_z)); ++sz){
-	      
-	      for(sy = sy_start; ((sy <= (detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetDECmax() - chunk_y_start)) && (sy < size_y)); ++sy){
-		
-		for(sx = sx_start; ((sx <= (detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetRAmax() - chunk_x_start)) && (sx < size_x)); ++sx){
-		  
-		  if(flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx * data_metric[0]))] == check_obj_ids[i]){ flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx * data_metric[0]))] = -99; }
-		  
-		  // for(sx = x_start[(match_init[i] - (obj_batch_2 * obj_limit))]; sx <= x_finish[(match_init[i] - (obj_batch_2 * obj_limit))]; ++sx)
-		}
-		
-		// for(sy = y_start[(match_init[i] - (obj_batch_2 * obj_limit))]; sy <= y_finish[(match_init[i] - (obj_batch_2 * obj_limit))]; ++sy)
-	      }
-	      
-	      // for(sz = z_start[(match_init[i] - (obj_batch_2 * obj_limit))]; sz <= z_finish[(match_init[i] - (obj_batch_2 * obj_limit))]; ++sz)
-	    }
-	    
-	    // add object id to list of available ids
-	    j = -1;
-	    for(g = 0; g < NO_obj_ids; ++g){ if(obj_ids[g] == check_obj_ids[i]){ j = 1; break; } }
-	    if(j == -1){
-	      ++NO_obj_ids;
-	      obj_ids.push_back(check_obj_ids[i]);
-	    }
-
-	  }
-	  
-	  // if(z_finish[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))] < (z - merge_z - 1))
-	} else {
-	  
-	  check_obj_ids[NOi] = check_obj_ids[i];
-	  ++NOi;
-	  
-	  // else . . . if(z_finish[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))] < (z - merge_z - 1))
-	}
-	
-	// for(i = 0; i < NO_check_obj_ids; ++i)
-      }
-
-      // update NO_check_obj_ids
-      NO_check_obj_ids = NOi;
-      check_obj_ids.resize(NOi);
-      
-      // if(z > (merge_z + 2))
-    }
-    
-    for(y = y_start; (y < size_y) && ((chunk_y_start + y) < max_y_val); ++y){
-      
-      for(x = x_start; (x < size_x) && ((chunk_x_start + x) < max_x_val); ++x){
-	
-	// if this is a source voxel, check if it is associated with a previously identified
-	// source voxel
-	if(flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (x*data_metric[0]))] == flag_value){ 
-	  
-	  // 1.  initialise variables
-	  existing = flag_value;
-	  NOi = 0;
-	  match_init.resize(0);
-	  
-	  // 3. initial pass, check the voxels within the merging distance to see if any have been
-	  // identified as previous objects
-	  
-	  // 3a. set limits of region to be searched
-	  sx_start = x - merge_x - 1;
-	  if(sx_start < 0){ sx_start = 0; }
-	  sy_start = y - merge_y - 1;
-	  if(sy_start < 0){ sy_start = 0; }
-	  sz_start = z - merge_z - 1;
-	  if(sz_start < 0){ sz_start = 0; }
-	  
-	  // 3b. search through previous region and modify existing flag if required
-
-	  if(ss_mode == 1){
-	    
-	    // use a rectangular paralleliped to do the linking
-
-	    for(sz = sz_start; (sz < z); ++sz){
-	    
-	      for(sy = sy_start; (sy <= (y + merge_y + 1)) && (sy < size_y); ++sy){
-	      
-		for(sx = sx_start; (sx <= (x + merge_x + 1)) && (sx < size_x); ++sx){
-		
-		  // check if this test voxel is source
-		  if((flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] == flag_value) || (flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] >= 0)){
-		    
-		    // check if this is a new objid
-		    prev = -1;
-		    for(i = 0; (i < NOi) && (i < init_limit); ++i){
-		      
-		      if(match_init[i] == flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))]){
-			
-			prev = 1;
-			break;
-			
-		      }
-		      
-		    }
-		    if(prev == -1){ 
-		      
-		      // add current object to list of previous matches
-		      match_init.push_back(flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))]);
-		      ++NOi;
-
-		    }
-		    
-		    // update existing flag
-		    if(((flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] < existing) && (flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] >= 0)) || (existing == flag_value)){ existing = flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))]; }
-		    
-		  }
-		  
-		  // for(sx = x_start; (sx < (x + merge_x + 1)) && (sx < size_x); ++sx)
-		}
-		
-		// for(sy = y_start; (sy < (y + merge_y + 1)) && (sy < size_y); ++sy)
-	      }
-	      
-	      // for(sz = z_start; (sz < z); ++sz)
-	    }
-	    for(sy = sy_start; (sy < y); ++sy){
-	      
-	      for(sx = sx_start; (sx <= (x + merge_x + 1)) && (sx < size_x); ++sx){
-		
-		// check if this test voxel is source
-		if((flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] == flag_value) || (flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] >= 0)){
-		  
-		  // check if this is a new objid, move on if not
-		  prev = -1;
-		  for(i = 0; (i < NOi) && (i < init_limit); ++i){
-		    
-		    if(match_init[i] == flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))]){
-		      
-		      prev = 1;
-		      break;
-		      
-		    }
-		    
-		  }
-		  if(prev == -1){ 
-		    
-		    // add current object to list of previous matches
-		    ++NOi;
-		    match_init.push_back(flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))]);
-
-		  }
-		  
-		  // update existing flag
-		  if(((flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] < existing) && (flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] >= 0)) || (existing == flag_value)){ existing = flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))]; }
-		  
-		}		
-		
-		// for(sx = x_start; (sx < = (x + merge_x + 1)) && (sx < size_x); ++sx)
-	      }
-	      
-	      // for(sy = y_start; (sy < y) && (sy < size_y); ++sy)
-	    }
-	    for(sx = sx_start; sx < x; ++sx){
-	      
-	      // check if this test voxel is source
-	      if((flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))] == flag_value) || (flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))] >= 0)){
-		
-		// check if this is a new objid, move on if not
-		prev = -1;
-		for(i = 0; (i < NOi) && (i < init_limit); ++i){
-		  
-		  if(match_init[i] == flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))]){
-		    
-		    prev = 1;
-		    break;
-		    
-		  }
-		  
-		}
-		if(prev == -1){ 
-		  
-		  // add current object to list of previous matches
-		  ++NOi;
-		  match_init.push_back(flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))]);
-
-		}
-		
-		// update existing flag
-		if(((flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))] < existing) && (flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))] >= 0)) || (existing == flag_value)){ existing = flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))]; }
-		
-	      }	  
-	      
-	      // for(sx = x_start; sx <= x; ++sx)
-	    }
-	  
-	    // if(ss_mode == 1)
-	  } else {
-
-	    // use a cylinder for the linking lengths
-
-	    for(sz = sz_start; (sz < z); ++sz){
-	    
-	      for(sy = sy_start; (sy <= (y + merge_y + 1)) && (sy < size_y); ++sy){
-	      
-		for(sx = sx_start; (sx <= (x + merge_x + 1)) && (sx < size_x); ++sx){
-		
-		  // check if the test voxel is within the boundaries of the spatial ellipse
-		  if(((((float) (x - sx)) * ((float) (x - sx)) / (((float) (merge_x + 1)) * ((float) (merge_x + 1)))) + (((float) (y - sy)) * ((float) (y - sy)) / (((float) (merge_y + 1)) * ((float) (merge_y + 1))))) > 1.0){ continue; }
-
-		  // check if this test voxel is source
-		  if((flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] == flag_value) || (flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] >= 0)){
-
-		    // check if this is a new objid
-		    prev = -1;
-		    for(i = 0; (i < NOi) && (i < init_limit); ++i){
-		      
-		      if(match_init[i] == flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))]){
-			
-			prev = 1;
-			break;
-			
-		      }
-		      
-		    }
-		    if(prev == -1){ 
-		      
-		      // add current object to list of previous matches
-		      ++NOi;
-		      match_init.push_back(flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))]);
-
-		    }
-		    
-		    // update existing flag
-		    if(((flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] < existing) && (flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] >= 0)) || (existing == flag_value)){ existing = flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))]; }
-		    
-		  }
-		  
-		  // for(sx = x_start; (sx < (x + merge_x + 1)) && (sx < size_x); ++sx)
-		}
-		
-		// for(sy = y_start; (sy < (y + merge_y + 1)) && (sy < size_y); ++sy)
-	      }
-	      
-	      // for(sz = z_start; (sz < z); ++sz)
-	    }
-	    for(sy = sy_start; (sy < y); ++sy){
-	      
-	      for(sx = sx_start; (sx <= (x + merge_x + 1)) && (sx < size_x); ++sx){
-		
-		// check if the test voxel is within the boundaries of the spatial ellipse
-		if(((((float) (x - sx)) * ((float) (x - sx)) / (((float) (merge_x + 1)) * ((float) (merge_x + 1)))) + (((float) (y - sy)) * ((float) (y - sy)) / (((float) (merge_y + 1)) * ((float) (merge_y + 1))))) > 1.0){ continue; }
-
-		// check if this test voxel is source
-		if((flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] == flag_value) || (flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] >= 0)){
-		  
-		  // check if this is a new objid, move on if not
-		  prev = -1;
-		  for(i = 0; (i < NOi) && (i < init_limit); ++i){
-		    
-		    if(match_init[i] == flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))]){
-		      
-		      prev = 1;
-		      break;
-		      
-		    }
-		    
-		  }
-		  if(prev == -1){ 
-		    
-		    // add current object to list of previous matches
-		    ++NOi;
-		    match_init.push_back(flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))]);
-
-		  }
-		  
-		  // update existing flag
-		  if(((flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] < existing) && (flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] >= 0)) || (existing == flag_value)){ existing = flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))]; }
-		  
-		}		
-		
-		// for(sx = x_start; (sx < = (x + merge_x + 1)) && (sx < size_x); ++sx)
-	      }
-	      
-	      // for(sy = y_start; (sy < y) && (sy < size_y); ++sy)
-	    }
-	    for(sx = sx_start; sx < x; ++sx){
-	      
-	      // check if this test voxel is source
-	      if((flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))] == flag_value) || (flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))] >= 0)){
-		
-		// check if this is a new objid, move on if not
-		prev = -1;
-		for(i = 0; (i < NOi) && (i < init_limit); ++i){
-		  
-		  if(match_init[i] == flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))]){
-		    
-		    prev = 1;
-		    break;
-		    
-		  }
-		  
-		}
-		if(prev == -1){ 
-		  
-		  // add current object to list of previous matches
-		  ++NOi;
-		  match_init.push_back(flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))]);
-		  
-		}
-		
-		// update existing flag
-		if(((flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))] < existing) && (flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))] >= 0)) || (existing == flag_value)){ existing = flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))]; }
-		
-	      }	  
-	      
-	      // for(sx = x_start; sx <= x; ++sx)
-	    }
-
-	    // else . . . if(ss_mode == 1)
-	  }
-
-	  // 3c. assign an object number to this voxel, depending upon the value of the existing flag,
-	  // and if this is part of an existing object or objects, then daisy chain from this voxel to all the others
-	  if(existing == flag_value){
-	    
-	    // get obj value from array of obj_ids, then replace it with an incremented obj value
-	    
-	    // ensure that the obj_ids array is sorted
-	    sort(obj_ids.begin(),obj_ids.end());
-	    
-	    // assign value to array
-	    flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (x*data_metric[0]))] = obj_ids[0]; 
-	    
-	    // calculate the obj_batch value for this obj_id
-	    obj_batch = (long int) floor(((double) obj_ids[0] / (double) obj_limit));
-	    
-	    // add this initial point to the object
-	    detections[obj_batch][(obj_ids[0] - (obj_batch * obj_limit))].AddPoint(((float) (chunk_x_start + x)),((float) (chunk_y_start + y)),((float) (chunk_z_start + z)),data_vals[((z*data_metric[2]) + (y*data_metric[1]) + (x*data_metric[0]))]);
-
-	    // push id to list of objects that need to be size thresholded
-	    i = -1;
-	    for(g = 0; g < NO_check_obj_ids; ++g){ if(check_obj_ids[g] == obj_ids[0]){ i = 1; break; } }
-	    if(i == -1){
-
-	      ++NO_check_obj_ids;
-	      check_obj_ids.push_back(obj_ids[0]);
-	      
-	    }
-
-	    // adjust obj and obj_ids
-	    if(NO_obj_ids > 1){
-	      
-	      for(i = 0; i < (NO_obj_ids - 1); ++i){ obj_ids[i] = obj_ids[(i + 1)]; }
-	      --NO_obj_ids;
-	      obj_ids.resize(NO_obj_ids);
-
-	    } else {
-	      
-	      ++obj;
-
-	      obj_ids[0] = obj;
-	      
-	      // if this obj_id modulo obj_limit == 0, then it's the first obj of a new batch
-	      // so create a new batch of objects
-	      if((obj % obj_limit) == 0){ 
-				
-		detections.push_back(new object_props[obj_limit]);
-				
-		// if((obj % obj_limit) == 0)
-	      }
-			      
-	      // if(NO_obj_ids > 1) { } else 
-	    }
-	    
-	    // if(existing == -1)
-	  } else if(existing >= 0){
-	    
-	    // assign the current voxel being processed the correct flag value, and update
-	    // the bounding box
-	    
-	    // add object to list of objects within the merging box, provided that it hasn't been added already
-	    i = -1;
-	    for(g = 0; g < NO_check_obj_ids; ++g){ if(check_obj_ids[g] == existing){ i = 1; break; } }
-	    if(i == -1){
-
-	      ++NO_check_obj_ids;
-	      check_obj_ids.push_back(existing);
-
-	    }
-
-	    // assign value to array
-	    flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (x*data_metric[0]))] = existing;
-	    
-	    // calculate the obj_batch value for the existing object
-	    obj_batch = (long int) floor(((double) existing / (double) obj_limit));
-	    
-	    // add this point to the existing object
-	    detections[obj_batch][(existing - (obj_batch * obj_limit))].AddPoint((chunk_x_start + x),(chunk_y_start + y),(chunk_z_start + z),data_vals[((z*data_metric[2]) + (y*data_metric[1]) + (x*data_metric[0]))]);
-	    
-	    // for each object detected within the merging volume, update all of the values within the bounding box of this object
-	    // to be the same as the other part of this object, and update the bounding box at the same time
-	    if(NOi > 1){
-	      
-	      for(i = 0; i < NOi; ++i){
-		
-		// move on if this is the existing object
-		if(match_init[i] == existing){ 
-
-		  continue; 
-
-		}
-		
-		// calculate a temporary obj_batch value
-		obj_batch_2 = (long int) floor(((double) match_init[i] / (double) obj_limit));		
-		
-		// add this object to an existing object
-		//detections[obj_batch][(existing - (obj_batch * obj_limit))].AddObject(detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))]);
-		detections[obj_batch][(existing - (obj_batch * obj_limit))].AddObject(detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))],temp_sparse_reps_grid,temp_sparse_reps_strings,temp_mom0,temp_RAPV,temp_DECPV,temp_ref_spec,temp_obj_spec,temp_vfield);
-		
-		// flag the `object' values within the bounding box to merge it with the base object
-		sx_start = detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))].GetRAmin() - chunk_x_start;
-		if(sx_start < 0){ sx_start = 0; }
-		sy_start = detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))].GetDECmin() - chunk_y_start;
-		if(sy_start < 0){ sy_start = 0; }
-		sz_start = detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))].GetFREQmin() - chunk_z_start;
-		if(sz_start < 0){ sz_start = 0; }
-		for(sz = sz_start; (sz <= detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))].GetFREQmax() - chunk_z_start) && (sz < size_z); ++sz){
-		  
-		  for(sy = sy_start; (sy <= detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))].GetDECmax() - chunk_y_start) && (sy < size_y); ++sy){
-		    
-		    for(sx = sx_start; (sx <= detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))].GetRAmax() - chunk_x_start) && (sx < size_x); ++sx){
-		      
-		      if(flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] == match_init[i]){ flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] = existing; }
-		      
-		      // for(sx = x_start[(match_init[i] - (obj_batch_2 * obj_limit))]; sx <= x_finish[(match_init[i] - (obj_batch_2 * obj_limit))]; ++sx)
-		    }
-		    
-		    // for(sy = y_start[(match_init[i] - (obj_batch_2 * obj_limit))]; sy <= y_finish[(match_init[i] - (obj_batch_2 * obj_limit))]; ++sy)
-		  }
-		  
-		  // for(sz = z_start[(match_init[i] - (obj_batch_2 * obj_limit))]; sz <= z_finish[(match_init[i] - (obj_batch_2 * obj_limit))]; ++sz)
-		}
-		
-		// re-initialise the `object' values for the match_init[i] object that has just been merged into the existing object, 
-		// and push the obj value (match_init[i]) to the top of the array of values
-		detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))].ReInit();
-		if((detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))].Get_srep_update() != 0) && (detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))].Get_srep_size(0) >= 0)){
-		  
-		  detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))].ReInit_srep();
-		  detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))].ReInit_mini();
-
-		}
-		detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))].ReInit_size();
-		detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))].Set_srep_update(0);
-
-		j = -1;
-		for(g = 0; g < NO_obj_ids; ++g){ if(obj_ids[g] == match_init[i]){ j = 1; break; } }
-		if(j == -1){
-		  
-		  ++NO_obj_ids;
-		  obj_ids.push_back(match_init[i]);
-		  		  
-		}
-		
-		// for(i = 0; i < NOi; ++i)
-	      }
-	      
-	      // if(NOi > 1)
-	    }
-	    
-	    // else . . . if(existing == -1)
-	  }
-	  
-	  // if(flag_vals[((z*size_x*size_y) + (y*size_x) + x)] == -1)
-	}
-	
-	// update progress on display
-	while(progress <= (((float) ((z * size_x * size_y) + (y * size_x) + x + 1)) / ((float) (size_x * size_y * size_z)))){ std::cout << "*"; std::cout.flush(); progress+=0.05; }
-	
-	// for(x = 0; x < size_x; ++x)
-      }
-      
-      // for(y = 0; y < size_y; ++y)
-    }
-    
-    // for(z = 0; z < size_z; ++z)
-  }
-  std::cout << "* done." << std::endl;
-  
-  // 4. generate sparse representations of coherent objects that are retained after
-  // this `chunk' of the datacube is processed
-  std::cout << "Generating/updating sparse representations of sources . . . " << std::endl;
-  std::cout << "0 | |:| | : | |:| | 100% complete" << std::endl;
-  progress = 0.0;
-  for(o = 0; o < obj; ++o){
-    
-    // calculate the obj_batch value for this object
-    obj_batch = (long int) floor(((double) o / (double) obj_limit));
-    
-    // move on if this object has been re-initialised
-    if(detections[obj_batch][(o - (obj_batch * obj_limit))].ShowVoxels() < 1){ 
-      
-      // update progress on display
-      while(progress <= (((double) (o + 1) / ((double) obj)))){ std::cout << "*"; std::cout.flush(); progress+=0.05; }  
-      continue; 
-      
-    }
-    
-    // move on if this object is not within the boundaries of the current chunk, in other words,
-    // move on if this object doesn't need to have it's sparse representation and postage stamp images updated
-    if((detections[obj_batch][(o - (obj_batch * obj_limit))].GetRAmax() < chunk_x_start) || (detections[obj_batch][(o - (obj_batch * obj_limit))].GetDECmax() < chunk_y_start) || (detections[obj_batch][(o - (obj_batch * obj_limit))].GetFREQmax() < chunk_z_start) || (detections[obj_batch][(o - (obj_batch * obj_limit))].GetRAmin() >= (chunk_x_start + size_x)) || (detections[obj_batch][(o - (obj_batch * obj_limit))].GetDECmin() >= (chunk_y_start + size_y)) || (detections[obj_batch][(o - (obj_batch * obj_limit))].GetFREQmin() >= (chunk_z_start + size_z))){ 
-
-      // update progress on display
-      while(progress <= (((double) (o + 1) / ((double) obj)))){ std::cout << "*"; std::cout.flush(); progress+=0.05; }  
-      continue; 
-      
-    }
-    
-    // move on if this object's sparse representation and postage stamp images don't need updating
-    if((detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0) >= 0) && (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_update() == -1)){
-      
-      // update progress on display
-      while(progress <= (((double) (o + 1) / ((double) obj)))){ std::cout << "*"; std::cout.flush(); progress+=0.05; }  
-      continue; 
-	
-    }
-          
-    // update the sparse representation for this object
-    
-    // 0. if there is no existing sparse representation and postage stamp images, create them from scratch, 
-    // otherwise concatenate the existing sparse representation and postage stamp images with the updates
-    if((detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0) < 0) && (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_update() >= 0)){
-      
-      // branch for creating a brand new sparse representation
-      
-      // update the sparse_reps_update array
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Set_srep_update(-1);
-
-      // initialise the number of object sections that make up this object
-      NOi = 0;   
-      
-      // calculate the edge of the bounding box in `chunk' co-ordinates
-      sx_start = detections[obj_batch][(o - (obj_batch * obj_limit))].GetRAmin() - chunk_x_start;
-      if(sx_start < 0){ sx_start = 0; }
-      sx_finish = detections[obj_batch][(o - (obj_batch * obj_limit))].GetRAmax() - chunk_x_start;
-      sy_start = detections[obj_batch][(o - (obj_batch * obj_limit))].GetDECmin() - chunk_y_start;
-      if(sy_start < 0){ sy_start = 0; }
-      sy_finish = detections[obj_batch][(o - (obj_batch * obj_limit))].GetDECmax() - chunk_y_start;
-      sz_start = detections[obj_batch][(o - (obj_batch * obj_limit))].GetFREQmin() - chunk_z_start;
-      if(sz_start < 0){ sz_start = 0; }
-      sz_finish = detections[obj_batch][(o - (obj_batch * obj_limit))].GetFREQmax() - chunk_z_start;
-      
-      // count the number of object sections that make up this object
-      for(sy = sy_start; (sy <= sy_finish) && (sy < size_y); ++sy){
-	
-	for(sx = sx_start; (sx <= sx_finish) && (sx < size_x); ++sx){
-	  
-	  // initialise the dummy integer j
-	  j = -1;
-	  
-	  for(sz = sz_start; (sz <= sz_finish) && (sz < size_z); ++sz){
-	    
-	    // change j to reflect if this voxel in the flag_vals array belongs to the source
-	    if(flag_vals[((sz * data_metric[2]) + (sy * data_metric[1]) + (sx * data_metric[0]))] == o){ 
-	      
-	      // if previously this was not part of an object string, j == -1, then increment the number of object strings and
-	      // adjust the value of j
-	      if(j == -1){ ++NOi; }
-	      
-	      // change j to reflect that this voxel belongs to the object
-	      j = 1; 
-	      
-	    } else { j = -1; }
-	    
-	    // for(sz = detections[obj_batch][(obj - (obj_batch * obj_limit))].GetFREQmin() - chunk_z_size; sz <= (detections[obj_batch][(obj - (obj_batch * obj_limit))].GetFREQmax() - chunk_z_size); ++sz)
-	  }
-	  
-	  // for(sx = detections[obj_batch][(obj - (obj_batch * obj_limit))].GetRAmin() - chunk_x_size; sx <= (detections[obj_batch][(obj - (obj_batch * obj_limit))].GetRAmax() - chunk_x_size); ++sx)
-	}
-	
-	// for(sy = detections[obj_batch][(obj - (obj_batch * obj_limit))].GetDECmin() - chunk_y_size; sy <= (detections[obj_batch][(obj - (obj_batch * obj_limit))].GetDECmax() - chunk_y_size); ++sy)
-      }
-
-      // create an array element to store this sparse representation
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Set_srep_size(0,detections[obj_batch][(o - (obj_batch * obj_limit))].GetRAmin());
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Set_srep_size(1,detections[obj_batch][(o - (obj_batch * obj_limit))].GetRAmax());
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Set_srep_size(2,detections[obj_batch][(o - (obj_batch * obj_limit))].GetDECmin());
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Set_srep_size(3,detections[obj_batch][(o - (obj_batch * obj_limit))].GetDECmax());
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Set_srep_size(4,detections[obj_batch][(o - (obj_batch * obj_limit))].GetFREQmin());
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Set_srep_size(5,detections[obj_batch][(o - (obj_batch * obj_limit))].GetFREQmax());
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Create_srep_grid((((detections[obj_batch][(o - (obj_batch * obj_limit))].GetRAmax() - detections[obj_batch][(o - (obj_batch * obj_limit))].GetRAmin() + 1) * (detections[obj_batch][(o - (obj_batch * obj_limit))].GetDECmax() - detections[obj_batch][(o - (obj_batch * obj_limit))].GetDECmin() + 1)) + 1));
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Create_srep_strings((2 * NOi));
-      
-      // calculate the extent of the sparse_rep volume
-      sx_finish = detections[obj_batch][(o - (obj_batch * obj_limit))].GetRAmax() - detections[obj_batch][(o - (obj_batch * obj_limit))].GetRAmin() + 1;
-      sy_finish = detections[obj_batch][(o - (obj_batch * obj_limit))].GetDECmax() - detections[obj_batch][(o - (obj_batch * obj_limit))].GetDECmin() + 1;
-      sz_finish = detections[obj_batch][(o - (obj_batch * obj_limit))].GetFREQmax() - detections[obj_batch][(o - (obj_batch * obj_limit))].GetFREQmin() + 1;
-      
-      // create arrays to store the postage stamp images and initialise them
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Create_mom0((sx_finish * sy_finish));
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Create_RAPV((sx_finish * sz_finish));
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Create_DECPV((sy_finish * sz_finish));
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Create_ospec(sz_finish);
-      if(sz_finish >= 10){
-
-	detections[obj_batch][(o - (obj_batch * obj_limit))].Create_rspec((2 * sz_finish));
-
-      } else {
-
-	detections[obj_batch][(o - (obj_batch * obj_limit))].Create_rspec((10 + sz_finish));
-
-      }
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Create_vfield((sx_finish * sy_finish));
-      
-      // initialise the mini_mom0 values
-      for(sy = 0; sy < sy_finish; ++sy){
-	for(sx = 0; sx < sx_finish; ++sx){
-	  detections[obj_batch][(o - (obj_batch * obj_limit))].Set_mom0(((sy * sx_finish) + sx),0.0);
-	}
-      }
-
-      // initialise the mini_RAPV values
-      for(sz = 0; sz < sz_finish; ++sz){
-	for(sx = 0; sx < sx_finish; ++sx){
-	  detections[obj_batch][(o - (obj_batch * obj_limit))].Set_RAPV(((sz * sx_finish) + sx),0.0);
-	}
-      }
-      
-      // initialise the mini_DECPV values
-      for(sz = 0; sz < sz_finish; ++sz){
-	for(sy = 0; sy < sy_finish; ++sy){
-	  detections[obj_batch][(o - (obj_batch * obj_limit))].Set_DECPV(((sz * sy_finish) + sy),0.0);
-	}
-      }
-      
-      // initialise the mini_spec values
-      for(sz = 0; sz < sz_finish; ++sz){ detections[obj_batch][(o - (obj_batch * obj_limit))].Set_ospec(sz,0.0); }
-      if(sz_finish >= 10){
-
-	for(sz = 0; sz < (2 * sz_finish); ++sz){ detections[obj_batch][(o - (obj_batch * obj_limit))].Set_rspec(sz,0.0); }
-
-      } else {
-
-	for(sz = 0; sz < (10 + sz_finish); ++sz){ detections[obj_batch][(o - (obj_batch * obj_limit))].Set_rspec(sz,0.0); }
-
-      }
-            
-      // initialise the mini_vfield values
-      for(sy = 0; sy < sy_finish; ++sy){
-	for(sx = 0; sx < sx_finish; ++sx){
-	  detections[obj_batch][(o - (obj_batch * obj_limit))].Set_vfield(((sy * sx_finish) + sx),0.0);
-	}
-      }
-
-      // populate the sparse array representation and postage stamp images
-      NOi = 0;
-      for(sy = 0; sy < sy_finish; ++sy){
-	
-	for(sx = 0; sx < sx_finish; ++sx){
-	  
-	  // write the current number of object strings to the grid
-	  detections[obj_batch][(o - (obj_batch * obj_limit))].Set_srep_grid(((sy * sx_finish) + sx),NOi);
-	  
-	  // initialise the dummy integer j 
-	  j = -1;
-	  
-	  for(sz = 0; sz < sz_finish; ++sz){
-	    
-	    // change j to reflect if this voxel in the flag_vals array belongs to the source
-	    if(flag_vals[(((sz + sz_start) * data_metric[2]) + ((sy + sy_start) * data_metric[1]) + ((sx + sx_start) * data_metric[0]))] == o){ 
-	      
-	      // update mini_mom0
-	      detections[obj_batch][(o - (obj_batch * obj_limit))].Add_mom0(((sy * sx_finish) + sx),data_vals[(((sz + sz_start) * data_metric[2]) + ((sy + sy_start) * data_metric[1]) + ((sx + sx_start) * data_metric[0]))]);
-	      
-	      // update mini_RAPV
-	      detections[obj_batch][(o - (obj_batch * obj_limit))].Add_RAPV(((sz * sx_finish) + sx),data_vals[(((sz + sz_start) * data_metric[2]) + ((sy + sy_start) * data_metric[1]) + ((sx + sx_start) * data_metric[0]))]);
-	      
-	      // update mini_DECPV
-	      detections[obj_batch][(o - (obj_batch * obj_limit))].Add_DECPV(((sz * sy_finish) + sy),data_vals[(((sz + sz_start) * data_metric[2]) + ((sy + sy_start) * data_metric[1]) + ((sx + sx_start) * data_metric[0]))]);
-	      
-	      // update mini_obj_spec
-	      detections[obj_batch][(o - (obj_batch * obj_limit))].Add_ospec(sz,data_vals[(((sz + sz_start) * data_metric[2]) + ((sy + sy_start) * data_metric[1]) + ((sx + sx_start) * data_metric[0]))]);
-  
-	      // update mini_vfield
-	      detections[obj_batch][(o - (obj_batch * obj_limit))].Add_vfield(((sy * sx_finish) + sx),(((float) (sz + sz_start + chunk_z_start)) * data_vals[(((sz + sz_start) * data_metric[2]) + ((sy + sy_start) * data_metric[1]) + ((sx + sx_start) * data_metric[0]))]));
-	      
-	      // if previously this was not part of an object string, j == -1, then increment the number of object strings and
-	      // write the position to the sparse_reps array
-	      if(j == -1){ 
-		
-		// write the beginning of the object string to sparse_reps
-		detections[obj_batch][(o - (obj_batch * obj_limit))].Set_srep_strings((2 * NOi),(sz_start + chunk_z_start + sz));
-		
-		// increment NOi
-		++NOi; 
-		
-		// initialise the end of the object string in sparse_reps
-		detections[obj_batch][(o - (obj_batch * obj_limit))].Set_srep_strings(((2 * NOi) - 1),(sz_start + chunk_z_start + sz));
-
-	      } else {
-		
-		// update the end of the object string in sparse_reps
-		detections[obj_batch][(o - (obj_batch * obj_limit))].Set_srep_strings(((2 * NOi) - 1),(sz_start + chunk_z_start + sz));
-		
-	      }
-	      
-	      // change j to reflect that this voxel belongs to the object
-	      j = 1; 
-	      
-	    } else { 
-	      
-	      // change j to reflect that this voxel doesn't belong to the object
-	      j = -1; 
-	      
-	    }
-	    
-	    // for(sz = detections[obj_batch][(obj - (obj_batch * obj_limit))].GetFREmin() - chunk_z_start + 1; sz <= (detections[obj_batch][(obj - (obj_batch * obj_limit))].GetFREQmax() - chunk_z_start + 1); ++sz)
-	  }
-	  
-	  // for(sx = detections[obj_batch][(obj - (obj_batch * obj_limit))].GetRAmin() - chunk_x_start + 1; sx <= (detections[obj_batch][(obj - (obj_batch * obj_limit))].GetRAmax() - chunk_x_start + 1); ++sx)
-	}
-	
-	//for(sy = detections[obj_batch][(obj - (obj_batch * obj_limit))].GetDECmin() - chunk_y_start + 1; sy <= (detections[obj_batch][(obj - (obj_batch * obj_limit))].GetDECmax() - chunk_y_start + 1); ++sy)
-      }
-            
-      // update sparse_reps with the final value of NOi
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Set_srep_grid((sx_finish * sy_finish),NOi);
-            
-      // create the reference spectrum
-      if(sz_finish >= 10){
-	
-	for(sz = -1 * (int) floorf((0.5 * (float) sz_finish)); sz < (sz_finish + ((int) floorf((0.5 * (float) sz_finish)))); ++sz){
-	  
-	  for(sy = 0; sy < sy_finish; ++sy){
-	  
-	    for(sx = 0; sx < sx_finish; ++sx){
-	    
-	      if(((sz + sz_start) >= 0) && ((sz + sz_start) < size_z)){
-		
-		// update mini_ref_spec	
-		detections[obj_batch][(o - (obj_batch * obj_limit))].Add_rspec((sz + ((int) floorf((0.5 * (float) sz_finish)))),data_vals[(((sz + sz_start) * data_metric[2]) + ((sy + sy_start) * data_metric[1]) + ((sx + sx_start) * data_metric[0]))]);	
-		
-	      }
-	      
-	    }
-	    
-	  }
-      
-	}
-
-	// if(sz_finish >= 10)
-      } else {
-
-	for(sz = -5; sz < (sz_finish + 5); ++sz){
-	  
-	  for(sy = 0; sy < sy_finish; ++sy){
-	  
-	    for(sx = 0; sx < sx_finish; ++sx){
-	    
-	      if(((sz + sz_start) >= 0) && ((sz + sz_start) < size_z)){
-		
-		// update mini_ref_spec
-		detections[obj_batch][(o - (obj_batch * obj_limit))].Add_rspec((sz + 5),data_vals[(((sz + sz_start) * data_metric[2]) + ((sy + sy_start) * data_metric[1]) + ((sx + sx_start) * data_metric[0]))]);	
-		
-	      }
-	      
-	    }
-	    
-	  }
-      
-	}
-
-	// else . . . if(sz_finish >= 10)
-      }
-      
-     // if(sparse_reps[obj_batch][(obj - (obj_batch * obj_limit))][0] < 0) . . . else
-    } else {
-            
-      // branch for updating an existing sparse representation
-      
-      // count the number of object strings comprising the object
-      
-      // 1. initialise the number of object strings
-      NOi = 0;
-      
-      // 2. convert the new bounding box of the object into `chunk' co-ordinates
-      sx_start = detections[obj_batch][(o - (obj_batch * obj_limit))].GetRAmin() - chunk_x_start;
-      sx_finish = detections[obj_batch][(o - (obj_batch * obj_limit))].GetRAmax() - chunk_x_start;
-      sy_start = detections[obj_batch][(o - (obj_batch * obj_limit))].GetDECmin() - chunk_y_start;
-      sy_finish = detections[obj_batch][(o - (obj_batch * obj_limit))].GetDECmax() - chunk_y_start;
-      sz_start = detections[obj_batch][(o - (obj_batch * obj_limit))].GetFREQmin() - chunk_z_start;
-      if(sz_start < 0){ sz_start = 0; }
-      sz_finish = detections[obj_batch][(o - (obj_batch * obj_limit))].GetFREQmax() - chunk_z_start;
-      
-      // 3. search through the bounding box, and do one of the following
-      // 3.a if inside the chunk and outside the existing sparse rep grid, run the routine to count the number
-      //     of object strings along the current line of sight
-      // 3.b otherwise use the grid value to increment NOi
-      for(sy = sy_start; sy <= sy_finish; ++sy){
-	
-	for(sx = sx_start; sx <= sx_finish; ++sx){
-	  	  
-	  // case 3.a triggered
-	  if(((sx > merge_x) || (chunk_x_start == 0)) && ((sy > merge_y) || (chunk_y_start == 0))){
-	    	    
-	    // initialise the dummy integer j 
-	    j = -1;
-	    
-	    for(sz = sz_start; sz <= sz_finish; ++sz){
-	      
-	      // change i to reflect if this voxel in the flag_vals array belongs to the source
-	      if(flag_vals[((sz * data_metric[2]) + (sy * data_metric[1]) + (sx * data_metric[0]))] == o){ 
-		
-		// if previously this was not part of an object string, i == -1, then increment the number of object strings and
-		// write the position to the sparse_reps array
-		if(j == -1){ 
-		  
-		  // increment NOi
-		  ++NOi; 
-		  
-		} 
-		
-		// change j to reflect that this voxel belongs to the object
-		j = 1; 
-		
-	      } else { j = -1; }
-	      
-	      // for(sz = sz_start; sz <= sz_finish; ++sz)
-	    }
-	    
-	  } else {
-	    
-	    // case 3.b triggered  
-	    NOi+=(detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_grid((((sy + chunk_y_start - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(2)) * (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) + sx + chunk_x_start - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_grid((((sy + chunk_y_start - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(2)) * (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) + sx + chunk_x_start - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0))));
-	    
-	  }     
-	  
-	  // for(sx = sx_start; sx <= sx_finish; ++sx)
-	}
-	
-	// for(sy = sy_start; sy <= sy_finish; ++sy)
-      }
-      
-      // 4. allocate memory to store temporary sparse representation and postage stamp images, then
-      //    initialise the postage stamp image arrays
-      temp_mom0.resize(0);
-      for(sy = 0; sy < (sy_finish - sy_start + 1); ++sy){
-	for(sx = 0; sx < (sx_finish - sx_start + 1); ++sx){
-	  temp_mom0.push_back(0.0);
-	}
-      }
-      temp_RAPV.resize(0);
-      for(sz = 0; sz < (sz_finish - sz_start + 1); ++sz){
-	for(sx = 0; sx < (sx_finish - sx_start + 1); ++sx){
-	  temp_RAPV.push_back(0.0);
-	}
-      }
-      temp_DECPV.resize(0);
-      for(sz = 0; sz < (sz_finish - sz_start + 1); ++sz){
-	for(sy = 0; sy < (sy_finish - sy_start + 1); ++sy){
-	  temp_DECPV.push_back(0.0);
-	}
-      }
-      temp_obj_spec.resize(0);
-      for(sz = 0; sz < (sz_finish - sz_start + 1); ++sz){ temp_obj_spec.push_back(0.0); }
-      if((sz_finish - sz_start + 1) >= 10){
-
-	temp_ref_spec.resize(0);
-	for(sz = 0; sz < (2 * (sz_finish - sz_start + 1)); ++sz){ temp_ref_spec.push_back(0.0); }
-
-      } else {
-
-	temp_ref_spec.resize(0);
-	for(sz = 0; sz < (sz_finish - sz_start + 11); ++sz){ temp_ref_spec.push_back(0.0); }
-
-      }
-      temp_vfield.resize(0);
-      for(sy = 0; sy < (sy_finish - sy_start + 1); ++sy){
-	for(sx = 0; sx < (sx_finish - sx_start + 1); ++sx){
-	  temp_vfield.push_back(0.0);
-	}
-      }
-     
-      // 5. populate temp_sparse_rep arrays
-      // 5.a if inside the chunk and outside the existing sparse rep grid, run the routine to count the number
-      //     of object strings along the current line of sight, populate new strings array and add values to new 
-      //     postage stamp images
-      // 5.b if outside of the chunk, use the grid value to increment NOi, populate strings array from previous version and 
-      //     fill in valuese for postage stamp images
-
-      // initialise number of object strings
-      NOi = 0;
-      
-      // initialise RA PV image
-      for(sz = 0; sz < (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) + 1); ++sz){
-
-	for(sx = 0; sx < (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0) + 1); ++sx){
-	
-	  temp_RAPV[(((sz + detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) - sz_start - chunk_z_start) * (sx_finish - sx_start + 1)) + sx + detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0) - sx_start - chunk_x_start)]+=detections[obj_batch][(o - (obj_batch * obj_limit))].Get_RAPV(((sz * (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) + sx));
-	  
-	}
-
-      }
-
-      // initialise Dec PV image
-      for(sz = 0; sz < (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) + 1); ++sz){
-
-	for(sy = 0; sy < (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(2) + 1); ++sy){
-	
-	  temp_DECPV[(((sz + detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) - sz_start - chunk_z_start) * (sy_finish - sy_start + 1)) + sy + detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(2) - sy_start - chunk_y_start)]+=detections[obj_batch][(o - (obj_batch * obj_limit))].Get_DECPV(((sz * (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(2) + 1)) + sy));
-	  
-	}
-
-      }
-
-      // initialise mini spec's
-      for(sz = 0; sz < (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) + 1); ++sz){ temp_obj_spec[(sz + detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) - sz_start - chunk_z_start)]+=detections[obj_batch][(o - (obj_batch * obj_limit))].Get_ospec(sz); }
-
-      if((sz_finish - sz_start + 1) >= 10){
-
-	j = sz_start + chunk_z_start - ((int) floorf((0.5 * (float) (sz_finish - sz_start + 1))));
-
-	if((detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) + 1) >= 10){
-
-	  k = detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) - ((int) floorf((0.5 * (float) (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) + 1))));
-
-	  for(sz = 0; sz < (2 * (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) + 1)); ++sz){
-
-	    temp_ref_spec[(sz + k - j)]+=detections[obj_batch][(o - (obj_batch * obj_limit))].Get_rspec(sz);
-
-	  }
-
-	} else {
-	  
-	  k = detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) - 5;
-
-	  for(sz = 0; sz < (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) + 11); ++sz){
-	    
-	    temp_ref_spec[(sz + k - j)]+=detections[obj_batch][(o - (obj_batch * obj_limit))].Get_rspec(sz);
-
-	  }
-	  
-	}
-
-      } else {
-
-	j = sz_start + chunk_z_start - 5;
-
-	if((detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) + 1) >= 10){
-
-	  k = detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) - ((int) floorf((0.5 * (float) (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) + 1))));
-
-	  for(sz = 0; sz < (2 * (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) + 1)); ++sz){
-
-	    temp_ref_spec[(sz + k - j)]+=detections[obj_batch][(o - (obj_batch * obj_limit))].Get_rspec(sz);
-
-	  }
-
-	} else {
-	  
-	  k = detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) - 5;
-
-	  for(sz = 0; sz < (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) + 11); ++sz){
-	    
-	    temp_ref_spec[(sz + k - j)]+=detections[obj_batch][(o - (obj_batch * obj_limit))].Get_rspec(sz);
-
-	  }
-	  
-	}
-
-      }
-      
-      // search through LoS's of updated bounding box and take action as dictated by case 5.a or 5.b
-      for(sy = sy_start; sy <= sy_finish; ++sy){
-	
-	for(sx = sx_start; sx <= sx_finish; ++sx){
-	  	  
-	  // add value to temp_sparse_rep_grid
-	  temp_sparse_reps_grid[(((sy - sy_start) * (sx_finish - sx_start + 1)) + sx - sx_start)] = NOi;
-	  
-	  // case 5.a triggered for moment-0 image and sparse representation
-	  if(((sx > merge_x) || (chunk_x_start == 0)) && ((sy > merge_y) || (chunk_y_start == 0))){
-	    
-	    // initialise the dummy integer j 
-	    j = -1;
-	    
-	    for(sz = sz_start; sz <= sz_finish; ++sz){
-	      
-	      // change j to reflect if this voxel in the flag_vals array belongs to the source
-	      if(flag_vals[((sz * data_metric[2]) + (sy * data_metric[1]) + (sx * data_metric[0]))] == o){ 
-		
-		// update mini_mom0
-		temp_mom0[(((sy - sy_start) * (sx_finish - sx_start + 1)) + sx - sx_start)]+=data_vals[((sz * data_metric[2]) + (sy * data_metric[1]) + (sx * data_metric[0]))];
-		
-		// update mini_RAPV
-		temp_RAPV[(((sz - sz_start) * (sx_finish - sx_start + 1)) + sx - sx_start)]+=data_vals[((sz * data_metric[2]) + (sy * data_metric[1]) + (sx * data_metric[0]))];
-		
-		// update mini_DECPV
-		temp_DECPV[(((sz - sz_start) * (sy_finish - sy_start + 1)) + sy - sy_start)]+=data_vals[((sz * data_metric[2]) + (sy * data_metric[1]) + (sx * data_metric[0]))];
-		
-		// update mini_obj_spec
-		temp_obj_spec[(sz - sz_start)]+=data_vals[((sz * data_metric[2]) + (sy * data_metric[1]) + (sx * data_metric[0]))];
-		
-		// update mini_vfield
-		temp_vfield[(((sy - sy_start) * (sx_finish - sx_start + 1)) + sx - sx_start)]+=(((float) (sz + chunk_z_start)) * data_vals[((sz * data_metric[2]) + (sy * data_metric[1]) + (sx * data_metric[0]))]);
-		
-		// if previously this was not part of an object string, j == -1, then increment the number of object strings and
-		// write the position to the sparse_reps array
-		if(j == -1){ 
-		  
-		  // write the beginning of the object string to sparse_reps
-		  temp_sparse_reps_strings[(2 * NOi)] = chunk_z_start + sz;
-		  
-		  // increment NOi
-		  ++NOi; 
-		  		  
-		  // initialise the end of the object string in sparse_reps
-		  temp_sparse_reps_strings[((2 * NOi) - 1)] = chunk_z_start + sz;
-		  
-		} else {
-		  
-		  // update the end of the object string in sparse_reps
-		  temp_sparse_reps_strings[((2 * NOi) - 1)] = chunk_z_start + sz;
-		  
-		}
-		
-		// change j to reflect that this voxel belongs to the object
-		j = 1; 
-		
-	      } else { 
-		
-		// change j to reflect that this voxel doesn't belong to the object
-		j = -1; 
-		
-	      }
-	      
-	      // for(sz = sz_start; sz <= sz_finish; ++sz)
-	    }
-	    
-	    // add values to temp_ref_spec
-	    if((sz_finish - sz_start + 1) >= 10){
-	      
-	      k = (int) floorf((0.5 * (float) (sz_finish - sz_start + 1)));
-	      
-	      for(sz = 0; sz < (2 * (sz_finish - sz_start + 1)); ++sz){
-	  	
-		if(((sz + sz_start - k) >= 0) && ((sz + sz_start - k) < size_z)){
-		  
-		  // update mini_ref_spec
-		  temp_ref_spec[(sz + sz_start - k)]+=data_vals[(((sz + sz_start - k) * data_metric[2]) + (sy * data_metric[1]) + (sx * data_metric[0]))];	
-		  
-		}
-		
-	      }
-	      
-	      // if(sz_finish >= 10)
-	    } else {
-	      
-	      for(sz = 0; sz < (sz_finish - sz_start + 11); ++sz){
-		
-		if(((sz + sz_start - 5) >= 0) && ((sz + sz_start - 5) < size_z)){
-		  
-		  // update mini_ref_spec
-		  temp_ref_spec[(sz + sz_start - 5)]+=data_vals[(((sz + sz_start - 5) * data_metric[2]) + (sy * data_metric[1]) + (sx * data_metric[0]))];	
-		  
-		}
-		
-	      }
-	      
-	      // else . . . if(sz_finish >= 10)
-	    }
-	    
-	  } else {
-	    // case 5.b triggered  
-	    	    
-	    // update temp_sparse_rep_strings
-	    j = 0;
-	    if(((sx + chunk_x_start) >= detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0)) && ((sx + chunk_x_start) <= (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(1) + 1)) && ((sy + chunk_y_start) >= detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(2)) && ((sy + chunk_y_start) <= (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(3) + 1))){
-	      
-	      for(g = detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_grid((((sy + chunk_y_start - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(2)) * (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) + sx + chunk_x_start - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0))); g < detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_grid((((sy + chunk_y_start - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(2)) * (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) + sx + chunk_x_start - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0) + 1)); ++g){
-		
-		temp_sparse_reps_strings[(NOi + j)] = detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_strings((2 * g));
-		temp_sparse_reps_strings[(NOi + j + 1)] = detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_strings(((2 * g) + 1));
-		++j;
-		
-	      }
-	      
-	      // update moment 0 postage stamp image
-	      temp_mom0[(((sy - sy_start) * (detections[obj_batch][(o - (obj_batch * obj_limit))].GetRAmax() - detections[obj_batch][(o - (obj_batch * obj_limit))].GetRAmin() + 1)) + sx - sx_start)] = detections[obj_batch][(o - (obj_batch * obj_limit))].Get_mom0((((sy + chunk_y_start - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(2)) * (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) + sx + chunk_x_start - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0)));
-	      
-	      // update vfield postage stamp image
-	      temp_vfield[(((sy - sy_start) * (detections[obj_batch][(o - (obj_batch * obj_limit))].GetRAmax() - detections[obj_batch][(o - (obj_batch * obj_limit))].GetRAmin() + 1)) + sx - sx_start)] = detections[obj_batch][(o - (obj_batch * obj_limit))].Get_vfield((((sy + chunk_y_start - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(2)) * (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) + sx + chunk_x_start - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0)));
-
-	      // update NOi
-	      NOi+=(detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_grid((((sy + chunk_y_start - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(2)) * (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) + sx + chunk_x_start - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_grid((((sy + chunk_y_start - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(2)) * (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) + sx + chunk_x_start - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0))));
-	      	      
-	    }
-	    
-	    // else . . . case 5.b
-	  }
-	    
-	  // for(sx = sx_start; sx <= sx_finish; ++sx)
-	}
-		
-	// for(sy = sy_start; sy <= sy_finish; ++sy)
-      }
-            
-      temp_sparse_reps_grid[((sx_finish - sx_start + 1) * (sy_finish - sy_start + 1))] = NOi;
-
-      // 6. replace the current sparse representation with the new sparse representation
-      detections[obj_batch][(o - (obj_batch * obj_limit))].ReInit_srep();
-      detections[obj_batch][(o - (obj_batch * obj_limit))].ReInit_mini();
- 
-      // update the sparse_reps_size array with the new bounding box
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Set_srep_size(0,detections[obj_batch][(o - (obj_batch * obj_limit))].GetRAmin());
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Set_srep_size(1,detections[obj_batch][(o - (obj_batch * obj_limit))].GetRAmax());
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Set_srep_size(2,detections[obj_batch][(o - (obj_batch * obj_limit))].GetDECmin());
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Set_srep_size(3,detections[obj_batch][(o - (obj_batch * obj_limit))].GetDECmax());
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Set_srep_size(4,detections[obj_batch][(o - (obj_batch * obj_limit))].GetFREQmin());
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Set_srep_size(5,detections[obj_batch][(o - (obj_batch * obj_limit))].GetFREQmax());
-
-      // update the sparse_reps_update array
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Set_srep_update(-1);
-          
-      // populate the new sparse_reps and postage stamps
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Create_srep_grid((1 + ((detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0) + 1) * (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(2) + 1))));
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Create_srep_strings((2 * NOi));
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Create_mom0(((detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0) + 1) * (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(2) + 1)));
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Create_RAPV(((detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0) + 1) * (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) + 1)));
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Create_DECPV(((detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(2) + 1) * (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) + 1)));
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Create_vfield(((detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0) + 1) * (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(2) + 1)));
-  
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Create_ospec((detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) + 1));
-      if((detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) + 1) >= 10){
-       
-	detections[obj_batch][(o - (obj_batch * obj_limit))].Create_rspec((2 * (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) + 1)));
-	
-      } else {
-	
-	detections[obj_batch][(o - (obj_batch * obj_limit))].Create_rspec((detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) + 11));
-
-      }
-   
-      for(j = 0; j < (1 + ((detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0) + 1) * (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(2) + 1))); ++j){ detections[obj_batch][(o - (obj_batch * obj_limit))].Set_srep_grid(j,temp_sparse_reps_grid[j]); }
-      for(j = 0; j < (2 * NOi); ++j){ detections[obj_batch][(o - (obj_batch * obj_limit))].Set_srep_strings(j,temp_sparse_reps_strings[j]); }
-      for(j = 0; j < ((detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0) + 1) * (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(2) + 1)); ++j){ detections[obj_batch][(o - (obj_batch * obj_limit))].Set_mom0(j,temp_mom0[j]); }
-      for(j = 0; j < ((detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0) + 1) * (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) + 1)); ++j){ detections[obj_batch][(o - (obj_batch * obj_limit))].Set_RAPV(j,temp_RAPV[j]); }
-      for(j = 0; j < ((detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(2) + 1) * (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) + 1)); ++j){ detections[obj_batch][(o - (obj_batch * obj_limit))].Set_DECPV(j,temp_DECPV[j]); }
-      for(j = 0; j < ((detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0) + 1) * (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(2) + 1)); ++j){ detections[obj_batch][(o - (obj_batch * obj_limit))].Set_vfield(j,temp_vfield[j]); }
-
-      for(j = 0; j < (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) + 1); ++j){ detections[obj_batch][(o - (obj_batch * obj_limit))].Set_ospec(j,temp_obj_spec[j]); }
-      if((detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) + 1) >= 10){
-
-	for(j = 0; j < (2 * (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) + 1)); ++j){ detections[obj_batch][(o - (obj_batch * obj_limit))].Set_rspec(j,temp_ref_spec[j]); }
-	
-      } else {
-
-	for(j = 0; j < (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) + 11); ++j){ detections[obj_batch][(o - (obj_batch * obj_limit))].Set_rspec(j,temp_ref_spec[j]); }
-
-      }
-      
-      // else . . . if(sparse_reps[obj_batch][(obj - (obj_batch * obj_limit))][0] < 0)
-    }
-    
-    // update progress on display
-    while(progress <= (((double) (o + 1) / ((double) obj)))){ std::cout << "*"; std::cout.flush(); progress+=0.05; }  
-   
-    // for(o = 0; o < obj; ++o)
-  }
-  std::cout << "* done." << std::endl;
-    
-  // 5. return the number of coherent objects 
-  return obj;
-  
-}
-
-// functions using doubles
-
-int CreateObjects(double * data_vals, int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, double intens_thresh_min, double intens_thresh_max, int flag_value, int start_obj, vector<object_props_dbl *> & detections, vector<int> & obj_ids, vector<int> & check_obj_ids, int obj_limit, int max_x_val, int max_y_val, int max_z_val, int ss_mode, int * data_metric, int * xyz_order){
- 
-  int x,y,z,obj,existing,sx,sy,sz,sx_start,sy_start,sz_start,sx_finish,sy_finish,sz_finish,init_limit,g;
-  int i,j,k,NOi, obj_batch, obj_batch_2,NO_obj_ids,NO_check_obj_ids;
-  int prev,x_start,y_start,temp_x[3],temp_y[3],temp_z[3];
-  float progress;
-  vector<double> temp_mom0, temp_RAPV, temp_DECPV, temp_obj_spec, temp_ref_spec, temp_vfield;
-  vector<int> match_init, temp_sparse_reps_grid, temp_sparse_reps_strings;
-
-  // convert the merging lengths from distances (in pixels/voxels) to empty space between linked detections (in pixels/voxels) --- subtract 1 --- this is a more naturual
-  // definition when processing a large file in chunks, because it makes it easier to build up sources that need to be retained for the rest of the input file
-  --merge_x;
-  --merge_y;
-  --merge_z;
-
-  // reorder the datacube and subcube limits to be in x,y,z order
-  temp_x[0] = chunk_x_start;
-  temp_y[0] = chunk_y_start;
-  temp_z[0] = chunk_z_start;
-  temp_x[1] = size_x;
-  temp_y[1] = size_y;
-  temp_z[1] = size_z;
-  temp_x[2] = max_x_val;
-  temp_y[2] = max_y_val;
-  temp_z[2] = max_z_val;
-  switch(xyz_order[0]){
-  case 1:
-    chunk_x_start = temp_x[0];
-    size_x = temp_x[1];
-    max_x_val = temp_x[2];
-    break;
-  case 2:
-    chunk_x_start = temp_y[0];
-    size_x = temp_y[1];
-    max_x_val = temp_y[2];
-    break;
-  case 3:
-    chunk_x_start = temp_z[0];
-    size_x = temp_z[1];
-    max_x_val = temp_z[2];
-    break;
-  default:
-    chunk_x_start = temp_x[0];
-    size_x = temp_x[1];
-    max_x_val = temp_x[2];
-    break;
-  }
-  switch(xyz_order[1]){
-  case 1:
-    chunk_y_start = temp_x[0];
-    size_y = temp_x[1];
-    max_y_val = temp_x[2];
-    break;
-  case 2:
-    chunk_y_start = temp_y[0];
-    size_y = temp_y[1];
-    max_y_val = temp_y[2];
-    break;
-  case 3:
-    chunk_y_start = temp_z[0];
-    size_y = temp_z[1];
-    max_y_val = temp_z[2];
-    break;
-  default:
-    chunk_y_start = temp_y[0];
-    size_y = temp_y[1];
-    max_y_val = temp_y[2];
-    break;
-  }
-  switch(xyz_order[2]){
-  case 1:
-    chunk_z_start = temp_x[0];
-    size_z = temp_x[1];
-    max_z_val = temp_x[2];
-    break;
-  case 2:
-    chunk_z_start = temp_y[0];
-    size_z = temp_y[1];
-    max_z_val = temp_y[2];
-    break;
-  case 3:
-    chunk_z_start = temp_z[0];
-    size_z = temp_z[1];
-    max_z_val = temp_z[2];
-    break;
-  default:
-    chunk_z_start = temp_z[0];
-    size_z = temp_z[1];
-    max_z_val = temp_z[2];
-    break;
-  }
-
-  // create temporary arrays
-  if(10000 > (((2 * merge_x) + 3) * ((2 * merge_y) + 3) * ((2 * merge_z) + 3))){
-    
-    init_limit = 10000;
-    
-  } else {
-    
-    init_limit = ((2 * merge_x) + 3) * ((2 * merge_y) + 3) * ((2 * merge_z) + 3) + 10;
-    
-  }
-  match_init.reserve(init_limit);
-  match_init.resize(0);
-
-  temp_sparse_reps_grid.reserve(1000000);
-  temp_sparse_reps_grid.resize(0);
-  temp_sparse_reps_strings.reserve(1000000);
-  temp_sparse_reps_strings.resize(0);
-  temp_mom0.reserve(1000000);
-  temp_mom0.resize(0);
-  temp_RAPV.reserve(1000000);
-  temp_RAPV.resize(0);
-  temp_DECPV.reserve(1000000);
-  temp_DECPV.resize(0);
-  temp_obj_spec.reserve(1000000);
-  temp_obj_spec.resize(0);
-  temp_ref_spec.reserve(1000000);
-  temp_ref_spec.resize(0);
-  temp_vfield.reserve(1000000);
-  temp_vfield.resize(0);
- 
-  // 0. initialise variables and arrays
-  obj = start_obj;
-  x_start = 0;
-  y_start = 0;
-  if(chunk_x_start > 0){ x_start = merge_x + 1; }
-  if(chunk_y_start > 0){ y_start = merge_y + 1; }
-  NO_obj_ids = obj_ids.size();
-  NO_check_obj_ids = check_obj_ids.size();
-
-  // 1. Create list of `coherent' objects from neighbouring voxels
-  
-  // for each grid point, check if it has been flagged as a source voxel, and assign
-  // it an object ID if it is. If a neighbouring voxel has already been flagged, assign 
-  // that ID to the grid point, otherwise, assign current value of obj and increment obj.
-  std::cout << "0 | |:| | : | |:| | 100% complete" << std::endl;
-  progress = 0.0;
-  for(z = 0; ((z < size_z) && ((z + chunk_z_start) < max_z_val)); ++z){
-
-    // if the z value is sufficiently large that objects have started to pop out of the merging box,
-    // then check if the objects outside of the merging box are sufficiently large
-    if(z > (merge_z + 1)){
-      
-      // initialise NOi to store the number of current check_obj_ids values that haven't moved outside of 
-      // the merging volume, and that form the basis for the new check_obj_ids list
-      NOi = 0;
-      
-      // apply size threshold to objects added since last size thresholding
-      for(i = 0; i < NO_check_obj_ids; ++i){
-	
-	// calculate the obj_batch value for the existing object
-	obj_batch = (int) floorf(((float) check_obj_ids[i] / (float) obj_limit));
-	
-	// move to the next object if this one has been re-initialised
-	if(detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].ShowVoxels() < 1){ continue; }
-	
-	// check if this object has moved outside of the merging box available to the next plane, if it 
-	// has apply a size threshold, otherwise use it to seed the new list of objects to be size thresholded
-	// the next time
-	if(detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetFREQmax() < (chunk_z_start + z - merge_z - 1)){
-	  
-	  // apply the size threshold, and if it fails re-initialise the object and pop its id to the list
-	  // of available obj_ids
-	  if((((detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetRAmax() - detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetRAmin() + 1) < min_x_size) || ((detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetDECmax() - detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetDECmin() + 1) < min_y_size) || ((detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetFREQmax() - detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetFREQmin() + 1) < min_z_size) || (detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].ShowVoxels() < min_v_size)) && (((detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetRAmin() - chunk_x_start) > merge_x) || (chunk_x_start == 0)) && ((((chunk_x_start + size_x - 1 - detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetRAmax()) > merge_x) || ((chunk_x_start + size_x) >= max_x_val)) && (((detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetDECmin() - chunk_y_start) > merge_y) || (chunk_y_start == 0)) && (((chunk_y_start + size_y - 1 - detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetDECmax()) > merge_y) || ((chunk_y_start + size_y) >= max_y_val)) && (((detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetFREQmin() - chunk_z_start) > merge_z) || (chunk_z_start == 0)) && (((chunk_z_start + size_z - 1 - detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetFREQmax()) > merge_z) || ((chunk_z_start + size_z) >= max_z_val)))){
-	    
-	    // re-initialise object
-	    detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].ReInit();
-	    if((detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].Get_srep_update() != 0) && (detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].Get_srep_size(0) >= 0)){
-	      
-	      detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].ReInit_srep();
-	      detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].ReInit_mini();
-
-	    }
-	    detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].ReInit_size();
-	    detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].Set_srep_update(0);
-
-	    // flag the `object' values within the bounding box and remove it from the flag_vals array
-	    sx_start = detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetRAmin() - chunk_x_start;
-	    if(sx_start < 0){ sx_start = 0; }
-	    sy_start = detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetDECmin() - chunk_y_start;
-	    if(sy_start < 0){ sy_start = 0; }
-	    sz_start = detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetFREQmin() - chunk_z_start;
-	    if(sz_start < 0){ sz_start = 0; }
-	    for(sz = sz_start; ((sz <= (detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetFREQmax() - chunk_z_start)) && (sz < size_z)); ++sz){
-	      
-	      for(sy = sy_start; ((sy <= (detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetDECmax() - chunk_y_start)) && (sy < size_y)); ++sy){
-		
-		for(sx = sx_start; ((sx <= (detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetRAmax() - chunk_x_start)) && (sx < size_x)); ++sx){
-		  
-		  if(flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx * data_metric[0]))] == check_obj_ids[i]){ flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx * data_metric[0]))] = -99; }
-		  
-		  // for(sx = x_start[(match_init[i] - (obj_batch_2 * obj_limit))]; sx <= x_finish[(match_init[i] - (obj_batch_2 * obj_limit))]; ++sx)
-		}
-		
-		// for(sy = y_start[(match_init[i] - (obj_batch_2 * obj_limit))]; sy <= y_finish[(match_init[i] - (obj_batch_2 * obj_limit))]; ++sy)
-	      }
-	      
-	      // for(sz = z_start[(match_init[i] - (obj_batch_2 * obj_limit))]; sz <= z_finish[(match_init[i] - (obj_batch_2 * obj_limit))]; ++sz)
-	    }
-	    
-	    // add object id to list of available ids
-	    j = -1;
-	    for(g = 0; g < NO_obj_ids; ++g){ if(obj_ids[g] == check_obj_ids[i]){ j = 1; break; } }
-	    if(j == -1){
-	      ++NO_obj_ids;
-	      obj_ids.push_back(check_obj_ids[i]);
-	    }
-
-	  }
-	  
-	  // if(z_finish[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))] < (z - merge_z - 1))
-	} else {
-	  
-	  check_obj_ids[NOi] = check_obj_ids[i];
-	  ++NOi;
-	  
-	  // else . . . if(z_finish[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))] < (z - merge_z - 1))
-	}
-	
-	// for(i = 0; i < NO_check_obj_ids; ++i)
-      }
-
-      // update NO_check_obj_ids
-      NO_check_obj_ids = NOi;
-      check_obj_ids.resize(NOi);
-      
-      // if(z > (merge_z + 2))
-    }
-    
-    for(y = y_start; (y < size_y) && ((chunk_y_start + y) < max_y_val); ++y){
-      
-      for(x = x_start; (x < size_x) && ((chunk_x_start + x) < max_x_val); ++x){
-	
-	// if this is a source voxel, check if it is associated with a previously identified
-	// source voxel
-	if(flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (x*data_metric[0]))] == flag_value){ 
-	  
-	  // 1.  initialise variables
-	  existing = flag_value;
-	  NOi = 0;
-	  match_init.resize(0);
-	  
-	  // 3. initial pass, check the voxels within the merging distance to see if any have been
-	  // identified as previous objects
-	  
-	  // 3a. set limits of region to be searched
-	  sx_start = x - merge_x - 1;
-	  if(sx_start < 0){ sx_start = 0; }
-	  sy_start = y - merge_y - 1;
-	  if(sy_start < 0){ sy_start = 0; }
-	  sz_start = z - merge_z - 1;
-	  if(sz_start < 0){ sz_start = 0; }
-	  
-	  // 3b. search through previous region and modify existing flag if required
-
-	  if(ss_mode == 1){
-	    
-	    // use a rectangular paralleliped to do the linking
-
-	    for(sz = sz_start; (sz < z); ++sz){
-	    
-	      for(sy = sy_start; (sy <= (y + merge_y + 1)) && (sy < size_y); ++sy){
-	      
-		for(sx = sx_start; (sx <= (x + merge_x + 1)) && (sx < size_x); ++sx){
-		
-		  // check if this test voxel is source
-		  if((flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] == flag_value) || (flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] >= 0)){
-		    
-		    // check if this is a new objid
-		    prev = -1;
-		    for(i = 0; (i < NOi) && (i < init_limit); ++i){
-		      
-		      if(match_init[i] == flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))]){
-			
-			prev = 1;
-			break;
-			
-		      }
-		      
-		    }
-		    if(prev == -1){ 
-		      
-		      // add current object to list of previous matches
-		      match_init.push_back(flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))]);
-		      ++NOi;
-
-		    }
-		    
-		    // update existing flag
-		    if(((flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] < existing) && (flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] >= 0)) || (existing == flag_value)){ existing = flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))]; }
-		    
-		  }
-		  
-		  // for(sx = x_start; (sx < (x + merge_x + 1)) && (sx < size_x); ++sx)
-		}
-		
-		// for(sy = y_start; (sy < (y + merge_y + 1)) && (sy < size_y); ++sy)
-	      }
-	      
-	      // for(sz = z_start; (sz < z); ++sz)
-	    }
-	    for(sy = sy_start; (sy < y); ++sy){
-	      
-	      for(sx = sx_start; (sx <= (x + merge_x + 1)) && (sx < size_x); ++sx){
-		
-		// check if this test voxel is source
-		if((flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] == flag_value) || (flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] >= 0)){
-		  
-		  // check if this is a new objid, move on if not
-		  prev = -1;
-		  for(i = 0; (i < NOi) && (i < init_limit); ++i){
-		    
-		    if(match_init[i] == flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))]){
-		      
-		      prev = 1;
-		      break;
-		      
-		    }
-		    
-		  }
-		  if(prev == -1){ 
-		    
-		    // add current object to list of previous matches
-		    ++NOi;
-		    match_init.push_back(flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))]);
-
-		  }
-		  
-		  // update existing flag
-		  if(((flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] < existing) && (flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] >= 0)) || (existing == flag_value)){ existing = flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))]; }
-		  
-		}		
-		
-		// for(sx = x_start; (sx < = (x + merge_x + 1)) && (sx < size_x); ++sx)
-	      }
-	      
-	      // for(sy = y_start; (sy < y) && (sy < size_y); ++sy)
-	    }
-	    for(sx = sx_start; sx < x; ++sx){
-	      
-	      // check if this test voxel is source
-	      if((flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))] == flag_value) || (flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))] >= 0)){
-		
-		// check if this is a new objid, move on if not
-		prev = -1;
-		for(i = 0; (i < NOi) && (i < init_limit); ++i){
-		  
-		  if(match_init[i] == flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))]){
-		    
-		    prev = 1;
-		    break;
-		    
-		  }
-		  
-		}
-		if(prev == -1){ 
-		  
-		  // add current object to list of previous matches
-		  ++NOi;
-		  match_init.push_back(flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))]);
-
-		}
-		
-		// update existing flag
-		if(((flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))] < existing) && (flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))] >= 0)) || (existing == flag_value)){ existing = flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))]; }
-		
-	      }	  
-	      
-	      // for(sx = x_start; sx <= x; ++sx)
-	    }
-	  
-	    // if(ss_mode == 1)
-	  } else {
-
-	    // use a cylinder for the linking lengths
-
-	    for(sz = sz_start; (sz < z); ++sz){
-	    
-	      for(sy = sy_start; (sy <= (y + merge_y + 1)) && (sy < size_y); ++sy){
-	      
-		for(sx = sx_start; (sx <= (x + merge_x + 1)) && (sx < size_x); ++sx){
-		
-		  // check if the test voxel is within the boundaries of the spatial ellipse
-		  if(((((float) (x - sx)) * ((float) (x - sx)) / (((float) (merge_x + 1)) * ((float) (merge_x + 1)))) + (((float) (y - sy)) * ((float) (y - sy)) / (((float) (merge_y + 1)) * ((float) (merge_y + 1))))) > 1.0){ continue; }
-
-		  // check if this test voxel is source
-		  if((flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] == flag_value) || (flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] >= 0)){
-
-		    // check if this is a new objid
-		    prev = -1;
-		    for(i = 0; (i < NOi) && (i < init_limit); ++i){
-		      
-		      if(match_init[i] == flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))]){
-			
-			prev = 1;
-			break;
-			
-		      }
-		      
-		    }
-		    if(prev == -1){ 
-		      
-		      // add current object to list of previous matches
-		      ++NOi;
-		      match_init.push_back(flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))]);
-
-		    }
-		    
-		    // update existing flag
-		    if(((flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] < existing) && (flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] >= 0)) || (existing == flag_value)){ existing = flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))]; }
-		    
-		  }
-		  
-		  // for(sx = x_start; (sx < (x + merge_x + 1)) && (sx < size_x); ++sx)
-		}
-		
-		// for(sy = y_start; (sy < (y + merge_y + 1)) && (sy < size_y); ++sy)
-	      }
-	      
-	      // for(sz = z_start; (sz < z); ++sz)
-	    }
-	    for(sy = sy_start; (sy < y); ++sy){
-	      
-	      for(sx = sx_start; (sx <= (x + merge_x + 1)) && (sx < size_x); ++sx){
-		
-		// check if the test voxel is within the boundaries of the spatial ellipse
-		if(((((float) (x - sx)) * ((float) (x - sx)) / (((float) (merge_x + 1)) * ((float) (merge_x + 1)))) + (((float) (y - sy)) * ((float) (y - sy)) / (((float) (merge_y + 1)) * ((float) (merge_y + 1))))) > 1.0){ continue; }
-
-		// check if this test voxel is source
-		if((flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] == flag_value) || (flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] >= 0)){
-		  
-		  // check if this is a new objid, move on if not
-		  prev = -1;
-		  for(i = 0; (i < NOi) && (i < init_limit); ++i){
-		    
-		    if(match_init[i] == flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))]){
-		      
-		      prev = 1;
-		      break;
-		      
-		    }
-		    
-		  }
-		  if(prev == -1){ 
-		    
-		    // add current object to list of previous matches
-		    ++NOi;
-		    match_init.push_back(flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))]);
-
-		  }
-		  
-		  // update existing flag
-		  if(((flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] < existing) && (flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] >= 0)) || (existing == flag_value)){ existing = flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))]; }
-		  
-		}		
-		
-		// for(sx = x_start; (sx < = (x + merge_x + 1)) && (sx < size_x); ++sx)
-	      }
-	      
-	      // for(sy = y_start; (sy < y) && (sy < size_y); ++sy)
-	    }
-	    for(sx = sx_start; sx < x; ++sx){
-	      
-	      // check if this test voxel is source
-	      if((flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))] == flag_value) || (flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))] >= 0)){
-		
-		// check if this is a new objid, move on if not
-		prev = -1;
-		for(i = 0; (i < NOi) && (i < init_limit); ++i){
-		  
-		  if(match_init[i] == flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))]){
-		    
-		    prev = 1;
-		    break;
-		    
-		  }
-		  
-		}
-		if(prev == -1){ 
-		  
-		  // add current object to list of previous matches
-		  ++NOi;
-		  match_init.push_back(flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))]);
-		  
-		}
-		
-		// update existing flag
-		if(((flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))] < existing) && (flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))] >= 0)) || (existing == flag_value)){ existing = flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))]; }
-		
-	      }	  
-	      
-	      // for(sx = x_start; sx <= x; ++sx)
-	    }
-
-	    // else . . . if(ss_mode == 1)
-	  }
-
-	  // 3c. assign an object number to this voxel, depending upon the value of the existing flag,
-	  // and if this is part of an existing object or objects, then daisy chain from this voxel to all the others
-	  if(existing == flag_value){
-	    
-	    // get obj value from array of obj_ids, then replace it with an incremented obj value
-	    
-	    // ensure that the obj_ids array is sorted
-	    sort(obj_ids.begin(),obj_ids.end());
-	    
-	    // assign value to array
-	    flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (x*data_metric[0]))] = obj_ids[0]; 
-	    
-	    // calculate the obj_batch value for this obj_id
-	    obj_batch = (int) floorf(((float) obj_ids[0] / (float) obj_limit));
-	    
-	    // add this initial point to the object
-	    detections[obj_batch][(obj_ids[0] - (obj_batch * obj_limit))].AddPoint(((double) (chunk_x_start + x)),((double) (chunk_y_start + y)),((double) (chunk_z_start + z)),data_vals[((z*data_metric[2]) + (y*data_metric[1]) + (x*data_metric[0]))]);
-
-	    // push id to list of objects that need to be size thresholded
-	    i = -1;
-	    for(g = 0; g < NO_check_obj_ids; ++g){ if(check_obj_ids[g] == obj_ids[0]){ i = 1; break; } }
-	    if(i == -1){
-
-	      ++NO_check_obj_ids;
-	      check_obj_ids.push_back(obj_ids[0]);
-	      
-	    }
-
-	    // adjust obj and obj_ids
-	    if(NO_obj_ids > 1){
-	      
-	      for(i = 0; i < (NO_obj_ids - 1); ++i){ obj_ids[i] = obj_ids[(i + 1)]; }
-	      --NO_obj_ids;
-	      obj_ids.resize(NO_obj_ids);
-
-	    } else {
-	      
-	      ++obj;
-
-	      obj_ids[0] = obj;
-	      
-	      // if this obj_id modulo obj_limit == 0, then it's the first obj of a new batch
-	      // so create a new batch of objects
-	      if((obj % obj_limit) == 0){ 
-				
-		detections.push_back(new object_props_dbl[obj_limit]);
-				
-		// if((obj % obj_limit) == 0)
-	      }
-			      
-	      // if(NO_obj_ids > 1) { } else 
-	    }
-	    
-	    // if(existing == -1)
-	  } else if(existing >= 0){
-	    
-	    // assign the current voxel being processed the correct flag value, and update
-	    // the bounding box
-	    
-	    // add object to list of objects within the merging box, provided that it hasn't been added already
-	    i = -1;
-	    for(g = 0; g < NO_check_obj_ids; ++g){ if(check_obj_ids[g] == existing){ i = 1; break; } }
-	    if(i == -1){
-
-	      ++NO_check_obj_ids;
-	      check_obj_ids.push_back(existing);
-
-	    }
-
-	    // assign value to array
-	    flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (x*data_metric[0]))] = existing;
-	    
-	    // calculate the obj_batch value for the existing object
-	    obj_batch = (int) floorf(((float) existing / (float) obj_limit));
-	    
-	    // add this point to the existing object
-	    detections[obj_batch][(existing - (obj_batch * obj_limit))].AddPoint((chunk_x_start + x),(chunk_y_start + y),(chunk_z_start + z),data_vals[((z*data_metric[2]) + (y*data_metric[1]) + (x*data_metric[0]))]);
-	    
-	    // for each object detected within the merging volume, update all of the values within the bounding box of this object
-	    // to be the same as the other part of this object, and update the bounding box at the same time
-	    if(NOi > 1){
-	      
-	      for(i = 0; i < NOi; ++i){
-		
-		// move on if this is the existing object
-		if(match_init[i] == existing){ 
-
-		  continue; 
-
-		}
-		
-		// calculate a temporary obj_batch value
-		obj_batch_2 = (int) floorf(((float) match_init[i] / (float) obj_limit));		
-		
-		// add this object to an existing object
-		//detections[obj_batch][(existing - (obj_batch * obj_limit))].AddObject(detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))]);
-		detections[obj_batch][(existing - (obj_batch * obj_limit))].AddObject(detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))],temp_sparse_reps_grid,temp_sparse_reps_strings,temp_mom0,temp_RAPV,temp_DECPV,temp_ref_spec,temp_obj_spec,temp_vfield);
-		
-		// flag the `object' values within the bounding box to merge it with the base object
-		sx_start = detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))].GetRAmin() - chunk_x_start;
-		if(sx_start < 0){ sx_start = 0; }
-		sy_start = detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))].GetDECmin() - chunk_y_start;
-		if(sy_start < 0){ sy_start = 0; }
-		sz_start = detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))].GetFREQmin() - chunk_z_start;
-		if(sz_start < 0){ sz_start = 0; }
-		for(sz = sz_start; (sz <= detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))].GetFREQmax() - chunk_z_start) && (sz < size_z); ++sz){
-		  
-		  for(sy = sy_start; (sy <= detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))].GetDECmax() - chunk_y_start) && (sy < size_y); ++sy){
-		    
-		    for(sx = sx_start; (sx <= detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))].GetRAmax() - chunk_x_start) && (sx < size_x); ++sx){
-		      
-		      if(flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] == match_init[i]){ flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] = existing; }
-		      
-		      // for(sx = x_start[(match_init[i] - (obj_batch_2 * obj_limit))]; sx <= x_finish[(match_init[i] - (obj_batch_2 * obj_limit))]; ++sx)
-		    }
-		    
-		    // for(sy = y_start[(match_init[i] - (obj_batch_2 * obj_limit))]; sy <= y_finish[(match_init[i] - (obj_batch_2 * obj_limit))]; ++sy)
-		  }
-		  
-		  // for(sz = z_start[(match_init[i] - (obj_batch_2 * obj_limit))]; sz <= z_finish[(match_init[i] - (obj_batch_2 * obj_limit))]; ++sz)
-		}
-			
-		// re-initialise the `object' values for the match_init[i] object that has just been merged into the existing object, 
-		// and push the obj value (match_init[i]) to the top of the array of values
-		detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))].ReInit();
-		if((detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))].Get_srep_update() != 0) && (detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))].Get_srep_size(0) >= 0)){
-		  
-		  detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))].ReInit_srep();
-		  detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))].ReInit_mini();
-
-		}
-		detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))].ReInit_size();
-		detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))].Set_srep_update(0);
-
-		j = -1;
-		for(g = 0; g < NO_obj_ids; ++g){ if(obj_ids[g] == match_init[i]){ j = 1; break; } }
-		if(j == -1){
-		  
-		  ++NO_obj_ids;
-		  obj_ids.push_back(match_init[i]);
-		  		  
-		}
-		
-		// for(i = 0; i < NOi; ++i)
-	      }
-	      
-	      // if(NOi > 1)
-	    }
-	    
-	    // else . . . if(existing == -1)
-	  }
-	  
-	  // if(flag_vals[((z*size_x*size_y) + (y*size_x) + x)] == -1)
-	}
-	
-	// update progress on display
-	while(progress <= (((float) ((z * size_x * size_y) + (y * size_x) + x + 1)) / ((float) (size_x * size_y * size_z)))){ std::cout << "*"; std::cout.flush(); progress+=0.05; }
-	
-	// for(x = 0; x < size_x; ++x)
-      }
-      
-      // for(y = 0; y < size_y; ++y)
-    }
-    
-    // for(z = 0; z < size_z; ++z)
-  }
-  std::cout << "* done." << std::endl;
-  
-  // 4. generate sparse representations of coherent objects that are retained after
-  // this `chunk' of the datacube is processed
-  std::cout << "Generating/updating sparse representations of sources . . . " << std::endl;
-  std::cout << "0 | |:| | : | |:| | 100% complete" << std::endl;
-  progress = 0.0;
-  for(i = 0; i < obj; ++i){
-    
-    // calculate the obj_batch value for this object
-    obj_batch = floorf(((float) i / (float) obj_limit));
-    
-    // move on if this object has been re-initialised
-    if(detections[obj_batch][(i - (obj_batch * obj_limit))].ShowVoxels() < 1){ 
-      
-      // update progress on display
-      while(progress <= (((float) (i + 1) / ((float) obj)))){ std::cout << "*"; std::cout.flush(); progress+=0.05; }  
-      continue; 
-      
-    }
-    
-    // move on if this object is not within the boundaries of the current chunk, in other words,
-    // move on if this object doesn't need to have it's sparse representation and postage stamp images updated
-    if((detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmax() < chunk_x_start) || (detections[obj_batch][(i - (obj_batch * obj_limit))].GetDECmax() < chunk_y_start) || (detections[obj_batch][(i - (obj_batch * obj_limit))].GetFREQmax() < chunk_z_start) || (detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmin() >= (chunk_x_start + size_x)) || (detections[obj_batch][(i - (obj_batch * obj_limit))].GetDECmin() >= (chunk_y_start + size_y)) || (detections[obj_batch][(i - (obj_batch * obj_limit))].GetFREQmin() >= (chunk_z_start + size_z))){ 
-
-      // update progress on display
-      while(progress <= (((float) (i + 1) / ((float) obj)))){ std::cout << "*"; std::cout.flush(); progress+=0.05; }  
-      continue; 
-      
-    }
-    
-    // move on if this object's sparse representation and postage stamp images don't need updating
-    if((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) >= 0) && (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_update() == -1)){
-      
-      // update progress on display
-      while(progress <= (((float) (i + 1) / ((float) obj)))){ std::cout << "*"; std::cout.flush(); progress+=0.05; }  
-      continue; 
-	
-    }
-          
-    // update the sparse representation for this object
-    
-    // 0. if there is no existing sparse representation and postage stamp images, create them from scratch, 
-    // otherwise concatenate the existing sparse representation and postage stamp images with the updates
-    if((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) < 0) && (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_update() >= 0)){
-      
-      // branch for creating a brand new sparse representation
-      
-      // update the sparse_reps_update array
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_update(-1);
-
-      // initialise the number of object sections that make up this object
-      NOi = 0;   
-      
-      // calculate the edge of the bounding box in `chunk' co-ordinates
-      sx_start = detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmin() - chunk_x_start;
-      if(sx_start < 0){ sx_start = 0; }
-      sx_finish = detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmax() - chunk_x_start;
-      sy_start = detections[obj_batch][(i - (obj_batch * obj_limit))].GetDECmin() - chunk_y_start;
-      if(sy_start < 0){ sy_start = 0; }
-      sy_finish = detections[obj_batch][(i - (obj_batch * obj_limit))].GetDECmax() - chunk_y_start;
-      sz_start = detections[obj_batch][(i - (obj_batch * obj_limit))].GetFREQmin() - chunk_z_start;
-      if(sz_start < 0){ sz_start = 0; }
-      sz_finish = detections[obj_batch][(i - (obj_batch * obj_limit))].GetFREQmax() - chunk_z_start;
-      
-      // count the number of object sections that make up this object
-      for(sy = sy_start; (sy <= sy_finish) && (sy < size_y); ++sy){
-	
-	for(sx = sx_start; (sx <= sx_finish) && (sx < size_x); ++sx){
-	  
-	  // initialise the dummy integer j
-	  j = -1;
-	  
-	  for(sz = sz_start; (sz <= sz_finish) && (sz < size_z); ++sz){
-	    
-	    // change j to reflect if this voxel in the flag_vals array belongs to the source
-	    if(flag_vals[((sz * data_metric[2]) + (sy * data_metric[1]) + (sx * data_metric[0]))] == i){ 
-	      
-	      // if previously this was not part of an object string, j == -1, then increment the number of object strings and
-	      // adjust the value of j
-	      if(j == -1){ ++NOi; }
-	      
-	      // change j to reflect that this voxel belongs to the object
-	      j = 1; 
-	      
-	    } else { j = -1; }
-	    
-	    // for(sz = detections[obj_batch][(obj - (obj_batch * obj_limit))].GetFREQmin() - chunk_z_size; sz <= (detections[obj_batch][(obj - (obj_batch * obj_limit))].GetFREQmax() - chunk_z_size); ++sz)
-	  }
-	  
-	  // for(sx = detections[obj_batch][(obj - (obj_batch * obj_limit))].GetRAmin() - chunk_x_size; sx <= (detections[obj_batch][(obj - (obj_batch * obj_limit))].GetRAmax() - chunk_x_size); ++sx)
-	}
-	
-	// for(sy = detections[obj_batch][(obj - (obj_batch * obj_limit))].GetDECmin() - chunk_y_size; sy <= (detections[obj_batch][(obj - (obj_batch * obj_limit))].GetDECmax() - chunk_y_size); ++sy)
-      }
-
-      // create an array element to store this sparse representation
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_size(0,detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmin());
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_size(1,detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmax());
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_size(2,detections[obj_batch][(i - (obj_batch * obj_limit))].GetDECmin());
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_size(3,detections[obj_batch][(i - (obj_batch * obj_limit))].GetDECmax());
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_size(4,detections[obj_batch][(i - (obj_batch * obj_limit))].GetFREQmin());
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_size(5,detections[obj_batch][(i - (obj_batch * obj_limit))].GetFREQmax());
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Create_srep_grid((((detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmax() - detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmin() + 1) * (detections[obj_batch][(i - (obj_batch * obj_limit))].GetDECmax() - detections[obj_batch][(i - (obj_batch * obj_limit))].GetDECmin() + 1)) + 1));
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Create_srep_strings((2 * NOi));
-      
-      // calculate the extent of the sparse_rep volume
-      sx_finish = detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmax() - detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmin() + 1;
-      sy_finish = detections[obj_batch][(i - (obj_batch * obj_limit))].GetDECmax() - detections[obj_batch][(i - (obj_batch * obj_limit))].GetDECmin() + 1;
-      sz_finish = detections[obj_batch][(i - (obj_batch * obj_limit))].GetFREQmax() - detections[obj_batch][(i - (obj_batch * obj_limit))].GetFREQmin() + 1;
-      
-      // create arrays to store the postage stamp images and initialise them
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Create_mom0((sx_finish * sy_finish));
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Create_RAPV((sx_finish * sz_finish));
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Create_DECPV((sy_finish * sz_finish));
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Create_ospec(sz_finish);
-      if(sz_finish >= 10){
-
-	detections[obj_batch][(i - (obj_batch * obj_limit))].Create_rspec((2 * sz_finish));
-
-      } else {
-
-	detections[obj_batch][(i - (obj_batch * obj_limit))].Create_rspec((10 + sz_finish));
-
-      }
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Create_vfield((sx_finish * sy_finish));
-      
-      // initialise the mini_mom0 values
-      for(sy = 0; sy < sy_finish; ++sy){
-	for(sx = 0; sx < sx_finish; ++sx){
-	  detections[obj_batch][(i - (obj_batch * obj_limit))].Set_mom0(((sy * sx_finish) + sx),0.0);
-	}
-      }
-
-      // initialise the mini_RAPV values
-      for(sz = 0; sz < sz_finish; ++sz){
-	for(sx = 0; sx < sx_finish; ++sx){
-	  detections[obj_batch][(i - (obj_batch * obj_limit))].Set_RAPV(((sz * sx_finish) + sx),0.0);
-	}
-      }
-      
-      // initialise the mini_DECPV values
-      for(sz = 0; sz < sz_finish; ++sz){
-	for(sy = 0; sy < sy_finish; ++sy){
-	  detections[obj_batch][(i - (obj_batch * obj_limit))].Set_DECPV(((sz * sy_finish) + sy),0.0);
-	}
-      }
-      
-      // initialise the mini_spec values
-      for(sz = 0; sz < sz_finish; ++sz){ detections[obj_batch][(i - (obj_batch * obj_limit))].Set_ospec(sz,0.0); }
-      if(sz_finish >= 10){
-
-	for(sz = 0; sz < (2 * sz_finish); ++sz){ detections[obj_batch][(i - (obj_batch * obj_limit))].Set_rspec(sz,0.0); }
-
-      } else {
-
-	for(sz = 0; sz < (10 + sz_finish); ++sz){ detections[obj_batch][(i - (obj_batch * obj_limit))].Set_rspec(sz,0.0); }
-
-      }
-            
-      // initialise the mini_vfield values
-      for(sy = 0; sy < sy_finish; ++sy){
-	for(sx = 0; sx < sx_finish; ++sx){
-	  detections[obj_batch][(i - (obj_batch * obj_limit))].Set_vfield(((sy * sx_finish) + sx),0.0);
-	}
-      }
-
-      // populate the sparse array representation and postage stamp images
-      NOi = 0;
-      for(sy = 0; sy < sy_finish; ++sy){
-	
-	for(sx = 0; sx < sx_finish; ++sx){
-	  
-	  // write the current number of object strings to the grid
-	  detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_grid(((sy * sx_finish) + sx),NOi);
-	  
-	  // initialise the dummy integer j 
-	  j = -1;
-	  
-	  for(sz = 0; sz < sz_finish; ++sz){
-	    
-	    // change j to reflect if this voxel in the flag_vals array belongs to the source
-	    if(flag_vals[(((sz + sz_start) * data_metric[2]) + ((sy + sy_start) * data_metric[1]) + ((sx + sx_start) * data_metric[0]))] == i){ 
-	      
-	      // update mini_mom0
-	      detections[obj_batch][(i - (obj_batch * obj_limit))].Add_mom0(((sy * sx_finish) + sx),data_vals[(((sz + sz_start) * data_metric[2]) + ((sy + sy_start) * data_metric[1]) + ((sx + sx_start) * data_metric[0]))]);
-	      
-	      // update mini_RAPV
-	      detections[obj_batch][(i - (obj_batch * obj_limit))].Add_RAPV(((sz * sx_finish) + sx),data_vals[(((sz + sz_start) * data_metric[2]) + ((sy + sy_start) * data_metric[1]) + ((sx + sx_start) * data_metric[0]))]);
-	      
-	      // update mini_DECPV
-	      detections[obj_batch][(i - (obj_batch * obj_limit))].Add_DECPV(((sz * sy_finish) + sy),data_vals[(((sz + sz_start) * data_metric[2]) + ((sy + sy_start) * data_metric[1]) + ((sx + sx_start) * data_metric[0]))]);
-	      
-	      // update mini_obj_spec
-	      detections[obj_batch][(i - (obj_batch * obj_limit))].Add_ospec(sz,data_vals[(((sz + sz_start) * data_metric[2]) + ((sy + sy_start) * data_metric[1]) + ((sx + sx_start) * data_metric[0]))]);
-  
-	      // update mini_vfield
-	      detections[obj_batch][(i - (obj_batch * obj_limit))].Add_vfield(((sy * sx_finish) + sx),(((double) (sz + sz_start + chunk_z_start)) * data_vals[(((sz + sz_start) * data_metric[2]) + ((sy + sy_start) * data_metric[1]) + ((sx + sx_start) * data_metric[0]))]));
-	      
-	      // if previously this was not part of an object string, j == -1, then increment the number of object strings and
-	      // write the position to the sparse_reps array
-	      if(j == -1){ 
-		
-		// write the beginning of the object string to sparse_reps
-		detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_strings((2 * NOi),(sz_start + chunk_z_start + sz));
-		
-		// increment NOi
-		++NOi; 
-		
-		// initialise the end of the object string in sparse_reps
-		detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_strings(((2 * NOi) - 1),(sz_start + chunk_z_start + sz));
-
-	      } else {
-		
-		// update the end of the object string in sparse_reps
-		detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_strings(((2 * NOi) - 1),(sz_start + chunk_z_start + sz));
-		
-	      }
-	      
-	      // change j to reflect that this voxel belongs to the object
-	      j = 1; 
-	      
-	    } else { 
-	      
-	      // change j to reflect that this voxel doesn't belong to the object
-	      j = -1; 
-	      
-	    }
-	    
-	    // for(sz = detections[obj_batch][(obj - (obj_batch * obj_limit))].GetFREmin() - chunk_z_start + 1; sz <= (detections[obj_batch][(obj - (obj_batch * obj_limit))].GetFREQmax() - chunk_z_start + 1); ++sz)
-	  }
-	  
-	  // for(sx = detections[obj_batch][(obj - (obj_batch * obj_limit))].GetRAmin() - chunk_x_start + 1; sx <= (detections[obj_batch][(obj - (obj_batch * obj_limit))].GetRAmax() - chunk_x_start + 1); ++sx)
-	}
-	
-	//for(sy = detections[obj_batch][(obj - (obj_batch * obj_limit))].GetDECmin() - chunk_y_start + 1; sy <= (detections[obj_batch][(obj - (obj_batch * obj_limit))].GetDECmax() - chunk_y_start + 1); ++sy)
-      }
-            
-      // update sparse_reps with the final value of NOi
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_grid((sx_finish * sy_finish),NOi);
-            
-      // create the reference spectrum
-      if(sz_finish >= 10){
-	
-	for(sz = -1 * (int) floorf((0.5 * (float) sz_finish)); sz < (sz_finish + ((int) floorf((0.5 * (float) sz_finish)))); ++sz){
-	  
-	  for(sy = 0; sy < sy_finish; ++sy){
-	  
-	    for(sx = 0; sx < sx_finish; ++sx){
-	    
-	      if(((sz + sz_start) >= 0) && ((sz + sz_start) < size_z)){
-		
-		// update mini_ref_spec	
-		detections[obj_batch][(i - (obj_batch * obj_limit))].Add_rspec((sz + ((int) floorf((0.5 * (double) sz_finish)))),data_vals[(((sz + sz_start) * data_metric[2]) + ((sy + sy_start) * data_metric[1]) + ((sx + sx_start) * data_metric[0]))]);	
-		
-	      }
-	      
-	    }
-	    
-	  }
-      
-	}
-
-	// if(sz_finish >= 10)
-      } else {
-
-	for(sz = -5; sz < (sz_finish + 5); ++sz){
-	  
-	  for(sy = 0; sy < sy_finish; ++sy){
-	  
-	    for(sx = 0; sx < sx_finish; ++sx){
-	    
-	      if(((sz + sz_start) >= 0) && ((sz + sz_start) < size_z)){
-		
-		// update mini_ref_spec
-		detections[obj_batch][(i - (obj_batch * obj_limit))].Add_rspec((sz + 5),data_vals[(((sz + sz_start) * data_metric[2]) + ((sy + sy_start) * data_metric[1]) + ((sx + sx_start) * data_metric[0]))]);	
-		
-	      }
-	      
-	    }
-	    
-	  }
-      
-	}
-
-	// else . . . if(sz_finish >= 10)
-      }
-      
-     // if(sparse_reps[obj_batch][(obj - (obj_batch * obj_limit))][0] < 0) . . . else
-    } else {
-            
-      // branch for updating an existing sparse representation
-      
-      // count the number of object strings comprising the object
-      
-      // 1. initialise the number of object strings
-      NOi = 0;
-      
-      // 2. convert the new bounding box of the object into `chunk' co-ordinates
-      sx_start = detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmin() - chunk_x_start;
-      sx_finish = detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmax() - chunk_x_start;
-      sy_start = detections[obj_batch][(i - (obj_batch * obj_limit))].GetDECmin() - chunk_y_start;
-      sy_finish = detections[obj_batch][(i - (obj_batch * obj_limit))].GetDECmax() - chunk_y_start;
-      sz_start = detections[obj_batch][(i - (obj_batch * obj_limit))].GetFREQmin() - chunk_z_start;
-      if(sz_start < 0){ sz_start = 0; }
-      sz_finish = detections[obj_batch][(i - (obj_batch * obj_limit))].GetFREQmax() - chunk_z_start;
-      
-      // 3. search through the bounding box, and do one of the following
-      // 3.a if inside the chunk and outside the existing sparse rep grid, run the routine to count the number
-      //     of object strings along the current line of sight
-      // 3.b otherwise use the grid value to increment NOi
-      for(sy = sy_start; sy <= sy_finish; ++sy){
-	
-	for(sx = sx_start; sx <= sx_finish; ++sx){
-	  	  
-	  // case 3.a triggered
-	  if(((sx > merge_x) || (chunk_x_start == 0)) && ((sy > merge_y) || (chunk_y_start == 0))){
-	    	    
-	    // initialise the dummy integer j 
-	    j = -1;
-	    
-	    for(sz = sz_start; sz <= sz_finish; ++sz){
-	      
-	      // change i to reflect if this voxel in the flag_vals array belongs to the source
-	      if(flag_vals[((sz * data_metric[2]) + (sy * data_metric[1]) + (sx * data_metric[0]))] == i){ 
-		
-		// if previously this was not part of an object string, i == -1, then increment the number of object strings and
-		// write the position to the sparse_reps array
-		if(j == -1){ 
-		  
-		  // increment NOi
-		  ++NOi; 
-		  
-		} 
-		
-		// change j to reflect that this voxel belongs to the object
-		j = 1; 
-		
-	      } else { j = -1; }
-	      
-	      // for(sz = sz_start; sz <= sz_finish; ++sz)
-	    }
-	    
-	  } else {
-	    
-	    // case 3.b triggered  
-	    NOi+=(detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_grid((((sy + chunk_y_start - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2)) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) + sx + chunk_x_start - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_grid((((sy + chunk_y_start - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2)) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) + sx + chunk_x_start - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0))));
-	    
-	  }     
-	  
-	  // for(sx = sx_start; sx <= sx_finish; ++sx)
-	}
-	
-	// for(sy = sy_start; sy <= sy_finish; ++sy)
-      }
-      
-      // 4. allocate memory to store temporary sparse representation and postage stamp images, then
-      //    initialise the postage stamp image arrays
-      temp_mom0.resize(0);
-      for(sy = 0; sy < (sy_finish - sy_start + 1); ++sy){
-	for(sx = 0; sx < (sx_finish - sx_start + 1); ++sx){
-	  temp_mom0.push_back(0.0);
-	}
-      }
-      temp_RAPV.resize(0);
-      for(sz = 0; sz < (sz_finish - sz_start + 1); ++sz){
-	for(sx = 0; sx < (sx_finish - sx_start + 1); ++sx){
-	  temp_RAPV.push_back(0.0);
-	}
-      }
-      temp_DECPV.resize(0);
-      for(sz = 0; sz < (sz_finish - sz_start + 1); ++sz){
-	for(sy = 0; sy < (sy_finish - sy_start + 1); ++sy){
-	  temp_DECPV.push_back(0.0);
-	}
-      }
-      temp_obj_spec.resize(0);
-      for(sz = 0; sz < (sz_finish - sz_start + 1); ++sz){ temp_obj_spec.push_back(0.0); }
-      if((sz_finish - sz_start + 1) >= 10){
+// Scanning engine. Every source voxel is compared with the previously processed voxels within its
+// merging box, and takes the lowest object ID found there --- merging any other objects into that one,
+// by rewriting their voxels within their bounding box. The engine is specialised at compile time on the
+// shape of the merging box (SS_MODE) and on whether the x axis is contiguous in memory (UNIT_X), so that
+// the default axis order gets unit strides in the innermost loops. Other axis orders use the strides of
+// the data_metric array. Only the runs of source voxels in each row are visited: they are either taken
+// from a list of runs given by the caller --- CreateObjectsRuns --- or found by scanning the row.
+// Merging lengths of 1 only link the nearest neighbours (UNIT_MERGE). Two source voxels among these
+// neighbours that are linked to each other already belong to the same object, so the neighbours are
+// tested in a fixed order, skipping each one that is linked to a neighbour found to be a source voxel.
+
+// the number of voxels that are tested at once when scanning a row for source voxels
+#define RUN_BLOCK 16
+
+// a preceding neighbour of a voxel when the merging lengths are 1, and the mask of the neighbours
+// before it in the list that it is linked to
+struct unit_offset {
+
+  int dx, dy, dz;
+  long int index;
+  unsigned int covered;
+
+};
+
+// the stride of the x axis
+template <bool UNIT_X>
+static inline long int StrideX(long int * data_metric){ return (UNIT_X ? 1L : (long int) data_metric[0]); }
+
+// list the offsets within the spatial part of the merging box, in the order that the voxels are scanned.
+// The offsets of the previous rows and the previous voxels in this row --- the only ones that need to be
+// tested in the current plane --- come first, and their number is returned. The other engines use the
+// same list, so that no engine tests the spatial ellipse for every voxel.
+int CreateStencil(vector<link_offset> & stencil, int ss_mode, int merge_x, int merge_y, long int stride_x, long int stride_y){
+
+  int dx, dy, NOprev;
+  link_offset offset;
+
+  stencil.resize(0);
+  NOprev = 0;
+  for(dy = -(merge_y + 1); dy <= (merge_y + 1); ++dy){
+
+    for(dx = -(merge_x + 1); dx <= (merge_x + 1); ++dx){
+
+      // check if the offset is within the boundaries of the spatial ellipse
+      if((ss_mode != 1) && (((((float) dx) * ((float) dx) / (((float) (merge_x + 1)) * ((float) (merge_x + 1)))) + (((float) dy) * ((float) dy) / (((float) (merge_y + 1)) * ((float) (merge_y + 1))))) > 1.0)){ continue; }
+
+      offset.dx = dx;
+      offset.dy = dy;
+      offset.index = ((long int) dy * stride_y) + ((long int) dx * stride_x);
+      stencil.push_back(offset);
+      if((dy < 0) || ((dy == 0) && (dx < 0))){ NOprev = stencil.size(); }
 
-	temp_ref_spec.resize(0);
-	for(sz = 0; sz < (2 * (sz_finish - sz_start + 1)); ++sz){ temp_ref_spec.push_back(0.0); }
+    }
 
-      } else {
+  }
 
-	temp_ref_spec.resize(0);
-	for(sz = 0; sz < (sz_finish - sz_start + 11); ++sz){ temp_ref_spec.push_back(0.0); }
+  return NOprev;
 
-      }
-      temp_vfield.resize(0);
-      for(sy = 0; sy < (sy_finish - sy_start + 1); ++sy){
-	for(sx = 0; sx < (sx_finish - sx_start + 1); ++sx){
-	  temp_vfield.push_back(0.0);
-	}
-      }
-     
-      // 5. populate temp_sparse_rep arrays
-      // 5.a if inside the chunk and outside the existing sparse rep grid, run the routine to count the number
-      //     of object strings along the current line of sight, populate new strings array and add values to new 
-      //     postage stamp images
-      // 5.b if outside of the chunk, use the grid value to increment NOi, populate strings array from previous version and 
-      //     fill in valuese for postage stamp images
-
-      // initialise number of object strings
-      NOi = 0;
-      
-      // initialise RA PV image
-      for(sz = 0; sz < (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1); ++sz){
-
-	for(sx = 0; sx < (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1); ++sx){
-	
-	  temp_RAPV[(((sz + detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) - sz_start - chunk_z_start) * (sx_finish - sx_start + 1)) + sx + detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) - sx_start - chunk_x_start)]+=detections[obj_batch][(i - (obj_batch * obj_limit))].Get_RAPV(((sz * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) + sx));
-	  
-	}
+}
 
-      }
+// test if two voxels are linked when the merging lengths are 1 --- the spatial ellipse then only
+// holds the voxel itself and its four nearest neighbours
+template <int SS_MODE>
+static bool UnitLinked(int dx, int dy, int dz){
 
-      // initialise Dec PV image
-      for(sz = 0; sz < (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1); ++sz){
+  if((dx < -1) || (dx > 1) || (dy < -1) || (dy > 1) || (dz < -1) || (dz > 1)){ return false; }
+  return ((SS_MODE == 1) || (((dx * dx) + (dy * dy)) <= 1));
 
-	for(sy = 0; sy < (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2) + 1); ++sy){
-	
-	  temp_DECPV[(((sz + detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) - sz_start - chunk_z_start) * (sy_finish - sy_start + 1)) + sy + detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2) - sy_start - chunk_y_start)]+=detections[obj_batch][(i - (obj_batch * obj_limit))].Get_DECPV(((sz * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2) + 1)) + sy));
-	  
-	}
+}
 
-      }
+// list the preceding neighbours for merging lengths of 1, from the stencil of a plane: the voxel
+// behind in z is linked to all of the others, so it comes first, followed by the rest of the previous
+// plane and the preceding voxels of this plane
+template <int SS_MODE>
+static void CreateUnitOffsets(vector<unit_offset> & unit, vector<link_offset> & stencil, int NOprev, long int * data_metric){
 
-      // initialise mini spec's
-      for(sz = 0; sz < (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1); ++sz){ temp_obj_spec[(sz + detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) - sz_start - chunk_z_start)]+=detections[obj_batch][(i - (obj_batch * obj_limit))].Get_ospec(sz); }
+  int dz, s, i, j;
+  unit_offset offset;
 
-      if((sz_finish - sz_start + 1) >= 10){
+  unit.resize(0);
+  for(i = 0; i < 3; ++i){
 
-	j = sz_start + chunk_z_start - ((int) floorf((0.5 * (float) (sz_finish - sz_start + 1))));
+    dz = (i < 2) ? -1 : 0;
+    for(s = 0; s < ((dz < 0) ? ((int) stencil.size()) : NOprev); ++s){
 
-	if((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1) >= 10){
+      // the voxel behind in z is listed by the first pass only
+      if((i < 2) && ((i == 0) != ((stencil[s].dx == 0) && (stencil[s].dy == 0)))){ continue; }
+      offset.dx = stencil[s].dx;
+      offset.dy = stencil[s].dy;
+      offset.dz = dz;
+      offset.index = stencil[s].index + ((long int) dz * data_metric[2]);
+      offset.covered = 0;
+      for(j = 0; j < ((int) unit.size()); ++j){
 
-	  k = detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) - ((int) floorf((0.5 * (double) (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1))));
+	if(UnitLinked<SS_MODE>((offset.dx - unit[j].dx),(offset.dy - unit[j].dy),(offset.dz - unit[j].dz))){ offset.covered|=(1u << j); }
 
-	  for(sz = 0; sz < (2 * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1)); ++sz){
+      }
+      unit.push_back(offset);
 
-	    temp_ref_spec[(sz + k - j)]+=detections[obj_batch][(i - (obj_batch * obj_limit))].Get_rspec(sz);
+    }
 
-	  }
+  }
 
-	} else {
-	  
-	  k = detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) - 5;
+}
 
-	  for(sz = 0; sz < (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 11); ++sz){
-	    
-	    temp_ref_spec[(sz + k - j)]+=detections[obj_batch][(i - (obj_batch * obj_limit))].Get_rspec(sz);
+// compare a previously processed voxel with the current one, and record its object
+template <typename FlagT>
+static inline void LinkVoxel(FlagT flag, FlagT flag_value, vector<FlagT> & match_init, int & NOi, int init_limit, FlagT & existing){
 
-	  }
-	  
-	}
+  int i;
 
-      } else {
+  // check if this test voxel is source
+  if((flag != flag_value) && (flag < 0)){ return; }
 
-	j = sz_start + chunk_z_start - 5;
+  // check if this is a new objid, and add it to the list of previous matches if it is
+  for(i = 0; (i < NOi) && (i < init_limit); ++i){ if(match_init[i] == flag){ break; } }
+  if((i >= NOi) || (i >= init_limit)){
 
-	if((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1) >= 10){
+    match_init.push_back(flag);
+    ++NOi;
 
-	  k = detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) - ((int) floorf((0.5 * (double) (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1))));
+  }
 
-	  for(sz = 0; sz < (2 * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1)); ++sz){
+  // update existing flag
+  if(((flag < existing) && (flag >= 0)) || (existing == flag_value)){ existing = flag; }
 
-	    temp_ref_spec[(sz + k - j)]+=detections[obj_batch][(i - (obj_batch * obj_limit))].Get_rspec(sz);
+}
 
-	  }
+// re-label the voxels of an object within its bounding box
+template <typename FlagT, typename PropsT, bool UNIT_X>
+static long int RelabelObject(FlagT * flag_vals, PropsT & object, FlagT old_id, FlagT new_id, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, long int * data_metric){
+
+  int sx,sy,sz,sx_start,sy_start,sz_start,sx_finish,sy_finish,sz_finish;
+  long int stride_x;
+  FlagT * row;
+
+  sx_start = object.GetRAmin() - chunk_x_start;
+  if(sx_start < 0){ sx_start = 0; }
+  sy_start = object.GetDECmin() - chunk_y_start;
+  if(sy_start < 0){ sy_start = 0; }
+  sz_start = object.GetFREQmin() - chunk_z_start;
+  if(sz_start < 0){ sz_start = 0; }
+  sx_finish = object.GetRAmax() - chunk_x_start + 1;
+  if(sx_finish > size_x){ sx_finish = size_x; }
+  sy_finish = object.GetDECmax() - chunk_y_start + 1;
+  if(sy_finish > size_y){ sy_finish = size_y; }
+  sz_finish = object.GetFREQmax() - chunk_z_start + 1;
+  if(sz_finish > size_z){ sz_finish = size_z; }
+  stride_x = StrideX<UNIT_X>(data_metric);
+  for(sz = sz_start; sz < sz_finish; ++sz){
+
+    for(sy = sy_start; sy < sy_finish; ++sy){
+
+      row = flag_vals + (((long int) sz * (long int) data_metric[2]) + ((long int) sy * (long int) data_metric[1]));
+      for(sx = sx_start; sx < sx_finish; ++sx){ row[(sx * stride_x)] = (row[(sx * stride_x)] == old_id) ? new_id : row[(sx * stride_x)]; }
+
+      // for(sy = sy_start; sy < sy_finish; ++sy)
+    }
 
-	} else {
-	  
-	  k = detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) - 5;
+    // for(sz = sz_start; sz < sz_finish; ++sz)
+  }
 
-	  for(sz = 0; sz < (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 11); ++sz){
-	    
-	    temp_ref_spec[(sz + k - j)]+=detections[obj_batch][(i - (obj_batch * obj_limit))].Get_rspec(sz);
+  // return the number of voxels that have been re-written
+  if((sx_finish <= sx_start) || (sy_finish <= sy_start) || (sz_finish <= sz_start)){ return 0; }
+  return (long int) (sx_finish - sx_start) * (long int) (sy_finish - sy_start) * (long int) (sz_finish - sz_start);
 
-	  }
-	  
-	}
+}
 
-      }
-      
-      // search through LoS's of updated bounding box and take action as dictated by case 5.a or 5.b
-      for(sy = sy_start; sy <= sy_finish; ++sy){
-	
-	for(sx = sx_start; sx <= sx_finish; ++sx){
-	  	  
-	  // add value to temp_sparse_rep_grid
-	  temp_sparse_reps_grid[(((sy - sy_start) * (sx_finish - sx_start + 1)) + sx - sx_start)] = NOi;
-	  
-	  // case 5.a triggered for moment-0 image and sparse representation
-	  if(((sx > merge_x) || (chunk_x_start == 0)) && ((sy > merge_y) || (chunk_y_start == 0))){
-	    
-	    // initialise the dummy integer j 
-	    j = -1;
-	    
-	    for(sz = sz_start; sz <= sz_finish; ++sz){
-	      
-	      // change j to reflect if this voxel in the flag_vals array belongs to the source
-	      if(flag_vals[((sz * data_metric[2]) + (sy * data_metric[1]) + (sx * data_metric[0]))] == i){ 
-		
-		// update mini_mom0
-		temp_mom0[(((sy - sy_start) * (sx_finish - sx_start + 1)) + sx - sx_start)]+=data_vals[((sz * data_metric[2]) + (sy * data_metric[1]) + (sx * data_metric[0]))];
-		
-		// update mini_RAPV
-		temp_RAPV[(((sz - sz_start) * (sx_finish - sx_start + 1)) + sx - sx_start)]+=data_vals[((sz * data_metric[2]) + (sy * data_metric[1]) + (sx * data_metric[0]))];
-		
-		// update mini_DECPV
-		temp_DECPV[(((sz - sz_start) * (sy_finish - sy_start + 1)) + sy - sy_start)]+=data_vals[((sz * data_metric[2]) + (sy * data_metric[1]) + (sx * data_metric[0]))];
-		
-		// update mini_obj_spec
-		temp_obj_spec[(sz - sz_start)]+=data_vals[((sz * data_metric[2]) + (sy * data_metric[1]) + (sx * data_metric[0]))];
-		
-		// update mini_vfield
-		temp_vfield[(((sy - sy_start) * (sx_finish - sx_start + 1)) + sx - sx_start)]+=(((double) (sz + chunk_z_start)) * data_vals[((sz * data_metric[2]) + (sy * data_metric[1]) + (sx * data_metric[0]))]);
-		
-		// if previously this was not part of an object string, j == -1, then increment the number of object strings and
-		// write the position to the sparse_reps array
-		if(j == -1){ 
-		  
-		  // write the beginning of the object string to sparse_reps
-		  temp_sparse_reps_strings[(2 * NOi)] = chunk_z_start + sz;
-		  
-		  // increment NOi
-		  ++NOi; 
-		  		  
-		  // initialise the end of the object string in sparse_reps
-		  temp_sparse_reps_strings[((2 * NOi) - 1)] = chunk_z_start + sz;
-		  
-		} else {
-		  
-		  // update the end of the object string in sparse_reps
-		  temp_sparse_reps_strings[((2 * NOi) - 1)] = chunk_z_start + sz;
-		  
-		}
-		
-		// change j to reflect that this voxel belongs to the object
-		j = 1; 
-		
-	      } else { 
-		
-		// change j to reflect that this voxel doesn't belong to the object
-		j = -1; 
-		
-	      }
-	      
-	      // for(sz = sz_start; sz <= sz_finish; ++sz)
-	    }
-	    
-	    // add values to temp_ref_spec
-	    if((sz_finish - sz_start + 1) >= 10){
-	      
-	      k = (int) floorf((0.5 * (float) (sz_finish - sz_start + 1)));
-	      
-	      for(sz = 0; sz < (2 * (sz_finish - sz_start + 1)); ++sz){
-	  	
-		if(((sz + sz_start - k) >= 0) && ((sz + sz_start - k) < size_z)){
-		  
-		  // update mini_ref_spec
-		  temp_ref_spec[(sz + sz_start - k)]+=data_vals[(((sz + sz_start - k) * data_metric[2]) + (sy * data_metric[1]) + (sx * data_metric[0]))];	
-		  
-		}
-		
-	      }
-	      
-	      // if(sz_finish >= 10)
-	    } else {
-	      
-	      for(sz = 0; sz < (sz_finish - sz_start + 11); ++sz){
-		
-		if(((sz + sz_start - 5) >= 0) && ((sz + sz_start - 5) < size_z)){
-		  
-		  // update mini_ref_spec
-		  temp_ref_spec[(sz + sz_start - 5)]+=data_vals[(((sz + sz_start - 5) * data_metric[2]) + (sy * data_metric[1]) + (sx * data_metric[0]))];	
-		  
-		}
-		
-	      }
-	      
-	      // else . . . if(sz_finish >= 10)
-	    }
-	    
-	  } else {
-	    // case 5.b triggered  
-	    	    
-	    // update temp_sparse_rep_strings
-	    j = 0;
-	    if(((sx + chunk_x_start) >= detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0)) && ((sx + chunk_x_start) <= (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) + 1)) && ((sy + chunk_y_start) >= detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2)) && ((sy + chunk_y_start) <= (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(3) + 1))){
-	      
-	      for(g = detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_grid((((sy + chunk_y_start - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2)) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) + sx + chunk_x_start - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0))); g < detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_grid((((sy + chunk_y_start - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2)) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) + sx + chunk_x_start - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1)); ++g){
-		
-		temp_sparse_reps_strings[(NOi + j)] = detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_strings((2 * g));
-		temp_sparse_reps_strings[(NOi + j + 1)] = detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_strings(((2 * g) + 1));
-		++j;
-		
-	      }
-	      
-	      // update moment 0 postage stamp image
-	      temp_mom0[(((sy - sy_start) * (detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmax() - detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmin() + 1)) + sx - sx_start)] = detections[obj_batch][(i - (obj_batch * obj_limit))].Get_mom0((((sy + chunk_y_start - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2)) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) + sx + chunk_x_start - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0)));
-	      
-	      // update vfield postage stamp image
-	      temp_vfield[(((sy - sy_start) * (detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmax() - detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmin() + 1)) + sx - sx_start)] = detections[obj_batch][(i - (obj_batch * obj_limit))].Get_vfield((((sy + chunk_y_start - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2)) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) + sx + chunk_x_start - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0)));
-
-	      // update NOi
-	      NOi+=(detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_grid((((sy + chunk_y_start - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2)) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) + sx + chunk_x_start - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_grid((((sy + chunk_y_start - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2)) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) + sx + chunk_x_start - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0))));
-	      	      
-	    }
-	    
-	    // else . . . case 5.b
-	  }
-	    
-	  // for(sx = sx_start; sx <= sx_finish; ++sx)
-	}
-		
-	// for(sy = sy_start; sy <= sy_finish; ++sy)
-      }
-            
-      temp_sparse_reps_grid[((sx_finish - sx_start + 1) * (sy_finish - sy_start + 1))] = NOi;
-
-      // 6. replace the current sparse representation with the new sparse representation
-      detections[obj_batch][(i - (obj_batch * obj_limit))].ReInit_srep();
-      detections[obj_batch][(i - (obj_batch * obj_limit))].ReInit_mini();
- 
-      // update the sparse_reps_size array with the new bounding box
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_size(0,detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmin());
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_size(1,detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmax());
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_size(2,detections[obj_batch][(i - (obj_batch * obj_limit))].GetDECmin());
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_size(3,detections[obj_batch][(i - (obj_batch * obj_limit))].GetDECmax());
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_size(4,detections[obj_batch][(i - (obj_batch * obj_limit))].GetFREQmin());
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_size(5,detections[obj_batch][(i - (obj_batch * obj_limit))].GetFREQmax());
-
-      // update the sparse_reps_update array
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_update(-1);
-          
-      // populate the new sparse_reps and postage stamps
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Create_srep_grid((1 + ((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2) + 1))));
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Create_srep_strings((2 * NOi));
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Create_mom0(((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2) + 1)));
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Create_RAPV(((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1)));
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Create_DECPV(((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2) + 1) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1)));
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Create_vfield(((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2) + 1)));
-  
-      detections[obj_batch][(i - (obj_batch * obj_limit))].Create_ospec((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1));
-      if((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1) >= 10){
-       
-	detections[obj_batch][(i - (obj_batch * obj_limit))].Create_rspec((2 * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1)));
-	
-      } else {
-	
-	detections[obj_batch][(i - (obj_batch * obj_limit))].Create_rspec((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 11));
+// append the first and last x values of the runs of voxels with the value flag_value, between x_start and
+// x_finish, in a row of the flag_vals array. With a unit stride, blocks of voxels without a source voxel
+// are skipped by a vectorised test of the whole block.
+template <typename FlagT, bool UNIT_X>
+static void FindRuns(FlagT * row, long int stride_x, int x_start, int x_finish, FlagT flag_value, vector<int> & row_runs){
 
-      }
-   
-      for(j = 0; j < (1 + ((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2) + 1))); ++j){ detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_grid(j,temp_sparse_reps_grid[j]); }
-      for(j = 0; j < (2 * NOi); ++j){ detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_strings(j,temp_sparse_reps_strings[j]); }
-      for(j = 0; j < ((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2) + 1)); ++j){ detections[obj_batch][(i - (obj_batch * obj_limit))].Set_mom0(j,temp_mom0[j]); }
-      for(j = 0; j < ((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1)); ++j){ detections[obj_batch][(i - (obj_batch * obj_limit))].Set_RAPV(j,temp_RAPV[j]); }
-      for(j = 0; j < ((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2) + 1) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1)); ++j){ detections[obj_batch][(i - (obj_batch * obj_limit))].Set_DECPV(j,temp_DECPV[j]); }
-      for(j = 0; j < ((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2) + 1)); ++j){ detections[obj_batch][(i - (obj_batch * obj_limit))].Set_vfield(j,temp_vfield[j]); }
-
-      for(j = 0; j < (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1); ++j){ detections[obj_batch][(i - (obj_batch * obj_limit))].Set_ospec(j,temp_obj_spec[j]); }
-      if((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1) >= 10){
-
-	for(j = 0; j < (2 * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1)); ++j){ detections[obj_batch][(i - (obj_batch * obj_limit))].Set_rspec(j,temp_ref_spec[j]); }
-	
-      } else {
+  int x, b, found, run_start;
 
-	for(j = 0; j < (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 11); ++j){ detections[obj_batch][(i - (obj_batch * obj_limit))].Set_rspec(j,temp_ref_spec[j]); }
+  x = x_start;
+  while(x < x_finish){
+
+    if(UNIT_X){
+
+      while((x + RUN_BLOCK) <= x_finish){
+
+	found = 0;
+#pragma omp simd reduction(|:found)
+	for(b = 0; b < RUN_BLOCK; ++b){ found |= (row[(x + b)] == flag_value); }
+	if(found != 0){ break; }
+	x+=RUN_BLOCK;
 
       }
-      
-      // else . . . if(sparse_reps[obj_batch][(obj - (obj_batch * obj_limit))][0] < 0)
+
     }
-    
-    // update progress on display
-    while(progress <= (((float) (i + 1) / ((float) obj)))){ std::cout << "*"; std::cout.flush(); progress+=0.05; }  
-   
-    // for(i = 0; i < obj; ++i)
+    while((x < x_finish) && (row[(x * stride_x)] != flag_value)){ ++x; }
+    if(x >= x_finish){ break; }
+    run_start = x;
+    while((x < x_finish) && (row[(x * stride_x)] == flag_value)){ ++x; }
+    row_runs.push_back(run_start);
+    row_runs.push_back((x - 1));
+
   }
-  std::cout << "* done." << std::endl;
-    
-  // 5. return the number of coherent objects 
-  return obj;
-  
+
 }
 
-long int CreateObjects(double * data_vals, long int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, double intens_thresh_min, double intens_thresh_max, long int flag_value, long int start_obj, vector<object_props_dbl *> & detections, vector<long int> & obj_ids, vector<long int> & check_obj_ids, int obj_limit, int max_x_val, int max_y_val, int max_z_val, int ss_mode, int * data_metric, int * xyz_order){
- 
-  long int o,obj,existing,obj_batch,obj_batch_2;
-  int x,y,z,sx,sy,sz,sx_start,sy_start,sz_start,sx_finish,sy_finish,sz_finish;
-  int g,i,j,k,NO_obj_ids,NO_check_obj_ids,NOi;
-  int init_limit,prev,x_start,y_start,temp_x[3],temp_y[3],temp_z[3];
-  float progress;
-  vector<double> temp_mom0, temp_RAPV, temp_DECPV, temp_obj_spec, temp_ref_spec, temp_vfield;
-  vector<long int> match_init;
-  vector<int> temp_sparse_reps_grid, temp_sparse_reps_strings;
+template <typename DataT, typename FlagT, typename PropsT, int SS_MODE, bool UNIT_X, bool UNIT_MERGE>
+static FlagT LinkObjectsScan(DataT * data_vals, FlagT * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, FlagT flag_value, FlagT start_obj, vector<PropsT *> & detections, vector<FlagT> & obj_ids, vector<FlagT> & check_obj_ids, int obj_limit, int max_x_val, int max_y_val, int max_z_val, long int * data_metric, int * xyz_order, int products, const int * runs, long int NOruns){
+
+  FlagT obj,obj_id,existing,obj_batch,obj_batch_2,flag;
+  int x,y,z,sz,sz_start,s,r,init_limit,NOi,NOprev,NOstencil,NOunit;
+  int x_start,y_start,x_finish,temp_vals[3],bbox[6];
+  unsigned int i,found;
+  long int index, plane, stride_x, next_run, NOscanned, NOmerges, NOrewritten;
+  double sweep_start, merge_start;
+  bool interior;
+  vector<char> free_ids;
+  vector<link_offset> stencil;
+  vector<unit_offset> unit;
+  vector<int> row_runs;
+  check_id_set check_set;
+  srep_arena<DataT> & arena = *(detections[0][0].GetArena());
+  vector<DataT> & temp_mom0 = arena.temp_mom0, & temp_RAPV = arena.temp_RAPV, & temp_DECPV = arena.temp_DECPV, & temp_obj_spec = arena.temp_obj_spec, & temp_ref_spec = arena.temp_ref_spec, & temp_vfield = arena.temp_vfield;
+  vector<FlagT> match_init;
+  vector<int> & temp_sparse_reps_grid = arena.temp_sparse_reps_grid, & temp_sparse_reps_strings = arena.temp_sparse_reps_strings;
 
   // convert the merging lengths from distances (in pixels/voxels) to empty space between linked detections (in pixels/voxels) --- subtract 1 --- this is a more naturual
   // definition when processing a large file in chunks, because it makes it easier to build up sources that need to be retained for the rest of the input file
@@ -4086,1340 +233,392 @@ long int CreateObjects(double * data_vals, long int * flag_vals, int size_x, int
   --merge_z;
 
   // reorder the datacube and subcube limits to be in x,y,z order
-  temp_x[0] = chunk_x_start;
-  temp_y[0] = chunk_y_start;
-  temp_z[0] = chunk_z_start;
-  temp_x[1] = size_x;
-  temp_y[1] = size_y;
-  temp_z[1] = size_z;
-  temp_x[2] = max_x_val;
-  temp_y[2] = max_y_val;
-  temp_z[2] = max_z_val;
-  switch(xyz_order[0]){
-  case 1:
-    chunk_x_start = temp_x[0];
-    size_x = temp_x[1];
-    max_x_val = temp_x[2];
-    break;
-  case 2:
-    chunk_x_start = temp_y[0];
-    size_x = temp_y[1];
-    max_x_val = temp_y[2];
-    break;
-  case 3:
-    chunk_x_start = temp_z[0];
-    size_x = temp_z[1];
-    max_x_val = temp_z[2];
-    break;
-  default:
-    chunk_x_start = temp_x[0];
-    size_x = temp_x[1];
-    max_x_val = temp_x[2];
-    break;
-  }
-  switch(xyz_order[1]){
-  case 1:
-    chunk_y_start = temp_x[0];
-    size_y = temp_x[1];
-    max_y_val = temp_x[2];
-    break;
-  case 2:
-    chunk_y_start = temp_y[0];
-    size_y = temp_y[1];
-    max_y_val = temp_y[2];
-    break;
-  case 3:
-    chunk_y_start = temp_z[0];
-    size_y = temp_z[1];
-    max_y_val = temp_z[2];
-    break;
-  default:
-    chunk_y_start = temp_y[0];
-    size_y = temp_y[1];
-    max_y_val = temp_y[2];
-    break;
-  }
-  switch(xyz_order[2]){
-  case 1:
-    chunk_z_start = temp_x[0];
-    size_z = temp_x[1];
-    max_z_val = temp_x[2];
-    break;
-  case 2:
-    chunk_z_start = temp_y[0];
-    size_z = temp_y[1];
-    max_z_val = temp_y[2];
-    break;
-  case 3:
-    chunk_z_start = temp_z[0];
-    size_z = temp_z[1];
-    max_z_val = temp_z[2];
-    break;
-  default:
-    chunk_z_start = temp_z[0];
-    size_z = temp_z[1];
-    max_z_val = temp_z[2];
-    break;
-  }
+  temp_vals[0] = chunk_x_start; temp_vals[1] = chunk_y_start; temp_vals[2] = chunk_z_start;
+  chunk_x_start = ReorderAxis(temp_vals,xyz_order[0],0);
+  chunk_y_start = ReorderAxis(temp_vals,xyz_order[1],1);
+  chunk_z_start = ReorderAxis(temp_vals,xyz_order[2],2);
+  temp_vals[0] = size_x; temp_vals[1] = size_y; temp_vals[2] = size_z;
+  size_x = ReorderAxis(temp_vals,xyz_order[0],0);
+  size_y = ReorderAxis(temp_vals,xyz_order[1],1);
+  size_z = ReorderAxis(temp_vals,xyz_order[2],2);
+  temp_vals[0] = max_x_val; temp_vals[1] = max_y_val; temp_vals[2] = max_z_val;
+  max_x_val = ReorderAxis(temp_vals,xyz_order[0],0);
+  max_y_val = ReorderAxis(temp_vals,xyz_order[1],1);
+  max_z_val = ReorderAxis(temp_vals,xyz_order[2],2);
 
   // create temporary arrays
   if(10000 > (((2 * merge_x) + 3) * ((2 * merge_y) + 3) * ((2 * merge_z) + 3))){
-    
+
     init_limit = 10000;
-    
+
   } else {
-    
+
     init_limit = ((2 * merge_x) + 3) * ((2 * merge_y) + 3) * ((2 * merge_z) + 3) + 10;
-    
+
   }
   match_init.reserve(init_limit);
   match_init.resize(0);
 
-  temp_sparse_reps_grid.reserve(1000000);
   temp_sparse_reps_grid.resize(0);
-  temp_sparse_reps_strings.reserve(1000000);
   temp_sparse_reps_strings.resize(0);
-  temp_mom0.reserve(1000000);
   temp_mom0.resize(0);
-  temp_RAPV.reserve(1000000);
   temp_RAPV.resize(0);
-  temp_DECPV.reserve(1000000);
   temp_DECPV.resize(0);
-  temp_obj_spec.reserve(1000000);
   temp_obj_spec.resize(0);
-  temp_ref_spec.reserve(1000000);
   temp_ref_spec.resize(0);
-  temp_vfield.reserve(1000000);
   temp_vfield.resize(0);
- 
+
+  // list the offsets to be tested within the merging box, in place of testing the spatial ellipse for every voxel
+  stride_x = StrideX<UNIT_X>(data_metric);
+  NOprev = CreateStencil(stencil,SS_MODE,merge_x,merge_y,stride_x,(long int) data_metric[1]);
+  NOstencil = stencil.size();
+  if(UNIT_MERGE){ CreateUnitOffsets<SS_MODE>(unit,stencil,NOprev,data_metric); }
+  NOunit = unit.size();
+
   // 0. initialise variables and arrays
   obj = start_obj;
   x_start = 0;
   y_start = 0;
   if(chunk_x_start > 0){ x_start = merge_x + 1; }
   if(chunk_y_start > 0){ y_start = merge_y + 1; }
-  NO_obj_ids = obj_ids.size();
-  NO_check_obj_ids = check_obj_ids.size();
+  x_finish = size_x;
+  if((chunk_x_start + x_finish) > max_x_val){ x_finish = max_x_val - chunk_x_start; }
+  next_run = 0;
+  InitObjIDs(obj_ids,free_ids,arena.stats);
+  InitCheckIDs(check_obj_ids,check_set,detections,obj_limit);
 
   // 1. Create list of `coherent' objects from neighbouring voxels
-  
+
   // for each grid point, check if it has been flagged as a source voxel, and assign
-  // it an object ID if it is. If a neighbouring voxel has already been flagged, assign 
+  // it an object ID if it is. If a neighbouring voxel has already been flagged, assign
   // that ID to the grid point, otherwise, assign current value of obj and increment obj.
-  std::cout << "0 | |:| | : | |:| | 100% complete" << std::endl;
-  progress = 0.0;
+  NOscanned = 0;
+  NOmerges = 0;
+  NOrewritten = 0;
+  sweep_start = arena.stats.collect ? WallTime() : 0.0;
   for(z = 0; ((z < size_z) && ((z + chunk_z_start) < max_z_val)); ++z){
 
     // if the z value is sufficiently large that objects have started to pop out of the merging box,
     // then check if the objects outside of the merging box are sufficiently large
     if(z > (merge_z + 1)){
-      
-      // initialise NOi to store the number of current check_obj_ids values that haven't moved outside of 
-      // the merging volume, and that form the basis for the new check_obj_ids list
-      NOi = 0;
-      
-      // apply size threshold to objects added since last size thresholding
-      for(i = 0; i < NO_check_obj_ids; ++i){
-	
+
+      // apply the size threshold to the objects that have moved outside of the merging box available to
+      // the next plane, taking them from the queue of objects ordered by their last channel
+      while((obj_id = NextRetiredID(check_obj_ids,check_set,detections,obj_limit,(chunk_z_start + z - merge_z - 1))) >= 0){
+
 	// calculate the obj_batch value for the existing object
-	obj_batch = (long int) floor(((double) check_obj_ids[i] / (double) obj_limit));
-	
-	// move to the next object if this one has been re-initialised
-	if(detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].ShowVoxels() < 1){ continue; }
-	
-	// check if this object has moved outside of the merging box available to the next plane, if it 
-	// has apply a size threshold, otherwise use it to seed the new list of objects to be size thresholded
-	// the next time
-	if(detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetFREQmax() < (chunk_z_start + z - merge_z - 1)){
-	  
-	  // apply the size threshold, and if it fails re-initialise the object and pop its id to the list
-	  // of available obj_ids
-	  if((((detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetRAmax() - detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetRAmin() + 1) < min_x_size) || ((detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetDECmax() - detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetDECmin() + 1) < min_y_size) || ((detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetFREQmax() - detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetFREQmin() + 1) < min_z_size) || (detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].ShowVoxels() < min_v_size)) && (((detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetRAmin() - chunk_x_start) > merge_x) || (chunk_x_start == 0)) && ((((chunk_x_start + size_x - 1 - detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetRAmax()) > merge_x) || ((chunk_x_start + size_x) >= max_x_val)) && (((detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetDECmin() - chunk_y_start) > merge_y) || (chunk_y_start == 0)) && (((chunk_y_start + size_y - 1 - detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetDECmax()) > merge_y) || ((chunk_y_start + size_y) >= max_y_val)) && (((detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetFREQmin() - chunk_z_start) > merge_z) || (chunk_z_start == 0)) && (((chunk_z_start + size_z - 1 - detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetFREQmax()) > merge_z) || ((chunk_z_start + size_z) >= max_z_val)))){
-	    
-	    // re-initialise object
-	    detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].ReInit();
-	    if((detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].Get_srep_update() != 0) && (detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].Get_srep_size(0) >= 0)){
-	      
-	      detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].ReInit_srep();
-	      detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].ReInit_mini();
+	obj_batch = obj_id / obj_limit;
+	PropsT & object = detections[obj_batch][(obj_id - (obj_batch * obj_limit))];
 
-	    }
-	    detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].ReInit_size();
-	    detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].Set_srep_update(0);
-
-	    // flag the `object' values within the bounding box and remove it from the flag_vals array
-	    sx_start = detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetRAmin() - chunk_x_start;
-	    if(sx_start < 0){ sx_start = 0; }
-	    sy_start = detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetDECmin() - chunk_y_start;
-	    if(sy_start < 0){ sy_start = 0; }
-	    sz_start = detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetFREQmin() - chunk_z_start;
-	    if(sz_start < 0){ sz_start = 0; }
-	    for(sz = sz_start; ((sz <= (detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetFREQmax() - chunk_z_start)) && (sz < size_z)); ++sz){
-	      
-	      for(sy = sy_start; ((sy <= (detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetDECmax() - chunk_y_start)) && (sy < size_y)); ++sy){
-		
-		for(sx = sx_start; ((sx <= (detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetRAmax() - chunk_x_start)) && (sx < size_x)); ++sx){
-		  
-		  if(flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx * data_metric[0]))] == check_obj_ids[i]){ flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx * data_metric[0]))] = -99; }
-		  
-		  // for(sx = x_start[(match_init[i] - (obj_batch_2 * obj_limit))]; sx <= x_finish[(match_init[i] - (obj_batch_2 * obj_limit))]; ++sx)
-		}
-		
-		// for(sy = y_start[(match_init[i] - (obj_batch_2 * obj_limit))]; sy <= y_finish[(match_init[i] - (obj_batch_2 * obj_limit))]; ++sy)
-	      }
-	      
-	      // for(sz = z_start[(match_init[i] - (obj_batch_2 * obj_limit))]; sz <= z_finish[(match_init[i] - (obj_batch_2 * obj_limit))]; ++sz)
-	    }
-	    
-	    // add object id to list of available ids
-	    j = -1;
-	    for(g = 0; g < NO_obj_ids; ++g){ if(obj_ids[g] == check_obj_ids[i]){ j = 1; break; } }
-	    if(j == -1){
-	      ++NO_obj_ids;
-	      obj_ids.push_back(check_obj_ids[i]);
-	    }
+	// objects that are too close to the edges of the chunk may still be merged with the next chunk
+	if(!((((object.GetRAmin() - chunk_x_start) > merge_x) || (chunk_x_start == 0)) && ((((chunk_x_start + size_x - 1 - object.GetRAmax()) > merge_x) || ((chunk_x_start + size_x) >= max_x_val)) && (((object.GetDECmin() - chunk_y_start) > merge_y) || (chunk_y_start == 0)) && (((chunk_y_start + size_y - 1 - object.GetDECmax()) > merge_y) || ((chunk_y_start + size_y) >= max_y_val)) && (((object.GetFREQmin() - chunk_z_start) > merge_z) || (chunk_z_start == 0)) && (((chunk_z_start + size_z - 1 - object.GetFREQmax()) > merge_z) || ((chunk_z_start + size_z) >= max_z_val))))){ continue; }
+
+	// apply the size threshold, and if it fails, or the object is demoted to a compact record,
+	// re-initialise the object and pop its id to the list of available obj_ids
+	if((((object.GetRAmax() - object.GetRAmin() + 1) < min_x_size) || ((object.GetDECmax() - object.GetDECmin() + 1) < min_y_size) || ((object.GetFREQmax() - object.GetFREQmin() + 1) < min_z_size) || (object.ShowVoxels() < min_v_size)) || CompactObj(object)){
+
+	  // remove the object from the flag_vals array, using its bounding box before it is re-initialised
+	  RelabelObject<FlagT,PropsT,UNIT_X>(flag_vals,object,obj_id,((FlagT) -99),size_x,size_y,size_z,chunk_x_start,chunk_y_start,chunk_z_start,data_metric);
+
+	  // re-initialise object
+	  object.ReInit();
+	  if((object.Get_srep_update() != 0) && (object.Get_srep_size(0) >= 0)){
+
+	    object.ReInit_srep();
+	    object.ReInit_mini();
 
 	  }
-	  
-	  // if(z_finish[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))] < (z - merge_z - 1))
-	} else {
-	  
-	  check_obj_ids[NOi] = check_obj_ids[i];
-	  ++NOi;
-	  
-	  // else . . . if(z_finish[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))] < (z - merge_z - 1))
+	  object.ReInit_size();
+	  object.Set_srep_update(0);
+
+	  // add object id to list of available ids
+	  FreeObjID(obj_ids,free_ids,obj_id,arena.stats);
+
+	} else if(arena.finalise_func != NULL){
+
+	  // the object has passed the size thresholds and can no longer grow, and all of its voxels are
+	  // labelled with its id in flag_vals, so it is handed over while the sweep continues
+	  bbox[0] = object.GetRAmin(); bbox[1] = object.GetRAmax();
+	  bbox[2] = object.GetDECmin(); bbox[3] = object.GetDECmax();
+	  bbox[4] = object.GetFREQmin(); bbox[5] = object.GetFREQmax();
+	  if(arena.Finalise((long int) obj_id,bbox)){ break; }
+
 	}
-	
-	// for(i = 0; i < NO_check_obj_ids; ++i)
+
+	// while((obj_id = NextRetiredID(check_obj_ids,check_set,detections,obj_limit,(chunk_z_start + z - merge_z - 1))) >= 0)
       }
 
-      // update NO_check_obj_ids
-      NO_check_obj_ids = NOi;
-      check_obj_ids.resize(NOi);
-      
       // if(z > (merge_z + 2))
     }
-    
+
+    sz_start = z - merge_z - 1;
+    if(sz_start < 0){ sz_start = 0; }
     for(y = y_start; (y < size_y) && ((chunk_y_start + y) < max_y_val); ++y){
-      
-      for(x = x_start; (x < size_x) && ((chunk_x_start + x) < max_x_val); ++x){
-	
-	// if this is a source voxel, check if it is associated with a previously identified
-	// source voxel
-	if(flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (x*data_metric[0]))] == flag_value){ 
-	  
-	  // 1.  initialise variables
-	  existing = flag_value;
-	  NOi = 0;
-	  match_init.resize(0);
-	  
-	  // 3. initial pass, check the voxels within the merging distance to see if any have been
-	  // identified as previous objects
-	  
-	  // 3a. set limits of region to be searched
-	  sx_start = x - merge_x - 1;
-	  if(sx_start < 0){ sx_start = 0; }
-	  sy_start = y - merge_y - 1;
-	  if(sy_start < 0){ sy_start = 0; }
-	  sz_start = z - merge_z - 1;
-	  if(sz_start < 0){ sz_start = 0; }
-	  
-	  // 3b. search through previous region and modify existing flag if required
-
-	  if(ss_mode == 1){
-	    
-	    // use a rectangular paralleliped to do the linking
-
-	    for(sz = sz_start; (sz < z); ++sz){
-	    
-	      for(sy = sy_start; (sy <= (y + merge_y + 1)) && (sy < size_y); ++sy){
-	      
-		for(sx = sx_start; (sx <= (x + merge_x + 1)) && (sx < size_x); ++sx){
-		
-		  // check if this test voxel is source
-		  if((flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] == flag_value) || (flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] >= 0)){
-		    
-		    // check if this is a new objid
-		    prev = -1;
-		    for(i = 0; (i < NOi) && (i < init_limit); ++i){
-		      
-		      if(match_init[i] == flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))]){
-			
-			prev = 1;
-			break;
-			
-		      }
-		      
-		    }
-		    if(prev == -1){ 
-		      
-		      // add current object to list of previous matches
-		      match_init.push_back(flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))]);
-		      ++NOi;
-
-		    }
-		    
-		    // update existing flag
-		    if(((flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] < existing) && (flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] >= 0)) || (existing == flag_value)){ existing = flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))]; }
-		    
-		  }
-		  
-		  // for(sx = x_start; (sx < (x + merge_x + 1)) && (sx < size_x); ++sx)
-		}
-		
-		// for(sy = y_start; (sy < (y + merge_y + 1)) && (sy < size_y); ++sy)
-	      }
-	      
-	      // for(sz = z_start; (sz < z); ++sz)
-	    }
-	    for(sy = sy_start; (sy < y); ++sy){
-	      
-	      for(sx = sx_start; (sx <= (x + merge_x + 1)) && (sx < size_x); ++sx){
-		
-		// check if this test voxel is source
-		if((flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] == flag_value) || (flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] >= 0)){
-		  
-		  // check if this is a new objid, move on if not
-		  prev = -1;
-		  for(i = 0; (i < NOi) && (i < init_limit); ++i){
-		    
-		    if(match_init[i] == flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))]){
-		      
-		      prev = 1;
-		      break;
-		      
-		    }
-		    
-		  }
-		  if(prev == -1){ 
-		    
-		    // add current object to list of previous matches
-		    ++NOi;
-		    match_init.push_back(flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))]);
 
-		  }
-		  
-		  // update existing flag
-		  if(((flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] < existing) && (flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] >= 0)) || (existing == flag_value)){ existing = flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))]; }
-		  
-		}		
-		
-		// for(sx = x_start; (sx < = (x + merge_x + 1)) && (sx < size_x); ++sx)
-	      }
-	      
-	      // for(sy = y_start; (sy < y) && (sy < size_y); ++sy)
-	    }
-	    for(sx = sx_start; sx < x; ++sx){
-	      
-	      // check if this test voxel is source
-	      if((flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))] == flag_value) || (flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))] >= 0)){
-		
-		// check if this is a new objid, move on if not
-		prev = -1;
-		for(i = 0; (i < NOi) && (i < init_limit); ++i){
-		  
-		  if(match_init[i] == flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))]){
-		    
-		    prev = 1;
-		    break;
-		    
-		  }
-		  
-		}
-		if(prev == -1){ 
-		  
-		  // add current object to list of previous matches
-		  ++NOi;
-		  match_init.push_back(flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))]);
+      plane = ((long int) z * (long int) data_metric[2]) + ((long int) y * (long int) data_metric[1]);
 
-		}
-		
-		// update existing flag
-		if(((flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))] < existing) && (flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))] >= 0)) || (existing == flag_value)){ existing = flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))]; }
-		
-	      }	  
-	      
-	      // for(sx = x_start; sx <= x; ++sx)
-	    }
-	  
-	    // if(ss_mode == 1)
-	  } else {
-
-	    // use a cylinder for the linking lengths
-
-	    for(sz = sz_start; (sz < z); ++sz){
-	    
-	      for(sy = sy_start; (sy <= (y + merge_y + 1)) && (sy < size_y); ++sy){
-	      
-		for(sx = sx_start; (sx <= (x + merge_x + 1)) && (sx < size_x); ++sx){
-		
-		  // check if the test voxel is within the boundaries of the spatial ellipse
-		  if(((((float) (x - sx)) * ((float) (x - sx)) / (((float) (merge_x + 1)) * ((float) (merge_x + 1)))) + (((float) (y - sy)) * ((float) (y - sy)) / (((float) (merge_y + 1)) * ((float) (merge_y + 1))))) > 1.0){ continue; }
-
-		  // check if this test voxel is source
-		  if((flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] == flag_value) || (flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] >= 0)){
-
-		    // check if this is a new objid
-		    prev = -1;
-		    for(i = 0; (i < NOi) && (i < init_limit); ++i){
-		      
-		      if(match_init[i] == flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))]){
-			
-			prev = 1;
-			break;
-			
-		      }
-		      
-		    }
-		    if(prev == -1){ 
-		      
-		      // add current object to list of previous matches
-		      ++NOi;
-		      match_init.push_back(flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))]);
-
-		    }
-		    
-		    // update existing flag
-		    if(((flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] < existing) && (flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] >= 0)) || (existing == flag_value)){ existing = flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))]; }
-		    
-		  }
-		  
-		  // for(sx = x_start; (sx < (x + merge_x + 1)) && (sx < size_x); ++sx)
-		}
-		
-		// for(sy = y_start; (sy < (y + merge_y + 1)) && (sy < size_y); ++sy)
-	      }
-	      
-	      // for(sz = z_start; (sz < z); ++sz)
-	    }
-	    for(sy = sy_start; (sy < y); ++sy){
-	      
-	      for(sx = sx_start; (sx <= (x + merge_x + 1)) && (sx < size_x); ++sx){
-		
-		// check if the test voxel is within the boundaries of the spatial ellipse
-		if(((((float) (x - sx)) * ((float) (x - sx)) / (((float) (merge_x + 1)) * ((float) (merge_x + 1)))) + (((float) (y - sy)) * ((float) (y - sy)) / (((float) (merge_y + 1)) * ((float) (merge_y + 1))))) > 1.0){ continue; }
-
-		// check if this test voxel is source
-		if((flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] == flag_value) || (flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] >= 0)){
-		  
-		  // check if this is a new objid, move on if not
-		  prev = -1;
-		  for(i = 0; (i < NOi) && (i < init_limit); ++i){
-		    
-		    if(match_init[i] == flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))]){
-		      
-		      prev = 1;
-		      break;
-		      
-		    }
-		    
-		  }
-		  if(prev == -1){ 
-		    
-		    // add current object to list of previous matches
-		    ++NOi;
-		    match_init.push_back(flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))]);
+      // find the runs of source voxels in this row, taking them from the list of runs if one is given,
+      // and scanning the row for them otherwise --- only the voxels of the runs are visited
+      row_runs.resize(0);
+      if(runs != NULL){
 
-		  }
-		  
-		  // update existing flag
-		  if(((flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] < existing) && (flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] >= 0)) || (existing == flag_value)){ existing = flag_vals[((z*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))]; }
-		  
-		}		
-		
-		// for(sx = x_start; (sx < = (x + merge_x + 1)) && (sx < size_x); ++sx)
-	      }
-	      
-	      // for(sy = y_start; (sy < y) && (sy < size_y); ++sy)
-	    }
-	    for(sx = sx_start; sx < x; ++sx){
-	      
-	      // check if this test voxel is source
-	      if((flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))] == flag_value) || (flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))] >= 0)){
-		
-		// check if this is a new objid, move on if not
-		prev = -1;
-		for(i = 0; (i < NOi) && (i < init_limit); ++i){
-		  
-		  if(match_init[i] == flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))]){
-		    
-		    prev = 1;
-		    break;
-		    
-		  }
-		  
-		}
-		if(prev == -1){ 
-		  
-		  // add current object to list of previous matches
-		  ++NOi;
-		  match_init.push_back(flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))]);
-		  
-		}
-		
-		// update existing flag
-		if(((flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))] < existing) && (flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))] >= 0)) || (existing == flag_value)){ existing = flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (sx*data_metric[0]))]; }
-		
-	      }	  
-	      
-	      // for(sx = x_start; sx <= x; ++sx)
-	    }
+	while((next_run < NOruns) && ((runs[(4 * next_run)] < z) || ((runs[(4 * next_run)] == z) && (runs[((4 * next_run) + 1)] < y)))){ ++next_run; }
+	for(; (next_run < NOruns) && (runs[(4 * next_run)] == z) && (runs[((4 * next_run) + 1)] == y); ++next_run){
 
-	    // else . . . if(ss_mode == 1)
-	  }
+	  x = (runs[((4 * next_run) + 2)] > x_start) ? runs[((4 * next_run) + 2)] : x_start;
+	  r = (runs[((4 * next_run) + 3)] < (x_finish - 1)) ? runs[((4 * next_run) + 3)] : (x_finish - 1);
+	  if(x > r){ continue; }
+	  row_runs.push_back(x);
+	  row_runs.push_back(r);
 
-	  // 3c. assign an object number to this voxel, depending upon the value of the existing flag,
-	  // and if this is part of an existing object or objects, then daisy chain from this voxel to all the others
-	  if(existing == flag_value){
-	    
-	    // get obj value from array of obj_ids, then replace it with an incremented obj value
-	    
-	    // ensure that the obj_ids array is sorted
-	    sort(obj_ids.begin(),obj_ids.end());
-	    
-	    // assign value to array
-	    flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (x*data_metric[0]))] = obj_ids[0]; 
-	    
-	    // calculate the obj_batch value for this obj_id
-	    obj_batch = (long int) floor(((double) obj_ids[0] / (double) obj_limit));
-	    
-	    // add this initial point to the object
-	    detections[obj_batch][(obj_ids[0] - (obj_batch * obj_limit))].AddPoint(((double) (chunk_x_start + x)),((double) (chunk_y_start + y)),((double) (chunk_z_start + z)),data_vals[((z*data_metric[2]) + (y*data_metric[1]) + (x*data_metric[0]))]);
-
-	    // push id to list of objects that need to be size thresholded
-	    i = -1;
-	    for(g = 0; g < NO_check_obj_ids; ++g){ if(check_obj_ids[g] == obj_ids[0]){ i = 1; break; } }
-	    if(i == -1){
-
-	      ++NO_check_obj_ids;
-	      check_obj_ids.push_back(obj_ids[0]);
-	      
-	    }
+	}
+
+      } else {
 
-	    // adjust obj and obj_ids
-	    if(NO_obj_ids > 1){
-	      
-	      for(i = 0; i < (NO_obj_ids - 1); ++i){ obj_ids[i] = obj_ids[(i + 1)]; }
-	      --NO_obj_ids;
-	      obj_ids.resize(NO_obj_ids);
+	FindRuns<FlagT,UNIT_X>((flag_vals + plane),stride_x,x_start,x_finish,flag_value,row_runs);
+
+      }
+      for(r = 0; r < (int) row_runs.size(); r+=2){
+
+	for(x = row_runs[r]; x <= row_runs[(r + 1)]; ++x){
+
+	  index = plane + ((long int) x * stride_x);
+
+	  // if this is a source voxel, check if it is associated with a previously identified
+	  // source voxel
+	  if(flag_vals[index] == flag_value){
+
+	    // 1.  initialise variables
+	    existing = flag_value;
+	    NOi = 0;
+	    match_init.resize(0);
+	    ++NOscanned;
+
+	    // 3. initial pass, check the voxels within the merging distance to see if any have been
+	    // identified as previous objects --- the bounds of the merging box only need to be tested
+	    // for the voxels near the edges of the chunk
+	    interior = (x > merge_x) && ((x + merge_x + 1) < size_x) && (y > merge_y) && ((y + merge_y + 1) < size_y);
+
+	    // 3a. search through the previous planes, and then the previous rows and voxels of this plane
+	    if(UNIT_MERGE){
+
+	      found = 0;
+	      for(s = 0; s < NOunit; ++s){
+
+		if(((found & unit[s].covered) != 0) || ((z + unit[s].dz) < sz_start)){ continue; }
+		if(!interior && (((x + unit[s].dx) < 0) || ((x + unit[s].dx) >= size_x) || ((y + unit[s].dy) < 0) || ((y + unit[s].dy) >= size_y))){ continue; }
+		flag = flag_vals[(index + unit[s].index)];
+		if(flag >= 0){ found|=(1u << s); }
+		LinkVoxel(flag,flag_value,match_init,NOi,init_limit,existing);
 
-	    } else {
-	      
-	      ++obj;
-
-	      obj_ids[0] = obj;
-	      
-	      // if this obj_id modulo obj_limit == 0, then it's the first obj of a new batch
-	      // so create a new batch of objects
-	      if((obj % obj_limit) == 0){ 
-				
-		detections.push_back(new object_props_dbl[obj_limit]);
-				
-		// if((obj % obj_limit) == 0)
 	      }
-			      
-	      // if(NO_obj_ids > 1) { } else 
-	    }
-	    
-	    // if(existing == -1)
-	  } else if(existing >= 0){
-	    
-	    // assign the current voxel being processed the correct flag value, and update
-	    // the bounding box
-	    
-	    // add object to list of objects within the merging box, provided that it hasn't been added already
-	    i = -1;
-	    for(g = 0; g < NO_check_obj_ids; ++g){ if(check_obj_ids[g] == existing){ i = 1; break; } }
-	    if(i == -1){
-
-	      ++NO_check_obj_ids;
-	      check_obj_ids.push_back(existing);
 
-	    }
+	    } else {
 
-	    // assign value to array
-	    flag_vals[((z*data_metric[2]) + (y*data_metric[1]) + (x*data_metric[0]))] = existing;
-	    
-	    // calculate the obj_batch value for the existing object
-	    obj_batch = (long int) floor(((double) existing / (double) obj_limit));
-	    
-	    // add this point to the existing object
-	    detections[obj_batch][(existing - (obj_batch * obj_limit))].AddPoint((chunk_x_start + x),(chunk_y_start + y),(chunk_z_start + z),data_vals[((z*data_metric[2]) + (y*data_metric[1]) + (x*data_metric[0]))]);
-	    
-	    // for each object detected within the merging volume, update all of the values within the bounding box of this object
-	    // to be the same as the other part of this object, and update the bounding box at the same time
-	    if(NOi > 1){
-	      
-	      for(i = 0; i < NOi; ++i){
-		
-		// move on if this is the existing object
-		if(match_init[i] == existing){ 
-
-		  continue; 
+	      for(sz = sz_start; sz <= z; ++sz){
+
+		index = plane + ((long int) x * stride_x) - ((long int) (z - sz) * (long int) data_metric[2]);
+		NOstencil = (sz < z) ? stencil.size() : NOprev;
+		if(interior){
+
+		  for(s = 0; s < NOstencil; ++s){ LinkVoxel(flag_vals[(index + stencil[s].index)],flag_value,match_init,NOi,init_limit,existing); }
+
+		} else {
+
+		  for(s = 0; s < NOstencil; ++s){
+
+		    if(((x + stencil[s].dx) < 0) || ((x + stencil[s].dx) >= size_x) || ((y + stencil[s].dy) < 0) || ((y + stencil[s].dy) >= size_y)){ continue; }
+		    LinkVoxel(flag_vals[(index + stencil[s].index)],flag_value,match_init,NOi,init_limit,existing);
 
-		}
-		
-		// calculate a temporary obj_batch value
-		obj_batch_2 = (long int) floor(((double) match_init[i] / (double) obj_limit));		
-		
-		// add this object to an existing object
-		//detections[obj_batch][(existing - (obj_batch * obj_limit))].AddObject(detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))]);
-		detections[obj_batch][(existing - (obj_batch * obj_limit))].AddObject(detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))],temp_sparse_reps_grid,temp_sparse_reps_strings,temp_mom0,temp_RAPV,temp_DECPV,temp_ref_spec,temp_obj_spec,temp_vfield);
-		
-		// flag the `object' values within the bounding box to merge it with the base object
-		sx_start = detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))].GetRAmin() - chunk_x_start;
-		if(sx_start < 0){ sx_start = 0; }
-		sy_start = detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))].GetDECmin() - chunk_y_start;
-		if(sy_start < 0){ sy_start = 0; }
-		sz_start = detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))].GetFREQmin() - chunk_z_start;
-		if(sz_start < 0){ sz_start = 0; }
-		for(sz = sz_start; (sz <= detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))].GetFREQmax() - chunk_z_start) && (sz < size_z); ++sz){
-		  
-		  for(sy = sy_start; (sy <= detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))].GetDECmax() - chunk_y_start) && (sy < size_y); ++sy){
-		    
-		    for(sx = sx_start; (sx <= detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))].GetRAmax() - chunk_x_start) && (sx < size_x); ++sx){
-		      
-		      if(flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] == match_init[i]){ flag_vals[((sz*data_metric[2]) + (sy*data_metric[1]) + (sx*data_metric[0]))] = existing; }
-		      
-		      // for(sx = x_start[(match_init[i] - (obj_batch_2 * obj_limit))]; sx <= x_finish[(match_init[i] - (obj_batch_2 * obj_limit))]; ++sx)
-		    }
-		    
-		    // for(sy = y_start[(match_init[i] - (obj_batch_2 * obj_limit))]; sy <= y_finish[(match_init[i] - (obj_batch_2 * obj_limit))]; ++sy)
 		  }
-		  
-		  // for(sz = z_start[(match_init[i] - (obj_batch_2 * obj_limit))]; sz <= z_finish[(match_init[i] - (obj_batch_2 * obj_limit))]; ++sz)
-		}
-			
-		// re-initialise the `object' values for the match_init[i] object that has just been merged into the existing object, 
-		// and push the obj value (match_init[i]) to the top of the array of values
-		detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))].ReInit();
-		if((detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))].Get_srep_update() != 0) && (detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))].Get_srep_size(0) >= 0)){
-		  
-		  detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))].ReInit_srep();
-		  detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))].ReInit_mini();
 
 		}
-		detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))].ReInit_size();
-		detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))].Set_srep_update(0);
-
-		j = -1;
-		for(g = 0; g < NO_obj_ids; ++g){ if(obj_ids[g] == match_init[i]){ j = 1; break; } }
-		if(j == -1){
-		  
-		  ++NO_obj_ids;
-		  obj_ids.push_back(match_init[i]);
-		  		  
-		}
-		
-		// for(i = 0; i < NOi; ++i)
+
+		// for(sz = sz_start; sz <= z; ++sz)
 	      }
-	      
-	      // if(NOi > 1)
+	      index = plane + ((long int) x * stride_x);
+
 	    }
-	    
-	    // else . . . if(existing == -1)
-	  }
-	  
-	  // if(flag_vals[((z*size_x*size_y) + (y*size_x) + x)] == -1)
-	}
-	
-	// update progress on display
-	while(progress <= (((float) ((z * size_x * size_y) + (y * size_x) + x + 1)) / ((float) (size_x * size_y * size_z)))){ std::cout << "*"; std::cout.flush(); progress+=0.05; }
-	
-	// for(x = 0; x < size_x; ++x)
-      }
-      
-      // for(y = 0; y < size_y; ++y)
-    }
-    
-    // for(z = 0; z < size_z; ++z)
-  }
-  std::cout << "* done." << std::endl;
-  
-  // 4. generate sparse representations of coherent objects that are retained after
-  // this `chunk' of the datacube is processed
-  std::cout << "Generating/updating sparse representations of sources . . . " << std::endl;
-  std::cout << "0 | |:| | : | |:| | 100% complete" << std::endl;
-  progress = 0.0;
-  for(o = 0; o < obj; ++o){
-    
-    // calculate the obj_batch value for this object
-    obj_batch = (long int) floor(((double) o / (double) obj_limit));
-    
-    // move on if this object has been re-initialised
-    if(detections[obj_batch][(o - (obj_batch * obj_limit))].ShowVoxels() < 1){ 
-      
-      // update progress on display
-      while(progress <= (((double) (o + 1) / ((double) obj)))){ std::cout << "*"; std::cout.flush(); progress+=0.05; }  
-      continue; 
-      
-    }
-    
-    // move on if this object is not within the boundaries of the current chunk, in other words,
-    // move on if this object doesn't need to have it's sparse representation and postage stamp images updated
-    if((detections[obj_batch][(o - (obj_batch * obj_limit))].GetRAmax() < chunk_x_start) || (detections[obj_batch][(o - (obj_batch * obj_limit))].GetDECmax() < chunk_y_start) || (detections[obj_batch][(o - (obj_batch * obj_limit))].GetFREQmax() < chunk_z_start) || (detections[obj_batch][(o - (obj_batch * obj_limit))].GetRAmin() >= (chunk_x_start + size_x)) || (detections[obj_batch][(o - (obj_batch * obj_limit))].GetDECmin() >= (chunk_y_start + size_y)) || (detections[obj_batch][(o - (obj_batch * obj_limit))].GetFREQmin() >= (chunk_z_start + size_z))){ 
-
-      // update progress on display
-      while(progress <= (((double) (o + 1) / ((double) obj)))){ std::cout << "*"; std::cout.flush(); progress+=0.05; }  
-      continue; 
-      
-    }
-    
-    // move on if this object's sparse representation and postage stamp images don't need updating
-    if((detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0) >= 0) && (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_update() == -1)){
-      
-      // update progress on display
-      while(progress <= (((double) (i + 1) / ((double) obj)))){ std::cout << "*"; std::cout.flush(); progress+=0.05; }  
-      continue; 
-	
-    }
-          
-    // update the sparse representation for this object
-    
-    // 0. if there is no existing sparse representation and postage stamp images, create them from scratch, 
-    // otherwise concatenate the existing sparse representation and postage stamp images with the updates
-    if((detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0) < 0) && (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_update() >= 0)){
-      
-      // branch for creating a brand new sparse representation
-      
-      // update the sparse_reps_update array
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Set_srep_update(-1);
-
-      // initialise the number of object sections that make up this object
-      NOi = 0;   
-      
-      // calculate the edge of the bounding box in `chunk' co-ordinates
-      sx_start = detections[obj_batch][(o - (obj_batch * obj_limit))].GetRAmin() - chunk_x_start;
-      if(sx_start < 0){ sx_start = 0; }
-      sx_finish = detections[obj_batch][(o - (obj_batch * obj_limit))].GetRAmax() - chunk_x_start;
-      sy_start = detections[obj_batch][(o - (obj_batch * obj_limit))].GetDECmin() - chunk_y_start;
-      if(sy_start < 0){ sy_start = 0; }
-      sy_finish = detections[obj_batch][(o - (obj_batch * obj_limit))].GetDECmax() - chunk_y_start;
-      sz_start = detections[obj_batch][(o - (obj_batch * obj_limit))].GetFREQmin() - chunk_z_start;
-      if(sz_start < 0){ sz_start = 0; }
-      sz_finish = detections[obj_batch][(o - (obj_batch * obj_limit))].GetFREQmax() - chunk_z_start;
-      
-      // count the number of object sections that make up this object
-      for(sy = sy_start; (sy <= sy_finish) && (sy < size_y); ++sy){
-	
-	for(sx = sx_start; (sx <= sx_finish) && (sx < size_x); ++sx){
-	  
-	  // initialise the dummy integer j
-	  j = -1;
-	  
-	  for(sz = sz_start; (sz <= sz_finish) && (sz < size_z); ++sz){
-	    
-	    // change j to reflect if this voxel in the flag_vals array belongs to the source
-	    if(flag_vals[((sz * data_metric[2]) + (sy * data_metric[1]) + (sx * data_metric[0]))] == o){ 
-	      
-	      // if previously this was not part of an object string, j == -1, then increment the number of object strings and
-	      // adjust the value of j
-	      if(j == -1){ ++NOi; }
-	      
-	      // change j to reflect that this voxel belongs to the object
-	      j = 1; 
-	      
-	    } else { j = -1; }
-	    
-	    // for(sz = detections[obj_batch][(obj - (obj_batch * obj_limit))].GetFREQmin() - chunk_z_size; sz <= (detections[obj_batch][(obj - (obj_batch * obj_limit))].GetFREQmax() - chunk_z_size); ++sz)
-	  }
-	  
-	  // for(sx = detections[obj_batch][(obj - (obj_batch * obj_limit))].GetRAmin() - chunk_x_size; sx <= (detections[obj_batch][(obj - (obj_batch * obj_limit))].GetRAmax() - chunk_x_size); ++sx)
-	}
-	
-	// for(sy = detections[obj_batch][(obj - (obj_batch * obj_limit))].GetDECmin() - chunk_y_size; sy <= (detections[obj_batch][(obj - (obj_batch * obj_limit))].GetDECmax() - chunk_y_size); ++sy)
-      }
 
-      // create an array element to store this sparse representation
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Set_srep_size(0,detections[obj_batch][(o - (obj_batch * obj_limit))].GetRAmin());
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Set_srep_size(1,detections[obj_batch][(o - (obj_batch * obj_limit))].GetRAmax());
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Set_srep_size(2,detections[obj_batch][(o - (obj_batch * obj_limit))].GetDECmin());
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Set_srep_size(3,detections[obj_batch][(o - (obj_batch * obj_limit))].GetDECmax());
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Set_srep_size(4,detections[obj_batch][(o - (obj_batch * obj_limit))].GetFREQmin());
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Set_srep_size(5,detections[obj_batch][(o - (obj_batch * obj_limit))].GetFREQmax());
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Create_srep_grid((((detections[obj_batch][(o - (obj_batch * obj_limit))].GetRAmax() - detections[obj_batch][(o - (obj_batch * obj_limit))].GetRAmin() + 1) * (detections[obj_batch][(o - (obj_batch * obj_limit))].GetDECmax() - detections[obj_batch][(o - (obj_batch * obj_limit))].GetDECmin() + 1)) + 1));
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Create_srep_strings((2 * NOi));
-      
-      // calculate the extent of the sparse_rep volume
-      sx_finish = detections[obj_batch][(o - (obj_batch * obj_limit))].GetRAmax() - detections[obj_batch][(o - (obj_batch * obj_limit))].GetRAmin() + 1;
-      sy_finish = detections[obj_batch][(o - (obj_batch * obj_limit))].GetDECmax() - detections[obj_batch][(o - (obj_batch * obj_limit))].GetDECmin() + 1;
-      sz_finish = detections[obj_batch][(o - (obj_batch * obj_limit))].GetFREQmax() - detections[obj_batch][(o - (obj_batch * obj_limit))].GetFREQmin() + 1;
-      
-      // create arrays to store the postage stamp images and initialise them
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Create_mom0((sx_finish * sy_finish));
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Create_RAPV((sx_finish * sz_finish));
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Create_DECPV((sy_finish * sz_finish));
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Create_ospec(sz_finish);
-      if(sz_finish >= 10){
-
-	detections[obj_batch][(o - (obj_batch * obj_limit))].Create_rspec((2 * sz_finish));
+	    // 3b. assign an object number to this voxel, depending upon the value of the existing flag,
+	    // and if this is part of an existing object or objects, then daisy chain from this voxel to all the others
+	    if(existing == flag_value){
 
-      } else {
+	      // take the lowest free obj value from the pool of obj_ids, which is replaced by an incremented obj value
+	      // once all the freed values have been used
+	      obj_id = NewObjID(obj_ids,free_ids,obj,detections,obj_limit);
 
-	detections[obj_batch][(o - (obj_batch * obj_limit))].Create_rspec((10 + sz_finish));
+	      // assign value to array
+	      flag_vals[index] = obj_id;
 
-      }
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Create_vfield((sx_finish * sy_finish));
-      
-      // initialise the mini_mom0 values
-      for(sy = 0; sy < sy_finish; ++sy){
-	for(sx = 0; sx < sx_finish; ++sx){
-	  detections[obj_batch][(o - (obj_batch * obj_limit))].Set_mom0(((sy * sx_finish) + sx),0.0);
-	}
-      }
+	      // add this initial point to the object
+	      obj_batch = obj_id / obj_limit;
+	      detections[obj_batch][(obj_id - (obj_batch * obj_limit))].AddPoint(((DataT) (chunk_x_start + x)),((DataT) (chunk_y_start + y)),((DataT) (chunk_z_start + z)),data_vals[index]);
 
-      // initialise the mini_RAPV values
-      for(sz = 0; sz < sz_finish; ++sz){
-	for(sx = 0; sx < sx_finish; ++sx){
-	  detections[obj_batch][(o - (obj_batch * obj_limit))].Set_RAPV(((sz * sx_finish) + sx),0.0);
-	}
-      }
-      
-      // initialise the mini_DECPV values
-      for(sz = 0; sz < sz_finish; ++sz){
-	for(sy = 0; sy < sy_finish; ++sy){
-	  detections[obj_batch][(o - (obj_batch * obj_limit))].Set_DECPV(((sz * sy_finish) + sy),0.0);
-	}
-      }
-      
-      // initialise the mini_spec values
-      for(sz = 0; sz < sz_finish; ++sz){ detections[obj_batch][(o - (obj_batch * obj_limit))].Set_ospec(sz,0.0); }
-      if(sz_finish >= 10){
+	      // push id to list of objects that need to be size thresholded
+	      AddCheckID(check_obj_ids,check_set,obj_id,detections,obj_limit);
 
-	for(sz = 0; sz < (2 * sz_finish); ++sz){ detections[obj_batch][(o - (obj_batch * obj_limit))].Set_rspec(sz,0.0); }
+	      // if(existing == flag_value)
+	    } else if(existing >= 0){
 
-      } else {
+	      // add object to list of objects within the merging box, provided that it hasn't been added already
+	      AddCheckID(check_obj_ids,check_set,existing,detections,obj_limit);
 
-	for(sz = 0; sz < (10 + sz_finish); ++sz){ detections[obj_batch][(o - (obj_batch * obj_limit))].Set_rspec(sz,0.0); }
+	      // assign value to array
+	      flag_vals[index] = existing;
 
-      }
-            
-      // initialise the mini_vfield values
-      for(sy = 0; sy < sy_finish; ++sy){
-	for(sx = 0; sx < sx_finish; ++sx){
-	  detections[obj_batch][(o - (obj_batch * obj_limit))].Set_vfield(((sy * sx_finish) + sx),0.0);
-	}
-      }
+	      // add this point to the existing object
+	      obj_batch = existing / obj_limit;
+	      detections[obj_batch][(existing - (obj_batch * obj_limit))].AddPoint((chunk_x_start + x),(chunk_y_start + y),(chunk_z_start + z),data_vals[index]);
 
-      // populate the sparse array representation and postage stamp images
-      NOi = 0;
-      for(sy = 0; sy < sy_finish; ++sy){
-	
-	for(sx = 0; sx < sx_finish; ++sx){
-	  
-	  // write the current number of object strings to the grid
-	  detections[obj_batch][(o - (obj_batch * obj_limit))].Set_srep_grid(((sy * sx_finish) + sx),NOi);
-	  
-	  // initialise the dummy integer j 
-	  j = -1;
-	  
-	  for(sz = 0; sz < sz_finish; ++sz){
-	    
-	    // change j to reflect if this voxel in the flag_vals array belongs to the source
-	    if(flag_vals[(((sz + sz_start) * data_metric[2]) + ((sy + sy_start) * data_metric[1]) + ((sx + sx_start) * data_metric[0]))] == o){ 
-	      
-	      // update mini_mom0
-	      detections[obj_batch][(o - (obj_batch * obj_limit))].Add_mom0(((sy * sx_finish) + sx),data_vals[(((sz + sz_start) * data_metric[2]) + ((sy + sy_start) * data_metric[1]) + ((sx + sx_start) * data_metric[0]))]);
-	      
-	      // update mini_RAPV
-	      detections[obj_batch][(o - (obj_batch * obj_limit))].Add_RAPV(((sz * sx_finish) + sx),data_vals[(((sz + sz_start) * data_metric[2]) + ((sy + sy_start) * data_metric[1]) + ((sx + sx_start) * data_metric[0]))]);
-	      
-	      // update mini_DECPV
-	      detections[obj_batch][(o - (obj_batch * obj_limit))].Add_DECPV(((sz * sy_finish) + sy),data_vals[(((sz + sz_start) * data_metric[2]) + ((sy + sy_start) * data_metric[1]) + ((sx + sx_start) * data_metric[0]))]);
-	      
-	      // update mini_obj_spec
-	      detections[obj_batch][(o - (obj_batch * obj_limit))].Add_ospec(sz,data_vals[(((sz + sz_start) * data_metric[2]) + ((sy + sy_start) * data_metric[1]) + ((sx + sx_start) * data_metric[0]))]);
-  
-	      // update mini_vfield
-	      detections[obj_batch][(o - (obj_batch * obj_limit))].Add_vfield(((sy * sx_finish) + sx),(((double) (sz + sz_start + chunk_z_start)) * data_vals[(((sz + sz_start) * data_metric[2]) + ((sy + sy_start) * data_metric[1]) + ((sx + sx_start) * data_metric[0]))]));
-	      
-	      // if previously this was not part of an object string, j == -1, then increment the number of object strings and
-	      // write the position to the sparse_reps array
-	      if(j == -1){ 
-		
-		// write the beginning of the object string to sparse_reps
-		detections[obj_batch][(o - (obj_batch * obj_limit))].Set_srep_strings((2 * NOi),(sz_start + chunk_z_start + sz));
-		
-		// increment NOi
-		++NOi; 
-		
-		// initialise the end of the object string in sparse_reps
-		detections[obj_batch][(o - (obj_batch * obj_limit))].Set_srep_strings(((2 * NOi) - 1),(sz_start + chunk_z_start + sz));
-
-	      } else {
-		
-		// update the end of the object string in sparse_reps
-		detections[obj_batch][(o - (obj_batch * obj_limit))].Set_srep_strings(((2 * NOi) - 1),(sz_start + chunk_z_start + sz));
-		
-	      }
-	      
-	      // change j to reflect that this voxel belongs to the object
-	      j = 1; 
-	      
-	    } else { 
-	      
-	      // change j to reflect that this voxel doesn't belong to the object
-	      j = -1; 
-	      
-	    }
-	    
-	    // for(sz = detections[obj_batch][(obj - (obj_batch * obj_limit))].GetFREmin() - chunk_z_start + 1; sz <= (detections[obj_batch][(obj - (obj_batch * obj_limit))].GetFREQmax() - chunk_z_start + 1); ++sz)
-	  }
-	  
-	  // for(sx = detections[obj_batch][(obj - (obj_batch * obj_limit))].GetRAmin() - chunk_x_start + 1; sx <= (detections[obj_batch][(obj - (obj_batch * obj_limit))].GetRAmax() - chunk_x_start + 1); ++sx)
-	}
-	
-	//for(sy = detections[obj_batch][(obj - (obj_batch * obj_limit))].GetDECmin() - chunk_y_start + 1; sy <= (detections[obj_batch][(obj - (obj_batch * obj_limit))].GetDECmax() - chunk_y_start + 1); ++sy)
-      }
-            
-      // update sparse_reps with the final value of NOi
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Set_srep_grid((sx_finish * sy_finish),NOi);
-            
-      // create the reference spectrum
-      if(sz_finish >= 10){
-	
-	for(sz = -1 * (int) floorf((0.5 * (float) sz_finish)); sz < (sz_finish + ((int) floorf((0.5 * (float) sz_finish)))); ++sz){
-	  
-	  for(sy = 0; sy < sy_finish; ++sy){
-	  
-	    for(sx = 0; sx < sx_finish; ++sx){
-	    
-	      if(((sz + sz_start) >= 0) && ((sz + sz_start) < size_z)){
-		
-		// update mini_ref_spec	
-		detections[obj_batch][(o - (obj_batch * obj_limit))].Add_rspec((sz + ((int) floorf((0.5 * (double) sz_finish)))),data_vals[(((sz + sz_start) * data_metric[2]) + ((sy + sy_start) * data_metric[1]) + ((sx + sx_start) * data_metric[0]))]);	
-		
-	      }
-	      
-	    }
-	    
-	  }
-      
-	}
+	      // for each object detected within the merging volume, update all of the values within the bounding box of this object
+	      // to be the same as the other part of this object, and update the bounding box at the same time
+	      if(NOi > 1){
 
-	// if(sz_finish >= 10)
-      } else {
+		merge_start = arena.stats.collect ? WallTime() : 0.0;
+		for(i = 0; i < match_init.size(); ++i){
+
+		  // move on if this is the existing object
+		  if(match_init[i] == existing){ continue; }
+
+		  // add this object to the existing object
+		  obj_batch_2 = match_init[i] / obj_limit;
+		  PropsT & object = detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))];
+		  detections[obj_batch][(existing - (obj_batch * obj_limit))].AddObject(object,temp_sparse_reps_grid,temp_sparse_reps_strings,temp_mom0,temp_RAPV,temp_DECPV,temp_ref_spec,temp_obj_spec,temp_vfield);
+
+		  // flag the `object' values within the bounding box to merge it with the base object
+		  NOrewritten+=RelabelObject<FlagT,PropsT,UNIT_X>(flag_vals,object,match_init[i],existing,size_x,size_y,size_z,chunk_x_start,chunk_y_start,chunk_z_start,data_metric);
+		  ++NOmerges;
+
+		  // re-initialise the `object' values for the match_init[i] object that has just been merged into the existing object,
+		  // and push the obj value (match_init[i]) to the top of the array of values
+		  object.ReInit();
+		  if((object.Get_srep_update() != 0) && (object.Get_srep_size(0) >= 0)){
+
+		    object.ReInit_srep();
+		    object.ReInit_mini();
 
-	for(sz = -5; sz < (sz_finish + 5); ++sz){
-	  
-	  for(sy = 0; sy < sy_finish; ++sy){
-	  
-	    for(sx = 0; sx < sx_finish; ++sx){
-	    
-	      if(((sz + sz_start) >= 0) && ((sz + sz_start) < size_z)){
-		
-		// update mini_ref_spec
-		detections[obj_batch][(o - (obj_batch * obj_limit))].Add_rspec((sz + 5),data_vals[(((sz + sz_start) * data_metric[2]) + ((sy + sy_start) * data_metric[1]) + ((sx + sx_start) * data_metric[0]))]);	
-		
+		  }
+		  object.ReInit_size();
+		  object.Set_srep_update(0);
+
+		  FreeObjID(obj_ids,free_ids,match_init[i],arena.stats);
+
+		  // for(i = 0; i < match_init.size(); ++i)
+		}
+		if(arena.stats.collect){ arena.stats.merge_time+=(WallTime() - merge_start); }
+
+		// if(NOi > 1)
 	      }
-	      
+
+	      // else . . . if(existing == flag_value)
 	    }
-	    
+
+	    // if(flag_vals[index] == flag_value)
 	  }
-      
-	}
 
-	// else . . . if(sz_finish >= 10)
-      }
-      
-     // if(sparse_reps[obj_batch][(obj - (obj_batch * obj_limit))][0] < 0) . . . else
-    } else {
-            
-      // branch for updating an existing sparse representation
-      
-      // count the number of object strings comprising the object
-      
-      // 1. initialise the number of object strings
-      NOi = 0;
-      
-      // 2. convert the new bounding box of the object into `chunk' co-ordinates
-      sx_start = detections[obj_batch][(o - (obj_batch * obj_limit))].GetRAmin() - chunk_x_start;
-      sx_finish = detections[obj_batch][(o - (obj_batch * obj_limit))].GetRAmax() - chunk_x_start;
-      sy_start = detections[obj_batch][(o - (obj_batch * obj_limit))].GetDECmin() - chunk_y_start;
-      sy_finish = detections[obj_batch][(o - (obj_batch * obj_limit))].GetDECmax() - chunk_y_start;
-      sz_start = detections[obj_batch][(o - (obj_batch * obj_limit))].GetFREQmin() - chunk_z_start;
-      if(sz_start < 0){ sz_start = 0; }
-      sz_finish = detections[obj_batch][(o - (obj_batch * obj_limit))].GetFREQmax() - chunk_z_start;
-      
-      // 3. search through the bounding box, and do one of the following
-      // 3.a if inside the chunk and outside the existing sparse rep grid, run the routine to count the number
-      //     of object strings along the current line of sight
-      // 3.b otherwise use the grid value to increment NOi
-      for(sy = sy_start; sy <= sy_finish; ++sy){
-	
-	for(sx = sx_start; sx <= sx_finish; ++sx){
-	  	  
-	  // case 3.a triggered
-	  if(((sx > merge_x) || (chunk_x_start == 0)) && ((sy > merge_y) || (chunk_y_start == 0))){
-	    	    
-	    // initialise the dummy integer j 
-	    j = -1;
-	    
-	    for(sz = sz_start; sz <= sz_finish; ++sz){
-	      
-	      // change i to reflect if this voxel in the flag_vals array belongs to the source
-	      if(flag_vals[((sz * data_metric[2]) + (sy * data_metric[1]) + (sx * data_metric[0]))] == o){ 
-		
-		// if previously this was not part of an object string, i == -1, then increment the number of object strings and
-		// write the position to the sparse_reps array
-		if(j == -1){ 
-		  
-		  // increment NOi
-		  ++NOi; 
-		  
-		} 
-		
-		// change j to reflect that this voxel belongs to the object
-		j = 1; 
-		
-	      } else { j = -1; }
-	      
-	      // for(sz = sz_start; sz <= sz_finish; ++sz)
-	    }
-	    
-	  } else {
-	    
-	    // case 3.b triggered  
-	    NOi+=(detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_grid((((sy + chunk_y_start - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(2)) * (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) + sx + chunk_x_start - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_grid((((sy + chunk_y_start - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(2)) * (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) + sx + chunk_x_start - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0))));
-	    
-	  }     
-	  
-	  // for(sx = sx_start; sx <= sx_finish; ++sx)
-	}
-	
-	// for(sy = sy_start; sy <= sy_finish; ++sy)
-      }
-      
-      // 4. allocate memory to store temporary sparse representation and postage stamp images, then
-      //    initialise the postage stamp image arrays
-      temp_mom0.resize(0);
-      for(sy = 0; sy < (sy_finish - sy_start + 1); ++sy){
-	for(sx = 0; sx < (sx_finish - sx_start + 1); ++sx){
-	  temp_mom0.push_back(0.0);
-	}
-      }
-      temp_RAPV.resize(0);
-      for(sz = 0; sz < (sz_finish - sz_start + 1); ++sz){
-	for(sx = 0; sx < (sx_finish - sx_start + 1); ++sx){
-	  temp_RAPV.push_back(0.0);
-	}
-      }
-      temp_DECPV.resize(0);
-      for(sz = 0; sz < (sz_finish - sz_start + 1); ++sz){
-	for(sy = 0; sy < (sy_finish - sy_start + 1); ++sy){
-	  temp_DECPV.push_back(0.0);
+	  // for(x = row_runs[r]; x <= row_runs[(r + 1)]; ++x)
 	}
+
+	// for(r = 0; r < row_runs.size(); r+=2)
       }
-      temp_obj_spec.resize(0);
-      for(sz = 0; sz < (sz_finish - sz_start + 1); ++sz){ temp_obj_spec.push_back(0.0); }
-      if((sz_finish - sz_start + 1) >= 10){
 
-	temp_ref_spec.resize(0);
-	for(sz = 0; sz < (2 * (sz_finish - sz_start + 1)); ++sz){ temp_ref_spec.push_back(0.0); }
+      // for(y = y_start; (y < size_y) && ((chunk_y_start + y) < max_y_val); ++y)
+    }
 
-      } else {
+    // report the progress once per plane, and stop if the linking has been cancelled
+    if(arena.Progress((z + 1),size_z)){ break; }
 
-	temp_ref_spec.resize(0);
-	for(sz = 0; sz < (sz_finish - sz_start + 11); ++sz){ temp_ref_spec.push_back(0.0); }
+    // for(z = 0; ((z < size_z) && ((z + chunk_z_start) < max_z_val)); ++z)
+  }
 
-      }
-      temp_vfield.resize(0);
-      for(sy = 0; sy < (sy_finish - sy_start + 1); ++sy){
-	for(sx = 0; sx < (sx_finish - sx_start + 1); ++sx){
-	  temp_vfield.push_back(0.0);
-	}
-      }
-     
-      // 5. populate temp_sparse_rep arrays
-      // 5.a if inside the chunk and outside the existing sparse rep grid, run the routine to count the number
-      //     of object strings along the current line of sight, populate new strings array and add values to new 
-      //     postage stamp images
-      // 5.b if outside of the chunk, use the grid value to increment NOi, populate strings array from previous version and 
-      //     fill in valuese for postage stamp images
-
-      // initialise number of object strings
-      NOi = 0;
-      
-      // initialise RA PV image
-      for(sz = 0; sz < (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) + 1); ++sz){
-
-	for(sx = 0; sx < (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0) + 1); ++sx){
-	
-	  temp_RAPV[(((sz + detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) - sz_start - chunk_z_start) * (sx_finish - sx_start + 1)) + sx + detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0) - sx_start - chunk_x_start)]+=detections[obj_batch][(o - (obj_batch * obj_limit))].Get_RAPV(((sz * (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) + sx));
-	  
-	}
+  arena.stats.voxels_scanned+=NOscanned;
+  arena.stats.merges+=NOmerges;
+  arena.stats.voxels_rewritten+=NOrewritten;
+  if(arena.stats.collect){ arena.stats.sweep_time+=(WallTime() - sweep_start); }
 
-      }
+  // a cancelled linking is abandoned, and the caller releases the objects
+  if(arena.cancelled){ return obj; }
 
-      // initialise Dec PV image
-      for(sz = 0; sz < (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) + 1); ++sz){
+  // 4. generate sparse representations of coherent objects that are retained after
+  // this `chunk' of the datacube is processed
+  CreateSparseReps(data_vals,flag_vals,size_x,size_y,size_z,chunk_x_start,chunk_y_start,chunk_z_start,merge_x,merge_y,merge_z,obj,detections,obj_limit,data_metric,products);
 
-	for(sy = 0; sy < (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(2) + 1); ++sy){
-	
-	  temp_DECPV[(((sz + detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) - sz_start - chunk_z_start) * (sy_finish - sy_start + 1)) + sy + detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(2) - sy_start - chunk_y_start)]+=detections[obj_batch][(o - (obj_batch * obj_limit))].Get_DECPV(((sz * (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(2) + 1)) + sy));
-	  
-	}
+  // 5. return the number of coherent objects
+  return obj;
 
-      }
+}
 
-      // initialise mini spec's
-      for(sz = 0; sz < (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) + 1); ++sz){ temp_obj_spec[(sz + detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) - sz_start - chunk_z_start)]+=detections[obj_batch][(o - (obj_batch * obj_limit))].Get_ospec(sz); }
+// select the specialisation of the scanning engine for the merging box and the axis order --- merging
+// lengths of 1 are only specialised for the default axis order
+template <typename DataT, typename FlagT, typename PropsT>
+static FlagT LinkObjects(DataT * data_vals, FlagT * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, FlagT flag_value, FlagT start_obj, vector<PropsT *> & detections, vector<FlagT> & obj_ids, vector<FlagT> & check_obj_ids, int obj_limit, int max_x_val, int max_y_val, int max_z_val, int ss_mode, long int * data_metric, int * xyz_order, int products, const int * runs, long int NOruns){
 
-      if((sz_finish - sz_start + 1) >= 10){
+  if((data_metric[0] == 1) && (merge_x == 1) && (merge_y == 1) && (merge_z == 1)){
 
-	j = sz_start + chunk_z_start - ((int) floorf((0.5 * (float) (sz_finish - sz_start + 1))));
+    if(ss_mode == 1){ return LinkObjectsScan<DataT,FlagT,PropsT,1,true,true>(data_vals,flag_vals,size_x,size_y,size_z,chunk_x_start,chunk_y_start,chunk_z_start,merge_x,merge_y,merge_z,min_x_size,min_y_size,min_z_size,min_v_size,flag_value,start_obj,detections,obj_ids,check_obj_ids,obj_limit,max_x_val,max_y_val,max_z_val,data_metric,xyz_order,products,runs,NOruns); }
+    return LinkObjectsScan<DataT,FlagT,PropsT,0,true,true>(data_vals,flag_vals,size_x,size_y,size_z,chunk_x_start,chunk_y_start,chunk_z_start,merge_x,merge_y,merge_z,min_x_size,min_y_size,min_z_size,min_v_size,flag_value,start_obj,detections,obj_ids,check_obj_ids,obj_limit,max_x_val,max_y_val,max_z_val,data_metric,xyz_order,products,runs,NOruns);
 
-	if((detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) + 1) >= 10){
+  }
+  if(data_metric[0] == 1){
 
-	  k = detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) - ((int) floorf((0.5 * (double) (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) + 1))));
+    if(ss_mode == 1){ return LinkObjectsScan<DataT,FlagT,PropsT,1,true,false>(data_vals,flag_vals,size_x,size_y,size_z,chunk_x_start,chunk_y_start,chunk_z_start,merge_x,merge_y,merge_z,min_x_size,min_y_size,min_z_size,min_v_size,flag_value,start_obj,detections,obj_ids,check_obj_ids,obj_limit,max_x_val,max_y_val,max_z_val,data_metric,xyz_order,products,runs,NOruns); }
+    return LinkObjectsScan<DataT,FlagT,PropsT,0,true,false>(data_vals,flag_vals,size_x,size_y,size_z,chunk_x_start,chunk_y_start,chunk_z_start,merge_x,merge_y,merge_z,min_x_size,min_y_size,min_z_size,min_v_size,flag_value,start_obj,detections,obj_ids,check_obj_ids,obj_limit,max_x_val,max_y_val,max_z_val,data_metric,xyz_order,products,runs,NOruns);
 
-	  for(sz = 0; sz < (2 * (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) + 1)); ++sz){
+  }
+  if(ss_mode == 1){ return LinkObjectsScan<DataT,FlagT,PropsT,1,false,false>(data_vals,flag_vals,size_x,size_y,size_z,chunk_x_start,chunk_y_start,chunk_z_start,merge_x,merge_y,merge_z,min_x_size,min_y_size,min_z_size,min_v_size,flag_value,start_obj,detections,obj_ids,check_obj_ids,obj_limit,max_x_val,max_y_val,max_z_val,data_metric,xyz_order,products,runs,NOruns); }
+  return LinkObjectsScan<DataT,FlagT,PropsT,0,false,false>(data_vals,flag_vals,size_x,size_y,size_z,chunk_x_start,chunk_y_start,chunk_z_start,merge_x,merge_y,merge_z,min_x_size,min_y_size,min_z_size,min_v_size,flag_value,start_obj,detections,obj_ids,check_obj_ids,obj_limit,max_x_val,max_y_val,max_z_val,data_metric,xyz_order,products,runs,NOruns);
 
-	    temp_ref_spec[(sz + k - j)]+=detections[obj_batch][(o - (obj_batch * obj_limit))].Get_rspec(sz);
+}
 
-	  }
+// functions using floats
 
-	} else {
-	  
-	  k = detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) - 5;
+int CreateObjects(float * data_vals, int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, float intens_thresh_min, float intens_thresh_max, int flag_value, int start_obj, vector<object_props *> & detections, vector<int> & obj_ids, vector<int> & check_obj_ids, int obj_limit, int max_x_val, int max_y_val, int max_z_val, int ss_mode, long int * data_metric, int * xyz_order, int products){
 
-	  for(sz = 0; sz < (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) + 11); ++sz){
-	    
-	    temp_ref_spec[(sz + k - j)]+=detections[obj_batch][(o - (obj_batch * obj_limit))].Get_rspec(sz);
+  return LinkObjects(data_vals,flag_vals,size_x,size_y,size_z,chunk_x_start,chunk_y_start,chunk_z_start,merge_x,merge_y,merge_z,min_x_size,min_y_size,min_z_size,min_v_size,flag_value,start_obj,detections,obj_ids,check_obj_ids,obj_limit,max_x_val,max_y_val,max_z_val,ss_mode,data_metric,xyz_order,products,NULL,0);
 
-	  }
-	  
-	}
+}
 
-      } else {
+int CreateObjectsRuns(float * data_vals, int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, float intens_thresh_min, float intens_thresh_max, int flag_value, int start_obj, vector<object_props *> & detections, vector<int> & obj_ids, vector<int> & check_obj_ids, int obj_limit, int max_x_val, int max_y_val, int max_z_val, int ss_mode, long int * data_metric, int * xyz_order, int products, const int * runs, long int NOruns){
 
-	j = sz_start + chunk_z_start - 5;
+  return LinkObjects(data_vals,flag_vals,size_x,size_y,size_z,chunk_x_start,chunk_y_start,chunk_z_start,merge_x,merge_y,merge_z,min_x_size,min_y_size,min_z_size,min_v_size,flag_value,start_obj,detections,obj_ids,check_obj_ids,obj_limit,max_x_val,max_y_val,max_z_val,ss_mode,data_metric,xyz_order,products,runs,NOruns);
 
-	if((detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) + 1) >= 10){
+}
 
-	  k = detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) - ((int) floorf((0.5 * (double) (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) + 1))));
+long int CreateObjects(float * data_vals, long int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, float intens_thresh_min, float intens_thresh_max, long int flag_value, long int start_obj, vector<object_props *> & detections, vector<long int> & obj_ids, vector<long int> & check_obj_ids, int obj_limit, int max_x_val, int max_y_val, int max_z_val, int ss_mode, long int * data_metric, int * xyz_order, int products){
 
-	  for(sz = 0; sz < (2 * (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) + 1)); ++sz){
+  return LinkObjects(data_vals,flag_vals,size_x,size_y,size_z,chunk_x_start,chunk_y_start,chunk_z_start,merge_x,merge_y,merge_z,min_x_size,min_y_size,min_z_size,min_v_size,flag_value,start_obj,detections,obj_ids,check_obj_ids,obj_limit,max_x_val,max_y_val,max_z_val,ss_mode,data_metric,xyz_order,products,NULL,0);
 
-	    temp_ref_spec[(sz + k - j)]+=detections[obj_batch][(o - (obj_batch * obj_limit))].Get_rspec(sz);
+}
 
-	  }
+long int CreateObjectsRuns(float * data_vals, long int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, float intens_thresh_min, float intens_thresh_max, long int flag_value, long int start_obj, vector<object_props *> & detections, vector<long int> & obj_ids, vector<long int> & check_obj_ids, int obj_limit, int max_x_val, int max_y_val, int max_z_val, int ss_mode, long int * data_metric, int * xyz_order, int products, const int * runs, long int NOruns){
 
-	} else {
-	  
-	  k = detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) - 5;
+  return LinkObjects(data_vals,flag_vals,size_x,size_y,size_z,chunk_x_start,chunk_y_start,chunk_z_start,merge_x,merge_y,merge_z,min_x_size,min_y_size,min_z_size,min_v_size,flag_value,start_obj,detections,obj_ids,check_obj_ids,obj_limit,max_x_val,max_y_val,max_z_val,ss_mode,data_metric,xyz_order,products,runs,NOruns);
 
-	  for(sz = 0; sz < (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) + 11); ++sz){
-	    
-	    temp_ref_spec[(sz + k - j)]+=detections[obj_batch][(o - (obj_batch * obj_limit))].Get_rspec(sz);
+}
 
-	  }
-	  
-	}
+// functions using doubles
 
-      }
-      
-      // search through LoS's of updated bounding box and take action as dictated by case 5.a or 5.b
-      for(sy = sy_start; sy <= sy_finish; ++sy){
-	
-	for(sx = sx_start; sx <= sx_finish; ++sx){
-	  	  
-	  // add value to temp_sparse_rep_grid
-	  temp_sparse_reps_grid[(((sy - sy_start) * (sx_finish - sx_start + 1)) + sx - sx_start)] = NOi;
-	  
-	  // case 5.a triggered for moment-0 image and sparse representation
-	  if(((sx > merge_x) || (chunk_x_start == 0)) && ((sy > merge_y) || (chunk_y_start == 0))){
-	    
-	    // initialise the dummy integer j 
-	    j = -1;
-	    
-	    for(sz = sz_start; sz <= sz_finish; ++sz){
-	      
-	      // change j to reflect if this voxel in the flag_vals array belongs to the source
-	      if(flag_vals[((sz * data_metric[2]) + (sy * data_metric[1]) + (sx * data_metric[0]))] == o){ 
-		
-		// update mini_mom0
-		temp_mom0[(((sy - sy_start) * (sx_finish - sx_start + 1)) + sx - sx_start)]+=data_vals[((sz * data_metric[2]) + (sy * data_metric[1]) + (sx * data_metric[0]))];
-		
-		// update mini_RAPV
-		temp_RAPV[(((sz - sz_start) * (sx_finish - sx_start + 1)) + sx - sx_start)]+=data_vals[((sz * data_metric[2]) + (sy * data_metric[1]) + (sx * data_metric[0]))];
-		
-		// update mini_DECPV
-		temp_DECPV[(((sz - sz_start) * (sy_finish - sy_start + 1)) + sy - sy_start)]+=data_vals[((sz * data_metric[2]) + (sy * data_metric[1]) + (sx * data_metric[0]))];
-		
-		// update mini_obj_spec
-		temp_obj_spec[(sz - sz_start)]+=data_vals[((sz * data_metric[2]) + (sy * data_metric[1]) + (sx * data_metric[0]))];
-		
-		// update mini_vfield
-		temp_vfield[(((sy - sy_start) * (sx_finish - sx_start + 1)) + sx - sx_start)]+=(((double) (sz + chunk_z_start)) * data_vals[((sz * data_metric[2]) + (sy * data_metric[1]) + (sx * data_metric[0]))]);
-		
-		// if previously this was not part of an object string, j == -1, then increment the number of object strings and
-		// write the position to the sparse_reps array
-		if(j == -1){ 
-		  
-		  // write the beginning of the object string to sparse_reps
-		  temp_sparse_reps_strings[(2 * NOi)] = chunk_z_start + sz;
-		  
-		  // increment NOi
-		  ++NOi; 
-		  		  
-		  // initialise the end of the object string in sparse_reps
-		  temp_sparse_reps_strings[((2 * NOi) - 1)] = chunk_z_start + sz;
-		  
-		} else {
-		  
-		  // update the end of the object string in sparse_reps
-		  temp_sparse_reps_strings[((2 * NOi) - 1)] = chunk_z_start + sz;
-		  
-		}
-		
-		// change j to reflect that this voxel belongs to the object
-		j = 1; 
-		
-	      } else { 
-		
-		// change j to reflect that this voxel doesn't belong to the object
-		j = -1; 
-		
-	      }
-	      
-	      // for(sz = sz_start; sz <= sz_finish; ++sz)
-	    }
-	    
-	    // add values to temp_ref_spec
-	    if((sz_finish - sz_start + 1) >= 10){
-	      
-	      k = (int) floorf((0.5 * (float) (sz_finish - sz_start + 1)));
-	      
-	      for(sz = 0; sz < (2 * (sz_finish - sz_start + 1)); ++sz){
-	  	
-		if(((sz + sz_start - k) >= 0) && ((sz + sz_start - k) < size_z)){
-		  
-		  // update mini_ref_spec
-		  temp_ref_spec[(sz + sz_start - k)]+=data_vals[(((sz + sz_start - k) * data_metric[2]) + (sy * data_metric[1]) + (sx * data_metric[0]))];	
-		  
-		}
-		
-	      }
-	      
-	      // if(sz_finish >= 10)
-	    } else {
-	      
-	      for(sz = 0; sz < (sz_finish - sz_start + 11); ++sz){
-		
-		if(((sz + sz_start - 5) >= 0) && ((sz + sz_start - 5) < size_z)){
-		  
-		  // update mini_ref_spec
-		  temp_ref_spec[(sz + sz_start - 5)]+=data_vals[(((sz + sz_start - 5) * data_metric[2]) + (sy * data_metric[1]) + (sx * data_metric[0]))];	
-		  
-		}
-		
-	      }
-	      
-	      // else . . . if(sz_finish >= 10)
-	    }
-	    
-	  } else {
-	    // case 5.b triggered  
-	    	    
-	    // update temp_sparse_rep_strings
-	    j = 0;
-	    if(((sx + chunk_x_start) >= detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0)) && ((sx + chunk_x_start) <= (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(1) + 1)) && ((sy + chunk_y_start) >= detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(2)) && ((sy + chunk_y_start) <= (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(3) + 1))){
-	      
-	      for(g = detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_grid((((sy + chunk_y_start - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(2)) * (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) + sx + chunk_x_start - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0))); g < detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_grid((((sy + chunk_y_start - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(2)) * (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) + sx + chunk_x_start - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0) + 1)); ++g){
-		
-		temp_sparse_reps_strings[(NOi + j)] = detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_strings((2 * g));
-		temp_sparse_reps_strings[(NOi + j + 1)] = detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_strings(((2 * g) + 1));
-		++j;
-		
-	      }
-	      
-	      // update moment 0 postage stamp image
-	      temp_mom0[(((sy - sy_start) * (detections[obj_batch][(o - (obj_batch * obj_limit))].GetRAmax() - detections[obj_batch][(o - (obj_batch * obj_limit))].GetRAmin() + 1)) + sx - sx_start)] = detections[obj_batch][(o - (obj_batch * obj_limit))].Get_mom0((((sy + chunk_y_start - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(2)) * (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) + sx + chunk_x_start - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0)));
-	      
-	      // update vfield postage stamp image
-	      temp_vfield[(((sy - sy_start) * (detections[obj_batch][(o - (obj_batch * obj_limit))].GetRAmax() - detections[obj_batch][(o - (obj_batch * obj_limit))].GetRAmin() + 1)) + sx - sx_start)] = detections[obj_batch][(o - (obj_batch * obj_limit))].Get_vfield((((sy + chunk_y_start - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(2)) * (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) + sx + chunk_x_start - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0)));
-
-	      // update NOi
-	      NOi+=(detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_grid((((sy + chunk_y_start - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(2)) * (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) + sx + chunk_x_start - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_grid((((sy + chunk_y_start - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(2)) * (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) + sx + chunk_x_start - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0))));
-	      	      
-	    }
-	    
-	    // else . . . case 5.b
-	  }
-	    
-	  // for(sx = sx_start; sx <= sx_finish; ++sx)
-	}
-		
-	// for(sy = sy_start; sy <= sy_finish; ++sy)
-      }
-            
-      temp_sparse_reps_grid[((sx_finish - sx_start + 1) * (sy_finish - sy_start + 1))] = NOi;
-
-      // 6. replace the current sparse representation with the new sparse representation
-      detections[obj_batch][(o - (obj_batch * obj_limit))].ReInit_srep();
-      detections[obj_batch][(o - (obj_batch * obj_limit))].ReInit_mini();
- 
-      // update the sparse_reps_size array with the new bounding box
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Set_srep_size(0,detections[obj_batch][(o - (obj_batch * obj_limit))].GetRAmin());
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Set_srep_size(1,detections[obj_batch][(o - (obj_batch * obj_limit))].GetRAmax());
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Set_srep_size(2,detections[obj_batch][(o - (obj_batch * obj_limit))].GetDECmin());
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Set_srep_size(3,detections[obj_batch][(o - (obj_batch * obj_limit))].GetDECmax());
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Set_srep_size(4,detections[obj_batch][(o - (obj_batch * obj_limit))].GetFREQmin());
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Set_srep_size(5,detections[obj_batch][(o - (obj_batch * obj_limit))].GetFREQmax());
-
-      // update the sparse_reps_update array
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Set_srep_update(-1);
-          
-      // populate the new sparse_reps and postage stamps
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Create_srep_grid((1 + ((detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0) + 1) * (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(2) + 1))));
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Create_srep_strings((2 * NOi));
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Create_mom0(((detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0) + 1) * (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(2) + 1)));
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Create_RAPV(((detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0) + 1) * (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) + 1)));
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Create_DECPV(((detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(2) + 1) * (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) + 1)));
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Create_vfield(((detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0) + 1) * (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(2) + 1)));
-  
-      detections[obj_batch][(o - (obj_batch * obj_limit))].Create_ospec((detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) + 1));
-      if((detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) + 1) >= 10){
-       
-	detections[obj_batch][(o - (obj_batch * obj_limit))].Create_rspec((2 * (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) + 1)));
-	
-      } else {
-	
-	detections[obj_batch][(o - (obj_batch * obj_limit))].Create_rspec((detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) + 11));
+int CreateObjects(double * data_vals, int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, double intens_thresh_min, double intens_thresh_max, int flag_value, int start_obj, vector<object_props_dbl *> & detections, vector<int> & obj_ids, vector<int> & check_obj_ids, int obj_limit, int max_x_val, int max_y_val, int max_z_val, int ss_mode, long int * data_metric, int * xyz_order, int products){
 
-      }
-   
-      for(j = 0; j < (1 + ((detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0) + 1) * (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(2) + 1))); ++j){ detections[obj_batch][(o - (obj_batch * obj_limit))].Set_srep_grid(j,temp_sparse_reps_grid[j]); }
-      for(j = 0; j < (2 * NOi); ++j){ detections[obj_batch][(o - (obj_batch * obj_limit))].Set_srep_strings(j,temp_sparse_reps_strings[j]); }
-      for(j = 0; j < ((detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0) + 1) * (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(2) + 1)); ++j){ detections[obj_batch][(o - (obj_batch * obj_limit))].Set_mom0(j,temp_mom0[j]); }
-      for(j = 0; j < ((detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0) + 1) * (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) + 1)); ++j){ detections[obj_batch][(o - (obj_batch * obj_limit))].Set_RAPV(j,temp_RAPV[j]); }
-      for(j = 0; j < ((detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(2) + 1) * (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) + 1)); ++j){ detections[obj_batch][(o - (obj_batch * obj_limit))].Set_DECPV(j,temp_DECPV[j]); }
-      for(j = 0; j < ((detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(0) + 1) * (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(2) + 1)); ++j){ detections[obj_batch][(o - (obj_batch * obj_limit))].Set_vfield(j,temp_vfield[j]); }
-
-      for(j = 0; j < (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) + 1); ++j){ detections[obj_batch][(o - (obj_batch * obj_limit))].Set_ospec(j,temp_obj_spec[j]); }
-      if((detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) + 1) >= 10){
-
-	for(j = 0; j < (2 * (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) + 1)); ++j){ detections[obj_batch][(o - (obj_batch * obj_limit))].Set_rspec(j,temp_ref_spec[j]); }
-	
-      } else {
+  return LinkObjects(data_vals,flag_vals,size_x,size_y,size_z,chunk_x_start,chunk_y_start,chunk_z_start,merge_x,merge_y,merge_z,min_x_size,min_y_size,min_z_size,min_v_size,flag_value,start_obj,detections,obj_ids,check_obj_ids,obj_limit,max_x_val,max_y_val,max_z_val,ss_mode,data_metric,xyz_order,products,NULL,0);
 
-	for(j = 0; j < (detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(o - (obj_batch * obj_limit))].Get_srep_size(4) + 11); ++j){ detections[obj_batch][(o - (obj_batch * obj_limit))].Set_rspec(j,temp_ref_spec[j]); }
+}
+
+int CreateObjectsRuns(double * data_vals, int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, double intens_thresh_min, double intens_thresh_max, int flag_value, int start_obj, vector<object_props_dbl *> & detections, vector<int> & obj_ids, vector<int> & check_obj_ids, int obj_limit, int max_x_val, int max_y_val, int max_z_val, int ss_mode, long int * data_metric, int * xyz_order, int products, const int * runs, long int NOruns){
+
+  return LinkObjects(data_vals,flag_vals,size_x,size_y,size_z,chunk_x_start,chunk_y_start,chunk_z_start,merge_x,merge_y,merge_z,min_x_size,min_y_size,min_z_size,min_v_size,flag_value,start_obj,detections,obj_ids,check_obj_ids,obj_limit,max_x_val,max_y_val,max_z_val,ss_mode,data_metric,xyz_order,products,runs,NOruns);
+
+}
+
+long int CreateObjects(double * data_vals, long int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, double intens_thresh_min, double intens_thresh_max, long int flag_value, long int start_obj, vector<object_props_dbl *> & detections, vector<long int> & obj_ids, vector<long int> & check_obj_ids, int obj_limit, int max_x_val, int max_y_val, int max_z_val, int ss_mode, long int * data_metric, int * xyz_order, int products){
+
+  return LinkObjects(data_vals,flag_vals,size_x,size_y,size_z,chunk_x_start,chunk_y_start,chunk_z_start,merge_x,merge_y,merge_z,min_x_size,min_y_size,min_z_size,min_v_size,flag_value,start_obj,detections,obj_ids,check_obj_ids,obj_limit,max_x_val,max_y_val,max_z_val,ss_mode,data_metric,xyz_order,products,NULL,0);
 
-      }
-      
-      // else . . . if(sparse_reps[obj_batch][(obj - (obj_batch * obj_limit))][0] < 0)
-    }
-    
-    // update progress on display
-    while(progress <= (((double) (o + 1) / ((double) obj)))){ std::cout << "*"; std::cout.flush(); progress+=0.05; }  
-   
-    // for(o = 0; o < obj; ++o)
-  }
-  std::cout << "* done." << std::endl;
-    
-  // 5. return the number of coherent objects 
-  return obj;
-  
 }
 
+long int CreateObjectsRuns(double * data_vals, long int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, double intens_thresh_min, double intens_thresh_max, long int flag_value, long int start_obj, vector<object_props_dbl *> & detections, vector<long int> & obj_ids, vector<long int> & check_obj_ids, int obj_limit, int max_x_val, int max_y_val, int max_z_val, int ss_mode, long int * data_metric, int * xyz_order, int products, const int * runs, long int NOruns){
+
+  return LinkObjects(data_vals,flag_vals,size_x,size_y,size_z,chunk_x_start,chunk_y_start,chunk_z_start,merge_x,merge_y,merge_z,min_x_size,min_y_size,min_z_size,min_v_size,flag_value,start_obj,detections,obj_ids,check_obj_ids,obj_limit,max_x_val,max_y_val,max_z_val,ss_mode,data_metric,xyz_order,products,runs,NOruns);
+
+}
@@ -15,6 +15,7 @@ object_props::object_props(){
   cw_max = cw20_min = cw50_min = cw20_max = cw50_max = -1E10;
   srep_size[0] = srep_size[1] = srep_size[2] = srep_size[3] = srep_size[4] = srep_size[5] = -99;
   srep_update = 0;
+  srep_NOlos = 0;
   srep_grid = NULL;
   srep_strings = NULL;
   mini_mom0 = NULL;
@@ -23,6 +24,7 @@ object_props::object_props(){
   mini_obj_spec = NULL;
   mini_ref_spec = NULL;
   mini_vfield = NULL;
+  arena = NULL;
 
   // new parameters --- multiple central moment calculations
   p_tot_intens = n_tot_intens = 0.0;
@@ -35,6 +37,7 @@ object_props::object_props(const object_props & copied){
 
   int i;
 
+  arena = NULL;
   NOvox = copied.NOvox; 
   ra = copied.ra;
   dec = copied.dec;
@@ -73,53 +76,54 @@ object_props::object_props(const object_props & copied){
   srep_size[4] = copied.srep_size[4];
   srep_size[5] = copied.srep_size[5];
   srep_update = copied.srep_update;
+  srep_NOlos = copied.srep_NOlos;
 
   if(copied.srep_grid != NULL){
 
-    srep_grid = new int[(srep_size[1] - srep_size[0] + 1) * (srep_size[3] - srep_size[2] + 1)];
+    srep_grid = NewInts((srep_size[1] - srep_size[0] + 1) * (srep_size[3] - srep_size[2] + 1));
     for(i = 0; i < ((srep_size[1] - srep_size[0] + 1) * (srep_size[3] - srep_size[2] + 1)); ++i){ srep_grid[i] = copied.srep_grid[i]; }    
 
   } else { srep_grid = NULL; }
   if(copied.srep_strings != NULL){
 
-    srep_strings = new int[(2 * srep_grid[((srep_size[3] - srep_size[2] + 1) * (srep_size[1] - srep_size[0] + 1))])];
+    srep_strings = NewInts((2 * srep_grid[((srep_size[3] - srep_size[2] + 1) * (srep_size[1] - srep_size[0] + 1))]));
     for(i = 0; i < (2 * srep_grid[((srep_size[3] - srep_size[2] + 1) * (srep_size[1] - srep_size[0] + 1))]); ++i){ srep_strings[i] = copied.srep_strings[i]; }
 
   } else { srep_strings = NULL; }
   if(copied.mini_mom0 != NULL){
 
-    mini_mom0 = new float[(srep_size[1] - srep_size[0] + 1) * (srep_size[3] - srep_size[2] + 1)];
+    mini_mom0 = NewVals((srep_size[1] - srep_size[0] + 1) * (srep_size[3] - srep_size[2] + 1));
     for(i = 0; i < ((srep_size[1] - srep_size[0] + 1) * (srep_size[3] - srep_size[2] + 1)); ++i){ mini_mom0[i] = copied.mini_mom0[i]; }
 
   } else { mini_mom0 = NULL; }
   if(copied.mini_RAPV != NULL){
 
-    mini_RAPV = new float[(srep_size[1] - srep_size[0] + 1) * (srep_size[5] - srep_size[4] + 1)];
+    mini_RAPV = NewVals((srep_size[1] - srep_size[0] + 1) * (srep_size[5] - srep_size[4] + 1));
     for(i = 0; i < ((srep_size[1] - srep_size[0] + 1) * (srep_size[5] - srep_size[4] + 1)); ++i){ mini_RAPV[i] = copied.mini_RAPV[i]; }
 
   } else { mini_RAPV = NULL; }
   if(copied.mini_DECPV != NULL){
 
-    mini_DECPV = new float[(srep_size[3] - srep_size[2] + 1) * (srep_size[5] - srep_size[4] + 1)];
+    mini_DECPV = NewVals((srep_size[3] - srep_size[2] + 1) * (srep_size[5] - srep_size[4] + 1));
     for(i = 0; i < ((srep_size[3] - srep_size[2] + 1) * (srep_size[5] - srep_size[4] + 1)); ++i){ mini_DECPV[i] = copied.mini_DECPV[i]; }
     
   } else { mini_DECPV = NULL; }
-  if(mini_obj_spec != NULL){
+  if(copied.mini_obj_spec != NULL){
 
-    mini_obj_spec = new float[(srep_size[5] - srep_size[4] + 1)];
+    mini_obj_spec = NewVals((srep_size[5] - srep_size[4] + 1));
     for(i = 0; i < ((srep_size[5] - srep_size[4] + 1)); ++i){ mini_obj_spec[i] = copied.mini_obj_spec[i]; }
 
   } else { mini_obj_spec = NULL; }
-  if(mini_ref_spec != NULL){
+  if(copied.mini_ref_spec != NULL){
 
     if((copied.srep_size[5] - copied.srep_size[4] + 1) >= 10){
 
-      mini_ref_spec = new float[(srep_size[5] - srep_size[4] + 1)];
-      for(i = 0; i < ((srep_size[5] - srep_size[4] + 1)); ++i){ mini_ref_spec[i] = copied.mini_ref_spec[i]; }    
+      mini_ref_spec = NewVals((2 * (srep_size[5] - srep_size[4] + 1)));
+      for(i = 0; i < (2 * (srep_size[5] - srep_size[4] + 1)); ++i){ mini_ref_spec[i] = copied.mini_ref_spec[i]; }    
 
     } else {
 
-      mini_ref_spec = new float[(srep_size[5] - srep_size[4] + 11)];
+      mini_ref_spec = NewVals((srep_size[5] - srep_size[4] + 11));
       for(i = 0; i < ((srep_size[5] - srep_size[4] + 11)); ++i){ mini_ref_spec[i] = copied.mini_ref_spec[i]; }    
 
     }
@@ -127,7 +131,7 @@ object_props::object_props(const object_props & copied){
   } else { mini_ref_spec = NULL; }
   if(copied.mini_vfield != NULL){
 
-    mini_vfield = new float[(srep_size[1] - srep_size[0] + 1) * (srep_size[3] - srep_size[2] + 1)];
+    mini_vfield = NewVals((srep_size[1] - srep_size[0] + 1) * (srep_size[3] - srep_size[2] + 1));
     for(i = 0; i < ((srep_size[1] - srep_size[0] + 1) * (srep_size[3] - srep_size[2] + 1)); ++i){ mini_vfield[i] = copied.mini_vfield[i]; }
 
   } else { mini_vfield = NULL; }
@@ -188,53 +192,54 @@ object_props & object_props::operator = (const object_props & copied){
     srep_size[4] = copied.srep_size[4];
     srep_size[5] = copied.srep_size[5];
     srep_update = copied.srep_update;
+    srep_NOlos = copied.srep_NOlos;
     
     if(copied.srep_grid != NULL){
       
-      srep_grid = new int[(srep_size[1] - srep_size[0] + 1) * (srep_size[3] - srep_size[2] + 1)];
+      srep_grid = NewInts((srep_size[1] - srep_size[0] + 1) * (srep_size[3] - srep_size[2] + 1));
       for(i = 0; i < ((srep_size[1] - srep_size[0] + 1) * (srep_size[3] - srep_size[2] + 1)); ++i){ srep_grid[i] = copied.srep_grid[i]; }    
       
     } else { srep_grid = NULL; }
     if(copied.srep_strings != NULL){
       
-      srep_strings = new int[(2 * srep_grid[((srep_size[3] - srep_size[2] + 1) * (srep_size[1] - srep_size[0] + 1))])];
+      srep_strings = NewInts((2 * srep_grid[((srep_size[3] - srep_size[2] + 1) * (srep_size[1] - srep_size[0] + 1))]));
       for(i = 0; i < (2 * srep_grid[((srep_size[3] - srep_size[2] + 1) * (srep_size[1] - srep_size[0] + 1))]); ++i){ srep_strings[i] = copied.srep_strings[i]; }
       
     } else { srep_strings = NULL; }
     if(copied.mini_mom0 != NULL){
       
-      mini_mom0 = new float[(srep_size[1] - srep_size[0] + 1) * (srep_size[3] - srep_size[2] + 1)];
+      mini_mom0 = NewVals((srep_size[1] - srep_size[0] + 1) * (srep_size[3] - srep_size[2] + 1));
       for(i = 0; i < ((srep_size[1] - srep_size[0] + 1) * (srep_size[3] - srep_size[2] + 1)); ++i){ mini_mom0[i] = copied.mini_mom0[i]; }
       
     } else { mini_mom0 = NULL; }
     if(copied.mini_RAPV != NULL){
       
-      mini_RAPV = new float[(srep_size[1] - srep_size[0] + 1) * (srep_size[5] - srep_size[4] + 1)];
+      mini_RAPV = NewVals((srep_size[1] - srep_size[0] + 1) * (srep_size[5] - srep_size[4] + 1));
       for(i = 0; i < ((srep_size[1] - srep_size[0] + 1) * (srep_size[5] - srep_size[4] + 1)); ++i){ mini_RAPV[i] = copied.mini_RAPV[i]; }
       
     } else { mini_RAPV = NULL; }
     if(copied.mini_DECPV != NULL){
       
-      mini_DECPV = new float[(srep_size[3] - srep_size[2] + 1) * (srep_size[5] - srep_size[4] + 1)];
+      mini_DECPV = NewVals((srep_size[3] - srep_size[2] + 1) * (srep_size[5] - srep_size[4] + 1));
       for(i = 0; i < ((srep_size[3] - srep_size[2] + 1) * (srep_size[5] - srep_size[4] + 1)); ++i){ mini_DECPV[i] = copied.mini_DECPV[i]; }
       
     } else { mini_DECPV = NULL; }
-    if(mini_obj_spec != NULL){
+    if(copied.mini_obj_spec != NULL){
       
-      mini_obj_spec = new float[(srep_size[5] - srep_size[4] + 1)];
+      mini_obj_spec = NewVals((srep_size[5] - srep_size[4] + 1));
       for(i = 0; i < ((srep_size[5] - srep_size[4] + 1)); ++i){ mini_obj_spec[i] = copied.mini_obj_spec[i]; }
       
     } else { mini_obj_spec = NULL; }
-    if(mini_ref_spec != NULL){
+    if(copied.mini_ref_spec != NULL){
       
       if((copied.srep_size[5] - copied.srep_size[4] + 1) >= 10){
 	
-	mini_ref_spec = new float[(srep_size[5] - srep_size[4] + 1)];
-	for(i = 0; i < ((srep_size[5] - srep_size[4] + 1)); ++i){ mini_ref_spec[i] = copied.mini_ref_spec[i]; }    
+	mini_ref_spec = NewVals((2 * (srep_size[5] - srep_size[4] + 1)));
+	for(i = 0; i < (2 * (srep_size[5] - srep_size[4] + 1)); ++i){ mini_ref_spec[i] = copied.mini_ref_spec[i]; }    
 	
       } else {
 	
-	mini_ref_spec = new float[(srep_size[5] - srep_size[4] + 11)];
+	mini_ref_spec = NewVals((srep_size[5] - srep_size[4] + 11));
 	for(i = 0; i < ((srep_size[5] - srep_size[4] + 11)); ++i){ mini_ref_spec[i] = copied.mini_ref_spec[i]; }    
 	
       }
@@ -242,7 +247,7 @@ object_props & object_props::operator = (const object_props & copied){
     } else { mini_ref_spec = NULL; }
     if(copied.mini_vfield != NULL){
       
-      mini_vfield = new float[(srep_size[1] - srep_size[0] + 1) * (srep_size[3] - srep_size[2] + 1)];
+      mini_vfield = NewVals((srep_size[1] - srep_size[0] + 1) * (srep_size[3] - srep_size[2] + 1));
       for(i = 0; i < ((srep_size[1] - srep_size[0] + 1) * (srep_size[3] - srep_size[2] + 1)); ++i){ mini_vfield[i] = copied.mini_vfield[i]; }
       
     } else { mini_vfield = NULL; }
@@ -264,14 +269,16 @@ object_props & object_props::operator = (const object_props & copied){
   
 object_props::~object_props(){ 
 
-  if(srep_grid != NULL){ delete [] srep_grid; srep_grid = NULL; } 
-  if(srep_strings != NULL){ delete [] srep_strings; srep_strings = NULL; }
-  if(mini_mom0 != NULL){ delete [] mini_mom0; mini_mom0 = NULL; }
-  if(mini_RAPV != NULL){ delete [] mini_RAPV; mini_RAPV = NULL; }
-  if(mini_DECPV != NULL){ delete [] mini_DECPV; mini_DECPV = NULL; }
-  if(mini_obj_spec != NULL){ delete [] mini_obj_spec; mini_obj_spec = NULL; }
-  if(mini_ref_spec != NULL){ delete [] mini_ref_spec; mini_ref_spec = NULL; }
-  if(mini_vfield != NULL){ delete [] mini_vfield; mini_vfield = NULL; }
+  // the arrays of objects with an arena are released in bulk with the arena
+  if(arena != NULL){ return; }
+  if(srep_grid != NULL){ Release(srep_grid); srep_grid = NULL; } 
+  if(srep_strings != NULL){ Release(srep_strings); srep_strings = NULL; }
+  if(mini_mom0 != NULL){ Release(mini_mom0); mini_mom0 = NULL; }
+  if(mini_RAPV != NULL){ Release(mini_RAPV); mini_RAPV = NULL; }
+  if(mini_DECPV != NULL){ Release(mini_DECPV); mini_DECPV = NULL; }
+  if(mini_obj_spec != NULL){ Release(mini_obj_spec); mini_obj_spec = NULL; }
+  if(mini_ref_spec != NULL){ Release(mini_ref_spec); mini_ref_spec = NULL; }
+  if(mini_vfield != NULL){ Release(mini_vfield); mini_vfield = NULL; }
 
 }
 
@@ -419,6 +426,9 @@ void object_props::ReInit(){
   ra_max = dec_max = freq_max = max_intens = -1E10;
   w_max = w20_min = w50_min = w20_max = w50_max = -1E10;
   cw_max = cw20_min = cw50_min = cw20_max = cw50_max = -1E10;
+  p_tot_intens = n_tot_intens = 0.0;
+  p_ra_i = p_dec_i = p_freq_i = 0.0;
+  n_ra_i = n_dec_i = n_freq_i = 0.0;
 
 }
 
@@ -436,12 +446,12 @@ void object_props::AddRA_i(float pos, float value){
 }
 
 void object_props::AddDec_i(float pos, float value){ 
-  dec_i+=value; 
+  dec_i+=(pos * value); 
   if(value >= 0.0){ p_dec_i+=(pos * value); } else { n_dec_i+=(pos * value); }
 }
 
 void object_props::AddFreq_i(float pos, float value){ 
-  freq_i+=value; 
+  freq_i+=(pos * value); 
   if(value >= 0.0){ p_freq_i+=(pos * value); } else { n_freq_i+=(pos * value); }
 }
 
@@ -462,9 +472,6 @@ void object_props::AdjustRange(float value){
 }
 
 void object_props::CalcProps(){
-  
-  float dummy, flip;
-  int g;
 
   // calculate basic properties
   ra = ra / NOvox; 
@@ -494,23 +501,36 @@ void object_props::CalcProps(){
     freq_i = n_freq_i;
   }
 
+  // the postage stamp images and the line widths depend on the moments calculated above
+  this->CalcMiniProps();
+
+}
+
+// clean the postage stamp images, normalise the velocity field and calculate the line widths
+void object_props::CalcMiniProps(){
+
+  float dummy, flip;
+  int g;
+
   // remove inf's and nan's from the various arrays
-  for(g = 0; g < ((srep_size[1] - srep_size[0] + 1) * (srep_size[3] - srep_size[2] + 1)); ++g){
+  for(g = 0; ((mini_mom0 != NULL) && (g < ((srep_size[1] - srep_size[0] + 1) * (srep_size[3] - srep_size[2] + 1)))); ++g){
     if((std::isinf(mini_mom0[g])) || (std::isnan(mini_mom0[g]))){ mini_mom0[g] = 0.0; }
+  }
+  for(g = 0; ((mini_vfield != NULL) && (g < ((srep_size[1] - srep_size[0] + 1) * (srep_size[3] - srep_size[2] + 1)))); ++g){
     if((std::isinf(mini_vfield[g])) || (std::isnan(mini_vfield[g]))){ mini_vfield[g] = 0.0; }
   }
-  for(g = 0; g < ((srep_size[1] - srep_size[0] + 1) * (srep_size[5] - srep_size[4] + 1)); ++g){
+  for(g = 0; ((mini_RAPV != NULL) && (g < ((srep_size[1] - srep_size[0] + 1) * (srep_size[5] - srep_size[4] + 1)))); ++g){
     if((std::isinf(mini_RAPV[g])) || (std::isnan(mini_RAPV[g]))){ mini_RAPV[g] = 0.0; }
   }
-  for(g = 0; g < ((srep_size[3] - srep_size[2] + 1) * (srep_size[5] - srep_size[4] + 1)); ++g){
+  for(g = 0; ((mini_DECPV != NULL) && (g < ((srep_size[3] - srep_size[2] + 1) * (srep_size[5] - srep_size[4] + 1)))); ++g){
     if((std::isinf(mini_DECPV[g])) || (std::isnan(mini_DECPV[g]))){ mini_DECPV[g] = 0.0; }
   }
-  for(g = 0; g < ((srep_size[5] - srep_size[4] + 1)); ++g){
+  for(g = 0; ((mini_obj_spec != NULL) && (g < (srep_size[5] - srep_size[4] + 1))); ++g){
     if((std::isinf(mini_obj_spec[g])) || (std::isnan(mini_obj_spec[g]))){ mini_obj_spec[g] = 0.0; }
   }
 
-  // normalise velocity field array
-  for(g = 0; g < ((srep_size[1] - srep_size[0] + 1) * (srep_size[3] - srep_size[2] + 1)); ++g){ 
+  // normalise velocity field array, which requires the moment-0 image
+  for(g = 0; ((mini_vfield != NULL) && (mini_mom0 != NULL) && (g < ((srep_size[1] - srep_size[0] + 1) * (srep_size[3] - srep_size[2] + 1)))); ++g){ 
 
     if(mini_mom0[g] != 0.0){
 
@@ -527,7 +547,7 @@ void object_props::CalcProps(){
   // calculate widths of source
   
   // determine maximum flux in integrated spectrum and W_50, W_20 limits
-  if((srep_size[5] - srep_size[4]) > 0){
+  if(((srep_size[5] - srep_size[4]) > 0) && (mini_obj_spec != NULL)){
     
     flip = 1.0;
     if(tot_intens < 0.0){ flip = -1.0; }
@@ -891,27 +911,33 @@ void object_props::Set_srep_update(int value){ srep_update = value; }
 
 int object_props::Get_srep_update(){ return srep_update; }
 
+int object_props::Get_products(){ return ((mini_mom0 != NULL) ? SREP_MOM0 : 0) | ((mini_RAPV != NULL) ? SREP_RAPV : 0) | ((mini_DECPV != NULL) ? SREP_DECPV : 0) | ((mini_obj_spec != NULL) ? SREP_OSPEC : 0) | ((mini_ref_spec != NULL) ? SREP_RSPEC : 0) | ((mini_vfield != NULL) ? SREP_VFIELD : 0); }
+
 void object_props::Set_srep_size(int index, int value){ srep_size[index] = value; }
 
 int object_props::Get_srep_size(int index){ return srep_size[index]; }
 
-void object_props::Create_srep_grid(int value){ while(srep_grid == NULL){ srep_grid = new int[value]; } }
+void object_props::Create_srep_grid(int value){ while(srep_grid == NULL){ srep_grid = NewInts(value); } srep_NOlos = 0; }
 
-void object_props::Set_srep_grid(int index, int value){ srep_grid[index] = value; }
+// the grid is always written in order, so the lines of sight that contain object strings are counted
+// as it is written
+void object_props::Set_srep_grid(int index, int value){ srep_grid[index] = value; if((index > 0) && (value > srep_grid[(index - 1)])){ ++srep_NOlos; } }
 
 int object_props::Get_srep_grid(int index){ return srep_grid[index]; }
 
-void object_props::Free_srep_grid(){ if(srep_grid != NULL){ delete [] srep_grid; srep_grid = NULL; } }
+void object_props::Free_srep_grid(){ if(srep_grid != NULL){ Release(srep_grid); srep_grid = NULL; } srep_NOlos = 0; }
+
+int object_props::Get_srep_NOlos(){ return srep_NOlos; }
 
-void object_props::Create_srep_strings(int value){ while(srep_strings == NULL){ srep_strings = new int[value]; } }
+void object_props::Create_srep_strings(int value){ while(srep_strings == NULL){ srep_strings = NewInts(value); } }
 
 void object_props::Set_srep_strings(int index, int value){ srep_strings[index] = value; }
 
 int object_props::Get_srep_strings(int index){ return srep_strings[index]; }
 
-void object_props::Free_srep_strings(){ if(srep_strings != NULL){ delete [] srep_strings; srep_strings = NULL; } }
+void object_props::Free_srep_strings(){ if(srep_strings != NULL){ Release(srep_strings); srep_strings = NULL; } }
 
-void object_props::Create_mom0(int value){ while(mini_mom0 == NULL){ mini_mom0 = new float[value]; } }
+void object_props::Create_mom0(int value){ while(mini_mom0 == NULL){ mini_mom0 = NewVals(value); } }
 
 void object_props::Set_mom0(int index, float value){ mini_mom0[index] = value; }
 
@@ -919,9 +945,9 @@ void object_props::Add_mom0(int index, float value){ mini_mom0[index]+=value; }
 
 float object_props::Get_mom0(int index){ return mini_mom0[index]; }
 
-void object_props::Free_mom0(){ if(mini_mom0 != NULL){ delete [] mini_mom0; mini_mom0 = NULL; } }
+void object_props::Free_mom0(){ if(mini_mom0 != NULL){ Release(mini_mom0); mini_mom0 = NULL; } }
 
-void object_props::Create_RAPV(int value){ while(mini_RAPV == NULL){ mini_RAPV = new float[value]; } }
+void object_props::Create_RAPV(int value){ while(mini_RAPV == NULL){ mini_RAPV = NewVals(value); } }
 
 void object_props::Set_RAPV(int index, float value){ mini_RAPV[index] = value; }
 
@@ -929,9 +955,9 @@ void object_props::Add_RAPV(int index, float value){ mini_RAPV[index]+=value; }
 
 float object_props::Get_RAPV(int index){ return mini_RAPV[index]; }
 
-void object_props::Free_RAPV(){ if(mini_RAPV != NULL){ delete [] mini_RAPV; mini_RAPV = NULL; } }
+void object_props::Free_RAPV(){ if(mini_RAPV != NULL){ Release(mini_RAPV); mini_RAPV = NULL; } }
 
-void object_props::Create_DECPV(int value){ while(mini_DECPV == NULL){ mini_DECPV = new float[value]; } }
+void object_props::Create_DECPV(int value){ while(mini_DECPV == NULL){ mini_DECPV = NewVals(value); } }
 
 void object_props::Set_DECPV(int index, float value){ mini_DECPV[index] = value; }
 
@@ -939,9 +965,9 @@ void object_props::Add_DECPV(int index, float value){ mini_DECPV[index]+=value;
 
 float object_props::Get_DECPV(int index){ return mini_DECPV[index]; }
 
-void object_props::Free_DECPV(){ if(mini_DECPV != NULL){ delete [] mini_DECPV; mini_DECPV = NULL; } }
+void object_props::Free_DECPV(){ if(mini_DECPV != NULL){ Release(mini_DECPV); mini_DECPV = NULL; } }
 
-void object_props::Create_ospec(int value){ while(mini_obj_spec == NULL){ mini_obj_spec = new float[value]; } }
+void object_props::Create_ospec(int value){ while(mini_obj_spec == NULL){ mini_obj_spec = NewVals(value); } }
 
 void object_props::Set_ospec(int index, float value){ mini_obj_spec[index] = value; }
 
@@ -949,9 +975,9 @@ void object_props::Add_ospec(int index, float value){ mini_obj_spec[index]+=valu
 
 float object_props::Get_ospec(int index){ return mini_obj_spec[index]; }
 
-void object_props::Free_ospec(){ if(mini_obj_spec != NULL){ delete [] mini_obj_spec; mini_obj_spec = NULL; } }
+void object_props::Free_ospec(){ if(mini_obj_spec != NULL){ Release(mini_obj_spec); mini_obj_spec = NULL; } }
 
-void object_props::Create_rspec(int value){ while(mini_ref_spec == NULL){ mini_ref_spec = new float[value]; } }
+void object_props::Create_rspec(int value){ while(mini_ref_spec == NULL){ mini_ref_spec = NewVals(value); } }
 
 void object_props::Set_rspec(int index, float value){ mini_ref_spec[index] = value; }
 
@@ -959,9 +985,9 @@ void object_props::Add_rspec(int index, float value){ mini_ref_spec[index]+=valu
 
 float object_props::Get_rspec(int index){ return mini_ref_spec[index]; }
 
-void object_props::Free_rspec(){ if(mini_ref_spec != NULL){ delete [] mini_ref_spec; mini_ref_spec = NULL; } }
+void object_props::Free_rspec(){ if(mini_ref_spec != NULL){ Release(mini_ref_spec); mini_ref_spec = NULL; } }
 
-void object_props::Create_vfield(int value){ while(mini_vfield == NULL){ mini_vfield = new float[value]; } }
+void object_props::Create_vfield(int value){ while(mini_vfield == NULL){ mini_vfield = NewVals(value); } }
 
 void object_props::Set_vfield(int index, float value){ mini_vfield[index] = value; }
 
@@ -969,40 +995,118 @@ void object_props::Add_vfield(int index, float value){ mini_vfield[index]+=value
 
 float object_props::Get_vfield(int index){ return mini_vfield[index]; }
 
-void object_props::Free_vfield(){ if(mini_vfield != NULL){ delete [] mini_vfield; mini_vfield = NULL; } }
+void object_props::Free_vfield(){ if(mini_vfield != NULL){ Release(mini_vfield); mini_vfield = NULL; } }
 
 void object_props::ReInit_srep(){
 
-  if(srep_grid != NULL){ delete [] srep_grid; }
+  if(srep_grid != NULL){ Release(srep_grid); }
   srep_grid = NULL;
-  if(srep_strings != NULL){ delete [] srep_strings; }
+  srep_NOlos = 0;
+  if(srep_strings != NULL){ Release(srep_strings); }
   srep_strings = NULL;
   
 }
 
 void object_props::ReInit_mini(){
 
-  if(mini_mom0 != NULL){ delete [] mini_mom0; }
+  if(mini_mom0 != NULL){ Release(mini_mom0); }
   mini_mom0 = NULL;
-  if(mini_RAPV != NULL){ delete [] mini_RAPV; }
+  if(mini_RAPV != NULL){ Release(mini_RAPV); }
   mini_RAPV = NULL;
-  if(mini_DECPV != NULL){ delete [] mini_DECPV; }
+  if(mini_DECPV != NULL){ Release(mini_DECPV); }
   mini_DECPV = NULL;
-  if(mini_obj_spec != NULL){ delete [] mini_obj_spec; }
+  if(mini_obj_spec != NULL){ Release(mini_obj_spec); }
   mini_obj_spec = NULL;
-  if(mini_ref_spec != NULL){ delete [] mini_ref_spec; }
+  if(mini_ref_spec != NULL){ Release(mini_ref_spec); }
   mini_ref_spec = NULL;
-  if(mini_vfield != NULL){ delete [] mini_vfield; }
+  if(mini_vfield != NULL){ Release(mini_vfield); }
   mini_vfield = NULL;
 
 }
 
+int * object_props::NewInts(int size){ return (arena != NULL) ? arena->TakeInts(size) : new int[size]; }
+
+float * object_props::NewVals(int size){ return (arena != NULL) ? arena->TakeVals(size) : new float[size]; }
+
+void object_props::Release(int * block){ if(arena != NULL){ arena->Give(block); } else { delete [] block; } }
+
+void object_props::Release(float * block){ if(arena != NULL){ arena->Give(block); } else { delete [] block; } }
+
+void object_props::SetArena(srep_arena<float> * value){ arena = value; }
+
+srep_arena<float> * object_props::GetArena(){ return arena; }
+
 void object_props::ReInit_size(){
 
   srep_size[0] = srep_size[1] = srep_size[2] = srep_size[3] = srep_size[4] = srep_size[5] = -99;
 
 }
 
+// copy the accumulated properties of this object to entry id of a columnar object store, and back
+void object_props::ToStore(object_store<float> & store, long int id){
+
+  store.NOvox[id] = NOvox;
+  store.ra[id] = ra;
+  store.dec[id] = dec;
+  store.freq[id] = freq;
+  store.ra_min[id] = ra_min;
+  store.ra_max[id] = ra_max;
+  store.dec_min[id] = dec_min;
+  store.dec_max[id] = dec_max;
+  store.freq_min[id] = freq_min;
+  store.freq_max[id] = freq_max;
+  store.ra_i[id] = ra_i;
+  store.dec_i[id] = dec_i;
+  store.freq_i[id] = freq_i;
+  store.p_ra_i[id] = p_ra_i;
+  store.p_dec_i[id] = p_dec_i;
+  store.p_freq_i[id] = p_freq_i;
+  store.n_ra_i[id] = n_ra_i;
+  store.n_dec_i[id] = n_dec_i;
+  store.n_freq_i[id] = n_freq_i;
+  store.tot_intens[id] = tot_intens;
+  store.p_tot_intens[id] = p_tot_intens;
+  store.n_tot_intens[id] = n_tot_intens;
+  store.avg_intens[id] = avg_intens;
+  store.sigma_intens[id] = sigma_intens;
+  store.rms[id] = rms;
+  store.min_intens[id] = min_intens;
+  store.max_intens[id] = max_intens;
+
+}
+
+void object_props::FromStore(object_store<float> & store, long int id){
+
+  NOvox = store.NOvox[id];
+  ra = store.ra[id];
+  dec = store.dec[id];
+  freq = store.freq[id];
+  ra_min = store.ra_min[id];
+  ra_max = store.ra_max[id];
+  dec_min = store.dec_min[id];
+  dec_max = store.dec_max[id];
+  freq_min = store.freq_min[id];
+  freq_max = store.freq_max[id];
+  ra_i = store.ra_i[id];
+  dec_i = store.dec_i[id];
+  freq_i = store.freq_i[id];
+  p_ra_i = store.p_ra_i[id];
+  p_dec_i = store.p_dec_i[id];
+  p_freq_i = store.p_freq_i[id];
+  n_ra_i = store.n_ra_i[id];
+  n_dec_i = store.n_dec_i[id];
+  n_freq_i = store.n_freq_i[id];
+  tot_intens = store.tot_intens[id];
+  p_tot_intens = store.p_tot_intens[id];
+  n_tot_intens = store.n_tot_intens[id];
+  avg_intens = store.avg_intens[id];
+  sigma_intens = store.sigma_intens[id];
+  rms = store.rms[id];
+  min_intens = store.min_intens[id];
+  max_intens = store.max_intens[id];
+
+}
+
 void object_props::AddPoint(float x_pos, float y_pos, float z_pos, float value){
 
   // update bounding box
@@ -1033,9 +1137,17 @@ void object_props::AddPoint(float x_pos, float y_pos, float z_pos, float value){
 
 void object_props::AddObject(object_props & merged){
 
-  int j,k,g,sx,sy,sz;
   vector<int> temp_sparse_reps_grid, temp_sparse_reps_strings;
   vector<float> temp_mom0, temp_RAPV, temp_DECPV, temp_ref_spec, temp_obj_spec, temp_vfield;
+
+  // use the scratch arrays of the arena if there is one, so that they are re-used between merges
+  if(arena != NULL){ this->AddObject(merged,arena->temp_sparse_reps_grid,arena->temp_sparse_reps_strings,arena->temp_mom0,arena->temp_RAPV,arena->temp_DECPV,arena->temp_ref_spec,arena->temp_obj_spec,arena->temp_vfield); }
+  else { this->AddObject(merged,temp_sparse_reps_grid,temp_sparse_reps_strings,temp_mom0,temp_RAPV,temp_DECPV,temp_ref_spec,temp_obj_spec,temp_vfield); }
+
+}
+
+void object_props::AddObject(object_props & merged,vector<int> & temp_sparse_reps_grid,vector<int> & temp_sparse_reps_strings,vector<float> & temp_mom0,vector<float> & temp_RAPV,vector<float> & temp_DECPV,vector<float> & temp_ref_spec,vector<float> & temp_obj_spec,vector<float> & temp_vfield){
+
     
   if(this != &merged){ 
 
@@ -1050,56 +1162,71 @@ void object_props::AddObject(object_props & merged){
     this->AddRa(merged.GetRA());
     this->AddDec(merged.GetDEC());
     this->AddFreq(merged.GetFREQ());
-    this->AddRA_i(1.0,merged.GetRAi());
-    this->AddDec_i(1.0,merged.GetDECi());
-    this->AddFreq_i(1.0,merged.GetFREQi());
-    this->AddTotIntens(merged.GetTI());
-    this->AddAvgIntens(merged.GetAvgI());
-    this->AddSigmaItens(merged.GetSigmaI());
+
+    // combine the intensity weighted sums directly --- the positive and negative parts have to be
+    // added separately, because the sign of the merged object's total says nothing about its parts
+    ra_i+=merged.ra_i;
+    dec_i+=merged.dec_i;
+    freq_i+=merged.freq_i;
+    p_ra_i+=merged.p_ra_i;
+    p_dec_i+=merged.p_dec_i;
+    p_freq_i+=merged.p_freq_i;
+    n_ra_i+=merged.n_ra_i;
+    n_dec_i+=merged.n_dec_i;
+    n_freq_i+=merged.n_freq_i;
+    tot_intens+=merged.tot_intens;
+    p_tot_intens+=merged.p_tot_intens;
+    n_tot_intens+=merged.n_tot_intens;
+    avg_intens+=merged.avg_intens;
+    sigma_intens+=merged.sigma_intens;
     this->AdjustRange(merged.GetMinI());		
     this->AdjustRange(merged.GetMaxI());	
 
-    // initialise temporary working arrays
-    temp_sparse_reps_grid.reserve(1000000);
-    temp_sparse_reps_grid.resize(0);
-    temp_sparse_reps_strings.reserve(1000000);
-    temp_sparse_reps_strings.resize(0);
-    temp_mom0.reserve(1000000);
-    temp_mom0.resize(0);
-    temp_RAPV.reserve(1000000);
-    temp_RAPV.resize(0);
-    temp_DECPV.reserve(1000000);
-    temp_DECPV.resize(0);
-    temp_obj_spec.reserve(1000000);
-    temp_obj_spec.resize(0);
-    temp_ref_spec.reserve(1000000);
-    temp_ref_spec.resize(0);
-    temp_vfield.reserve(1000000);
-    temp_vfield.resize(0);
-
-    // combine the sparse representations using the temporary arrays --- if they exist
-    if((merged.Get_srep_update() != 0) && (merged.Get_srep_size(0) >= 0)){
+    // combine the sparse representations, which relies on the updated bounding box
+    this->MergeSreps(merged,temp_sparse_reps_grid,temp_sparse_reps_strings,temp_mom0,temp_RAPV,temp_DECPV,temp_ref_spec,temp_obj_spec,temp_vfield);
+
+    // if(this != &merged)
+  }
+
+}
+
+// combine the sparse representation and postage stamp images of the merged object with those of this
+// object using the temporary arrays --- the bounding box of this object must already contain the merged object
+void object_props::MergeSreps(object_props & merged,vector<int> & temp_sparse_reps_grid,vector<int> & temp_sparse_reps_strings,vector<float> & temp_mom0,vector<float> & temp_RAPV,vector<float> & temp_DECPV,vector<float> & temp_ref_spec,vector<float> & temp_obj_spec,vector<float> & temp_vfield){
+
+  int j,k,g,sx,sy,sz,products;
+
+  if(this == &merged){ return; }
+
+  // only the postage stamp images held by both objects are kept, or those of the merged object if this
+  // object has no sparse representation yet
+  products = merged.Get_products();
+  if((this->Get_srep_update() != 0) && (this->Get_srep_size(0) >= 0)){ products&=this->Get_products(); }
+
+  // combine the sparse representations using the temporary arrays --- if they exist
+  if((merged.Get_srep_update() != 0) && (merged.Get_srep_size(0) >= 0)){
 		  
-      // write the existing object's sparse representations into temporary arrays and initialise temporary arrays at the same time, provided it exists
+    // write the existing object's sparse representations into temporary arrays and initialise temporary arrays at the same time, provided it exists
       
-      // a. grid
-      temp_sparse_reps_grid.resize(0);
-      for(g = 0; g < (1 + ((this->GetRAmax() - this->GetRAmin() + 1) * (this->GetDECmax() - this->GetDECmin() + 1))); ++g){ temp_sparse_reps_grid.push_back(0); }
+    // a. grid
+    temp_sparse_reps_grid.resize(0);
+    for(g = 0; g < (1 + ((this->GetRAmax() - this->GetRAmin() + 1) * (this->GetDECmax() - this->GetDECmin() + 1))); ++g){ temp_sparse_reps_grid.push_back(0); }
       
-      if((this->Get_srep_update() != 0) && (this->Get_srep_size(0) >= 0)){
+    if((this->Get_srep_update() != 0) && (this->Get_srep_size(0) >= 0)){
 	
-	for(sx = 0; sx < (this->Get_srep_size(1) - this->Get_srep_size(0) + 1); ++sx){
-	  for(sy = 0; sy < (this->Get_srep_size(3) - this->Get_srep_size(2) + 1); ++sy){
+      for(sx = 0; sx < (this->Get_srep_size(1) - this->Get_srep_size(0) + 1); ++sx){
+	for(sy = 0; sy < (this->Get_srep_size(3) - this->Get_srep_size(2) + 1); ++sy){
 	    
-	    temp_sparse_reps_grid[(((sy + this->Get_srep_size(2) - this->GetDECmin()) * (this->GetRAmax() - this->GetRAmin() + 1)) + sx + this->Get_srep_size(0) - this->GetRAmin())] = this->Get_srep_grid(((sy * (this->Get_srep_size(1) - this->Get_srep_size(0) + 1)) + sx + 1)) - this->Get_srep_grid(((sy * (this->Get_srep_size(1) - this->Get_srep_size(0) + 1)) + sx));
+	  temp_sparse_reps_grid[(((sy + this->Get_srep_size(2) - this->GetDECmin()) * (this->GetRAmax() - this->GetRAmin() + 1)) + sx + this->Get_srep_size(0) - this->GetRAmin())] = this->Get_srep_grid(((sy * (this->Get_srep_size(1) - this->Get_srep_size(0) + 1)) + sx + 1)) - this->Get_srep_grid(((sy * (this->Get_srep_size(1) - this->Get_srep_size(0) + 1)) + sx));
 	    
-	  }
-	  
 	}
-	
+	  
       }
+	
+    }
       
-      // b. mom-0
+    // b. mom-0
+    if(products & SREP_MOM0){
       temp_mom0.resize(0);
       for(g = 0; g < ((this->GetRAmax() - this->GetRAmin() + 1) * (this->GetDECmax() - this->GetDECmin() + 1)); ++g){ temp_mom0.push_back(0.0); }
       
@@ -1116,8 +1243,10 @@ void object_props::AddObject(object_props & merged){
 	}
 	
       }
+    }
       
-      // c. RAPV
+    // c. RAPV
+    if(products & SREP_RAPV){
       temp_RAPV.resize(0);
       for(g = 0; g < ((this->GetRAmax() - this->GetRAmin() + 1) * (this->GetFREQmax() - this->GetFREQmin() + 1)); ++g){ temp_RAPV.push_back(0.0); }
       
@@ -1134,8 +1263,10 @@ void object_props::AddObject(object_props & merged){
 	}
 	
       }
+    }
       
-      // d. DECPV
+    // d. DECPV
+    if(products & SREP_DECPV){
       temp_DECPV.resize(0);
       for(g = 0; g < ((this->GetDECmax() - this->GetDECmin() + 1) * (this->GetFREQmax() - this->GetFREQmin() + 1)); ++g){ temp_DECPV.push_back(0.0); }
       
@@ -1152,13 +1283,13 @@ void object_props::AddObject(object_props & merged){
 	}
 	
       }
+    }
       
-      // e. ref_spec
+    // e. ref_spec --- sized for the merged frequency range, as the object's new ref_spec is copied from it
+    if(products & SREP_RSPEC){
+      temp_ref_spec.assign((((this->GetFREQmax() - this->GetFREQmin() + 1) >= 10) ? (2 * (this->GetFREQmax() - this->GetFREQmin() + 1)) : (this->GetFREQmax() - this->GetFREQmin() + 11)),0.0);
       if((this->Get_srep_size(5) - this->Get_srep_size(4) + 1) >= 10){
 	
-	temp_ref_spec.resize(0);
-	for(g = 0; g < (2 * (this->GetFREQmax() - this->GetFREQmin() + 1)); ++g){ temp_ref_spec.push_back(0.0); }
-	
 	if((this->Get_srep_update() != 0) && (this->Get_srep_size(0) >= 0)){
 	  
 	  for(sz = 0; sz < (2 * (this->Get_srep_size(5) - this->Get_srep_size(4) + 1)); ++sz){ temp_ref_spec[(sz + this->Get_srep_size(4) - this->GetFREQmin())]+=this->Get_rspec(sz); } 
@@ -1167,9 +1298,6 @@ void object_props::AddObject(object_props & merged){
 	
       } else {
 	
-	temp_ref_spec.resize(0);
-	for(g = 0; g < (this->GetFREQmax() - this->GetFREQmin() + 11); ++g){ temp_ref_spec.push_back(0.0); }
-	
 	if((this->Get_srep_update() != 0) && (this->Get_srep_size(0) >= 0)){
 	  
 	  for(sz = 0; sz < (this->Get_srep_size(5) - this->Get_srep_size(4) + 11); ++sz){ temp_ref_spec[(sz + this->Get_srep_size(4) - this->GetFREQmin())]+=this->Get_rspec(sz); } 		    
@@ -1177,10 +1305,12 @@ void object_props::AddObject(object_props & merged){
 	}
 	
       }
+    }
       
-      // f. obj_spec
+    // f. obj_spec
+    if(products & SREP_OSPEC){
       temp_obj_spec.resize(0);
-      for(g = 0; g < (this->Get_srep_size(5) - this->Get_srep_size(4) + 1); ++g){ temp_obj_spec.push_back(0.0); }		  
+      for(g = 0; g < (this->GetFREQmax() - this->GetFREQmin() + 1); ++g){ temp_obj_spec.push_back(0.0); }		  
       if((this->Get_srep_update() != 0) && (this->Get_srep_size(0) >= 0)){
 	
 	for(sz = 0; sz < (this->Get_srep_size(5) - this->Get_srep_size(4) + 1); ++sz){
@@ -1190,8 +1320,10 @@ void object_props::AddObject(object_props & merged){
 	}
 	
       }
+    }
       
-      // g. vfield
+    // g. vfield
+    if(products & SREP_VFIELD){
       temp_vfield.resize(0);
       for(g = 0; g < ((this->GetRAmax() - this->GetRAmin() + 1) * (this->GetDECmax() - this->GetDECmin() + 1)); ++g){ temp_vfield.push_back(0.0); }
       
@@ -1208,21 +1340,23 @@ void object_props::AddObject(object_props & merged){
 	}
 	
       }
+    }
       
-      // write the merged object's sparse representations into temporary arrays
+    // write the merged object's sparse representations into temporary arrays
       
-      // a. grid
-      for(sx = 0; sx < (merged.Get_srep_size(1) - merged.Get_srep_size(0) + 1); ++sx){
+    // a. grid
+    for(sx = 0; sx < (merged.Get_srep_size(1) - merged.Get_srep_size(0) + 1); ++sx){
 	
-	for(sy = 0; sy < (merged.Get_srep_size(3) - merged.Get_srep_size(2) + 1); ++sy){
+      for(sy = 0; sy < (merged.Get_srep_size(3) - merged.Get_srep_size(2) + 1); ++sy){
 	  
-	  temp_sparse_reps_grid[(((sy + merged.Get_srep_size(2) - this->GetDECmin()) * (this->GetRAmax() - this->GetRAmin() + 1)) + sx + merged.Get_srep_size(0) - this->GetRAmin())]+=(merged.Get_srep_grid(((sy * (merged.Get_srep_size(1) - merged.Get_srep_size(0) + 1)) + sx + 1)) - merged.Get_srep_grid(((sy * (merged.Get_srep_size(1) - merged.Get_srep_size(0) + 1)) + sx)));
+	temp_sparse_reps_grid[(((sy + merged.Get_srep_size(2) - this->GetDECmin()) * (this->GetRAmax() - this->GetRAmin() + 1)) + sx + merged.Get_srep_size(0) - this->GetRAmin())]+=(merged.Get_srep_grid(((sy * (merged.Get_srep_size(1) - merged.Get_srep_size(0) + 1)) + sx + 1)) - merged.Get_srep_grid(((sy * (merged.Get_srep_size(1) - merged.Get_srep_size(0) + 1)) + sx)));
 	  
-	}
-	
       }
+	
+    }
       
-      // b. mom-0
+    // b. mom-0
+    if(products & SREP_MOM0){
       for(sx = 0; sx < (merged.Get_srep_size(1) - merged.Get_srep_size(0) + 1); ++sx){
 	
 	for(sy = 0; sy < (merged.Get_srep_size(3) - merged.Get_srep_size(2) + 1); ++sy){
@@ -1232,8 +1366,10 @@ void object_props::AddObject(object_props & merged){
 	}
 	
       }
+    }
       
-      // c. RAPV
+    // c. RAPV
+    if(products & SREP_RAPV){
       for(sx = 0; sx < (merged.Get_srep_size(1) - merged.Get_srep_size(0) + 1); ++sx){
 	
 	for(sz = 0; sz < (merged.Get_srep_size(5) - merged.Get_srep_size(4) + 1); ++sz){
@@ -1243,8 +1379,10 @@ void object_props::AddObject(object_props & merged){
 	}
 	
       }
+    }
       
-      // d. DECPV
+    // d. DECPV
+    if(products & SREP_DECPV){
       for(sy = 0; sy < (merged.Get_srep_size(3) - merged.Get_srep_size(2) + 1); ++sy){
 	
 	for(sz = 0; sz < (merged.Get_srep_size(5) - merged.Get_srep_size(4) + 1); ++sz){
@@ -1254,8 +1392,10 @@ void object_props::AddObject(object_props & merged){
 	}
 	
       }
+    }
       
-      // e. ref_spec
+    // e. ref_spec
+    if(products & SREP_RSPEC){
       if((merged.Get_srep_size(5) - merged.Get_srep_size(4) + 1) >= 10){
 	
 	for(sz = 0; sz < (2 * (merged.Get_srep_size(5) - merged.Get_srep_size(4) + 1)); ++sz){ 
@@ -1281,15 +1421,19 @@ void object_props::AddObject(object_props & merged){
 	} 		    
 	
       }
+    }
       
-      // f. obj_spec
+    // f. obj_spec
+    if(products & SREP_OSPEC){
       for(sz = 0; sz < (merged.Get_srep_size(5) - merged.Get_srep_size(4) + 1); ++sz){
 	
 	temp_obj_spec[(sz + merged.Get_srep_size(4) - this->GetFREQmin())]+=merged.Get_ospec(sz);
 	
       }
+    }
       
-      // g. vfield
+    // g. vfield
+    if(products & SREP_VFIELD){
       for(sx = 0; sx < (merged.Get_srep_size(1) - merged.Get_srep_size(0) + 1); ++sx){
 	
 	for(sy = 0; sy < (merged.Get_srep_size(3) - merged.Get_srep_size(2) + 1); ++sy){
@@ -1299,107 +1443,117 @@ void object_props::AddObject(object_props & merged){
 	}
 	
       }
+    }
       
-      // convert temp_sparse_reps_grid from differential to cumulative counts using temp_sparse_reps_string as an intermediary
-      temp_sparse_reps_strings.resize(1);
-      temp_sparse_reps_strings[0] = 0;
-      for(g = 1; g < (((this->GetRAmax() - this->GetRAmin() + 1) * (this->GetDECmax() - this->GetDECmin() + 1)) + 1); ++g){ temp_sparse_reps_strings.push_back(temp_sparse_reps_strings[(g - 1)] + temp_sparse_reps_grid[(g - 1)]); }
-      for(g = 0; g < (((this->GetRAmax() - this->GetRAmin() + 1) * (this->GetDECmax() - this->GetDECmin() + 1)) + 1); ++g){ temp_sparse_reps_grid[g] = temp_sparse_reps_strings[g]; }
+    // convert temp_sparse_reps_grid from differential to cumulative counts using temp_sparse_reps_string as an intermediary
+    temp_sparse_reps_strings.resize(1);
+    temp_sparse_reps_strings[0] = 0;
+    for(g = 1; g < (((this->GetRAmax() - this->GetRAmin() + 1) * (this->GetDECmax() - this->GetDECmin() + 1)) + 1); ++g){ temp_sparse_reps_strings.push_back(temp_sparse_reps_strings[(g - 1)] + temp_sparse_reps_grid[(g - 1)]); }
+    for(g = 0; g < (((this->GetRAmax() - this->GetRAmin() + 1) * (this->GetDECmax() - this->GetDECmin() + 1)) + 1); ++g){ temp_sparse_reps_grid[g] = temp_sparse_reps_strings[g]; }
       
-      // write new sparse_reps_strings value to temp_sparse_reps_strings array, using various grids to achieve indexing
+    // write new sparse_reps_strings value to temp_sparse_reps_strings array, using various grids to achieve indexing
       
-      // a. initialise temp_sparse_reps_strings
-      temp_sparse_reps_strings.resize(0);
-      for(g = 0; g < (2 * temp_sparse_reps_grid[((this->GetDECmax() - this->GetDECmin() + 1) * (this->GetRAmax() - this->GetRAmin() + 1))]); ++g){ temp_sparse_reps_strings.push_back(0); }
+    // a. initialise temp_sparse_reps_strings
+    temp_sparse_reps_strings.resize(0);
+    for(g = 0; g < (2 * temp_sparse_reps_grid[((this->GetDECmax() - this->GetDECmin() + 1) * (this->GetRAmax() - this->GetRAmin() + 1))]); ++g){ temp_sparse_reps_strings.push_back(0); }
       
       
-      // b. for each line of sight through the new existing object bounding box, retrieve the channel range of each object string along this LoS
-      for(sy = this->GetDECmin(); sy <= this->GetDECmax(); ++sy){
+    // b. for each line of sight through the new existing object bounding box, retrieve the channel range of each object string along this LoS
+    for(sy = this->GetDECmin(); sy <= this->GetDECmax(); ++sy){
 	
-	for(sx = this->GetRAmin(); sx <= this->GetRAmax(); ++sx){
+      for(sx = this->GetRAmin(); sx <= this->GetRAmax(); ++sx){
 	  
-	  // initialise the number of object strings written to this LoS
-	  k = 0;
+	// initialise the number of object strings written to this LoS
+	k = 0;
 	  
-	  // retrieve the starting index for object strings along this LoS
-	  j = 2 * temp_sparse_reps_grid[(((sy - this->GetDECmin()) * (this->GetRAmax() - this->GetRAmin() + 1)) + sx - this->GetRAmin())];
+	// retrieve the starting index for object strings along this LoS
+	j = 2 * temp_sparse_reps_grid[(((sy - this->GetDECmin()) * (this->GetRAmax() - this->GetRAmin() + 1)) + sx - this->GetRAmin())];
 	  
-	  // write existing object's object strings to temp_strings_array
-	  if((this->Get_srep_update() != 0) && (this->Get_srep_size(0) >= 0)){
+	// write existing object's object strings to temp_strings_array
+	if((this->Get_srep_update() != 0) && (this->Get_srep_size(0) >= 0)){
 	    
-	    if((sx >= this->Get_srep_size(0)) && (sx <= this->Get_srep_size(1)) && (sy >= this->Get_srep_size(2)) && (sy <= this->Get_srep_size(3))){
+	  if((sx >= this->Get_srep_size(0)) && (sx <= this->Get_srep_size(1)) && (sy >= this->Get_srep_size(2)) && (sy <= this->Get_srep_size(3))){
 	      
-	      for(g = this->Get_srep_grid((((sy - this->Get_srep_size(2)) * (this->Get_srep_size(1) - this->Get_srep_size(0) + 1)) + sx - this->Get_srep_size(0))); g < this->Get_srep_grid((((sy - this->Get_srep_size(2)) * (this->Get_srep_size(1) - this->Get_srep_size(0) + 1)) + sx - this->Get_srep_size(0) + 1)); ++g){
+	    for(g = this->Get_srep_grid((((sy - this->Get_srep_size(2)) * (this->Get_srep_size(1) - this->Get_srep_size(0) + 1)) + sx - this->Get_srep_size(0))); g < this->Get_srep_grid((((sy - this->Get_srep_size(2)) * (this->Get_srep_size(1) - this->Get_srep_size(0) + 1)) + sx - this->Get_srep_size(0) + 1)); ++g){
 		
-		temp_sparse_reps_strings[(j + k)] = this->Get_srep_strings((2 * g));
-		++k;
-		temp_sparse_reps_strings[(j + k)] = this->Get_srep_strings(((2 * g) + 1));
-		++k;
+	      temp_sparse_reps_strings[(j + k)] = this->Get_srep_strings((2 * g));
+	      ++k;
+	      temp_sparse_reps_strings[(j + k)] = this->Get_srep_strings(((2 * g) + 1));
+	      ++k;
 		
-	      }
-	      
-	      // if((sx >= sparse_reps_size[obj_batch][(existing - (obj_batch * obj_limit))][0]) && (sx <= sparse_reps_size[obj_batch][(existing - (obj_batch * obj_limit))][1]) && (sy >= sparse_reps_size[obj_batch][(existing - (obj_batch * obj_limit))][2]) && (sy <= sparse_reps_size[obj_batch][(existing - (obj_batch * obj_limit))][3]))
 	    }
-	    
-	    // if((sparse_reps_update[obj_batch][(existing - (obj_batch * obj_limit))] != 0) && (sparse_reps_size[obj_batch][(existing - (obj_batch * obj_limit))][0] >= 0))
+	      
+	    // if((sx >= sparse_reps_size[obj_batch][(existing - (obj_batch * obj_limit))][0]) && (sx <= sparse_reps_size[obj_batch][(existing - (obj_batch * obj_limit))][1]) && (sy >= sparse_reps_size[obj_batch][(existing - (obj_batch * obj_limit))][2]) && (sy <= sparse_reps_size[obj_batch][(existing - (obj_batch * obj_limit))][3]))
 	  }
+	    
+	  // if((sparse_reps_update[obj_batch][(existing - (obj_batch * obj_limit))] != 0) && (sparse_reps_size[obj_batch][(existing - (obj_batch * obj_limit))][0] >= 0))
+	}
 	  
-	  // write match_init[i] object strings to temp_strings_array
-	  if((sx >= merged.Get_srep_size(0)) && (sx <= merged.Get_srep_size(1)) && (sy >= merged.Get_srep_size(2)) && (sy <= merged.Get_srep_size(3))){
+	// write match_init[i] object strings to temp_strings_array
+	if((sx >= merged.Get_srep_size(0)) && (sx <= merged.Get_srep_size(1)) && (sy >= merged.Get_srep_size(2)) && (sy <= merged.Get_srep_size(3))){
 	    
-	    for(g = merged.Get_srep_grid((((sy - merged.Get_srep_size(2)) * (merged.Get_srep_size(1) - merged.Get_srep_size(0) + 1)) + sx - merged.Get_srep_size(0))); g < merged.Get_srep_grid((((sy - merged.Get_srep_size(2)) * (merged.Get_srep_size(1) - merged.Get_srep_size(0) + 1)) + sx - merged.Get_srep_size(0) + 1)); ++g){
+	  for(g = merged.Get_srep_grid((((sy - merged.Get_srep_size(2)) * (merged.Get_srep_size(1) - merged.Get_srep_size(0) + 1)) + sx - merged.Get_srep_size(0))); g < merged.Get_srep_grid((((sy - merged.Get_srep_size(2)) * (merged.Get_srep_size(1) - merged.Get_srep_size(0) + 1)) + sx - merged.Get_srep_size(0) + 1)); ++g){
 	      
-	      temp_sparse_reps_strings[(j + k)] = merged.Get_srep_strings((2 * g));
-	      ++k;
-	      temp_sparse_reps_strings[(j + k)] = merged.Get_srep_strings(((2 * g) + 1));
-	      ++k;
+	    temp_sparse_reps_strings[(j + k)] = merged.Get_srep_strings((2 * g));
+	    ++k;
+	    temp_sparse_reps_strings[(j + k)] = merged.Get_srep_strings(((2 * g) + 1));
+	    ++k;
 	      
-	    }
-	    
-	    // if((sx >= sparse_reps_size[obj_batch][(existing - (obj_batch * obj_limit))][0]) && (sx <= sparse_reps_size[obj_batch][(existing - (obj_batch * obj_limit))][1]) && (sy >= sparse_reps_size[obj_batch][(existing - (obj_batch * obj_limit))][2]) && (sy <= sparse_reps_size[obj_batch][(existing - (obj_batch * obj_limit))][3]))
 	  }
-	  
-	  // for(sx = 0; sx < (); ++sx)
+	    
+	  // if((sx >= sparse_reps_size[obj_batch][(existing - (obj_batch * obj_limit))][0]) && (sx <= sparse_reps_size[obj_batch][(existing - (obj_batch * obj_limit))][1]) && (sy >= sparse_reps_size[obj_batch][(existing - (obj_batch * obj_limit))][2]) && (sy <= sparse_reps_size[obj_batch][(existing - (obj_batch * obj_limit))][3]))
 	}
-	
-	// for(sy = 0; sy < (); ++sy)
+	  
+	// for(sx = 0; sx < (); ++sx)
       }
+	
+      // for(sy = 0; sy < (); ++sy)
+    }
       
-      // over-write the existing object's sparse representations with the existing+merged sparse representations
-      this->Set_srep_size(0,this->GetRAmin());
-      this->Set_srep_size(1,this->GetRAmax());
-      this->Set_srep_size(2,this->GetDECmin());
-      this->Set_srep_size(3,this->GetDECmax());
-      this->Set_srep_size(4,this->GetFREQmin());
-      this->Set_srep_size(5,this->GetFREQmax());
-      
-      // a. grid
-      this->Free_srep_grid();
-      this->Create_srep_grid((((this->Get_srep_size(1) - this->Get_srep_size(0) + 1) * (this->Get_srep_size(3) - this->Get_srep_size(2) + 1)) + 1));
-      for(g = 0; g < (((this->Get_srep_size(1) - this->Get_srep_size(0) + 1) * (this->Get_srep_size(3) - this->Get_srep_size(2) + 1)) + 1); ++g){ this->Set_srep_grid(g,temp_sparse_reps_grid[g]); }
-      
-      // b. mini_mom0
-      this->Free_mom0();
+    // over-write the existing object's sparse representations with the existing+merged sparse representations
+    this->Set_srep_size(0,this->GetRAmin());
+    this->Set_srep_size(1,this->GetRAmax());
+    this->Set_srep_size(2,this->GetDECmin());
+    this->Set_srep_size(3,this->GetDECmax());
+    this->Set_srep_size(4,this->GetFREQmin());
+    this->Set_srep_size(5,this->GetFREQmax());
+      
+    // a. grid
+    this->Free_srep_grid();
+    this->Create_srep_grid((((this->Get_srep_size(1) - this->Get_srep_size(0) + 1) * (this->Get_srep_size(3) - this->Get_srep_size(2) + 1)) + 1));
+    for(g = 0; g < (((this->Get_srep_size(1) - this->Get_srep_size(0) + 1) * (this->Get_srep_size(3) - this->Get_srep_size(2) + 1)) + 1); ++g){ this->Set_srep_grid(g,temp_sparse_reps_grid[g]); }
+      
+    // b. mini_mom0
+    this->Free_mom0();
+    if(products & SREP_MOM0){
       this->Create_mom0(((this->Get_srep_size(1) - this->Get_srep_size(0) + 1) * (this->Get_srep_size(3) - this->Get_srep_size(2) + 1)));
       for(g = 0; g < ((this->Get_srep_size(1) - this->Get_srep_size(0) + 1) * (this->Get_srep_size(3) - this->Get_srep_size(2) + 1)); ++g){ this->Set_mom0(g,temp_mom0[g]); }
+    }
       
-      // c. mini_RAPV
-      this->Free_RAPV();
+    // c. mini_RAPV
+    this->Free_RAPV();
+    if(products & SREP_RAPV){
       this->Create_RAPV(((this->Get_srep_size(1) - this->Get_srep_size(0) + 1) * (this->Get_srep_size(5) - this->Get_srep_size(4) + 1)));
       for(g = 0; g < ((this->Get_srep_size(1) - this->Get_srep_size(0) + 1) * (this->Get_srep_size(5) - this->Get_srep_size(4) + 1)); ++g){ this->Set_RAPV(g,temp_RAPV[g]); }
+    }
       
-      // d. mini_DECPV
-      this->Free_DECPV();
+    // d. mini_DECPV
+    this->Free_DECPV();
+    if(products & SREP_DECPV){
       this->Create_DECPV(((this->Get_srep_size(5) - this->Get_srep_size(4) + 1) * (this->Get_srep_size(3) - this->Get_srep_size(2) + 1)));
       for(g = 0; g < ((this->Get_srep_size(3) - this->Get_srep_size(2) + 1) * (this->Get_srep_size(5) - this->Get_srep_size(4) + 1)); ++g){ this->Set_DECPV(g,temp_DECPV[g]); }
+    }
       
-      // e. mini_obj_spec
-      this->Free_ospec();
+    // e. mini_obj_spec
+    this->Free_ospec();
+    if(products & SREP_OSPEC){
       this->Create_ospec((this->Get_srep_size(5) - this->Get_srep_size(4) + 1));
       for(g = 0; g < (this->Get_srep_size(5) - this->Get_srep_size(4) + 1); ++g){ this->Set_ospec(g,temp_obj_spec[g]); }
+    }
       
-      // f. mini_ref_spec
-      this->Free_rspec();
+    // f. mini_ref_spec
+    this->Free_rspec();
+    if(products & SREP_RSPEC){
       if((this->Get_srep_size(5) - this->Get_srep_size(4) + 1) >= 10){
 	
 	this->Create_rspec((2 * (this->Get_srep_size(5) - this->Get_srep_size(4) + 1)));
@@ -1411,427 +1565,51 @@ void object_props::AddObject(object_props & merged){
 	for(g = 0; g < (this->Get_srep_size(5) - this->Get_srep_size(4) + 11); ++g){ this->Set_rspec(g,temp_ref_spec[g]); }
 	
       }
+    }
       
-      // g. mini_vfield
-      this->Free_vfield();
+    // g. mini_vfield
+    this->Free_vfield();
+    if(products & SREP_VFIELD){
       this->Create_vfield(((this->Get_srep_size(1) - this->Get_srep_size(0) + 1) * (this->Get_srep_size(3) - this->Get_srep_size(2) + 1)));
       for(g = 0; g < ((this->Get_srep_size(1) - this->Get_srep_size(0) + 1) * (this->Get_srep_size(3) - this->Get_srep_size(2) + 1)); ++g){ this->Set_vfield(g,temp_vfield[g]); }
+    }
       
-      // h. sparse_reps_strings
-      this->Free_srep_strings();
-      this->Create_srep_strings((2 * this->Get_srep_grid(((this->Get_srep_size(1) - this->Get_srep_size(0) + 1) * (this->Get_srep_size(3) - this->Get_srep_size(2) + 1)))));
-      for(g = 0; g < (2 * this->Get_srep_grid(((this->Get_srep_size(1) - this->Get_srep_size(0) + 1) * (this->Get_srep_size(3) - this->Get_srep_size(2) + 1)))); ++g){ this->Set_srep_strings(g,temp_sparse_reps_strings[g]); }
+    // h. sparse_reps_strings
+    this->Free_srep_strings();
+    this->Create_srep_strings((2 * this->Get_srep_grid(((this->Get_srep_size(1) - this->Get_srep_size(0) + 1) * (this->Get_srep_size(3) - this->Get_srep_size(2) + 1)))));
+    for(g = 0; g < (2 * this->Get_srep_grid(((this->Get_srep_size(1) - this->Get_srep_size(0) + 1) * (this->Get_srep_size(3) - this->Get_srep_size(2) + 1)))); ++g){ this->Set_srep_strings(g,temp_sparse_reps_strings[g]); }
       
-    }
-  
-    // if(this != &merged)
   }
 
 }
 
-void object_props::AddObject(object_props & merged,vector<int> & temp_sparse_reps_grid,vector<int> & temp_sparse_reps_strings,vector<float> & temp_mom0,vector<float> & temp_RAPV,vector<float> & temp_DECPV,vector<float> & temp_ref_spec,vector<float> & temp_obj_spec,vector<float> & temp_vfield){
+// member definitions for double precision class definition
 
-  int j,k,g,sx,sy,sz;
+object_props_dbl::object_props_dbl(){ 
     
-  if(this != &merged){ 
+  NOvox = 0; 
+  ra = dec = freq = ra_i = dec_i = freq_i = tot_intens = avg_intens = sigma_intens = rms = 0.0;
+  ra_min = dec_min = freq_min = min_intens = 1E10;
+  ra_max = dec_max = freq_max = max_intens = -1E10;
+  w_max = w20_min = w50_min = w20_max = w50_max = -1E10;
+  cw_max = cw20_min = cw50_min = cw20_max = cw50_max = -1E10;
+  srep_size[0] = srep_size[1] = srep_size[2] = srep_size[3] = srep_size[4] = srep_size[5] = -99;
+  srep_update = 0;
+  srep_NOlos = 0;
+  srep_grid = NULL;
+  srep_strings = NULL;
+  mini_mom0 = NULL;
+  mini_RAPV = NULL;
+  mini_DECPV = NULL;
+  mini_obj_spec = NULL;
+  mini_ref_spec = NULL;
+  mini_vfield = NULL;
+  arena = NULL;
 
-    // update the properties of this object with the object being merged in
-    this->AddVoxel(merged.ShowVoxels());
-    this->AdjustRArange(merged.GetRAmin());
-    this->AdjustRArange(merged.GetRAmax());
-    this->AdjustDECrange(merged.GetDECmin());
-    this->AdjustDECrange(merged.GetDECmax());
-    this->AdjustFREQrange(merged.GetFREQmin());
-    this->AdjustFREQrange(merged.GetFREQmax());
-    this->AddRa(merged.GetRA());
-    this->AddDec(merged.GetDEC());
-    this->AddFreq(merged.GetFREQ());
-    this->AddRA_i(1.0,merged.GetRAi());
-    this->AddDec_i(1.0,merged.GetDECi());
-    this->AddFreq_i(1.0,merged.GetFREQi());
-    this->AddTotIntens(merged.GetTI());
-    this->AddAvgIntens(merged.GetAvgI());
-    this->AddSigmaItens(merged.GetSigmaI());
-    this->AdjustRange(merged.GetMinI());		
-    this->AdjustRange(merged.GetMaxI());	
-
-    // combine the sparse representations using the temporary arrays --- if they exist
-    if((merged.Get_srep_update() != 0) && (merged.Get_srep_size(0) >= 0)){
-		  
-      // write the existing object's sparse representations into temporary arrays and initialise temporary arrays at the same time, provided it exists
-      
-      // a. grid
-      temp_sparse_reps_grid.resize(0);
-      for(g = 0; g < (1 + ((this->GetRAmax() - this->GetRAmin() + 1) * (this->GetDECmax() - this->GetDECmin() + 1))); ++g){ temp_sparse_reps_grid.push_back(0); }
-      
-      if((this->Get_srep_update() != 0) && (this->Get_srep_size(0) >= 0)){
-	
-	for(sx = 0; sx < (this->Get_srep_size(1) - this->Get_srep_size(0) + 1); ++sx){
-	  for(sy = 0; sy < (this->Get_srep_size(3) - this->Get_srep_size(2) + 1); ++sy){
-	    
-	    temp_sparse_reps_grid[(((sy + this->Get_srep_size(2) - this->GetDECmin()) * (this->GetRAmax() - this->GetRAmin() + 1)) + sx + this->Get_srep_size(0) - this->GetRAmin())] = this->Get_srep_grid(((sy * (this->Get_srep_size(1) - this->Get_srep_size(0) + 1)) + sx + 1)) - this->Get_srep_grid(((sy * (this->Get_srep_size(1) - this->Get_srep_size(0) + 1)) + sx));
-	    
-	  }
-	  
-	}
-	
-      }
-      
-      // b. mom-0
-      temp_mom0.resize(0);
-      for(g = 0; g < ((this->GetRAmax() - this->GetRAmin() + 1) * (this->GetDECmax() - this->GetDECmin() + 1)); ++g){ temp_mom0.push_back(0.0); }
-      
-      if((this->Get_srep_update() != 0) && (this->Get_srep_size(0) >= 0)){
-	
-	for(sx = 0; sx < (this->Get_srep_size(1) - this->Get_srep_size(0) + 1); ++sx){
-	  
-	  for(sy = 0; sy < (this->Get_srep_size(3) - this->Get_srep_size(2) + 1); ++sy){
-	    
-	    temp_mom0[(((sy + this->Get_srep_size(2) - this->GetDECmin()) * (this->GetRAmax() - this->GetRAmin() + 1)) + sx + this->Get_srep_size(0) - this->GetRAmin())]+=this->Get_mom0(((sy * (this->Get_srep_size(1) - this->Get_srep_size(0) + 1)) + sx));
-	    
-	  }
-	  
-	}
-	
-      }
-      
-      // c. RAPV
-      temp_RAPV.resize(0);
-      for(g = 0; g < ((this->GetRAmax() - this->GetRAmin() + 1) * (this->GetFREQmax() - this->GetFREQmin() + 1)); ++g){ temp_RAPV.push_back(0.0); }
-      
-      if((this->Get_srep_update() != 0) && (this->Get_srep_size(0) >= 0)){
-	
-	for(sx = 0; sx < (this->Get_srep_size(1) - this->Get_srep_size(0) + 1); ++sx){
-	  
-	  for(sz = 0; sz < (this->Get_srep_size(5) - this->Get_srep_size(4) + 1); ++sz){
-	    
-	    temp_RAPV[(((sz + this->Get_srep_size(4) - this->GetFREQmin()) * (this->GetRAmax() - this->GetRAmin() + 1)) + sx + this->Get_srep_size(0) - this->GetRAmin())]+=this->Get_RAPV(((sz * (this->Get_srep_size(1) - this->Get_srep_size(0) + 1)) + sx));
-	    
-	  }
-	  
-	}
-	
-      }
-      
-      // d. DECPV
-      temp_DECPV.resize(0);
-      for(g = 0; g < ((this->GetDECmax() - this->GetDECmin() + 1) * (this->GetFREQmax() - this->GetFREQmin() + 1)); ++g){ temp_DECPV.push_back(0.0); }
-      
-      if((this->Get_srep_update() != 0) && (this->Get_srep_size(0) >= 0)){
-	
-	for(sy = 0; sy < (this->Get_srep_size(3) - this->Get_srep_size(2) + 1); ++sy){
-	  
-	  for(sz = 0; sz < (this->Get_srep_size(5) - this->Get_srep_size(4) + 1); ++sz){
-	    
-	    temp_DECPV[(((sz + this->Get_srep_size(4) - this->GetFREQmin()) * (this->GetDECmax() - this->GetDECmin() + 1)) + sy + this->Get_srep_size(2) - this->GetDECmin())]+=this->Get_DECPV(((sz * (this->Get_srep_size(3) - this->Get_srep_size(2) + 1)) + sy));
-	    
-	  }
-	  
-	}
-	
-      }
-      
-      // e. ref_spec
-      if((this->Get_srep_size(5) - this->Get_srep_size(4) + 1) >= 10){
-	
-	temp_ref_spec.resize(0);
-	for(g = 0; g < (2 * (this->GetFREQmax() - this->GetFREQmin() + 1)); ++g){ temp_ref_spec.push_back(0.0); }
-	
-	if((this->Get_srep_update() != 0) && (this->Get_srep_size(0) >= 0)){
-	  
-	  for(sz = 0; sz < (2 * (this->Get_srep_size(5) - this->Get_srep_size(4) + 1)); ++sz){ temp_ref_spec[(sz + this->Get_srep_size(4) - this->GetFREQmin())]+=this->Get_rspec(sz); } 
-	  
-	}
-	
-      } else {
-	
-	temp_ref_spec.resize(0);
-	for(g = 0; g < (this->GetFREQmax() - this->GetFREQmin() + 11); ++g){ temp_ref_spec.push_back(0.0); }
-	
-	if((this->Get_srep_update() != 0) && (this->Get_srep_size(0) >= 0)){
-	  
-	  for(sz = 0; sz < (this->Get_srep_size(5) - this->Get_srep_size(4) + 11); ++sz){ temp_ref_spec[(sz + this->Get_srep_size(4) - this->GetFREQmin())]+=this->Get_rspec(sz); } 		    
-	  
-	}
-	
-      }
-      
-      // f. obj_spec
-      temp_obj_spec.resize(0);
-      for(g = 0; g < (this->Get_srep_size(5) - this->Get_srep_size(4) + 1); ++g){ temp_obj_spec.push_back(0.0); }		  
-      if((this->Get_srep_update() != 0) && (this->Get_srep_size(0) >= 0)){
-	
-	for(sz = 0; sz < (this->Get_srep_size(5) - this->Get_srep_size(4) + 1); ++sz){
-	  
-	  temp_obj_spec[(sz + this->Get_srep_size(4) - this->GetFREQmin())]+=this->Get_ospec(sz);
-	  
-	}
-	
-      }
-      
-      // g. vfield
-      temp_vfield.resize(0);
-      for(g = 0; g < ((this->GetRAmax() - this->GetRAmin() + 1) * (this->GetDECmax() - this->GetDECmin() + 1)); ++g){ temp_vfield.push_back(0.0); }
-      
-      if((this->Get_srep_update() != 0) && (this->Get_srep_size(0) >= 0)){
-	
-	for(sx = 0; sx < (this->Get_srep_size(1) - this->Get_srep_size(0) + 1); ++sx){
-	  
-	  for(sy = 0; sy < (this->Get_srep_size(3) - this->Get_srep_size(2) + 1); ++sy){
-	    
-	    temp_vfield[(((sy + this->Get_srep_size(2) - this->GetDECmin()) * (this->GetRAmax() - this->GetRAmin() + 1)) + sx + this->Get_srep_size(0) - this->GetRAmin())]+=this->Get_vfield(((sy * (this->Get_srep_size(1) - this->Get_srep_size(0) + 1)) + sx));
-	    
-	  }
-	  
-	}
-	
-      }
-      
-      // write the merged object's sparse representations into temporary arrays
-      
-      // a. grid
-      for(sx = 0; sx < (merged.Get_srep_size(1) - merged.Get_srep_size(0) + 1); ++sx){
-	
-	for(sy = 0; sy < (merged.Get_srep_size(3) - merged.Get_srep_size(2) + 1); ++sy){
-	  
-	  temp_sparse_reps_grid[(((sy + merged.Get_srep_size(2) - this->GetDECmin()) * (this->GetRAmax() - this->GetRAmin() + 1)) + sx + merged.Get_srep_size(0) - this->GetRAmin())]+=(merged.Get_srep_grid(((sy * (merged.Get_srep_size(1) - merged.Get_srep_size(0) + 1)) + sx + 1)) - merged.Get_srep_grid(((sy * (merged.Get_srep_size(1) - merged.Get_srep_size(0) + 1)) + sx)));
-	  
-	}
-	
-      }
-      
-      // b. mom-0
-      for(sx = 0; sx < (merged.Get_srep_size(1) - merged.Get_srep_size(0) + 1); ++sx){
-	
-	for(sy = 0; sy < (merged.Get_srep_size(3) - merged.Get_srep_size(2) + 1); ++sy){
-	  
-	  temp_mom0[(((sy + merged.Get_srep_size(2) - this->GetDECmin()) * (this->GetRAmax() - this->GetRAmin() + 1)) + sx + merged.Get_srep_size(0) - this->GetRAmin())]+=merged.Get_mom0(((sy * (merged.Get_srep_size(1) - merged.Get_srep_size(0) + 1)) + sx));
-	  
-	}
-	
-      }
-      
-      // c. RAPV
-      for(sx = 0; sx < (merged.Get_srep_size(1) - merged.Get_srep_size(0) + 1); ++sx){
-	
-	for(sz = 0; sz < (merged.Get_srep_size(5) - merged.Get_srep_size(4) + 1); ++sz){
-	  
-	  temp_RAPV[(((sz + merged.Get_srep_size(4) - this->GetFREQmin()) * (this->GetRAmax() - this->GetRAmin() + 1)) + sx + merged.Get_srep_size(0) - this->GetRAmin())]+=merged.Get_RAPV(((sz * (merged.Get_srep_size(1) - merged.Get_srep_size(0) + 1)) + sx));
-	  
-	}
-	
-      }
-      
-      // d. DECPV
-      for(sy = 0; sy < (merged.Get_srep_size(3) - merged.Get_srep_size(2) + 1); ++sy){
-	
-	for(sz = 0; sz < (merged.Get_srep_size(5) - merged.Get_srep_size(4) + 1); ++sz){
-	  
-	  temp_DECPV[(((sz + merged.Get_srep_size(4) - this->GetFREQmin()) * (this->GetDECmax() - this->GetDECmin() + 1)) + sy + merged.Get_srep_size(2) - this->GetDECmin())]+=merged.Get_DECPV(((sz * (merged.Get_srep_size(3) - merged.Get_srep_size(2) + 1)) + sy));
-	  
-	}
-	
-      }
-      
-      // e. ref_spec
-      if((merged.Get_srep_size(5) - merged.Get_srep_size(4) + 1) >= 10){
-	
-	for(sz = 0; sz < (2 * (merged.Get_srep_size(5) - merged.Get_srep_size(4) + 1)); ++sz){ 
-	  
-	  if((sz + merged.Get_srep_size(4) - merged.GetFREQmin()) >= 0){
-	    
-	    temp_ref_spec[(sz + merged.Get_srep_size(4) - this->GetFREQmin())]+=merged.Get_rspec(sz); 
-	    
-	  }
-	  
-	} 
-	
-      } else {
-	
-	for(sz = 0; sz < (merged.Get_srep_size(5) - merged.Get_srep_size(4) + 11); ++sz){ 
-	  
-	  if((sz + merged.Get_srep_size(4) - this->GetFREQmin()) >= 0){
-	    
-	    temp_ref_spec[(sz + merged.Get_srep_size(4) - this->GetFREQmin())]+=merged.Get_rspec(sz); 
-	    
-	  }
-	  
-	} 		    
-	
-      }
-      
-      // f. obj_spec
-      for(sz = 0; sz < (merged.Get_srep_size(5) - merged.Get_srep_size(4) + 1); ++sz){
-	
-	temp_obj_spec[(sz + merged.Get_srep_size(4) - this->GetFREQmin())]+=merged.Get_ospec(sz);
-	
-      }
-      
-      // g. vfield
-      for(sx = 0; sx < (merged.Get_srep_size(1) - merged.Get_srep_size(0) + 1); ++sx){
-	
-	for(sy = 0; sy < (merged.Get_srep_size(3) - merged.Get_srep_size(2) + 1); ++sy){
-	  
-	  temp_vfield[(((sy + merged.Get_srep_size(2) - this->GetDECmin()) * (this->GetRAmax() - this->GetRAmin() + 1)) + sx + merged.Get_srep_size(0) - this->GetRAmin())]+=merged.Get_vfield(((sy * (merged.Get_srep_size(1) - merged.Get_srep_size(0) + 1)) + sx));
-	  
-	}
-	
-      }
-      
-      // convert temp_sparse_reps_grid from differential to cumulative counts using temp_sparse_reps_string as an intermediary
-      temp_sparse_reps_strings.resize(1);
-      temp_sparse_reps_strings[0] = 0;
-      for(g = 1; g < (((this->GetRAmax() - this->GetRAmin() + 1) * (this->GetDECmax() - this->GetDECmin() + 1)) + 1); ++g){ temp_sparse_reps_strings.push_back(temp_sparse_reps_strings[(g - 1)] + temp_sparse_reps_grid[(g - 1)]); }
-      for(g = 0; g < (((this->GetRAmax() - this->GetRAmin() + 1) * (this->GetDECmax() - this->GetDECmin() + 1)) + 1); ++g){ temp_sparse_reps_grid[g] = temp_sparse_reps_strings[g]; }
-      
-      // write new sparse_reps_strings value to temp_sparse_reps_strings array, using various grids to achieve indexing
-      
-      // a. initialise temp_sparse_reps_strings
-      temp_sparse_reps_strings.resize(0);
-      for(g = 0; g < (2 * temp_sparse_reps_grid[((this->GetDECmax() - this->GetDECmin() + 1) * (this->GetRAmax() - this->GetRAmin() + 1))]); ++g){ temp_sparse_reps_strings.push_back(0); }
-      
-      
-      // b. for each line of sight through the new existing object bounding box, retrieve the channel range of each object string along this LoS
-      for(sy = this->GetDECmin(); sy <= this->GetDECmax(); ++sy){
-	
-	for(sx = this->GetRAmin(); sx <= this->GetRAmax(); ++sx){
-	  
-	  // initialise the number of object strings written to this LoS
-	  k = 0;
-	  
-	  // retrieve the starting index for object strings along this LoS
-	  j = 2 * temp_sparse_reps_grid[(((sy - this->GetDECmin()) * (this->GetRAmax() - this->GetRAmin() + 1)) + sx - this->GetRAmin())];
-	  
-	  // write existing object's object strings to temp_strings_array
-	  if((this->Get_srep_update() != 0) && (this->Get_srep_size(0) >= 0)){
-	    
-	    if((sx >= this->Get_srep_size(0)) && (sx <= this->Get_srep_size(1)) && (sy >= this->Get_srep_size(2)) && (sy <= this->Get_srep_size(3))){
-	      
-	      for(g = this->Get_srep_grid((((sy - this->Get_srep_size(2)) * (this->Get_srep_size(1) - this->Get_srep_size(0) + 1)) + sx - this->Get_srep_size(0))); g < this->Get_srep_grid((((sy - this->Get_srep_size(2)) * (this->Get_srep_size(1) - this->Get_srep_size(0) + 1)) + sx - this->Get_srep_size(0) + 1)); ++g){
-		
-		temp_sparse_reps_strings[(j + k)] = this->Get_srep_strings((2 * g));
-		++k;
-		temp_sparse_reps_strings[(j + k)] = this->Get_srep_strings(((2 * g) + 1));
-		++k;
-		
-	      }
-	      
-	      // if((sx >= sparse_reps_size[obj_batch][(existing - (obj_batch * obj_limit))][0]) && (sx <= sparse_reps_size[obj_batch][(existing - (obj_batch * obj_limit))][1]) && (sy >= sparse_reps_size[obj_batch][(existing - (obj_batch * obj_limit))][2]) && (sy <= sparse_reps_size[obj_batch][(existing - (obj_batch * obj_limit))][3]))
-	    }
-	    
-	    // if((sparse_reps_update[obj_batch][(existing - (obj_batch * obj_limit))] != 0) && (sparse_reps_size[obj_batch][(existing - (obj_batch * obj_limit))][0] >= 0))
-	  }
-	  
-	  // write match_init[i] object strings to temp_strings_array
-	  if((sx >= merged.Get_srep_size(0)) && (sx <= merged.Get_srep_size(1)) && (sy >= merged.Get_srep_size(2)) && (sy <= merged.Get_srep_size(3))){
-	    
-	    for(g = merged.Get_srep_grid((((sy - merged.Get_srep_size(2)) * (merged.Get_srep_size(1) - merged.Get_srep_size(0) + 1)) + sx - merged.Get_srep_size(0))); g < merged.Get_srep_grid((((sy - merged.Get_srep_size(2)) * (merged.Get_srep_size(1) - merged.Get_srep_size(0) + 1)) + sx - merged.Get_srep_size(0) + 1)); ++g){
-	      
-	      temp_sparse_reps_strings[(j + k)] = merged.Get_srep_strings((2 * g));
-	      ++k;
-	      temp_sparse_reps_strings[(j + k)] = merged.Get_srep_strings(((2 * g) + 1));
-	      ++k;
-	      
-	    }
-	    
-	    // if((sx >= sparse_reps_size[obj_batch][(existing - (obj_batch * obj_limit))][0]) && (sx <= sparse_reps_size[obj_batch][(existing - (obj_batch * obj_limit))][1]) && (sy >= sparse_reps_size[obj_batch][(existing - (obj_batch * obj_limit))][2]) && (sy <= sparse_reps_size[obj_batch][(existing - (obj_batch * obj_limit))][3]))
-	  }
-	  
-	  // for(sx = 0; sx < (); ++sx)
-	}
-	
-	// for(sy = 0; sy < (); ++sy)
-      }
-      
-      // over-write the existing object's sparse representations with the existing+merged sparse representations
-      this->Set_srep_size(0,this->GetRAmin());
-      this->Set_srep_size(1,this->GetRAmax());
-      this->Set_srep_size(2,this->GetDECmin());
-      this->Set_srep_size(3,this->GetDECmax());
-      this->Set_srep_size(4,this->GetFREQmin());
-      this->Set_srep_size(5,this->GetFREQmax());
-      
-      // a. grid
-      this->Free_srep_grid();
-      this->Create_srep_grid((((this->Get_srep_size(1) - this->Get_srep_size(0) + 1) * (this->Get_srep_size(3) - this->Get_srep_size(2) + 1)) + 1));
-      for(g = 0; g < (((this->Get_srep_size(1) - this->Get_srep_size(0) + 1) * (this->Get_srep_size(3) - this->Get_srep_size(2) + 1)) + 1); ++g){ this->Set_srep_grid(g,temp_sparse_reps_grid[g]); }
-      
-      // b. mini_mom0
-      this->Free_mom0();
-      this->Create_mom0(((this->Get_srep_size(1) - this->Get_srep_size(0) + 1) * (this->Get_srep_size(3) - this->Get_srep_size(2) + 1)));
-      for(g = 0; g < ((this->Get_srep_size(1) - this->Get_srep_size(0) + 1) * (this->Get_srep_size(3) - this->Get_srep_size(2) + 1)); ++g){ this->Set_mom0(g,temp_mom0[g]); }
-      
-      // c. mini_RAPV
-      this->Free_RAPV();
-      this->Create_RAPV(((this->Get_srep_size(1) - this->Get_srep_size(0) + 1) * (this->Get_srep_size(5) - this->Get_srep_size(4) + 1)));
-      for(g = 0; g < ((this->Get_srep_size(1) - this->Get_srep_size(0) + 1) * (this->Get_srep_size(5) - this->Get_srep_size(4) + 1)); ++g){ this->Set_RAPV(g,temp_RAPV[g]); }
-      
-      // d. mini_DECPV
-      this->Free_DECPV();
-      this->Create_DECPV(((this->Get_srep_size(5) - this->Get_srep_size(4) + 1) * (this->Get_srep_size(3) - this->Get_srep_size(2) + 1)));
-      for(g = 0; g < ((this->Get_srep_size(3) - this->Get_srep_size(2) + 1) * (this->Get_srep_size(5) - this->Get_srep_size(4) + 1)); ++g){ this->Set_DECPV(g,temp_DECPV[g]); }
-      
-      // e. mini_obj_spec
-      this->Free_ospec();
-      this->Create_ospec((this->Get_srep_size(5) - this->Get_srep_size(4) + 1));
-      for(g = 0; g < (this->Get_srep_size(5) - this->Get_srep_size(4) + 1); ++g){ this->Set_ospec(g,temp_obj_spec[g]); }
-      
-      // f. mini_ref_spec
-      this->Free_rspec();
-      if((this->Get_srep_size(5) - this->Get_srep_size(4) + 1) >= 10){
-	
-	this->Create_rspec((2 * (this->Get_srep_size(5) - this->Get_srep_size(4) + 1)));
-	for(g = 0; g < (2 * (this->Get_srep_size(5) - this->Get_srep_size(4) + 1)); ++g){ this->Set_rspec(g,temp_ref_spec[g]); }
-	
-      } else {
-	
-	this->Create_rspec((this->Get_srep_size(5) - this->Get_srep_size(4) + 11));
-	for(g = 0; g < (this->Get_srep_size(5) - this->Get_srep_size(4) + 11); ++g){ this->Set_rspec(g,temp_ref_spec[g]); }
-	
-      }
-      
-      // g. mini_vfield
-      this->Free_vfield();
-      this->Create_vfield(((this->Get_srep_size(1) - this->Get_srep_size(0) + 1) * (this->Get_srep_size(3) - this->Get_srep_size(2) + 1)));
-      for(g = 0; g < ((this->Get_srep_size(1) - this->Get_srep_size(0) + 1) * (this->Get_srep_size(3) - this->Get_srep_size(2) + 1)); ++g){ this->Set_vfield(g,temp_vfield[g]); }
-      
-      // h. sparse_reps_strings
-      this->Free_srep_strings();
-      this->Create_srep_strings((2 * this->Get_srep_grid(((this->Get_srep_size(1) - this->Get_srep_size(0) + 1) * (this->Get_srep_size(3) - this->Get_srep_size(2) + 1)))));
-      for(g = 0; g < (2 * this->Get_srep_grid(((this->Get_srep_size(1) - this->Get_srep_size(0) + 1) * (this->Get_srep_size(3) - this->Get_srep_size(2) + 1)))); ++g){ this->Set_srep_strings(g,temp_sparse_reps_strings[g]); }
-      
-    }
-  
-    // if(this != &merged)
-  }
-
-}
-
-// member definitions for double precision class definition
-
-object_props_dbl::object_props_dbl(){ 
-    
-  NOvox = 0; 
-  ra = dec = freq = ra_i = dec_i = freq_i = tot_intens = avg_intens = sigma_intens = rms = 0.0;
-  ra_min = dec_min = freq_min = min_intens = 1E10;
-  ra_max = dec_max = freq_max = max_intens = -1E10;
-  w_max = w20_min = w50_min = w20_max = w50_max = -1E10;
-  cw_max = cw20_min = cw50_min = cw20_max = cw50_max = -1E10;
-  srep_size[0] = srep_size[1] = srep_size[2] = srep_size[3] = srep_size[4] = srep_size[5] = -99;
-  srep_update = 0;
-  srep_grid = NULL;
-  srep_strings = NULL;
-  mini_mom0 = NULL;
-  mini_RAPV = NULL;
-  mini_DECPV = NULL;
-  mini_obj_spec = NULL;
-  mini_ref_spec = NULL;
-  mini_vfield = NULL;
-
-  // new parameters --- multiple central moment calculations
-  p_tot_intens = n_tot_intens = 0.0;
-  p_ra_i = p_dec_i = p_freq_i = 0.0;
-  n_ra_i = n_dec_i = n_freq_i = 0.0;
+  // new parameters --- multiple central moment calculations
+  p_tot_intens = n_tot_intens = 0.0;
+  p_ra_i = p_dec_i = p_freq_i = 0.0;
+  n_ra_i = n_dec_i = n_freq_i = 0.0;
 
 }
 
@@ -1839,6 +1617,7 @@ object_props_dbl::object_props_dbl(const object_props_dbl & copied){
 
   int i;
 
+  arena = NULL;
   NOvox = copied.NOvox; 
   ra = copied.ra;
   dec = copied.dec;
@@ -1877,53 +1656,54 @@ object_props_dbl::object_props_dbl(const object_props_dbl & copied){
   srep_size[4] = copied.srep_size[4];
   srep_size[5] = copied.srep_size[5];
   srep_update = copied.srep_update;
+  srep_NOlos = copied.srep_NOlos;
 
   if(copied.srep_grid != NULL){
 
-    srep_grid = new int[(srep_size[1] - srep_size[0] + 1) * (srep_size[3] - srep_size[2] + 1)];
+    srep_grid = NewInts((srep_size[1] - srep_size[0] + 1) * (srep_size[3] - srep_size[2] + 1));
     for(i = 0; i < ((srep_size[1] - srep_size[0] + 1) * (srep_size[3] - srep_size[2] + 1)); ++i){ srep_grid[i] = copied.srep_grid[i]; }    
 
   } else { srep_grid = NULL; }
   if(copied.srep_strings != NULL){
 
-    srep_strings = new int[(2 * srep_grid[((srep_size[3] - srep_size[2] + 1) * (srep_size[1] - srep_size[0] + 1))])];
+    srep_strings = NewInts((2 * srep_grid[((srep_size[3] - srep_size[2] + 1) * (srep_size[1] - srep_size[0] + 1))]));
     for(i = 0; i < (2 * srep_grid[((srep_size[3] - srep_size[2] + 1) * (srep_size[1] - srep_size[0] + 1))]); ++i){ srep_strings[i] = copied.srep_strings[i]; }
 
   } else { srep_strings = NULL; }
   if(copied.mini_mom0 != NULL){
 
-    mini_mom0 = new double[(srep_size[1] - srep_size[0] + 1) * (srep_size[3] - srep_size[2] + 1)];
+    mini_mom0 = NewVals((srep_size[1] - srep_size[0] + 1) * (srep_size[3] - srep_size[2] + 1));
     for(i = 0; i < ((srep_size[1] - srep_size[0] + 1) * (srep_size[3] - srep_size[2] + 1)); ++i){ mini_mom0[i] = copied.mini_mom0[i]; }
 
   } else { mini_mom0 = NULL; }
   if(copied.mini_RAPV != NULL){
 
-    mini_RAPV = new double[(srep_size[1] - srep_size[0] + 1) * (srep_size[5] - srep_size[4] + 1)];
+    mini_RAPV = NewVals((srep_size[1] - srep_size[0] + 1) * (srep_size[5] - srep_size[4] + 1));
     for(i = 0; i < ((srep_size[1] - srep_size[0] + 1) * (srep_size[5] - srep_size[4] + 1)); ++i){ mini_RAPV[i] = copied.mini_RAPV[i]; }
 
   } else { mini_RAPV = NULL; }
   if(copied.mini_DECPV != NULL){
 
-    mini_DECPV = new double[(srep_size[3] - srep_size[2] + 1) * (srep_size[5] - srep_size[4] + 1)];
+    mini_DECPV = NewVals((srep_size[3] - srep_size[2] + 1) * (srep_size[5] - srep_size[4] + 1));
     for(i = 0; i < ((srep_size[3] - srep_size[2] + 1) * (srep_size[5] - srep_size[4] + 1)); ++i){ mini_DECPV[i] = copied.mini_DECPV[i]; }
     
   } else { mini_DECPV = NULL; }
-  if(mini_obj_spec != NULL){
+  if(copied.mini_obj_spec != NULL){
 
-    mini_obj_spec = new double[(srep_size[5] - srep_size[4] + 1)];
+    mini_obj_spec = NewVals((srep_size[5] - srep_size[4] + 1));
     for(i = 0; i < ((srep_size[5] - srep_size[4] + 1)); ++i){ mini_obj_spec[i] = copied.mini_obj_spec[i]; }
 
   } else { mini_obj_spec = NULL; }
-  if(mini_ref_spec != NULL){
+  if(copied.mini_ref_spec != NULL){
 
     if((copied.srep_size[5] - copied.srep_size[4] + 1) >= 10){
 
-      mini_ref_spec = new double[(srep_size[5] - srep_size[4] + 1)];
-      for(i = 0; i < ((srep_size[5] - srep_size[4] + 1)); ++i){ mini_ref_spec[i] = copied.mini_ref_spec[i]; }    
+      mini_ref_spec = NewVals((2 * (srep_size[5] - srep_size[4] + 1)));
+      for(i = 0; i < (2 * (srep_size[5] - srep_size[4] + 1)); ++i){ mini_ref_spec[i] = copied.mini_ref_spec[i]; }    
 
     } else {
 
-      mini_ref_spec = new double[(srep_size[5] - srep_size[4] + 11)];
+      mini_ref_spec = NewVals((srep_size[5] - srep_size[4] + 11));
       for(i = 0; i < ((srep_size[5] - srep_size[4] + 11)); ++i){ mini_ref_spec[i] = copied.mini_ref_spec[i]; }    
 
     }
@@ -1931,7 +1711,7 @@ object_props_dbl::object_props_dbl(const object_props_dbl & copied){
   } else { mini_ref_spec = NULL; }
   if(copied.mini_vfield != NULL){
 
-    mini_vfield = new double[(srep_size[1] - srep_size[0] + 1) * (srep_size[3] - srep_size[2] + 1)];
+    mini_vfield = NewVals((srep_size[1] - srep_size[0] + 1) * (srep_size[3] - srep_size[2] + 1));
     for(i = 0; i < ((srep_size[1] - srep_size[0] + 1) * (srep_size[3] - srep_size[2] + 1)); ++i){ mini_vfield[i] = copied.mini_vfield[i]; }
 
   } else { mini_vfield = NULL; }
@@ -1992,53 +1772,54 @@ object_props_dbl & object_props_dbl::operator = (const object_props_dbl & copied
     srep_size[4] = copied.srep_size[4];
     srep_size[5] = copied.srep_size[5];
     srep_update = copied.srep_update;
+    srep_NOlos = copied.srep_NOlos;
     
     if(copied.srep_grid != NULL){
       
-      srep_grid = new int[(srep_size[1] - srep_size[0] + 1) * (srep_size[3] - srep_size[2] + 1)];
+      srep_grid = NewInts((srep_size[1] - srep_size[0] + 1) * (srep_size[3] - srep_size[2] + 1));
       for(i = 0; i < ((srep_size[1] - srep_size[0] + 1) * (srep_size[3] - srep_size[2] + 1)); ++i){ srep_grid[i] = copied.srep_grid[i]; }    
       
     } else { srep_grid = NULL; }
     if(copied.srep_strings != NULL){
       
-      srep_strings = new int[(2 * srep_grid[((srep_size[3] - srep_size[2] + 1) * (srep_size[1] - srep_size[0] + 1))])];
+      srep_strings = NewInts((2 * srep_grid[((srep_size[3] - srep_size[2] + 1) * (srep_size[1] - srep_size[0] + 1))]));
       for(i = 0; i < (2 * srep_grid[((srep_size[3] - srep_size[2] + 1) * (srep_size[1] - srep_size[0] + 1))]); ++i){ srep_strings[i] = copied.srep_strings[i]; }
       
     } else { srep_strings = NULL; }
     if(copied.mini_mom0 != NULL){
       
-      mini_mom0 = new double[(srep_size[1] - srep_size[0] + 1) * (srep_size[3] - srep_size[2] + 1)];
+      mini_mom0 = NewVals((srep_size[1] - srep_size[0] + 1) * (srep_size[3] - srep_size[2] + 1));
       for(i = 0; i < ((srep_size[1] - srep_size[0] + 1) * (srep_size[3] - srep_size[2] + 1)); ++i){ mini_mom0[i] = copied.mini_mom0[i]; }
       
     } else { mini_mom0 = NULL; }
     if(copied.mini_RAPV != NULL){
       
-      mini_RAPV = new double[(srep_size[1] - srep_size[0] + 1) * (srep_size[5] - srep_size[4] + 1)];
+      mini_RAPV = NewVals((srep_size[1] - srep_size[0] + 1) * (srep_size[5] - srep_size[4] + 1));
       for(i = 0; i < ((srep_size[1] - srep_size[0] + 1) * (srep_size[5] - srep_size[4] + 1)); ++i){ mini_RAPV[i] = copied.mini_RAPV[i]; }
       
     } else { mini_RAPV = NULL; }
     if(copied.mini_DECPV != NULL){
       
-      mini_DECPV = new double[(srep_size[3] - srep_size[2] + 1) * (srep_size[5] - srep_size[4] + 1)];
+      mini_DECPV = NewVals((srep_size[3] - srep_size[2] + 1) * (srep_size[5] - srep_size[4] + 1));
       for(i = 0; i < ((srep_size[3] - srep_size[2] + 1) * (srep_size[5] - srep_size[4] + 1)); ++i){ mini_DECPV[i] = copied.mini_DECPV[i]; }
       
     } else { mini_DECPV = NULL; }
-    if(mini_obj_spec != NULL){
+    if(copied.mini_obj_spec != NULL){
       
-      mini_obj_spec = new double[(srep_size[5] - srep_size[4] + 1)];
+      mini_obj_spec = NewVals((srep_size[5] - srep_size[4] + 1));
       for(i = 0; i < ((srep_size[5] - srep_size[4] + 1)); ++i){ mini_obj_spec[i] = copied.mini_obj_spec[i]; }
       
     } else { mini_obj_spec = NULL; }
-    if(mini_ref_spec != NULL){
+    if(copied.mini_ref_spec != NULL){
       
       if((copied.srep_size[5] - copied.srep_size[4] + 1) >= 10){
 	
-	mini_ref_spec = new double[(srep_size[5] - srep_size[4] + 1)];
-	for(i = 0; i < ((srep_size[5] - srep_size[4] + 1)); ++i){ mini_ref_spec[i] = copied.mini_ref_spec[i]; }    
+	mini_ref_spec = NewVals((2 * (srep_size[5] - srep_size[4] + 1)));
+	for(i = 0; i < (2 * (srep_size[5] - srep_size[4] + 1)); ++i){ mini_ref_spec[i] = copied.mini_ref_spec[i]; }    
 	
       } else {
 	
-	mini_ref_spec = new double[(srep_size[5] - srep_size[4] + 11)];
+	mini_ref_spec = NewVals((srep_size[5] - srep_size[4] + 11));
 	for(i = 0; i < ((srep_size[5] - srep_size[4] + 11)); ++i){ mini_ref_spec[i] = copied.mini_ref_spec[i]; }    
 	
       }
@@ -2046,7 +1827,7 @@ object_props_dbl & object_props_dbl::operator = (const object_props_dbl & copied
     } else { mini_ref_spec = NULL; }
     if(copied.mini_vfield != NULL){
       
-      mini_vfield = new double[(srep_size[1] - srep_size[0] + 1) * (srep_size[3] - srep_size[2] + 1)];
+      mini_vfield = NewVals((srep_size[1] - srep_size[0] + 1) * (srep_size[3] - srep_size[2] + 1));
       for(i = 0; i < ((srep_size[1] - srep_size[0] + 1) * (srep_size[3] - srep_size[2] + 1)); ++i){ mini_vfield[i] = copied.mini_vfield[i]; }
       
     } else { mini_vfield = NULL; }
@@ -2068,14 +1849,16 @@ object_props_dbl & object_props_dbl::operator = (const object_props_dbl & copied
 
 object_props_dbl::~object_props_dbl(){ 
 
-  if(srep_grid != NULL){ delete [] srep_grid; srep_grid = NULL; } 
-  if(srep_strings != NULL){ delete [] srep_strings; srep_strings = NULL; }
-  if(mini_mom0 != NULL){ delete [] mini_mom0; mini_mom0 = NULL; }
-  if(mini_RAPV != NULL){ delete [] mini_RAPV; mini_RAPV = NULL; }
-  if(mini_DECPV != NULL){ delete [] mini_DECPV; mini_DECPV = NULL; }
-  if(mini_obj_spec != NULL){ delete [] mini_obj_spec; mini_obj_spec = NULL; }
-  if(mini_ref_spec != NULL){ delete [] mini_ref_spec; mini_ref_spec = NULL; }
-  if(mini_vfield != NULL){ delete [] mini_vfield; mini_vfield = NULL; }
+  // the arrays of objects with an arena are released in bulk with the arena
+  if(arena != NULL){ return; }
+  if(srep_grid != NULL){ Release(srep_grid); srep_grid = NULL; } 
+  if(srep_strings != NULL){ Release(srep_strings); srep_strings = NULL; }
+  if(mini_mom0 != NULL){ Release(mini_mom0); mini_mom0 = NULL; }
+  if(mini_RAPV != NULL){ Release(mini_RAPV); mini_RAPV = NULL; }
+  if(mini_DECPV != NULL){ Release(mini_DECPV); mini_DECPV = NULL; }
+  if(mini_obj_spec != NULL){ Release(mini_obj_spec); mini_obj_spec = NULL; }
+  if(mini_ref_spec != NULL){ Release(mini_ref_spec); mini_ref_spec = NULL; }
+  if(mini_vfield != NULL){ Release(mini_vfield); mini_vfield = NULL; }
 
 }
 
@@ -2223,6 +2006,9 @@ void object_props_dbl::ReInit(){
   ra_max = dec_max = freq_max = max_intens = -1E10;
   w_max = w20_min = w50_min = w20_max = w50_max = -1E10;
   cw_max = cw20_min = cw50_min = cw20_max = cw50_max = -1E10;
+  p_tot_intens = n_tot_intens = 0.0;
+  p_ra_i = p_dec_i = p_freq_i = 0.0;
+  n_ra_i = n_dec_i = n_freq_i = 0.0;
 
 }
 
@@ -2240,12 +2026,12 @@ void object_props_dbl::AddRA_i(double pos, double value){
 }
 
 void object_props_dbl::AddDec_i(double pos, double value){ 
-  dec_i+=value; 
+  dec_i+=(pos * value); 
   if(value >= 0.0){ p_dec_i+=(pos * value); } else { n_dec_i+=(pos * value); }
 }
 
 void object_props_dbl::AddFreq_i(double pos, double value){ 
-  freq_i+=value; 
+  freq_i+=(pos * value); 
   if(value >= 0.0){ p_freq_i+=(pos * value); } else { n_freq_i+=(pos * value); }
 }
 
@@ -2266,9 +2052,6 @@ void object_props_dbl::AdjustRange(double value){
 }
 
 void object_props_dbl::CalcProps(){
-  
-  double dummy, flip;
-  int g;
 
   // calculate basic properties
   ra = ra / NOvox; 
@@ -2298,23 +2081,36 @@ void object_props_dbl::CalcProps(){
     freq_i = n_freq_i;
   }
 
+  // the postage stamp images and the line widths depend on the moments calculated above
+  this->CalcMiniProps();
+
+}
+
+// clean the postage stamp images, normalise the velocity field and calculate the line widths
+void object_props_dbl::CalcMiniProps(){
+
+  double dummy, flip;
+  int g;
+
   // remove inf's and nan's from the various arrays
-  for(g = 0; g < ((srep_size[1] - srep_size[0] + 1) * (srep_size[3] - srep_size[2] + 1)); ++g){
+  for(g = 0; ((mini_mom0 != NULL) && (g < ((srep_size[1] - srep_size[0] + 1) * (srep_size[3] - srep_size[2] + 1)))); ++g){
     if((std::isinf(mini_mom0[g])) || (std::isnan(mini_mom0[g]))){ mini_mom0[g] = 0.0; }
+  }
+  for(g = 0; ((mini_vfield != NULL) && (g < ((srep_size[1] - srep_size[0] + 1) * (srep_size[3] - srep_size[2] + 1)))); ++g){
     if((std::isinf(mini_vfield[g])) || (std::isnan(mini_vfield[g]))){ mini_vfield[g] = 0.0; }
   }
-  for(g = 0; g < ((srep_size[1] - srep_size[0] + 1) * (srep_size[5] - srep_size[4] + 1)); ++g){
+  for(g = 0; ((mini_RAPV != NULL) && (g < ((srep_size[1] - srep_size[0] + 1) * (srep_size[5] - srep_size[4] + 1)))); ++g){
     if((std::isinf(mini_RAPV[g])) || (std::isnan(mini_RAPV[g]))){ mini_RAPV[g] = 0.0; }
   }
-  for(g = 0; g < ((srep_size[3] - srep_size[2] + 1) * (srep_size[5] - srep_size[4] + 1)); ++g){
+  for(g = 0; ((mini_DECPV != NULL) && (g < ((srep_size[3] - srep_size[2] + 1) * (srep_size[5] - srep_size[4] + 1)))); ++g){
     if((std::isinf(mini_DECPV[g])) || (std::isnan(mini_DECPV[g]))){ mini_DECPV[g] = 0.0; }
   }
-  for(g = 0; g < ((srep_size[5] - srep_size[4] + 1)); ++g){
+  for(g = 0; ((mini_obj_spec != NULL) && (g < (srep_size[5] - srep_size[4] + 1))); ++g){
     if((std::isinf(mini_obj_spec[g])) || (std::isnan(mini_obj_spec[g]))){ mini_obj_spec[g] = 0.0; }
   }  
 
-  // normalise velocity field array
-  for(g = 0; g < ((srep_size[1] - srep_size[0] + 1) * (srep_size[3] - srep_size[2] + 1)); ++g){ 
+  // normalise velocity field array, which requires the moment-0 image
+  for(g = 0; ((mini_vfield != NULL) && (mini_mom0 != NULL) && (g < ((srep_size[1] - srep_size[0] + 1) * (srep_size[3] - srep_size[2] + 1)))); ++g){ 
 
     if(mini_mom0[g] != 0.0){
 
@@ -2331,7 +2127,7 @@ void object_props_dbl::CalcProps(){
   // calculate widths of source
   
   // determine maximum flux in integrated spectrum and W_50, W_20 limits
-  if((srep_size[5] - srep_size[4]) > 0){
+  if(((srep_size[5] - srep_size[4]) > 0) && (mini_obj_spec != NULL)){
     
     flip = 1.0;
     if(tot_intens < 0.0){ flip = -1.0; }
@@ -2695,27 +2491,33 @@ void object_props_dbl::Set_srep_update(int value){ srep_update = value; }
 
 int object_props_dbl::Get_srep_update(){ return srep_update; }
 
+int object_props_dbl::Get_products(){ return ((mini_mom0 != NULL) ? SREP_MOM0 : 0) | ((mini_RAPV != NULL) ? SREP_RAPV : 0) | ((mini_DECPV != NULL) ? SREP_DECPV : 0) | ((mini_obj_spec != NULL) ? SREP_OSPEC : 0) | ((mini_ref_spec != NULL) ? SREP_RSPEC : 0) | ((mini_vfield != NULL) ? SREP_VFIELD : 0); }
+
 void object_props_dbl::Set_srep_size(int index, int value){ srep_size[index] = value; }
 
 int object_props_dbl::Get_srep_size(int index){ return srep_size[index]; }
 
-void object_props_dbl::Create_srep_grid(int value){ while(srep_grid == NULL){ srep_grid = new int[value]; } }
+void object_props_dbl::Create_srep_grid(int value){ while(srep_grid == NULL){ srep_grid = NewInts(value); } srep_NOlos = 0; }
 
-void object_props_dbl::Set_srep_grid(int index, int value){ srep_grid[index] = value; }
+// the grid is always written in order, so the lines of sight that contain object strings are counted
+// as it is written
+void object_props_dbl::Set_srep_grid(int index, int value){ srep_grid[index] = value; if((index > 0) && (value > srep_grid[(index - 1)])){ ++srep_NOlos; } }
 
 int object_props_dbl::Get_srep_grid(int index){ return srep_grid[index]; }
 
-void object_props_dbl::Free_srep_grid(){ if(srep_grid != NULL){ delete [] srep_grid; srep_grid = NULL; } }
+void object_props_dbl::Free_srep_grid(){ if(srep_grid != NULL){ Release(srep_grid); srep_grid = NULL; } srep_NOlos = 0; }
+
+int object_props_dbl::Get_srep_NOlos(){ return srep_NOlos; }
 
-void object_props_dbl::Create_srep_strings(int value){ while(srep_strings == NULL){ srep_strings = new int[value]; } }
+void object_props_dbl::Create_srep_strings(int value){ while(srep_strings == NULL){ srep_strings = NewInts(value); } }
 
 void object_props_dbl::Set_srep_strings(int index, int value){ srep_strings[index] = value; }
 
 int object_props_dbl::Get_srep_strings(int index){ return srep_strings[index]; }
 
-void object_props_dbl::Free_srep_strings(){ if(srep_strings != NULL){ delete [] srep_strings; srep_strings = NULL; } }
+void object_props_dbl::Free_srep_strings(){ if(srep_strings != NULL){ Release(srep_strings); srep_strings = NULL; } }
 
-void object_props_dbl::Create_mom0(int value){ while(mini_mom0 == NULL){ mini_mom0 = new double[value]; } }
+void object_props_dbl::Create_mom0(int value){ while(mini_mom0 == NULL){ mini_mom0 = NewVals(value); } }
 
 void object_props_dbl::Set_mom0(int index, double value){ mini_mom0[index] = value; }
 
@@ -2723,9 +2525,9 @@ void object_props_dbl::Add_mom0(int index, double value){ mini_mom0[index]+=valu
 
 double object_props_dbl::Get_mom0(int index){ return mini_mom0[index]; }
 
-void object_props_dbl::Free_mom0(){ if(mini_mom0 != NULL){ delete [] mini_mom0; mini_mom0 = NULL; } }
+void object_props_dbl::Free_mom0(){ if(mini_mom0 != NULL){ Release(mini_mom0); mini_mom0 = NULL; } }
 
-void object_props_dbl::Create_RAPV(int value){ while(mini_RAPV == NULL){ mini_RAPV = new double[value]; } }
+void object_props_dbl::Create_RAPV(int value){ while(mini_RAPV == NULL){ mini_RAPV = NewVals(value); } }
 
 void object_props_dbl::Set_RAPV(int index, double value){ mini_RAPV[index] = value; }
 
@@ -2733,9 +2535,9 @@ void object_props_dbl::Add_RAPV(int index, double value){ mini_RAPV[index]+=valu
 
 double object_props_dbl::Get_RAPV(int index){ return mini_RAPV[index]; }
 
-void object_props_dbl::Free_RAPV(){ if(mini_RAPV != NULL){ delete [] mini_RAPV; mini_RAPV = NULL; } }
+void object_props_dbl::Free_RAPV(){ if(mini_RAPV != NULL){ Release(mini_RAPV); mini_RAPV = NULL; } }
 
-void object_props_dbl::Create_DECPV(int value){ while(mini_DECPV == NULL){ mini_DECPV = new double[value]; } }
+void object_props_dbl::Create_DECPV(int value){ while(mini_DECPV == NULL){ mini_DECPV = NewVals(value); } }
 
 void object_props_dbl::Set_DECPV(int index, double value){ mini_DECPV[index] = value; }
 
@@ -2743,9 +2545,9 @@ void object_props_dbl::Add_DECPV(int index, double value){ mini_DECPV[index]+=va
 
 double object_props_dbl::Get_DECPV(int index){ return mini_DECPV[index]; }
 
-void object_props_dbl::Free_DECPV(){ if(mini_DECPV != NULL){ delete [] mini_DECPV; mini_DECPV = NULL; } }
+void object_props_dbl::Free_DECPV(){ if(mini_DECPV != NULL){ Release(mini_DECPV); mini_DECPV = NULL; } }
 
-void object_props_dbl::Create_ospec(int value){ while(mini_obj_spec == NULL){ mini_obj_spec = new double[value]; } }
+void object_props_dbl::Create_ospec(int value){ while(mini_obj_spec == NULL){ mini_obj_spec = NewVals(value); } }
 
 void object_props_dbl::Set_ospec(int index, double value){ mini_obj_spec[index] = value; }
 
@@ -2753,9 +2555,9 @@ void object_props_dbl::Add_ospec(int index, double value){ mini_obj_spec[index]+
 
 double object_props_dbl::Get_ospec(int index){ return mini_obj_spec[index]; }
 
-void object_props_dbl::Free_ospec(){ if(mini_obj_spec != NULL){ delete [] mini_obj_spec; mini_obj_spec = NULL; } }
+void object_props_dbl::Free_ospec(){ if(mini_obj_spec != NULL){ Release(mini_obj_spec); mini_obj_spec = NULL; } }
 
-void object_props_dbl::Create_rspec(int value){ while(mini_ref_spec == NULL){ mini_ref_spec = new double[value]; } }
+void object_props_dbl::Create_rspec(int value){ while(mini_ref_spec == NULL){ mini_ref_spec = NewVals(value); } }
 
 void object_props_dbl::Set_rspec(int index, double value){ mini_ref_spec[index] = value; }
 
@@ -2763,9 +2565,9 @@ void object_props_dbl::Add_rspec(int index, double value){ mini_ref_spec[index]+
 
 double object_props_dbl::Get_rspec(int index){ return mini_ref_spec[index]; }
 
-void object_props_dbl::Free_rspec(){ if(mini_ref_spec != NULL){ delete [] mini_ref_spec; mini_ref_spec = NULL; } }
+void object_props_dbl::Free_rspec(){ if(mini_ref_spec != NULL){ Release(mini_ref_spec); mini_ref_spec = NULL; } }
 
-void object_props_dbl::Create_vfield(int value){ while(mini_vfield == NULL){ mini_vfield = new double[value]; } }
+void object_props_dbl::Create_vfield(int value){ while(mini_vfield == NULL){ mini_vfield = NewVals(value); } }
 
 void object_props_dbl::Set_vfield(int index, double value){ mini_vfield[index] = value; }
 
@@ -2773,40 +2575,118 @@ void object_props_dbl::Add_vfield(int index, double value){ mini_vfield[index]+=
 
 double object_props_dbl::Get_vfield(int index){ return mini_vfield[index]; }
 
-void object_props_dbl::Free_vfield(){ if(mini_vfield != NULL){ delete [] mini_vfield; mini_vfield = NULL; } }
+void object_props_dbl::Free_vfield(){ if(mini_vfield != NULL){ Release(mini_vfield); mini_vfield = NULL; } }
 
 void object_props_dbl::ReInit_srep(){
 
-  if(srep_grid != NULL){ delete [] srep_grid; }
+  if(srep_grid != NULL){ Release(srep_grid); }
   srep_grid = NULL;
-  if(srep_strings != NULL){ delete [] srep_strings; }
+  srep_NOlos = 0;
+  if(srep_strings != NULL){ Release(srep_strings); }
   srep_strings = NULL;
   
 }
 
 void object_props_dbl::ReInit_mini(){
 
-  if(mini_mom0 != NULL){ delete [] mini_mom0; }
+  if(mini_mom0 != NULL){ Release(mini_mom0); }
   mini_mom0 = NULL;
-  if(mini_RAPV != NULL){ delete [] mini_RAPV; }
+  if(mini_RAPV != NULL){ Release(mini_RAPV); }
   mini_RAPV = NULL;
-  if(mini_DECPV != NULL){ delete [] mini_DECPV; }
+  if(mini_DECPV != NULL){ Release(mini_DECPV); }
   mini_DECPV = NULL;
-  if(mini_obj_spec != NULL){ delete [] mini_obj_spec; }
+  if(mini_obj_spec != NULL){ Release(mini_obj_spec); }
   mini_obj_spec = NULL;
-  if(mini_ref_spec != NULL){ delete [] mini_ref_spec; }
+  if(mini_ref_spec != NULL){ Release(mini_ref_spec); }
   mini_ref_spec = NULL;
-  if(mini_vfield != NULL){ delete [] mini_vfield; }
+  if(mini_vfield != NULL){ Release(mini_vfield); }
   mini_vfield = NULL;
 
 }
 
+int * object_props_dbl::NewInts(int size){ return (arena != NULL) ? arena->TakeInts(size) : new int[size]; }
+
+double * object_props_dbl::NewVals(int size){ return (arena != NULL) ? arena->TakeVals(size) : new double[size]; }
+
+void object_props_dbl::Release(int * block){ if(arena != NULL){ arena->Give(block); } else { delete [] block; } }
+
+void object_props_dbl::Release(double * block){ if(arena != NULL){ arena->Give(block); } else { delete [] block; } }
+
+void object_props_dbl::SetArena(srep_arena<double> * value){ arena = value; }
+
+srep_arena<double> * object_props_dbl::GetArena(){ return arena; }
+
 void object_props_dbl::ReInit_size(){
 
   srep_size[0] = srep_size[1] = srep_size[2] = srep_size[3] = srep_size[4] = srep_size[5] = -99;
 
 }
 
+// copy the accumulated properties of this object to entry id of a columnar object store, and back
+void object_props_dbl::ToStore(object_store<double> & store, long int id){
+
+  store.NOvox[id] = NOvox;
+  store.ra[id] = ra;
+  store.dec[id] = dec;
+  store.freq[id] = freq;
+  store.ra_min[id] = ra_min;
+  store.ra_max[id] = ra_max;
+  store.dec_min[id] = dec_min;
+  store.dec_max[id] = dec_max;
+  store.freq_min[id] = freq_min;
+  store.freq_max[id] = freq_max;
+  store.ra_i[id] = ra_i;
+  store.dec_i[id] = dec_i;
+  store.freq_i[id] = freq_i;
+  store.p_ra_i[id] = p_ra_i;
+  store.p_dec_i[id] = p_dec_i;
+  store.p_freq_i[id] = p_freq_i;
+  store.n_ra_i[id] = n_ra_i;
+  store.n_dec_i[id] = n_dec_i;
+  store.n_freq_i[id] = n_freq_i;
+  store.tot_intens[id] = tot_intens;
+  store.p_tot_intens[id] = p_tot_intens;
+  store.n_tot_intens[id] = n_tot_intens;
+  store.avg_intens[id] = avg_intens;
+  store.sigma_intens[id] = sigma_intens;
+  store.rms[id] = rms;
+  store.min_intens[id] = min_intens;
+  store.max_intens[id] = max_intens;
+
+}
+
+void object_props_dbl::FromStore(object_store<double> & store, long int id){
+
+  NOvox = store.NOvox[id];
+  ra = store.ra[id];
+  dec = store.dec[id];
+  freq = store.freq[id];
+  ra_min = store.ra_min[id];
+  ra_max = store.ra_max[id];
+  dec_min = store.dec_min[id];
+  dec_max = store.dec_max[id];
+  freq_min = store.freq_min[id];
+  freq_max = store.freq_max[id];
+  ra_i = store.ra_i[id];
+  dec_i = store.dec_i[id];
+  freq_i = store.freq_i[id];
+  p_ra_i = store.p_ra_i[id];
+  p_dec_i = store.p_dec_i[id];
+  p_freq_i = store.p_freq_i[id];
+  n_ra_i = store.n_ra_i[id];
+  n_dec_i = store.n_dec_i[id];
+  n_freq_i = store.n_freq_i[id];
+  tot_intens = store.tot_intens[id];
+  p_tot_intens = store.p_tot_intens[id];
+  n_tot_intens = store.n_tot_intens[id];
+  avg_intens = store.avg_intens[id];
+  sigma_intens = store.sigma_intens[id];
+  rms = store.rms[id];
+  min_intens = store.min_intens[id];
+  max_intens = store.max_intens[id];
+
+}
+
 void object_props_dbl::AddPoint(double x_pos, double y_pos, double z_pos, double value){
 
   // update bounding box
@@ -2837,9 +2717,17 @@ void object_props_dbl::AddPoint(double x_pos, double y_pos, double z_pos, double
 
 void object_props_dbl::AddObject(object_props_dbl & merged){
 
-  int j,k,g,sx,sy,sz;
   vector<int> temp_sparse_reps_grid, temp_sparse_reps_strings;
   vector<double> temp_mom0, temp_RAPV, temp_DECPV, temp_ref_spec, temp_obj_spec, temp_vfield;
+
+  // use the scratch arrays of the arena if there is one, so that they are re-used between merges
+  if(arena != NULL){ this->AddObject(merged,arena->temp_sparse_reps_grid,arena->temp_sparse_reps_strings,arena->temp_mom0,arena->temp_RAPV,arena->temp_DECPV,arena->temp_ref_spec,arena->temp_obj_spec,arena->temp_vfield); }
+  else { this->AddObject(merged,temp_sparse_reps_grid,temp_sparse_reps_strings,temp_mom0,temp_RAPV,temp_DECPV,temp_ref_spec,temp_obj_spec,temp_vfield); }
+
+}
+
+void object_props_dbl::AddObject(object_props_dbl & merged,vector<int> & temp_sparse_reps_grid,vector<int> & temp_sparse_reps_strings,vector<double> & temp_mom0,vector<double> & temp_RAPV,vector<double> & temp_DECPV,vector<double> & temp_ref_spec,vector<double> & temp_obj_spec,vector<double> & temp_vfield){
+
     
   if(this != &merged){ 
 
@@ -2854,56 +2742,71 @@ void object_props_dbl::AddObject(object_props_dbl & merged){
     this->AddRa(merged.GetRA());
     this->AddDec(merged.GetDEC());
     this->AddFreq(merged.GetFREQ());
-    this->AddRA_i(1.0,merged.GetRAi());
-    this->AddDec_i(1.0,merged.GetDECi());
-    this->AddFreq_i(1.0,merged.GetFREQi());
-    this->AddTotIntens(merged.GetTI());
-    this->AddAvgIntens(merged.GetAvgI());
-    this->AddSigmaItens(merged.GetSigmaI());
+
+    // combine the intensity weighted sums directly --- the positive and negative parts have to be
+    // added separately, because the sign of the merged object's total says nothing about its parts
+    ra_i+=merged.ra_i;
+    dec_i+=merged.dec_i;
+    freq_i+=merged.freq_i;
+    p_ra_i+=merged.p_ra_i;
+    p_dec_i+=merged.p_dec_i;
+    p_freq_i+=merged.p_freq_i;
+    n_ra_i+=merged.n_ra_i;
+    n_dec_i+=merged.n_dec_i;
+    n_freq_i+=merged.n_freq_i;
+    tot_intens+=merged.tot_intens;
+    p_tot_intens+=merged.p_tot_intens;
+    n_tot_intens+=merged.n_tot_intens;
+    avg_intens+=merged.avg_intens;
+    sigma_intens+=merged.sigma_intens;
     this->AdjustRange(merged.GetMinI());		
     this->AdjustRange(merged.GetMaxI());	
 
-    // initialise temporary working arrays
-    temp_sparse_reps_grid.reserve(1000000);
-    temp_sparse_reps_grid.resize(0);
-    temp_sparse_reps_strings.reserve(1000000);
-    temp_sparse_reps_strings.resize(0);
-    temp_mom0.reserve(1000000);
-    temp_mom0.resize(0);
-    temp_RAPV.reserve(1000000);
-    temp_RAPV.resize(0);
-    temp_DECPV.reserve(1000000);
-    temp_DECPV.resize(0);
-    temp_obj_spec.reserve(1000000);
-    temp_obj_spec.resize(0);
-    temp_ref_spec.reserve(1000000);
-    temp_ref_spec.resize(0);
-    temp_vfield.reserve(1000000);
-    temp_vfield.resize(0);
-
-    // combine the sparse representations using the temporary arrays --- if they exist
-    if((merged.Get_srep_update() != 0) && (merged.Get_srep_size(0) >= 0)){
+    // combine the sparse representations, which relies on the updated bounding box
+    this->MergeSreps(merged,temp_sparse_reps_grid,temp_sparse_reps_strings,temp_mom0,temp_RAPV,temp_DECPV,temp_ref_spec,temp_obj_spec,temp_vfield);
+
+    // if(this != &merged)
+  }
+
+}
+
+// combine the sparse representation and postage stamp images of the merged object with those of this
+// object using the temporary arrays --- the bounding box of this object must already contain the merged object
+void object_props_dbl::MergeSreps(object_props_dbl & merged,vector<int> & temp_sparse_reps_grid,vector<int> & temp_sparse_reps_strings,vector<double> & temp_mom0,vector<double> & temp_RAPV,vector<double> & temp_DECPV,vector<double> & temp_ref_spec,vector<double> & temp_obj_spec,vector<double> & temp_vfield){
+
+  int j,k,g,sx,sy,sz,products;
+
+  if(this == &merged){ return; }
+
+  // only the postage stamp images held by both objects are kept, or those of the merged object if this
+  // object has no sparse representation yet
+  products = merged.Get_products();
+  if((this->Get_srep_update() != 0) && (this->Get_srep_size(0) >= 0)){ products&=this->Get_products(); }
+
+  // combine the sparse representations using the temporary arrays --- if they exist
+  if((merged.Get_srep_update() != 0) && (merged.Get_srep_size(0) >= 0)){
 		  
-      // write the existing object's sparse representations into temporary arrays and initialise temporary arrays at the same time, provided it exists
+    // write the existing object's sparse representations into temporary arrays and initialise temporary arrays at the same time, provided it exists
       
-      // a. grid
-      temp_sparse_reps_grid.resize(0);
-      for(g = 0; g < (1 + ((this->GetRAmax() - this->GetRAmin() + 1) * (this->GetDECmax() - this->GetDECmin() + 1))); ++g){ temp_sparse_reps_grid.push_back(0); }
+    // a. grid
+    temp_sparse_reps_grid.resize(0);
+    for(g = 0; g < (1 + ((this->GetRAmax() - this->GetRAmin() + 1) * (this->GetDECmax() - this->GetDECmin() + 1))); ++g){ temp_sparse_reps_grid.push_back(0); }
       
-      if((this->Get_srep_update() != 0) && (this->Get_srep_size(0) >= 0)){
+    if((this->Get_srep_update() != 0) && (this->Get_srep_size(0) >= 0)){
 	
-	for(sx = 0; sx < (this->Get_srep_size(1) - this->Get_srep_size(0) + 1); ++sx){
-	  for(sy = 0; sy < (this->Get_srep_size(3) - this->Get_srep_size(2) + 1); ++sy){
+      for(sx = 0; sx < (this->Get_srep_size(1) - this->Get_srep_size(0) + 1); ++sx){
+	for(sy = 0; sy < (this->Get_srep_size(3) - this->Get_srep_size(2) + 1); ++sy){
 	    
-	    temp_sparse_reps_grid[(((sy + this->Get_srep_size(2) - this->GetDECmin()) * (this->GetRAmax() - this->GetRAmin() + 1)) + sx + this->Get_srep_size(0) - this->GetRAmin())] = this->Get_srep_grid(((sy * (this->Get_srep_size(1) - this->Get_srep_size(0) + 1)) + sx + 1)) - this->Get_srep_grid(((sy * (this->Get_srep_size(1) - this->Get_srep_size(0) + 1)) + sx));
+	  temp_sparse_reps_grid[(((sy + this->Get_srep_size(2) - this->GetDECmin()) * (this->GetRAmax() - this->GetRAmin() + 1)) + sx + this->Get_srep_size(0) - this->GetRAmin())] = this->Get_srep_grid(((sy * (this->Get_srep_size(1) - this->Get_srep_size(0) + 1)) + sx + 1)) - this->Get_srep_grid(((sy * (this->Get_srep_size(1) - this->Get_srep_size(0) + 1)) + sx));
 	    
-	  }
-	  
 	}
-	
+	  
       }
+	
+    }
       
-      // b. mom-0
+    // b. mom-0
+    if(products & SREP_MOM0){
       temp_mom0.resize(0);
       for(g = 0; g < ((this->GetRAmax() - this->GetRAmin() + 1) * (this->GetDECmax() - this->GetDECmin() + 1)); ++g){ temp_mom0.push_back(0.0); }
       
@@ -2920,8 +2823,10 @@ void object_props_dbl::AddObject(object_props_dbl & merged){
 	}
 	
       }
+    }
       
-      // c. RAPV
+    // c. RAPV
+    if(products & SREP_RAPV){
       temp_RAPV.resize(0);
       for(g = 0; g < ((this->GetRAmax() - this->GetRAmin() + 1) * (this->GetFREQmax() - this->GetFREQmin() + 1)); ++g){ temp_RAPV.push_back(0.0); }
       
@@ -2938,8 +2843,10 @@ void object_props_dbl::AddObject(object_props_dbl & merged){
 	}
 	
       }
+    }
       
-      // d. DECPV
+    // d. DECPV
+    if(products & SREP_DECPV){
       temp_DECPV.resize(0);
       for(g = 0; g < ((this->GetDECmax() - this->GetDECmin() + 1) * (this->GetFREQmax() - this->GetFREQmin() + 1)); ++g){ temp_DECPV.push_back(0.0); }
       
@@ -2956,13 +2863,13 @@ void object_props_dbl::AddObject(object_props_dbl & merged){
 	}
 	
       }
+    }
       
-      // e. ref_spec
+    // e. ref_spec --- sized for the merged frequency range, as the object's new ref_spec is copied from it
+    if(products & SREP_RSPEC){
+      temp_ref_spec.assign((((this->GetFREQmax() - this->GetFREQmin() + 1) >= 10) ? (2 * (this->GetFREQmax() - this->GetFREQmin() + 1)) : (this->GetFREQmax() - this->GetFREQmin() + 11)),0.0);
       if((this->Get_srep_size(5) - this->Get_srep_size(4) + 1) >= 10){
 	
-	temp_ref_spec.resize(0);
-	for(g = 0; g < (2 * (this->GetFREQmax() - this->GetFREQmin() + 1)); ++g){ temp_ref_spec.push_back(0.0); }
-	
 	if((this->Get_srep_update() != 0) && (this->Get_srep_size(0) >= 0)){
 	  
 	  for(sz = 0; sz < (2 * (this->Get_srep_size(5) - this->Get_srep_size(4) + 1)); ++sz){ temp_ref_spec[(sz + this->Get_srep_size(4) - this->GetFREQmin())]+=this->Get_rspec(sz); } 
@@ -2971,9 +2878,6 @@ void object_props_dbl::AddObject(object_props_dbl & merged){
 	
       } else {
 	
-	temp_ref_spec.resize(0);
-	for(g = 0; g < (this->GetFREQmax() - this->GetFREQmin() + 11); ++g){ temp_ref_spec.push_back(0.0); }
-	
 	if((this->Get_srep_update() != 0) && (this->Get_srep_size(0) >= 0)){
 	  
 	  for(sz = 0; sz < (this->Get_srep_size(5) - this->Get_srep_size(4) + 11); ++sz){ temp_ref_spec[(sz + this->Get_srep_size(4) - this->GetFREQmin())]+=this->Get_rspec(sz); } 		    
@@ -2981,10 +2885,12 @@ void object_props_dbl::AddObject(object_props_dbl & merged){
 	}
 	
       }
+    }
       
-      // f. obj_spec
+    // f. obj_spec
+    if(products & SREP_OSPEC){
       temp_obj_spec.resize(0);
-      for(g = 0; g < (this->Get_srep_size(5) - this->Get_srep_size(4) + 1); ++g){ temp_obj_spec.push_back(0.0); }		  
+      for(g = 0; g < (this->GetFREQmax() - this->GetFREQmin() + 1); ++g){ temp_obj_spec.push_back(0.0); }		  
       if((this->Get_srep_update() != 0) && (this->Get_srep_size(0) >= 0)){
 	
 	for(sz = 0; sz < (this->Get_srep_size(5) - this->Get_srep_size(4) + 1); ++sz){
@@ -2994,8 +2900,10 @@ void object_props_dbl::AddObject(object_props_dbl & merged){
 	}
 	
       }
+    }
       
-      // g. vfield
+    // g. vfield
+    if(products & SREP_VFIELD){
       temp_vfield.resize(0);
       for(g = 0; g < ((this->GetRAmax() - this->GetRAmin() + 1) * (this->GetDECmax() - this->GetDECmin() + 1)); ++g){ temp_vfield.push_back(0.0); }
       
@@ -3012,21 +2920,23 @@ void object_props_dbl::AddObject(object_props_dbl & merged){
 	}
 	
       }
+    }
       
-      // write the merged object's sparse representations into temporary arrays
+    // write the merged object's sparse representations into temporary arrays
       
-      // a. grid
-      for(sx = 0; sx < (merged.Get_srep_size(1) - merged.Get_srep_size(0) + 1); ++sx){
+    // a. grid
+    for(sx = 0; sx < (merged.Get_srep_size(1) - merged.Get_srep_size(0) + 1); ++sx){
 	
-	for(sy = 0; sy < (merged.Get_srep_size(3) - merged.Get_srep_size(2) + 1); ++sy){
+      for(sy = 0; sy < (merged.Get_srep_size(3) - merged.Get_srep_size(2) + 1); ++sy){
 	  
-	  temp_sparse_reps_grid[(((sy + merged.Get_srep_size(2) - this->GetDECmin()) * (this->GetRAmax() - this->GetRAmin() + 1)) + sx + merged.Get_srep_size(0) - this->GetRAmin())]+=(merged.Get_srep_grid(((sy * (merged.Get_srep_size(1) - merged.Get_srep_size(0) + 1)) + sx + 1)) - merged.Get_srep_grid(((sy * (merged.Get_srep_size(1) - merged.Get_srep_size(0) + 1)) + sx)));
+	temp_sparse_reps_grid[(((sy + merged.Get_srep_size(2) - this->GetDECmin()) * (this->GetRAmax() - this->GetRAmin() + 1)) + sx + merged.Get_srep_size(0) - this->GetRAmin())]+=(merged.Get_srep_grid(((sy * (merged.Get_srep_size(1) - merged.Get_srep_size(0) + 1)) + sx + 1)) - merged.Get_srep_grid(((sy * (merged.Get_srep_size(1) - merged.Get_srep_size(0) + 1)) + sx)));
 	  
-	}
-	
       }
+	
+    }
       
-      // b. mom-0
+    // b. mom-0
+    if(products & SREP_MOM0){
       for(sx = 0; sx < (merged.Get_srep_size(1) - merged.Get_srep_size(0) + 1); ++sx){
 	
 	for(sy = 0; sy < (merged.Get_srep_size(3) - merged.Get_srep_size(2) + 1); ++sy){
@@ -3036,8 +2946,10 @@ void object_props_dbl::AddObject(object_props_dbl & merged){
 	}
 	
       }
+    }
       
-      // c. RAPV
+    // c. RAPV
+    if(products & SREP_RAPV){
       for(sx = 0; sx < (merged.Get_srep_size(1) - merged.Get_srep_size(0) + 1); ++sx){
 	
 	for(sz = 0; sz < (merged.Get_srep_size(5) - merged.Get_srep_size(4) + 1); ++sz){
@@ -3047,8 +2959,10 @@ void object_props_dbl::AddObject(object_props_dbl & merged){
 	}
 	
       }
+    }
       
-      // d. DECPV
+    // d. DECPV
+    if(products & SREP_DECPV){
       for(sy = 0; sy < (merged.Get_srep_size(3) - merged.Get_srep_size(2) + 1); ++sy){
 	
 	for(sz = 0; sz < (merged.Get_srep_size(5) - merged.Get_srep_size(4) + 1); ++sz){
@@ -3058,8 +2972,10 @@ void object_props_dbl::AddObject(object_props_dbl & merged){
 	}
 	
       }
+    }
       
-      // e. ref_spec
+    // e. ref_spec
+    if(products & SREP_RSPEC){
       if((merged.Get_srep_size(5) - merged.Get_srep_size(4) + 1) >= 10){
 	
 	for(sz = 0; sz < (2 * (merged.Get_srep_size(5) - merged.Get_srep_size(4) + 1)); ++sz){ 
@@ -3085,15 +3001,19 @@ void object_props_dbl::AddObject(object_props_dbl & merged){
 	} 		    
 	
       }
+    }
       
-      // f. obj_spec
+    // f. obj_spec
+    if(products & SREP_OSPEC){
       for(sz = 0; sz < (merged.Get_srep_size(5) - merged.Get_srep_size(4) + 1); ++sz){
 	
 	temp_obj_spec[(sz + merged.Get_srep_size(4) - this->GetFREQmin())]+=merged.Get_ospec(sz);
 	
       }
+    }
       
-      // g. vfield
+    // g. vfield
+    if(products & SREP_VFIELD){
       for(sx = 0; sx < (merged.Get_srep_size(1) - merged.Get_srep_size(0) + 1); ++sx){
 	
 	for(sy = 0; sy < (merged.Get_srep_size(3) - merged.Get_srep_size(2) + 1); ++sy){
@@ -3103,485 +3023,117 @@ void object_props_dbl::AddObject(object_props_dbl & merged){
 	}
 	
       }
+    }
       
-      // convert temp_sparse_reps_grid from differential to cumulative counts using temp_sparse_reps_string as an intermediary
-      temp_sparse_reps_strings.resize(1);
-      temp_sparse_reps_strings[0] = 0;
-      for(g = 1; g < (((this->GetRAmax() - this->GetRAmin() + 1) * (this->GetDECmax() - this->GetDECmin() + 1)) + 1); ++g){ temp_sparse_reps_strings.push_back(temp_sparse_reps_strings[(g - 1)] + temp_sparse_reps_grid[(g - 1)]); }
-      for(g = 0; g < (((this->GetRAmax() - this->GetRAmin() + 1) * (this->GetDECmax() - this->GetDECmin() + 1)) + 1); ++g){ temp_sparse_reps_grid[g] = temp_sparse_reps_strings[g]; }
+    // convert temp_sparse_reps_grid from differential to cumulative counts using temp_sparse_reps_string as an intermediary
+    temp_sparse_reps_strings.resize(1);
+    temp_sparse_reps_strings[0] = 0;
+    for(g = 1; g < (((this->GetRAmax() - this->GetRAmin() + 1) * (this->GetDECmax() - this->GetDECmin() + 1)) + 1); ++g){ temp_sparse_reps_strings.push_back(temp_sparse_reps_strings[(g - 1)] + temp_sparse_reps_grid[(g - 1)]); }
+    for(g = 0; g < (((this->GetRAmax() - this->GetRAmin() + 1) * (this->GetDECmax() - this->GetDECmin() + 1)) + 1); ++g){ temp_sparse_reps_grid[g] = temp_sparse_reps_strings[g]; }
       
-      // write new sparse_reps_strings value to temp_sparse_reps_strings array, using various grids to achieve indexing
+    // write new sparse_reps_strings value to temp_sparse_reps_strings array, using various grids to achieve indexing
       
-      // a. initialise temp_sparse_reps_strings
-      temp_sparse_reps_strings.resize(0);
-      for(g = 0; g < (2 * temp_sparse_reps_grid[((this->GetDECmax() - this->GetDECmin() + 1) * (this->GetRAmax() - this->GetRAmin() + 1))]); ++g){ temp_sparse_reps_strings.push_back(0); }
+    // a. initialise temp_sparse_reps_strings
+    temp_sparse_reps_strings.resize(0);
+    for(g = 0; g < (2 * temp_sparse_reps_grid[((this->GetDECmax() - this->GetDECmin() + 1) * (this->GetRAmax() - this->GetRAmin() + 1))]); ++g){ temp_sparse_reps_strings.push_back(0); }
       
       
-      // b. for each line of sight through the new existing object bounding box, retrieve the channel range of each object string along this LoS
-      for(sy = this->GetDECmin(); sy <= this->GetDECmax(); ++sy){
+    // b. for each line of sight through the new existing object bounding box, retrieve the channel range of each object string along this LoS
+    for(sy = this->GetDECmin(); sy <= this->GetDECmax(); ++sy){
 	
-	for(sx = this->GetRAmin(); sx <= this->GetRAmax(); ++sx){
+      for(sx = this->GetRAmin(); sx <= this->GetRAmax(); ++sx){
 	  
-	  // initialise the number of object strings written to this LoS
-	  k = 0;
+	// initialise the number of object strings written to this LoS
+	k = 0;
 	  
-	  // retrieve the starting index for object strings along this LoS
-	  j = 2 * temp_sparse_reps_grid[(((sy - this->GetDECmin()) * (this->GetRAmax() - this->GetRAmin() + 1)) + sx - this->GetRAmin())];
+	// retrieve the starting index for object strings along this LoS
+	j = 2 * temp_sparse_reps_grid[(((sy - this->GetDECmin()) * (this->GetRAmax() - this->GetRAmin() + 1)) + sx - this->GetRAmin())];
 	  
-	  // write existing object's object strings to temp_strings_array
-	  if((this->Get_srep_update() != 0) && (this->Get_srep_size(0) >= 0)){
+	// write existing object's object strings to temp_strings_array
+	if((this->Get_srep_update() != 0) && (this->Get_srep_size(0) >= 0)){
 	    
-	    if((sx >= this->Get_srep_size(0)) && (sx <= this->Get_srep_size(1)) && (sy >= this->Get_srep_size(2)) && (sy <= this->Get_srep_size(3))){
+	  if((sx >= this->Get_srep_size(0)) && (sx <= this->Get_srep_size(1)) && (sy >= this->Get_srep_size(2)) && (sy <= this->Get_srep_size(3))){
 	      
-	      for(g = this->Get_srep_grid((((sy - this->Get_srep_size(2)) * (this->Get_srep_size(1) - this->Get_srep_size(0) + 1)) + sx - this->Get_srep_size(0))); g < this->Get_srep_grid((((sy - this->Get_srep_size(2)) * (this->Get_srep_size(1) - this->Get_srep_size(0) + 1)) + sx - this->Get_srep_size(0) + 1)); ++g){
-		
-		temp_sparse_reps_strings[(j + k)] = this->Get_srep_strings((2 * g));
-		++k;
-		temp_sparse_reps_strings[(j + k)] = this->Get_srep_strings(((2 * g) + 1));
-		++k;
+	    for(g = this->Get_srep_grid((((sy - this->Get_srep_size(2)) * (this->Get_srep_size(1) - this->Get_srep_size(0) + 1)) + sx - this->Get_srep_size(0))); g < this->Get_srep_grid((((sy - this->Get_srep_size(2)) * (this->Get_srep_size(1) - this->Get_srep_size(0) + 1)) + sx - this->Get_srep_size(0) + 1)); ++g){
 		
-	      }
-	      
-	      // if((sx >= sparse_reps_size[obj_batch][(existing - (obj_batch * obj_limit))][0]) && (sx <= sparse_reps_size[obj_batch][(existing - (obj_batch * obj_limit))][1]) && (sy >= sparse_reps_size[obj_batch][(existing - (obj_batch * obj_limit))][2]) && (sy <= sparse_reps_size[obj_batch][(existing - (obj_batch * obj_limit))][3]))
-	    }
-	    
-	    // if((sparse_reps_update[obj_batch][(existing - (obj_batch * obj_limit))] != 0) && (sparse_reps_size[obj_batch][(existing - (obj_batch * obj_limit))][0] >= 0))
-	  }
-	  
-	  // write match_init[i] object strings to temp_strings_array
-	  if((sx >= merged.Get_srep_size(0)) && (sx <= merged.Get_srep_size(1)) && (sy >= merged.Get_srep_size(2)) && (sy <= merged.Get_srep_size(3))){
-	    
-	    for(g = merged.Get_srep_grid((((sy - merged.Get_srep_size(2)) * (merged.Get_srep_size(1) - merged.Get_srep_size(0) + 1)) + sx - merged.Get_srep_size(0))); g < merged.Get_srep_grid((((sy - merged.Get_srep_size(2)) * (merged.Get_srep_size(1) - merged.Get_srep_size(0) + 1)) + sx - merged.Get_srep_size(0) + 1)); ++g){
-	      
-	      temp_sparse_reps_strings[(j + k)] = merged.Get_srep_strings((2 * g));
+	      temp_sparse_reps_strings[(j + k)] = this->Get_srep_strings((2 * g));
 	      ++k;
-	      temp_sparse_reps_strings[(j + k)] = merged.Get_srep_strings(((2 * g) + 1));
+	      temp_sparse_reps_strings[(j + k)] = this->Get_srep_strings(((2 * g) + 1));
 	      ++k;
-	      
+		
 	    }
-	    
+	      
 	    // if((sx >= sparse_reps_size[obj_batch][(existing - (obj_batch * obj_limit))][0]) && (sx <= sparse_reps_size[obj_batch][(existing - (obj_batch * obj_limit))][1]) && (sy >= sparse_reps_size[obj_batch][(existing - (obj_batch * obj_limit))][2]) && (sy <= sparse_reps_size[obj_batch][(existing - (obj_batch * obj_limit))][3]))
 	  }
-	  
-	  // for(sx = 0; sx < (); ++sx)
-	}
-	
-	// for(sy = 0; sy < (); ++sy)
-      }
-      
-      // over-write the existing object's sparse representations with the existing+merged sparse representations
-      this->Set_srep_size(0,this->GetRAmin());
-      this->Set_srep_size(1,this->GetRAmax());
-      this->Set_srep_size(2,this->GetDECmin());
-      this->Set_srep_size(3,this->GetDECmax());
-      this->Set_srep_size(4,this->GetFREQmin());
-      this->Set_srep_size(5,this->GetFREQmax());
-      
-      // a. grid
-      this->Free_srep_grid();
-      this->Create_srep_grid((((this->Get_srep_size(1) - this->Get_srep_size(0) + 1) * (this->Get_srep_size(3) - this->Get_srep_size(2) + 1)) + 1));
-      for(g = 0; g < (((this->Get_srep_size(1) - this->Get_srep_size(0) + 1) * (this->Get_srep_size(3) - this->Get_srep_size(2) + 1)) + 1); ++g){ this->Set_srep_grid(g,temp_sparse_reps_grid[g]); }
-      
-      // b. mini_mom0
-      this->Free_mom0();
-      this->Create_mom0(((this->Get_srep_size(1) - this->Get_srep_size(0) + 1) * (this->Get_srep_size(3) - this->Get_srep_size(2) + 1)));
-      for(g = 0; g < ((this->Get_srep_size(1) - this->Get_srep_size(0) + 1) * (this->Get_srep_size(3) - this->Get_srep_size(2) + 1)); ++g){ this->Set_mom0(g,temp_mom0[g]); }
-      
-      // c. mini_RAPV
-      this->Free_RAPV();
-      this->Create_RAPV(((this->Get_srep_size(1) - this->Get_srep_size(0) + 1) * (this->Get_srep_size(5) - this->Get_srep_size(4) + 1)));
-      for(g = 0; g < ((this->Get_srep_size(1) - this->Get_srep_size(0) + 1) * (this->Get_srep_size(5) - this->Get_srep_size(4) + 1)); ++g){ this->Set_RAPV(g,temp_RAPV[g]); }
-      
-      // d. mini_DECPV
-      this->Free_DECPV();
-      this->Create_DECPV(((this->Get_srep_size(5) - this->Get_srep_size(4) + 1) * (this->Get_srep_size(3) - this->Get_srep_size(2) + 1)));
-      for(g = 0; g < ((this->Get_srep_size(3) - this->Get_srep_size(2) + 1) * (this->Get_srep_size(5) - this->Get_srep_size(4) + 1)); ++g){ this->Set_DECPV(g,temp_DECPV[g]); }
-      
-      // e. mini_obj_spec
-      this->Free_ospec();
-      this->Create_ospec((this->Get_srep_size(5) - this->Get_srep_size(4) + 1));
-      for(g = 0; g < (this->Get_srep_size(5) - this->Get_srep_size(4) + 1); ++g){ this->Set_ospec(g,temp_obj_spec[g]); }
-      
-      // f. mini_ref_spec
-      this->Free_rspec();
-      if((this->Get_srep_size(5) - this->Get_srep_size(4) + 1) >= 10){
-	
-	this->Create_rspec((2 * (this->Get_srep_size(5) - this->Get_srep_size(4) + 1)));
-	for(g = 0; g < (2 * (this->Get_srep_size(5) - this->Get_srep_size(4) + 1)); ++g){ this->Set_rspec(g,temp_ref_spec[g]); }
-	
-      } else {
-	
-	this->Create_rspec((this->Get_srep_size(5) - this->Get_srep_size(4) + 11));
-	for(g = 0; g < (this->Get_srep_size(5) - this->Get_srep_size(4) + 11); ++g){ this->Set_rspec(g,temp_ref_spec[g]); }
-	
-      }
-      
-      // g. mini_vfield
-      this->Free_vfield();
-      this->Create_vfield(((this->Get_srep_size(1) - this->Get_srep_size(0) + 1) * (this->Get_srep_size(3) - this->Get_srep_size(2) + 1)));
-      for(g = 0; g < ((this->Get_srep_size(1) - this->Get_srep_size(0) + 1) * (this->Get_srep_size(3) - this->Get_srep_size(2) + 1)); ++g){ this->Set_vfield(g,temp_vfield[g]); }
-      
-      // h. sparse_reps_strings
-      this->Free_srep_strings();
-      this->Create_srep_strings((2 * this->Get_srep_grid(((this->Get_srep_size(1) - this->Get_srep_size(0) + 1) * (this->Get_srep_size(3) - this->Get_srep_size(2) + 1)))));
-      for(g = 0; g < (2 * this->Get_srep_grid(((this->Get_srep_size(1) - this->Get_srep_size(0) + 1) * (this->Get_srep_size(3) - this->Get_srep_size(2) + 1)))); ++g){ this->Set_srep_strings(g,temp_sparse_reps_strings[g]); }
-      
-    }
-  
-    // if(this != &merged)
-  }
-
-}
-
-void object_props_dbl::AddObject(object_props_dbl & merged,vector<int> & temp_sparse_reps_grid,vector<int> & temp_sparse_reps_strings,vector<double> & temp_mom0,vector<double> & temp_RAPV,vector<double> & temp_DECPV,vector<double> & temp_ref_spec,vector<double> & temp_obj_spec,vector<double> & temp_vfield){
-
-  int j,k,g,sx,sy,sz;
-    
-  if(this != &merged){ 
-
-    // update the properties of this object with the object being merged in
-    this->AddVoxel(merged.ShowVoxels());
-    this->AdjustRArange(merged.GetRAmin());
-    this->AdjustRArange(merged.GetRAmax());
-    this->AdjustDECrange(merged.GetDECmin());
-    this->AdjustDECrange(merged.GetDECmax());
-    this->AdjustFREQrange(merged.GetFREQmin());
-    this->AdjustFREQrange(merged.GetFREQmax());
-    this->AddRa(merged.GetRA());
-    this->AddDec(merged.GetDEC());
-    this->AddFreq(merged.GetFREQ());
-    this->AddRA_i(1.0,merged.GetRAi());
-    this->AddDec_i(1.0,merged.GetDECi());
-    this->AddFreq_i(1.0,merged.GetFREQi());
-    this->AddTotIntens(merged.GetTI());
-    this->AddAvgIntens(merged.GetAvgI());
-    this->AddSigmaItens(merged.GetSigmaI());
-    this->AdjustRange(merged.GetMinI());		
-    this->AdjustRange(merged.GetMaxI());	
-
-    // combine the sparse representations using the temporary arrays --- if they exist
-    if((merged.Get_srep_update() != 0) && (merged.Get_srep_size(0) >= 0)){
-		  
-      // write the existing object's sparse representations into temporary arrays and initialise temporary arrays at the same time, provided it exists
-      
-      // a. grid
-      temp_sparse_reps_grid.resize(0);
-      for(g = 0; g < (1 + ((this->GetRAmax() - this->GetRAmin() + 1) * (this->GetDECmax() - this->GetDECmin() + 1))); ++g){ temp_sparse_reps_grid.push_back(0); }
-      
-      if((this->Get_srep_update() != 0) && (this->Get_srep_size(0) >= 0)){
-	
-	for(sx = 0; sx < (this->Get_srep_size(1) - this->Get_srep_size(0) + 1); ++sx){
-	  for(sy = 0; sy < (this->Get_srep_size(3) - this->Get_srep_size(2) + 1); ++sy){
-	    
-	    temp_sparse_reps_grid[(((sy + this->Get_srep_size(2) - this->GetDECmin()) * (this->GetRAmax() - this->GetRAmin() + 1)) + sx + this->Get_srep_size(0) - this->GetRAmin())] = this->Get_srep_grid(((sy * (this->Get_srep_size(1) - this->Get_srep_size(0) + 1)) + sx + 1)) - this->Get_srep_grid(((sy * (this->Get_srep_size(1) - this->Get_srep_size(0) + 1)) + sx));
-	    
-	  }
-	  
-	}
-	
-      }
-      
-      // b. mom-0
-      temp_mom0.resize(0);
-      for(g = 0; g < ((this->GetRAmax() - this->GetRAmin() + 1) * (this->GetDECmax() - this->GetDECmin() + 1)); ++g){ temp_mom0.push_back(0.0); }
-      
-      if((this->Get_srep_update() != 0) && (this->Get_srep_size(0) >= 0)){
-	
-	for(sx = 0; sx < (this->Get_srep_size(1) - this->Get_srep_size(0) + 1); ++sx){
-	  
-	  for(sy = 0; sy < (this->Get_srep_size(3) - this->Get_srep_size(2) + 1); ++sy){
-	    
-	    temp_mom0[(((sy + this->Get_srep_size(2) - this->GetDECmin()) * (this->GetRAmax() - this->GetRAmin() + 1)) + sx + this->Get_srep_size(0) - this->GetRAmin())]+=this->Get_mom0(((sy * (this->Get_srep_size(1) - this->Get_srep_size(0) + 1)) + sx));
-	    
-	  }
-	  
-	}
-	
-      }
-      
-      // c. RAPV
-      temp_RAPV.resize(0);
-      for(g = 0; g < ((this->GetRAmax() - this->GetRAmin() + 1) * (this->GetFREQmax() - this->GetFREQmin() + 1)); ++g){ temp_RAPV.push_back(0.0); }
-      
-      if((this->Get_srep_update() != 0) && (this->Get_srep_size(0) >= 0)){
-	
-	for(sx = 0; sx < (this->Get_srep_size(1) - this->Get_srep_size(0) + 1); ++sx){
-	  
-	  for(sz = 0; sz < (this->Get_srep_size(5) - this->Get_srep_size(4) + 1); ++sz){
-	    
-	    temp_RAPV[(((sz + this->Get_srep_size(4) - this->GetFREQmin()) * (this->GetRAmax() - this->GetRAmin() + 1)) + sx + this->Get_srep_size(0) - this->GetRAmin())]+=this->Get_RAPV(((sz * (this->Get_srep_size(1) - this->Get_srep_size(0) + 1)) + sx));
-	    
-	  }
-	  
-	}
-	
-      }
-      
-      // d. DECPV
-      temp_DECPV.resize(0);
-      for(g = 0; g < ((this->GetDECmax() - this->GetDECmin() + 1) * (this->GetFREQmax() - this->GetFREQmin() + 1)); ++g){ temp_DECPV.push_back(0.0); }
-      
-      if((this->Get_srep_update() != 0) && (this->Get_srep_size(0) >= 0)){
-	
-	for(sy = 0; sy < (this->Get_srep_size(3) - this->Get_srep_size(2) + 1); ++sy){
-	  
-	  for(sz = 0; sz < (this->Get_srep_size(5) - this->Get_srep_size(4) + 1); ++sz){
-	    
-	    temp_DECPV[(((sz + this->Get_srep_size(4) - this->GetFREQmin()) * (this->GetDECmax() - this->GetDECmin() + 1)) + sy + this->Get_srep_size(2) - this->GetDECmin())]+=this->Get_DECPV(((sz * (this->Get_srep_size(3) - this->Get_srep_size(2) + 1)) + sy));
-	    
-	  }
-	  
-	}
-	
-      }
-      
-      // e. ref_spec
-      if((this->Get_srep_size(5) - this->Get_srep_size(4) + 1) >= 10){
-	
-	temp_ref_spec.resize(0);
-	for(g = 0; g < (2 * (this->GetFREQmax() - this->GetFREQmin() + 1)); ++g){ temp_ref_spec.push_back(0.0); }
-	
-	if((this->Get_srep_update() != 0) && (this->Get_srep_size(0) >= 0)){
-	  
-	  for(sz = 0; sz < (2 * (this->Get_srep_size(5) - this->Get_srep_size(4) + 1)); ++sz){ temp_ref_spec[(sz + this->Get_srep_size(4) - this->GetFREQmin())]+=this->Get_rspec(sz); } 
-	  
-	}
-	
-      } else {
-	
-	temp_ref_spec.resize(0);
-	for(g = 0; g < (this->GetFREQmax() - this->GetFREQmin() + 11); ++g){ temp_ref_spec.push_back(0.0); }
-	
-	if((this->Get_srep_update() != 0) && (this->Get_srep_size(0) >= 0)){
-	  
-	  for(sz = 0; sz < (this->Get_srep_size(5) - this->Get_srep_size(4) + 11); ++sz){ temp_ref_spec[(sz + this->Get_srep_size(4) - this->GetFREQmin())]+=this->Get_rspec(sz); } 		    
-	  
-	}
-	
-      }
-      
-      // f. obj_spec
-      temp_obj_spec.resize(0);
-      for(g = 0; g < (this->Get_srep_size(5) - this->Get_srep_size(4) + 1); ++g){ temp_obj_spec.push_back(0.0); }		  
-      if((this->Get_srep_update() != 0) && (this->Get_srep_size(0) >= 0)){
-	
-	for(sz = 0; sz < (this->Get_srep_size(5) - this->Get_srep_size(4) + 1); ++sz){
-	  
-	  temp_obj_spec[(sz + this->Get_srep_size(4) - this->GetFREQmin())]+=this->Get_ospec(sz);
-	  
-	}
-	
-      }
-      
-      // g. vfield
-      temp_vfield.resize(0);
-      for(g = 0; g < ((this->GetRAmax() - this->GetRAmin() + 1) * (this->GetDECmax() - this->GetDECmin() + 1)); ++g){ temp_vfield.push_back(0.0); }
-      
-      if((this->Get_srep_update() != 0) && (this->Get_srep_size(0) >= 0)){
-	
-	for(sx = 0; sx < (this->Get_srep_size(1) - this->Get_srep_size(0) + 1); ++sx){
-	  
-	  for(sy = 0; sy < (this->Get_srep_size(3) - this->Get_srep_size(2) + 1); ++sy){
-	    
-	    temp_vfield[(((sy + this->Get_srep_size(2) - this->GetDECmin()) * (this->GetRAmax() - this->GetRAmin() + 1)) + sx + this->Get_srep_size(0) - this->GetRAmin())]+=this->Get_vfield(((sy * (this->Get_srep_size(1) - this->Get_srep_size(0) + 1)) + sx));
-	    
-	  }
-	  
-	}
-	
-      }
-      
-      // write the merged object's sparse representations into temporary arrays
-      
-      // a. grid
-      for(sx = 0; sx < (merged.Get_srep_size(1) - merged.Get_srep_size(0) + 1); ++sx){
-	
-	for(sy = 0; sy < (merged.Get_srep_size(3) - merged.Get_srep_size(2) + 1); ++sy){
-	  
-	  temp_sparse_reps_grid[(((sy + merged.Get_srep_size(2) - this->GetDECmin()) * (this->GetRAmax() - this->GetRAmin() + 1)) + sx + merged.Get_srep_size(0) - this->GetRAmin())]+=(merged.Get_srep_grid(((sy * (merged.Get_srep_size(1) - merged.Get_srep_size(0) + 1)) + sx + 1)) - merged.Get_srep_grid(((sy * (merged.Get_srep_size(1) - merged.Get_srep_size(0) + 1)) + sx)));
-	  
-	}
-	
-      }
-      
-      // b. mom-0
-      for(sx = 0; sx < (merged.Get_srep_size(1) - merged.Get_srep_size(0) + 1); ++sx){
-	
-	for(sy = 0; sy < (merged.Get_srep_size(3) - merged.Get_srep_size(2) + 1); ++sy){
-	  
-	  temp_mom0[(((sy + merged.Get_srep_size(2) - this->GetDECmin()) * (this->GetRAmax() - this->GetRAmin() + 1)) + sx + merged.Get_srep_size(0) - this->GetRAmin())]+=merged.Get_mom0(((sy * (merged.Get_srep_size(1) - merged.Get_srep_size(0) + 1)) + sx));
-	  
-	}
-	
-      }
-      
-      // c. RAPV
-      for(sx = 0; sx < (merged.Get_srep_size(1) - merged.Get_srep_size(0) + 1); ++sx){
-	
-	for(sz = 0; sz < (merged.Get_srep_size(5) - merged.Get_srep_size(4) + 1); ++sz){
-	  
-	  temp_RAPV[(((sz + merged.Get_srep_size(4) - this->GetFREQmin()) * (this->GetRAmax() - this->GetRAmin() + 1)) + sx + merged.Get_srep_size(0) - this->GetRAmin())]+=merged.Get_RAPV(((sz * (merged.Get_srep_size(1) - merged.Get_srep_size(0) + 1)) + sx));
-	  
-	}
-	
-      }
-      
-      // d. DECPV
-      for(sy = 0; sy < (merged.Get_srep_size(3) - merged.Get_srep_size(2) + 1); ++sy){
-	
-	for(sz = 0; sz < (merged.Get_srep_size(5) - merged.Get_srep_size(4) + 1); ++sz){
-	  
-	  temp_DECPV[(((sz + merged.Get_srep_size(4) - this->GetFREQmin()) * (this->GetDECmax() - this->GetDECmin() + 1)) + sy + merged.Get_srep_size(2) - this->GetDECmin())]+=merged.Get_DECPV(((sz * (merged.Get_srep_size(3) - merged.Get_srep_size(2) + 1)) + sy));
-	  
-	}
-	
-      }
-      
-      // e. ref_spec
-      if((merged.Get_srep_size(5) - merged.Get_srep_size(4) + 1) >= 10){
-	
-	for(sz = 0; sz < (2 * (merged.Get_srep_size(5) - merged.Get_srep_size(4) + 1)); ++sz){ 
-	  
-	  if((sz + merged.Get_srep_size(4) - merged.GetFREQmin()) >= 0){
-	    
-	    temp_ref_spec[(sz + merged.Get_srep_size(4) - this->GetFREQmin())]+=merged.Get_rspec(sz); 
-	    
-	  }
-	  
-	} 
-	
-      } else {
-	
-	for(sz = 0; sz < (merged.Get_srep_size(5) - merged.Get_srep_size(4) + 11); ++sz){ 
-	  
-	  if((sz + merged.Get_srep_size(4) - this->GetFREQmin()) >= 0){
 	    
-	    temp_ref_spec[(sz + merged.Get_srep_size(4) - this->GetFREQmin())]+=merged.Get_rspec(sz); 
-	    
-	  }
-	  
-	} 		    
-	
-      }
-      
-      // f. obj_spec
-      for(sz = 0; sz < (merged.Get_srep_size(5) - merged.Get_srep_size(4) + 1); ++sz){
-	
-	temp_obj_spec[(sz + merged.Get_srep_size(4) - this->GetFREQmin())]+=merged.Get_ospec(sz);
-	
-      }
-      
-      // g. vfield
-      for(sx = 0; sx < (merged.Get_srep_size(1) - merged.Get_srep_size(0) + 1); ++sx){
-	
-	for(sy = 0; sy < (merged.Get_srep_size(3) - merged.Get_srep_size(2) + 1); ++sy){
-	  
-	  temp_vfield[(((sy + merged.Get_srep_size(2) - this->GetDECmin()) * (this->GetRAmax() - this->GetRAmin() + 1)) + sx + merged.Get_srep_size(0) - this->GetRAmin())]+=merged.Get_vfield(((sy * (merged.Get_srep_size(1) - merged.Get_srep_size(0) + 1)) + sx));
-	  
+	  // if((sparse_reps_update[obj_batch][(existing - (obj_batch * obj_limit))] != 0) && (sparse_reps_size[obj_batch][(existing - (obj_batch * obj_limit))][0] >= 0))
 	}
-	
-      }
-      
-      // convert temp_sparse_reps_grid from differential to cumulative counts using temp_sparse_reps_string as an intermediary
-      temp_sparse_reps_strings.resize(1);
-      temp_sparse_reps_strings[0] = 0;
-      for(g = 1; g < (((this->GetRAmax() - this->GetRAmin() + 1) * (this->GetDECmax() - this->GetDECmin() + 1)) + 1); ++g){ temp_sparse_reps_strings.push_back(temp_sparse_reps_strings[(g - 1)] + temp_sparse_reps_grid[(g - 1)]); }
-      for(g = 0; g < (((this->GetRAmax() - this->GetRAmin() + 1) * (this->GetDECmax() - this->GetDECmin() + 1)) + 1); ++g){ temp_sparse_reps_grid[g] = temp_sparse_reps_strings[g]; }
-      
-      // write new sparse_reps_strings value to temp_sparse_reps_strings array, using various grids to achieve indexing
-      
-      // a. initialise temp_sparse_reps_strings
-      temp_sparse_reps_strings.resize(0);
-      for(g = 0; g < (2 * temp_sparse_reps_grid[((this->GetDECmax() - this->GetDECmin() + 1) * (this->GetRAmax() - this->GetRAmin() + 1))]); ++g){ temp_sparse_reps_strings.push_back(0); }
-      
-      
-      // b. for each line of sight through the new existing object bounding box, retrieve the channel range of each object string along this LoS
-      for(sy = this->GetDECmin(); sy <= this->GetDECmax(); ++sy){
-	
-	for(sx = this->GetRAmin(); sx <= this->GetRAmax(); ++sx){
-	  
-	  // initialise the number of object strings written to this LoS
-	  k = 0;
 	  
-	  // retrieve the starting index for object strings along this LoS
-	  j = 2 * temp_sparse_reps_grid[(((sy - this->GetDECmin()) * (this->GetRAmax() - this->GetRAmin() + 1)) + sx - this->GetRAmin())];
-	  
-	  // write existing object's object strings to temp_strings_array
-	  if((this->Get_srep_update() != 0) && (this->Get_srep_size(0) >= 0)){
+	// write match_init[i] object strings to temp_strings_array
+	if((sx >= merged.Get_srep_size(0)) && (sx <= merged.Get_srep_size(1)) && (sy >= merged.Get_srep_size(2)) && (sy <= merged.Get_srep_size(3))){
 	    
-	    if((sx >= this->Get_srep_size(0)) && (sx <= this->Get_srep_size(1)) && (sy >= this->Get_srep_size(2)) && (sy <= this->Get_srep_size(3))){
+	  for(g = merged.Get_srep_grid((((sy - merged.Get_srep_size(2)) * (merged.Get_srep_size(1) - merged.Get_srep_size(0) + 1)) + sx - merged.Get_srep_size(0))); g < merged.Get_srep_grid((((sy - merged.Get_srep_size(2)) * (merged.Get_srep_size(1) - merged.Get_srep_size(0) + 1)) + sx - merged.Get_srep_size(0) + 1)); ++g){
 	      
-	      for(g = this->Get_srep_grid((((sy - this->Get_srep_size(2)) * (this->Get_srep_size(1) - this->Get_srep_size(0) + 1)) + sx - this->Get_srep_size(0))); g < this->Get_srep_grid((((sy - this->Get_srep_size(2)) * (this->Get_srep_size(1) - this->Get_srep_size(0) + 1)) + sx - this->Get_srep_size(0) + 1)); ++g){
-		
-		temp_sparse_reps_strings[(j + k)] = this->Get_srep_strings((2 * g));
-		++k;
-		temp_sparse_reps_strings[(j + k)] = this->Get_srep_strings(((2 * g) + 1));
-		++k;
-		
-	      }
+	    temp_sparse_reps_strings[(j + k)] = merged.Get_srep_strings((2 * g));
+	    ++k;
+	    temp_sparse_reps_strings[(j + k)] = merged.Get_srep_strings(((2 * g) + 1));
+	    ++k;
 	      
-	      // if((sx >= sparse_reps_size[obj_batch][(existing - (obj_batch * obj_limit))][0]) && (sx <= sparse_reps_size[obj_batch][(existing - (obj_batch * obj_limit))][1]) && (sy >= sparse_reps_size[obj_batch][(existing - (obj_batch * obj_limit))][2]) && (sy <= sparse_reps_size[obj_batch][(existing - (obj_batch * obj_limit))][3]))
-	    }
-	    
-	    // if((sparse_reps_update[obj_batch][(existing - (obj_batch * obj_limit))] != 0) && (sparse_reps_size[obj_batch][(existing - (obj_batch * obj_limit))][0] >= 0))
 	  }
-	  
-	  // write match_init[i] object strings to temp_strings_array
-	  if((sx >= merged.Get_srep_size(0)) && (sx <= merged.Get_srep_size(1)) && (sy >= merged.Get_srep_size(2)) && (sy <= merged.Get_srep_size(3))){
-	    
-	    for(g = merged.Get_srep_grid((((sy - merged.Get_srep_size(2)) * (merged.Get_srep_size(1) - merged.Get_srep_size(0) + 1)) + sx - merged.Get_srep_size(0))); g < merged.Get_srep_grid((((sy - merged.Get_srep_size(2)) * (merged.Get_srep_size(1) - merged.Get_srep_size(0) + 1)) + sx - merged.Get_srep_size(0) + 1)); ++g){
-	      
-	      temp_sparse_reps_strings[(j + k)] = merged.Get_srep_strings((2 * g));
-	      ++k;
-	      temp_sparse_reps_strings[(j + k)] = merged.Get_srep_strings(((2 * g) + 1));
-	      ++k;
-	      
-	    }
 	    
-	    // if((sx >= sparse_reps_size[obj_batch][(existing - (obj_batch * obj_limit))][0]) && (sx <= sparse_reps_size[obj_batch][(existing - (obj_batch * obj_limit))][1]) && (sy >= sparse_reps_size[obj_batch][(existing - (obj_batch * obj_limit))][2]) && (sy <= sparse_reps_size[obj_batch][(existing - (obj_batch * obj_limit))][3]))
-	  }
-	  
-	  // for(sx = 0; sx < (); ++sx)
+	  // if((sx >= sparse_reps_size[obj_batch][(existing - (obj_batch * obj_limit))][0]) && (sx <= sparse_reps_size[obj_batch][(existing - (obj_batch * obj_limit))][1]) && (sy >= sparse_reps_size[obj_batch][(existing - (obj_batch * obj_limit))][2]) && (sy <= sparse_reps_size[obj_batch][(existing - (obj_batch * obj_limit))][3]))
 	}
-	
-	// for(sy = 0; sy < (); ++sy)
+	  
+	// for(sx = 0; sx < (); ++sx)
       }
+	
+      // for(sy = 0; sy < (); ++sy)
+    }
       
-      // over-write the existing object's sparse representations with the existing+merged sparse representations
-      this->Set_srep_size(0,this->GetRAmin());
-      this->Set_srep_size(1,this->GetRAmax());
-      this->Set_srep_size(2,this->GetDECmin());
-      this->Set_srep_size(3,this->GetDECmax());
-      this->Set_srep_size(4,this->GetFREQmin());
-      this->Set_srep_size(5,this->GetFREQmax());
-      
-      // a. grid
-      this->Free_srep_grid();
-      this->Create_srep_grid((((this->Get_srep_size(1) - this->Get_srep_size(0) + 1) * (this->Get_srep_size(3) - this->Get_srep_size(2) + 1)) + 1));
-      for(g = 0; g < (((this->Get_srep_size(1) - this->Get_srep_size(0) + 1) * (this->Get_srep_size(3) - this->Get_srep_size(2) + 1)) + 1); ++g){ this->Set_srep_grid(g,temp_sparse_reps_grid[g]); }
-      
-      // b. mini_mom0
-      this->Free_mom0();
+    // over-write the existing object's sparse representations with the existing+merged sparse representations
+    this->Set_srep_size(0,this->GetRAmin());
+    this->Set_srep_size(1,this->GetRAmax());
+    this->Set_srep_size(2,this->GetDECmin());
+    this->Set_srep_size(3,this->GetDECmax());
+    this->Set_srep_size(4,this->GetFREQmin());
+    this->Set_srep_size(5,this->GetFREQmax());
+      
+    // a. grid
+    this->Free_srep_grid();
+    this->Create_srep_grid((((this->Get_srep_size(1) - this->Get_srep_size(0) + 1) * (this->Get_srep_size(3) - this->Get_srep_size(2) + 1)) + 1));
+    for(g = 0; g < (((this->Get_srep_size(1) - this->Get_srep_size(0) + 1) * (this->Get_srep_size(3) - this->Get_srep_size(2) + 1)) + 1); ++g){ this->Set_srep_grid(g,temp_sparse_reps_grid[g]); }
+      
+    // b. mini_mom0
+    this->Free_mom0();
+    if(products & SREP_MOM0){
       this->Create_mom0(((this->Get_srep_size(1) - this->Get_srep_size(0) + 1) * (this->Get_srep_size(3) - this->Get_srep_size(2) + 1)));
       for(g = 0; g < ((this->Get_srep_size(1) - this->Get_srep_size(0) + 1) * (this->Get_srep_size(3) - this->Get_srep_size(2) + 1)); ++g){ this->Set_mom0(g,temp_mom0[g]); }
+    }
       
-      // c. mini_RAPV
-      this->Free_RAPV();
+    // c. mini_RAPV
+    this->Free_RAPV();
+    if(products & SREP_RAPV){
       this->Create_RAPV(((this->Get_srep_size(1) - this->Get_srep_size(0) + 1) * (this->Get_srep_size(5) - this->Get_srep_size(4) + 1)));
       for(g = 0; g < ((this->Get_srep_size(1) - this->Get_srep_size(0) + 1) * (this->Get_srep_size(5) - this->Get_srep_size(4) + 1)); ++g){ this->Set_RAPV(g,temp_RAPV[g]); }
+    }
       
-      // d. mini_DECPV
-      this->Free_DECPV();
+    // d. mini_DECPV
+    this->Free_DECPV();
+    if(products & SREP_DECPV){
       this->Create_DECPV(((this->Get_srep_size(5) - this->Get_srep_size(4) + 1) * (this->Get_srep_size(3) - this->Get_srep_size(2) + 1)));
       for(g = 0; g < ((this->Get_srep_size(3) - this->Get_srep_size(2) + 1) * (this->Get_srep_size(5) - this->Get_srep_size(4) + 1)); ++g){ this->Set_DECPV(g,temp_DECPV[g]); }
+    }
       
-      // e. mini_obj_spec
-      this->Free_ospec();
+    // e. mini_obj_spec
+    this->Free_ospec();
+    if(products & SREP_OSPEC){
       this->Create_ospec((this->Get_srep_size(5) - this->Get_srep_size(4) + 1));
       for(g = 0; g < (this->Get_srep_size(5) - this->Get_srep_size(4) + 1); ++g){ this->Set_ospec(g,temp_obj_spec[g]); }
+    }
       
-      // f. mini_ref_spec
-      this->Free_rspec();
+    // f. mini_ref_spec
+    this->Free_rspec();
+    if(products & SREP_RSPEC){
       if((this->Get_srep_size(5) - this->Get_srep_size(4) + 1) >= 10){
 	
 	this->Create_rspec((2 * (this->Get_srep_size(5) - this->Get_srep_size(4) + 1)));
@@ -3593,20 +3145,20 @@ void object_props_dbl::AddObject(object_props_dbl & merged,vector<int> & temp_sp
 	for(g = 0; g < (this->Get_srep_size(5) - this->Get_srep_size(4) + 11); ++g){ this->Set_rspec(g,temp_ref_spec[g]); }
 	
       }
+    }
       
-      // g. mini_vfield
-      this->Free_vfield();
+    // g. mini_vfield
+    this->Free_vfield();
+    if(products & SREP_VFIELD){
       this->Create_vfield(((this->Get_srep_size(1) - this->Get_srep_size(0) + 1) * (this->Get_srep_size(3) - this->Get_srep_size(2) + 1)));
       for(g = 0; g < ((this->Get_srep_size(1) - this->Get_srep_size(0) + 1) * (this->Get_srep_size(3) - this->Get_srep_size(2) + 1)); ++g){ this->Set_vfield(g,temp_vfield[g]); }
+    }
       
-      // h. sparse_reps_strings
-      this->Free_srep_strings();
-      this->Create_srep_strings((2 * this->Get_srep_grid(((this->Get_srep_size(1) - this->Get_srep_size(0) + 1) * (this->Get_srep_size(3) - this->Get_srep_size(2) + 1)))));
-      for(g = 0; g < (2 * this->Get_srep_grid(((this->Get_srep_size(1) - this->Get_srep_size(0) + 1) * (this->Get_srep_size(3) - this->Get_srep_size(2) + 1)))); ++g){ this->Set_srep_strings(g,temp_sparse_reps_strings[g]); }
+    // h. sparse_reps_strings
+    this->Free_srep_strings();
+    this->Create_srep_strings((2 * this->Get_srep_grid(((this->Get_srep_size(1) - this->Get_srep_size(0) + 1) * (this->Get_srep_size(3) - this->Get_srep_size(2) + 1)))));
+    for(g = 0; g < (2 * this->Get_srep_grid(((this->Get_srep_size(1) - this->Get_srep_size(0) + 1) * (this->Get_srep_size(3) - this->Get_srep_size(2) + 1)))); ++g){ this->Set_srep_strings(g,temp_sparse_reps_strings[g]); }
       
-    }
-  
-    // if(this != &merged)
   }
 
 }
@@ -3,7 +3,7 @@
 
 using namespace std;
 
-void CreateMetric(int * data_metric, int * xyz_order, int NOx, int NOy, int NOz){
+void CreateMetric(long int * data_metric, int * xyz_order, int NOx, int NOy, int NOz){
 
   // ensure that the x_order, y_order and z_order values are 1,2,3
   if((xyz_order[0] <= xyz_order[1]) && (xyz_order[0] <= xyz_order[2])){
@@ -64,7 +64,7 @@ void CreateMetric(int * data_metric, int * xyz_order, int NOx, int NOy, int NOz)
     if(xyz_order[1] == 1){ data_metric[0] = NOy; } else { data_metric[0] = NOz; }
     break;
   case 3:
-    data_metric[0] = NOy * NOz;
+    data_metric[0] = ((long int) NOy) * ((long int) NOz);
     break;
   default:
     data_metric[0] = 1;
@@ -80,7 +80,7 @@ void CreateMetric(int * data_metric, int * xyz_order, int NOx, int NOy, int NOz)
     if(xyz_order[0] == 1){ data_metric[1] = NOx; } else { data_metric[1] = NOz; }
     break;
   case 3:
-    data_metric[1] = NOx * NOz;
+    data_metric[1] = ((long int) NOx) * ((long int) NOz);
     break;
   default:
     data_metric[1] = 1;
@@ -96,7 +96,7 @@ void CreateMetric(int * data_metric, int * xyz_order, int NOx, int NOy, int NOz)
     if(xyz_order[0] == 1){ data_metric[2] = NOx; } else { data_metric[2] = NOy; }
     break;
   case 3:
-    data_metric[2] = NOx * NOy;
+    data_metric[2] = ((long int) NOx) * ((long int) NOy);
     break;
   default:
     data_metric[2] = 1;
@@ -105,7 +105,11 @@ void CreateMetric(int * data_metric, int * xyz_order, int NOx, int NOy, int NOz)
 
 }
 
+// select the x, y or z value of a triplet of values given in the datacube's axis order, as is done
+// at the start of CreateObjects
+int ReorderAxis(int * vals, int order, int axis){
 
+  if((order >= 1) && (order <= 3)){ return vals[(order - 1)]; }
+  return vals[axis];
 
-
-
+}
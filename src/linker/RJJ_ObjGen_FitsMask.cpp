@@ -0,0 +1,194 @@
+#include<iostream>
+#include "RJJ_ObjGen.h"
+
+using namespace std;
+
+// FITS files are written in blocks of 2880 bytes, and their headers consist of cards of 80 characters
+#define FITS_BLOCK 2880
+#define FITS_CARD 80
+
+// append a card to a FITS header, truncated or padded with spaces to 80 characters
+static void AddFitsCard(string & header, const string & card){
+
+  header.append(card,0,FITS_CARD);
+  if(card.size() < FITS_CARD){ header.append((FITS_CARD - card.size()),' '); }
+
+}
+
+// append a card holding an integer, string or logical value to a FITS header
+static void AddFitsCard(string & header, const char * keyword, long int value){
+
+  ostringstream card;
+
+  card << left << setw(8) << keyword << "= " << right << setw(20) << value;
+  AddFitsCard(header,card.str());
+
+}
+
+static void AddFitsCard(string & header, const char * keyword, const char * value, bool quoted){
+
+  ostringstream card;
+
+  if(quoted){ card << left << setw(8) << keyword << "= '" << left << setw(8) << value << "'"; } else { card << left << setw(8) << keyword << "= " << right << setw(20) << value; }
+  AddFitsCard(header,card.str());
+
+}
+
+// write the label of voxel index of a plane of labels, in the big-endian byte order of FITS files
+template <typename LabelT>
+static void SetFitsLabel(vector<unsigned char> & plane, long int index, LabelT label){
+
+  int b;
+
+  for(b = ((int) sizeof(LabelT)) - 1; b >= 0; --b){ plane[((index * ((long int) sizeof(LabelT))) + b)] = (unsigned char) (label & 255); label>>=8; }
+
+}
+
+// write the planes of the labelled mask, one at a time. The objects are visited in the order of the
+// first channel of their sparse representations, so that only the objects that overlap a plane are
+// decoded for it; a plane that no object overlaps is written from the zeroed plane straight away, and
+// the voxels of a plane that have been labelled are zeroed again once it has been written
+template <typename LabelT, typename FlagT, typename PropsT>
+static bool WriteFitsPlanes(ofstream & mask_file, int NOx, int NOy, int NOf, vector<PropsT *> & detections, int obj_limit, vector< pair<int,FlagT> > & order, vector<FlagT> & new_ids){
+
+  FlagT obj_batch;
+  long int i, j, k, next;
+  int x, y, z, g, nx;
+  vector<unsigned char> plane(((long int) NOx * (long int) NOy * (long int) sizeof(LabelT)),0);
+  vector<FlagT> active;
+  vector<long int> written;
+
+  next = 0;
+  for(z = 0; z < NOf; ++z){
+
+    // add the objects that start at this plane, and drop the objects that end before it
+    while((next < ((long int) order.size())) && (order[next].first <= z)){ active.push_back(order[next].second); ++next; }
+    for(i = 0, k = 0; i < ((long int) active.size()); ++i){
+
+      obj_batch = active[i] / obj_limit;
+      if(detections[obj_batch][(active[i] - (obj_batch * obj_limit))].Get_srep_size(5) >= z){ active[k++] = active[i]; }
+
+    }
+    active.resize(k);
+
+    // label the voxels of the plane that lie on the objects' strings
+    for(i = 0; i < ((long int) active.size()); ++i){
+
+      obj_batch = active[i] / obj_limit;
+      PropsT & obj = detections[obj_batch][(active[i] - (obj_batch * obj_limit))];
+      nx = obj.Get_srep_size(1) - obj.Get_srep_size(0) + 1;
+      for(y = 0; y < (obj.Get_srep_size(3) - obj.Get_srep_size(2) + 1); ++y){
+
+	for(x = 0; x < nx; ++x){
+
+	  for(g = obj.Get_srep_grid(((y * nx) + x)); g < obj.Get_srep_grid(((y * nx) + x + 1)); ++g){
+
+	    if((obj.Get_srep_strings((2 * g)) > z) || (obj.Get_srep_strings(((2 * g) + 1)) < z)){ continue; }
+	    j = (((long int) (y + obj.Get_srep_size(2))) * (long int) NOx) + ((long int) (x + obj.Get_srep_size(0)));
+	    SetFitsLabel(plane,j,(LabelT) new_ids[active[i]]);
+	    written.push_back(j);
+
+	  }
+
+	}
+
+      }
+
+    }
+
+    mask_file.write((char *) &plane[0],plane.size());
+    if(!mask_file.good()){ return false; }
+    for(j = 0; j < ((long int) written.size()); ++j){ SetFitsLabel(plane,written[j],(LabelT) 0); }
+    written.resize(0);
+
+    // for(z = 0; z < NOf; ++z)
+  }
+
+  return true;
+
+}
+
+// write the labelled mask of the objects that contain voxels to the FITS file output_file, straight from
+// their sparse representations and without holding more than one plane of the mask in memory. The
+// objects are numbered in the order of their current IDs, starting from 1, as by LabelObjs, and BITPIX
+// is chosen from the number of objects. The header_cards are added to the header after the mandatory
+// cards, and must consist of whole cards of 80 characters. The number of objects is returned, or -1 if
+// the file couldn't be written.
+template <typename FlagT, typename PropsT>
+static FlagT WriteFitsMask(string output_file, string header_cards, int NOx, int NOy, int NOf, vector<PropsT *> & detections, FlagT NOobj, int obj_limit){
+
+  FlagT i, obj_batch, NOlabels;
+  vector<FlagT> new_ids;
+  vector< pair<int,FlagT> > order;
+  string header;
+  long int data_size;
+  int bitpix;
+  bool written;
+
+  // 1. number the objects that contain voxels, and sort them by their first channel
+  new_ids.assign(NOobj,0);
+  NOlabels = 0;
+  for(i = 0; i < NOobj; ++i){
+
+    obj_batch = i / obj_limit;
+    if(detections[obj_batch][(i - (obj_batch * obj_limit))].ShowVoxels() >= 1){ new_ids[i] = ++NOlabels; order.push_back(pair<int,FlagT>(detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4),i)); }
+
+  }
+  sort(order.begin(),order.end());
+
+  // 2. write the header, using the narrowest integer type that holds the final IDs
+  if(NOlabels <= 255){ bitpix = 8; } else if(NOlabels <= 32767){ bitpix = 16; } else if(((long int) NOlabels) <= 2147483647L){ bitpix = 32; } else { bitpix = 64; }
+  AddFitsCard(header,"SIMPLE","T",false);
+  AddFitsCard(header,"BITPIX",bitpix);
+  AddFitsCard(header,"NAXIS",3);
+  AddFitsCard(header,"NAXIS1",NOx);
+  AddFitsCard(header,"NAXIS2",NOy);
+  AddFitsCard(header,"NAXIS3",NOf);
+  header.append(header_cards,0,(header_cards.size() - (header_cards.size() % FITS_CARD)));
+  AddFitsCard(header,"BUNIT","source_ID",true);
+  AddFitsCard(header,"DATAMIN",0);
+  AddFitsCard(header,"DATAMAX",(long int) NOlabels);
+  AddFitsCard(header,"END");
+  header.append(((FITS_BLOCK - (header.size() % FITS_BLOCK)) % FITS_BLOCK),' ');
+
+  ofstream mask_file(output_file.c_str(),ios::out | ios::binary | ios::trunc);
+  if(!mask_file.is_open()){
+
+    std::cerr << "ERROR: Couldn't open the mask file " << output_file << "." << std::endl;
+    return -1;
+
+  }
+  mask_file.write(header.data(),header.size());
+
+  // 3. write the planes of the mask, and pad the data to a whole number of blocks
+  switch(bitpix){
+  case 8: written = WriteFitsPlanes<unsigned char>(mask_file,NOx,NOy,NOf,detections,obj_limit,order,new_ids); break;
+  case 16: written = WriteFitsPlanes<short int>(mask_file,NOx,NOy,NOf,detections,obj_limit,order,new_ids); break;
+  case 32: written = WriteFitsPlanes<int>(mask_file,NOx,NOy,NOf,detections,obj_limit,order,new_ids); break;
+  default: written = WriteFitsPlanes<long int>(mask_file,NOx,NOy,NOf,detections,obj_limit,order,new_ids); break;
+  }
+  data_size = (long int) NOx * (long int) NOy * (long int) NOf * (long int) (bitpix / 8);
+  if(written){ header.assign(((FITS_BLOCK - (data_size % FITS_BLOCK)) % FITS_BLOCK),'\0'); mask_file.write(header.data(),header.size()); }
+  mask_file.close();
+  if(!written || mask_file.fail()){
+
+    std::cerr << "ERROR: Couldn't write the mask file " << output_file << "." << std::endl;
+    return -1;
+
+  }
+
+  return NOlabels;
+
+}
+
+// functions using floats
+
+int CreateFitsMask(std::string output_file, std::string header_cards, int NOx, int NOy, int NOf, vector<object_props *> & detections, int NOobj, int obj_limit){ return WriteFitsMask(output_file,header_cards,NOx,NOy,NOf,detections,NOobj,obj_limit); }
+
+long int CreateFitsMask(std::string output_file, std::string header_cards, int NOx, int NOy, int NOf, vector<object_props *> & detections, long int NOobj, int obj_limit){ return WriteFitsMask(output_file,header_cards,NOx,NOy,NOf,detections,NOobj,obj_limit); }
+
+// functions using doubles
+
+int CreateFitsMask(std::string output_file, std::string header_cards, int NOx, int NOy, int NOf, vector<object_props_dbl *> & detections, int NOobj, int obj_limit){ return WriteFitsMask(output_file,header_cards,NOx,NOy,NOf,detections,NOobj,obj_limit); }
+
+long int CreateFitsMask(std::string output_file, std::string header_cards, int NOx, int NOy, int NOf, vector<object_props_dbl *> & detections, long int NOobj, int obj_limit){ return WriteFitsMask(output_file,header_cards,NOx,NOy,NOf,detections,NOobj,obj_limit); }
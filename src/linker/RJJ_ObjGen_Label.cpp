@@ -0,0 +1,500 @@
+#include<iostream>
+#include<cstdio>
+#include<cstring>
+#include "RJJ_ObjGen.h"
+
+using namespace std;
+
+// write the final, sequential IDs of the objects that contain voxels into the label_vals array, by
+// decoding their sparse representations one object string at a time. The objects are numbered in
+// the order of their current IDs, starting from 1, and new_ids receives the final ID of every
+// current ID, or 0 for the objects that have been re-initialised. The label_vals array covers the
+// whole cube, as described by data_metric, and only the voxels of the objects are written to it. The
+// label_vals array may be narrower than the object IDs, provided that it can hold the final IDs.
+// Objects don't overlap, so they are written concurrently.
+template <typename FlagT, typename LabelT, typename PropsT>
+static FlagT LabelObjects(vector<PropsT *> & detections, FlagT NOobj, int obj_limit, LabelT * label_vals, long int * data_metric, vector<FlagT> & new_ids, int NOthreads){
+
+  FlagT i, obj_batch, NOlabels;
+  long int j;
+  int x, y, z, g, nx;
+
+  if(NOthreads < 1){ NOthreads = 1; }
+
+  // 1. number the objects that contain voxels
+  new_ids.assign(NOobj,0);
+  NOlabels = 0;
+  for(i = 0; i < NOobj; ++i){
+
+    obj_batch = i / obj_limit;
+    if(detections[obj_batch][(i - (obj_batch * obj_limit))].ShowVoxels() >= 1){ new_ids[i] = ++NOlabels; }
+
+  }
+
+  // 2. write each object's strings to the label array
+#pragma omp parallel for private(i,obj_batch,j,x,y,z,g,nx) schedule(dynamic,64) num_threads(NOthreads)
+  for(i = 0; i < NOobj; ++i){
+
+    if(new_ids[i] < 1){ continue; }
+    obj_batch = i / obj_limit;
+    PropsT & obj = detections[obj_batch][(i - (obj_batch * obj_limit))];
+    nx = obj.Get_srep_size(1) - obj.Get_srep_size(0) + 1;
+
+    for(y = 0; y < (obj.Get_srep_size(3) - obj.Get_srep_size(2) + 1); ++y){
+
+      for(x = 0; x < nx; ++x){
+
+	for(g = obj.Get_srep_grid(((y * nx) + x)); g < obj.Get_srep_grid(((y * nx) + x + 1)); ++g){
+
+	  j = (((long int) (y + obj.Get_srep_size(2))) * data_metric[1]) + (((long int) (x + obj.Get_srep_size(0))) * data_metric[0]);
+	  for(z = obj.Get_srep_strings((2 * g)); z <= obj.Get_srep_strings(((2 * g) + 1)); ++z){ label_vals[(j + (((long int) z) * data_metric[2]))] = (LabelT) new_ids[i]; }
+
+	}
+
+      }
+
+    }
+
+  }
+
+  return NOlabels;
+
+}
+
+// copy the properties of an object to its catalogue record; the maxima of the bounding box are one past
+// the last voxel, so that they can be used as slices
+template <typename FlagT, typename PropsT>
+static void FillRecord(PropsT & obj, FlagT new_id, catalogue_record & record){
+
+  record.ID = new_id;
+  record.Xg = obj.GetRA();
+  record.Yg = obj.GetDEC();
+  record.Zg = obj.GetFREQ();
+  record.Xm = obj.GetRAi();
+  record.Ym = obj.GetDECi();
+  record.Zm = obj.GetFREQi();
+  record.Xmin = obj.GetRAmin();
+  record.Xmax = obj.GetRAmax() + 1;
+  record.Ymin = obj.GetDECmin();
+  record.Ymax = obj.GetDECmax() + 1;
+  record.Zmin = obj.GetFREQmin();
+  record.Zmax = obj.GetFREQmax() + 1;
+  record.NRvox = obj.ShowVoxels();
+  record.Fmin = obj.GetMinI();
+  record.Fmax = obj.GetMaxI();
+  record.Ftot = obj.GetTI();
+
+}
+
+// copy the properties of the objects that contain voxels to the row of their final ID in the records
+// array, which has a row for every final ID
+template <typename FlagT, typename PropsT>
+static void CopyRecords(vector<PropsT *> & detections, FlagT NOobj, int obj_limit, vector<FlagT> & new_ids, catalogue_record * records, int NOthreads){
+
+  FlagT i, obj_batch;
+
+  if(NOthreads < 1){ NOthreads = 1; }
+
+#pragma omp parallel for private(i,obj_batch) schedule(static,1024) num_threads(NOthreads)
+  for(i = 0; i < NOobj; ++i){
+
+    if(new_ids[i] < 1){ continue; }
+    obj_batch = i / obj_limit;
+    FillRecord(detections[obj_batch][(i - (obj_batch * obj_limit))],new_ids[i],records[(new_ids[i] - 1)]);
+
+  }
+
+}
+
+// copy the object strings of the sparse representations of the objects that contain voxels to the runs
+// array, as the x and y position and the first and last channel of each string, in the order of the
+// final IDs. The strings of the object with final ID k start at offsets[(k - 1)] and end before
+// offsets[k]. If runs is NULL, only the offsets are calculated. Returns the total number of strings.
+template <typename FlagT, typename PropsT>
+static long int CopyStrings(vector<PropsT *> & detections, FlagT NOobj, int obj_limit, vector<FlagT> & new_ids, long int * offsets, int * runs, int NOthreads){
+
+  FlagT i, obj_batch, NOlabels;
+  long int r;
+  int x, y, g, nx, ny;
+
+  if(NOthreads < 1){ NOthreads = 1; }
+  NOlabels = 0;
+  for(i = 0; i < NOobj; ++i){ if(new_ids[i] > NOlabels){ NOlabels = new_ids[i]; } }
+
+  // 1. count the strings of each object --- the last grid entry of an object is its number of strings
+  if(runs == NULL){
+
+    offsets[0] = 0;
+    for(i = 0; i < NOobj; ++i){
+
+      if(new_ids[i] < 1){ continue; }
+      obj_batch = i / obj_limit;
+      PropsT & obj = detections[obj_batch][(i - (obj_batch * obj_limit))];
+      nx = obj.Get_srep_size(1) - obj.Get_srep_size(0) + 1;
+      ny = obj.Get_srep_size(3) - obj.Get_srep_size(2) + 1;
+      offsets[new_ids[i]] = obj.Get_srep_grid((nx * ny));
+
+    }
+    for(i = 1; i <= NOlabels; ++i){ offsets[i]+=offsets[(i - 1)]; }
+    return offsets[NOlabels];
+
+  }
+
+  // 2. write the strings of each object
+#pragma omp parallel for private(i,obj_batch,r,x,y,g,nx,ny) schedule(dynamic,64) num_threads(NOthreads)
+  for(i = 0; i < NOobj; ++i){
+
+    if(new_ids[i] < 1){ continue; }
+    obj_batch = i / obj_limit;
+    PropsT & obj = detections[obj_batch][(i - (obj_batch * obj_limit))];
+    nx = obj.Get_srep_size(1) - obj.Get_srep_size(0) + 1;
+    ny = obj.Get_srep_size(3) - obj.Get_srep_size(2) + 1;
+    r = offsets[(new_ids[i] - 1)];
+    for(y = 0; y < ny; ++y){
+      for(x = 0; x < nx; ++x){
+	for(g = obj.Get_srep_grid(((y * nx) + x)); g < obj.Get_srep_grid(((y * nx) + x + 1)); ++g){
+
+	  runs[(4 * r)] = x + obj.Get_srep_size(0);
+	  runs[((4 * r) + 1)] = y + obj.Get_srep_size(2);
+	  runs[((4 * r) + 2)] = obj.Get_srep_strings((2 * g));
+	  runs[((4 * r) + 3)] = obj.Get_srep_strings(((2 * g) + 1));
+	  ++r;
+
+	}
+      }
+    }
+
+  }
+
+  return offsets[NOlabels];
+
+}
+
+// the columns of the catalogue written by CreateCatalogue, in the order of the fields of catalogue_record,
+// with the width and precision of each column as formatted by the pipeline. A precision of 0 marks an
+// integer column, and a negative precision a column in exponential notation. The flux columns take the
+// flux unit that is given to CreateCatalogue
+#define CATALOGUE_COLUMNS 17
+#define CATALOGUE_BUFFER 1048576
+#define CATALOGUE_FIELD 400
+static const char * catalogue_names[CATALOGUE_COLUMNS] = {"ID","Xg","Yg","Zg","Xm","Ym","Zm","Xmin","Xmax","Ymin","Ymax","Zmin","Zmax","NRvox","Fmin","Fmax","Ftot"};
+static const char * catalogue_units[CATALOGUE_COLUMNS] = {"-","pix","pix","chan","pix","pix","chan","pix","pix","pix","pix","chan","chan","-",NULL,NULL,NULL};
+static const int catalogue_widths[CATALOGUE_COLUMNS] = {10,10,10,10,10,10,10,7,7,7,7,7,7,8,12,12,12};
+static const int catalogue_precisions[CATALOGUE_COLUMNS] = {0,3,3,3,3,3,3,0,0,0,0,0,0,0,-3,-3,-3};
+static const double powers_of_ten[23] = {1E0,1E1,1E2,1E3,1E4,1E5,1E6,1E7,1E8,1E9,1E10,1E11,1E12,1E13,1E14,1E15,1E16,1E17,1E18,1E19,1E20,1E21,1E22};
+
+// write value right-aligned to width characters, and return the position after it
+static char * FormatInteger(char * out, long int value, int width){
+
+  char digits[24];
+  int n;
+  unsigned long int magnitude;
+
+  n = 0;
+  magnitude = (value < 0) ? (0UL - ((unsigned long int) value)) : ((unsigned long int) value);
+  do { digits[n++] = '0' + ((char) (magnitude % 10)); magnitude/=10; } while(magnitude > 0);
+  if(value < 0){ digits[n++] = '-'; }
+  for(; width > n; --width){ *out++ = ' '; }
+  while(n > 0){ *out++ = digits[--n]; }
+  return out;
+
+}
+
+// round magnitude * 10^shift to the nearest integer, and ties to even, as printf does. The product or
+// quotient is rounded to a double first, so the sign of its rounding error, which is exact, decides the
+// values that only look like ties; powers of ten up to 10^22 are exact
+static double RoundScaled(double magnitude, int shift){
+
+  double scaled, error, whole, fraction;
+
+  if(shift >= 0){
+
+    scaled = magnitude * powers_of_ten[shift];
+    error = fma(magnitude,powers_of_ten[shift],-scaled);
+
+  } else {
+
+    scaled = magnitude / powers_of_ten[-shift];
+    error = -fma(scaled,powers_of_ten[-shift],-magnitude);
+
+  }
+  whole = floor(scaled);
+  fraction = scaled - whole;
+  if((fraction > 0.5) || ((fraction == 0.5) && ((error > 0.0) || ((error == 0.0) && (fmod(whole,2.0) != 0.0))))){ whole+=1.0; }
+  return whole;
+
+}
+
+// write value with snprintf, for the values that the formatting below doesn't cover; none of them needs
+// more than CATALOGUE_FIELD characters
+static char * FormatFallback(char * out, const char * format, double value, int width, int precision){
+
+  char field[CATALOGUE_FIELD];
+  int n;
+
+  n = snprintf(field,CATALOGUE_FIELD,format,width,precision,value);
+  if(n >= CATALOGUE_FIELD){ n = CATALOGUE_FIELD - 1; }
+  memcpy(out,field,n);
+  return out + n;
+
+}
+
+// write the digits of a whole number below 2^52, with precision of them after the decimal point
+static char * FormatDigits(char * out, double digits, int precision){
+
+  char reversed[32];
+  int n;
+  unsigned long int whole;
+
+  whole = (unsigned long int) digits;
+  n = 0;
+  while((whole > 0) || (n <= precision)){ reversed[n++] = '0' + ((char) (whole % 10)); whole/=10; }
+  while(n > 0){
+
+    if(n == precision){ *out++ = '.'; }
+    *out++ = reversed[--n];
+
+  }
+  return out;
+
+}
+
+// write value with precision digits after the decimal point, right-aligned to width characters, as by
+// %<width>.<precision>f; values whose digits don't fit into the fraction of a double are left to snprintf
+static char * FormatFixed(char * out, double value, int width, int precision){
+
+  char digits[40];
+  char * end;
+  double rounded;
+  int n;
+
+  if(!(fabs(value) < (4E15 / powers_of_ten[precision]))){ return FormatFallback(out,"%*.*f",value,width,precision); }
+  rounded = RoundScaled(fabs(value),precision);
+  end = digits;
+  if(signbit(value)){ *end++ = '-'; }
+  end = FormatDigits(end,rounded,precision);
+  for(n = (int) (end - digits); n < width; ++n){ *out++ = ' '; }
+  memcpy(out,digits,(end - digits));
+  return out + (end - digits);
+
+}
+
+// write value in exponential notation with precision digits after the decimal point, right-aligned to
+// width characters, as by %<width>.<precision>e
+static char * FormatExponent(char * out, double value, int width, int precision){
+
+  char digits[40];
+  char * end;
+  double magnitude, rounded;
+  int exponent, n;
+
+  magnitude = fabs(value);
+  exponent = 0;
+  rounded = 0.0;
+  if(!(magnitude < 1E300)){ return FormatFallback(out,"%*.*e",value,width,precision); }
+  if(magnitude > 0.0){
+
+    // the exponent may still change by one below, and the power of ten must remain exact
+    exponent = (magnitude < 1E-300) ? -300 : ((int) floor(log10(magnitude)));
+    if(((exponent - precision) > 21) || ((precision - exponent) > 21)){ return FormatFallback(out,"%*.*e",value,width,precision); }
+
+    // log10 may be off by one next to the powers of ten, and the rounding may carry into the next power
+    rounded = RoundScaled(magnitude,(precision - exponent));
+    if(rounded < powers_of_ten[precision]){ --exponent; rounded = RoundScaled(magnitude,(precision - exponent)); }
+    if(rounded >= powers_of_ten[(precision + 1)]){ ++exponent; rounded = RoundScaled(magnitude,(precision - exponent)); }
+
+  }
+  end = digits;
+  if(signbit(value)){ *end++ = '-'; }
+  end = FormatDigits(end,rounded,precision);
+  *end++ = 'e';
+  *end++ = (exponent < 0) ? '-' : '+';
+  if(abs(exponent) < 10){ *end++ = '0'; }
+  end = FormatInteger(end,abs(exponent),0);
+  for(n = (int) (end - digits); n < width; ++n){ *out++ = ' '; }
+  memcpy(out,digits,(end - digits));
+  return out + (end - digits);
+
+}
+
+// write the header of the ASCII catalogue, with a line each for the names, units and numbers of the
+// columns, each right-aligned to one more character than its values; the binary catalogue has no header
+void PrintCatalogueHeader(std::string & header, int * columns, int NOcolumns, std::string flux_unit, int cat_mode){
+
+  string lines[3];
+  string number;
+  int i, c, pad;
+
+  header.clear();
+  if(cat_mode != 0){ return; }
+  for(i = 0; i < NOcolumns; ++i){
+
+    c = columns[i];
+    number = "(" + to_string(i) + ")";
+    const string fields[3] = {catalogue_names[c],((catalogue_units[c] != NULL) ? string(catalogue_units[c]) : flux_unit),number};
+    for(pad = 0; pad < 3; ++pad){
+
+      if(((int) fields[pad].size()) < (catalogue_widths[c] + 1)){ lines[pad].append(((catalogue_widths[c] + 1) - fields[pad].size()),' '); }
+      lines[pad].append(fields[pad]);
+
+    }
+
+  }
+  header = "# SoFia catalogue\n";
+  for(pad = 0; pad < 3; ++pad){ header+="# " + ((lines[pad].size() > 3) ? lines[pad].substr(3) : string()) + "\n"; }
+
+}
+
+// write the catalogue of the objects that contain voxels to output_file in one pass, numbering them as
+// LabelObjs does. With a cat_mode of 0, the given columns are written as ASCII, in the format of the
+// pipeline's catalogues, and with a cat_mode of 1 every catalogue_record is written as 17 little-endian
+// 8-byte fields. The rows are formatted into a buffer that is written whenever it fills up, and the
+// number of rows is returned, or -1 if the file couldn't be written.
+template <typename FlagT, typename PropsT>
+static FlagT WriteCatalogue(string output_file, string flux_unit, vector<PropsT *> & detections, FlagT NOobj, int obj_limit, int * columns, int NOcolumns, int cat_mode){
+
+  FlagT i, obj_batch, NOrows;
+  catalogue_record record;
+  vector<char> buffer;
+  string header;
+  char * out;
+  unsigned char * field;
+  unsigned long int bits;
+  long int integer;
+  double value;
+  int c, b;
+  bool written;
+  FILE * cat_file;
+
+  cat_file = fopen(output_file.c_str(),"wb");
+  if(cat_file == NULL){
+
+    std::cerr << "ERROR: Couldn't open the catalogue file " << output_file << "." << std::endl;
+    return -1;
+
+  }
+  PrintCatalogueHeader(header,columns,NOcolumns,flux_unit,cat_mode);
+  written = (fwrite(header.data(),1,header.size(),cat_file) == header.size());
+
+  // every row fits into the space beyond CATALOGUE_BUFFER, whichever columns are written
+  buffer.resize((CATALOGUE_BUFFER + (((NOcolumns > CATALOGUE_COLUMNS) ? NOcolumns : CATALOGUE_COLUMNS) * (CATALOGUE_FIELD + 1)) + 1));
+  out = &buffer[0];
+  NOrows = 0;
+  for(i = 0; (i < NOobj) && written; ++i){
+
+    obj_batch = i / obj_limit;
+    if(detections[obj_batch][(i - (obj_batch * obj_limit))].ShowVoxels() < 1){ continue; }
+    FillRecord(detections[obj_batch][(i - (obj_batch * obj_limit))],++NOrows,record);
+
+    if(cat_mode != 0){
+
+      for(c = 0; c < CATALOGUE_COLUMNS; ++c){
+
+	memcpy(&bits,(((char *) &record) + (8 * c)),8);
+	field = (unsigned char *) out;
+	for(b = 0; b < 8; ++b){ field[b] = (unsigned char) (bits & 255); bits>>=8; }
+	out+=8;
+
+      }
+
+    } else {
+
+      for(c = 0; c < NOcolumns; ++c){
+
+	if(catalogue_precisions[columns[c]] == 0){
+
+	  memcpy(&integer,(((char *) &record) + (8 * columns[c])),8);
+	  out = FormatInteger(out,integer,catalogue_widths[columns[c]]);
+
+	} else {
+
+	  memcpy(&value,(((char *) &record) + (8 * columns[c])),8);
+	  if(catalogue_precisions[columns[c]] > 0){ out = FormatFixed(out,value,catalogue_widths[columns[c]],catalogue_precisions[columns[c]]); } else { out = FormatExponent(out,value,catalogue_widths[columns[c]],-catalogue_precisions[columns[c]]); }
+
+	}
+	*out++ = ' ';
+
+      }
+      *out++ = '\n';
+
+    }
+
+    if((out - &buffer[0]) >= CATALOGUE_BUFFER){
+
+      written = (fwrite(&buffer[0],1,(out - &buffer[0]),cat_file) == ((size_t) (out - &buffer[0])));
+      out = &buffer[0];
+
+    }
+
+  }
+  if(written && (out > &buffer[0])){ written = (fwrite(&buffer[0],1,(out - &buffer[0]),cat_file) == ((size_t) (out - &buffer[0]))); }
+  if((fclose(cat_file) != 0) || !written){
+
+    std::cerr << "ERROR: Couldn't write the catalogue file " << output_file << "." << std::endl;
+    return -1;
+
+  }
+
+  return NOrows;
+
+}
+
+// functions using floats
+
+int LabelObjs(vector<object_props *> & detections, int NOobj, int obj_limit, int * label_vals, long int * data_metric, vector<int> & new_ids, int NOthreads){ return LabelObjects(detections,NOobj,obj_limit,label_vals,data_metric,new_ids,NOthreads); }
+
+long int LabelObjs(vector<object_props *> & detections, long int NOobj, int obj_limit, long int * label_vals, long int * data_metric, vector<long int> & new_ids, int NOthreads){ return LabelObjects(detections,NOobj,obj_limit,label_vals,data_metric,new_ids,NOthreads); }
+
+int LabelObjs(vector<object_props *> & detections, int NOobj, int obj_limit, unsigned short * label_vals, long int * data_metric, vector<int> & new_ids, int NOthreads){ return LabelObjects(detections,NOobj,obj_limit,label_vals,data_metric,new_ids,NOthreads); }
+
+long int LabelObjs(vector<object_props *> & detections, long int NOobj, int obj_limit, unsigned short * label_vals, long int * data_metric, vector<long int> & new_ids, int NOthreads){ return LabelObjects(detections,NOobj,obj_limit,label_vals,data_metric,new_ids,NOthreads); }
+
+int LabelObjs(vector<object_props *> & detections, int NOobj, int obj_limit, unsigned int * label_vals, long int * data_metric, vector<int> & new_ids, int NOthreads){ return LabelObjects(detections,NOobj,obj_limit,label_vals,data_metric,new_ids,NOthreads); }
+
+long int LabelObjs(vector<object_props *> & detections, long int NOobj, int obj_limit, unsigned int * label_vals, long int * data_metric, vector<long int> & new_ids, int NOthreads){ return LabelObjects(detections,NOobj,obj_limit,label_vals,data_metric,new_ids,NOthreads); }
+
+int LabelObjs(vector<object_props *> & detections, int NOobj, int obj_limit, unsigned long int * label_vals, long int * data_metric, vector<int> & new_ids, int NOthreads){ return LabelObjects(detections,NOobj,obj_limit,label_vals,data_metric,new_ids,NOthreads); }
+
+long int LabelObjs(vector<object_props *> & detections, long int NOobj, int obj_limit, unsigned long int * label_vals, long int * data_metric, vector<long int> & new_ids, int NOthreads){ return LabelObjects(detections,NOobj,obj_limit,label_vals,data_metric,new_ids,NOthreads); }
+
+void CopyCatalogue(vector<object_props *> & detections, int NOobj, int obj_limit, vector<int> & new_ids, catalogue_record * records, int NOthreads){ CopyRecords(detections,NOobj,obj_limit,new_ids,records,NOthreads); }
+
+void CopyCatalogue(vector<object_props *> & detections, long int NOobj, int obj_limit, vector<long int> & new_ids, catalogue_record * records, int NOthreads){ CopyRecords(detections,NOobj,obj_limit,new_ids,records,NOthreads); }
+
+long int CopyRuns(vector<object_props *> & detections, int NOobj, int obj_limit, vector<int> & new_ids, long int * offsets, int * runs, int NOthreads){ return CopyStrings(detections,NOobj,obj_limit,new_ids,offsets,runs,NOthreads); }
+
+long int CopyRuns(vector<object_props *> & detections, long int NOobj, int obj_limit, vector<long int> & new_ids, long int * offsets, int * runs, int NOthreads){ return CopyStrings(detections,NOobj,obj_limit,new_ids,offsets,runs,NOthreads); }
+
+int CreateCatalogue(std::string output_file, std::string flux_unit, vector<object_props *> & detections, int NOobj, int obj_limit, int * columns, int NOcolumns, int cat_mode){ return WriteCatalogue(output_file,flux_unit,detections,NOobj,obj_limit,columns,NOcolumns,cat_mode); }
+
+long int CreateCatalogue(std::string output_file, std::string flux_unit, vector<object_props *> & detections, long int NOobj, int obj_limit, int * columns, int NOcolumns, int cat_mode){ return WriteCatalogue(output_file,flux_unit,detections,NOobj,obj_limit,columns,NOcolumns,cat_mode); }
+
+// functions using doubles
+
+int LabelObjs(vector<object_props_dbl *> & detections, int NOobj, int obj_limit, int * label_vals, long int * data_metric, vector<int> & new_ids, int NOthreads){ return LabelObjects(detections,NOobj,obj_limit,label_vals,data_metric,new_ids,NOthreads); }
+
+long int LabelObjs(vector<object_props_dbl *> & detections, long int NOobj, int obj_limit, long int * label_vals, long int * data_metric, vector<long int> & new_ids, int NOthreads){ return LabelObjects(detections,NOobj,obj_limit,label_vals,data_metric,new_ids,NOthreads); }
+
+int LabelObjs(vector<object_props_dbl *> & detections, int NOobj, int obj_limit, unsigned short * label_vals, long int * data_metric, vector<int> & new_ids, int NOthreads){ return LabelObjects(detections,NOobj,obj_limit,label_vals,data_metric,new_ids,NOthreads); }
+
+long int LabelObjs(vector<object_props_dbl *> & detections, long int NOobj, int obj_limit, unsigned short * label_vals, long int * data_metric, vector<long int> & new_ids, int NOthreads){ return LabelObjects(detections,NOobj,obj_limit,label_vals,data_metric,new_ids,NOthreads); }
+
+int LabelObjs(vector<object_props_dbl *> & detections, int NOobj, int obj_limit, unsigned int * label_vals, long int * data_metric, vector<int> & new_ids, int NOthreads){ return LabelObjects(detections,NOobj,obj_limit,label_vals,data_metric,new_ids,NOthreads); }
+
+long int LabelObjs(vector<object_props_dbl *> & detections, long int NOobj, int obj_limit, unsigned int * label_vals, long int * data_metric, vector<long int> & new_ids, int NOthreads){ return LabelObjects(detections,NOobj,obj_limit,label_vals,data_metric,new_ids,NOthreads); }
+
+int LabelObjs(vector<object_props_dbl *> & detections, int NOobj, int obj_limit, unsigned long int * label_vals, long int * data_metric, vector<int> & new_ids, int NOthreads){ return LabelObjects(detections,NOobj,obj_limit,label_vals,data_metric,new_ids,NOthreads); }
+
+long int LabelObjs(vector<object_props_dbl *> & detections, long int NOobj, int obj_limit, unsigned long int * label_vals, long int * data_metric, vector<long int> & new_ids, int NOthreads){ return LabelObjects(detections,NOobj,obj_limit,label_vals,data_metric,new_ids,NOthreads); }
+
+void CopyCatalogue(vector<object_props_dbl *> & detections, int NOobj, int obj_limit, vector<int> & new_ids, catalogue_record * records, int NOthreads){ CopyRecords(detections,NOobj,obj_limit,new_ids,records,NOthreads); }
+
+void CopyCatalogue(vector<object_props_dbl *> & detections, long int NOobj, int obj_limit, vector<long int> & new_ids, catalogue_record * records, int NOthreads){ CopyRecords(detections,NOobj,obj_limit,new_ids,records,NOthreads); }
+
+long int CopyRuns(vector<object_props_dbl *> & detections, int NOobj, int obj_limit, vector<int> & new_ids, long int * offsets, int * runs, int NOthreads){ return CopyStrings(detections,NOobj,obj_limit,new_ids,offsets,runs,NOthreads); }
+
+long int CopyRuns(vector<object_props_dbl *> & detections, long int NOobj, int obj_limit, vector<long int> & new_ids, long int * offsets, int * runs, int NOthreads){ return CopyStrings(detections,NOobj,obj_limit,new_ids,offsets,runs,NOthreads); }
+
+int CreateCatalogue(std::string output_file, std::string flux_unit, vector<object_props_dbl *> & detections, int NOobj, int obj_limit, int * columns, int NOcolumns, int cat_mode){ return WriteCatalogue(output_file,flux_unit,detections,NOobj,obj_limit,columns,NOcolumns,cat_mode); }
+
+long int CreateCatalogue(std::string output_file, std::string flux_unit, vector<object_props_dbl *> & detections, long int NOobj, int obj_limit, int * columns, int NOcolumns, int cat_mode){ return WriteCatalogue(output_file,flux_unit,detections,NOobj,obj_limit,columns,NOcolumns,cat_mode); }
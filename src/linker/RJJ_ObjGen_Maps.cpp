@@ -0,0 +1,275 @@
+#include<iostream>
+#include<cmath>
+#include "RJJ_ObjGen.h"
+
+using namespace std;
+
+// the sums from which the maps are made, over the lines of sight of the moment maps and over the
+// pixels of the position-velocity images. Only the sums needed by the requested maps are allocated,
+// so that the memory used is proportional to the size of the maps rather than that of the data cube
+class map_sums {
+
+public:
+  vector<double> flux, first, second, RAPV, DECPV;
+
+  map_sums(int NOx, int NOy, int NOz, bool moments, bool higher, bool RA_PV, bool Dec_PV){
+
+    if(moments){ flux.assign(((long int) NOx * (long int) NOy),0.0); }
+    if(higher){ first.assign(((long int) NOx * (long int) NOy),0.0); second.assign(((long int) NOx * (long int) NOy),0.0); }
+    if(RA_PV){ RAPV.assign(((long int) NOx * (long int) NOz),0.0); }
+    if(Dec_PV){ DECPV.assign(((long int) NOy * (long int) NOz),0.0); }
+
+  }
+
+};
+
+// add the voxels of a run along the spectral axis to the sums. Blank voxels are treated as 0, as by
+// numpy.nan_to_num, and the moments are accumulated in channels
+template <typename DataT>
+static void AddRun(DataT * data_vals, long int * data_metric, int x, int y, int z_start, int z_end, int NOx, int NOy, map_sums & sums){
+
+  long int pixel;
+  double value, flux, first, second;
+  int z;
+
+  pixel = ((long int) y * (long int) NOx) + (long int) x;
+  flux = first = second = 0.0;
+  for(z = z_start; z <= z_end; ++z){
+
+    value = (double) data_vals[((x * data_metric[0]) + (y * data_metric[1]) + (z * data_metric[2]))];
+    if(value != value){ continue; }
+    flux+=value;
+    first+=(value * (double) z);
+    second+=(value * (double) z * (double) z);
+    if(sums.RAPV.size() > 0){ sums.RAPV[(((long int) z * (long int) NOx) + (long int) x)]+=value; }
+    if(sums.DECPV.size() > 0){ sums.DECPV[(((long int) z * (long int) NOy) + (long int) y)]+=value; }
+
+  }
+
+  if(sums.flux.size() > 0){ sums.flux[pixel]+=flux; }
+  if(sums.first.size() > 0){ sums.first[pixel]+=first; sums.second[pixel]+=second; }
+
+}
+
+// create the moment-0, moment-1 and moment-2 maps and the RA-velocity and Dec-velocity images of
+// the voxels in the runs along the spectral axis, each of which is the x and y position and the first
+// and last channel, or of the voxels of flag_vals that aren't 0 if flag_vals isn't NULL. The data and
+// flags are read through their own metrics, so that neither has to be copied into a contiguous cube,
+// and the flags may be of any integer type. Only the voxels of the runs are visited, so that the time
+// taken is proportional to the number of voxels in the objects. Any of the maps may be NULL. The
+// moment-1 and moment-2 maps are in channels, and are NaN where the moment-0 map is 0. 0 is returned,
+// or -1 if a run lies outside of the data cube.
+template <typename DataT, typename FlagT>
+static int MakeMaps(DataT * data_vals, long int * data_metric, FlagT * flag_vals, long int * flag_metric, int * runs, long int NOruns, int NOx, int NOy, int NOz, float * mom0, float * mom1, float * mom2, float * RAPV, float * DECPV){
+
+  map_sums sums(NOx,NOy,NOz,((mom0 != NULL) || (mom1 != NULL) || (mom2 != NULL)),((mom1 != NULL) || (mom2 != NULL)),(RAPV != NULL),(DECPV != NULL));
+  long int i;
+  double mean;
+  int x, y, z, z_start;
+
+  // 1. accumulate the sums, over the runs or over the runs of flagged voxels of each line of sight
+  if(flag_vals == NULL){
+
+    for(i = 0; i < NOruns; ++i){
+
+      if((runs[(4 * i)] < 0) || (runs[(4 * i)] >= NOx) || (runs[((4 * i) + 1)] < 0) || (runs[((4 * i) + 1)] >= NOy) || (runs[((4 * i) + 2)] < 0) || (runs[((4 * i) + 3)] >= NOz) || (runs[((4 * i) + 2)] > runs[((4 * i) + 3)])){
+
+	std::cerr << "ERROR: The run " << i << " lies outside of the data cube." << std::endl;
+	return -1;
+
+      }
+      AddRun(data_vals,data_metric,runs[(4 * i)],runs[((4 * i) + 1)],runs[((4 * i) + 2)],runs[((4 * i) + 3)],NOx,NOy,sums);
+
+    }
+
+  } else {
+
+    for(y = 0; y < NOy; ++y){
+
+      for(x = 0; x < NOx; ++x){
+
+	for(z = 0; z < NOz; ++z){
+
+	  if(flag_vals[((x * flag_metric[0]) + (y * flag_metric[1]) + (z * flag_metric[2]))] == 0){ continue; }
+	  for(z_start = z; (z < (NOz - 1)) && (flag_vals[((x * flag_metric[0]) + (y * flag_metric[1]) + ((z + 1) * flag_metric[2]))] != 0); ++z){ }
+	  AddRun(data_vals,data_metric,x,y,z_start,z,NOx,NOy,sums);
+
+	}
+
+      }
+
+    }
+
+  }
+
+  // 2. make the maps from the sums
+  for(i = 0; i < ((long int) sums.flux.size()); ++i){
+
+    if(mom0 != NULL){ mom0[i] = (float) sums.flux[i]; }
+    if((mom1 == NULL) && (mom2 == NULL)){ continue; }
+    if(sums.flux[i] == 0.0){
+
+      if(mom1 != NULL){ mom1[i] = NAN; }
+      if(mom2 != NULL){ mom2[i] = NAN; }
+      continue;
+
+    }
+    mean = sums.first[i] / sums.flux[i];
+    if(mom1 != NULL){ mom1[i] = (float) mean; }
+    if(mom2 != NULL){ mom2[i] = (float) sqrt(max(((sums.second[i] / sums.flux[i]) - (mean * mean)),0.0)); }
+
+  }
+  for(i = 0; i < ((long int) sums.RAPV.size()); ++i){ RAPV[i] = (float) sums.RAPV[i]; }
+  for(i = 0; i < ((long int) sums.DECPV.size()); ++i){ DECPV[i] = (float) sums.DECPV[i]; }
+
+  return 0;
+
+}
+
+// add the postage stamp images of the objects that contain voxels to a map of the whole data cube,
+// and return the largest value of the map. The moment-0 map is NOx by NOy, the RA-velocity image NOx
+// by NOz and the Dec-velocity image NOy by NOz, and the postage stamps must have been built
+template <typename FlagT, typename PropsT>
+static float AddStamps(float * plot_array, FlagT NOobj, vector<PropsT *> & detections, int size_a, int size_b, int obj_limit, int image){
+
+  FlagT i, obj_batch;
+  long int j;
+  int a, b, na, nb, start_a, start_b;
+  float max_val;
+
+  for(j = 0; j < ((long int) size_a * (long int) size_b); ++j){ plot_array[j] = 0.0; }
+
+  for(i = 0; i < NOobj; ++i){
+
+    obj_batch = i / obj_limit;
+    PropsT & obj = detections[obj_batch][(i - (obj_batch * obj_limit))];
+    if(obj.ShowVoxels() < 1){ continue; }
+
+    // the axes of the stamp are x and y, x and z, or y and z
+    start_a = obj.Get_srep_size(((image == 2) ? 2 : 0));
+    start_b = obj.Get_srep_size(((image == 0) ? 2 : 4));
+    na = obj.Get_srep_size(((image == 2) ? 3 : 1)) - start_a + 1;
+    nb = obj.Get_srep_size(((image == 0) ? 3 : 5)) - start_b + 1;
+    for(b = 0; b < nb; ++b){
+
+      for(a = 0; a < na; ++a){
+
+	j = (((long int) (b + start_b)) * (long int) size_a) + (long int) (a + start_a);
+	switch(image){
+	case 0: plot_array[j]+=(float) obj.Get_mom0(((b * na) + a)); break;
+	case 1: plot_array[j]+=(float) obj.Get_RAPV(((b * na) + a)); break;
+	default: plot_array[j]+=(float) obj.Get_DECPV(((b * na) + a)); break;
+	}
+
+      }
+
+    }
+
+    // for(i = 0; i < NOobj; ++i)
+  }
+
+  max_val = 0.0;
+  for(j = 0; j < ((long int) size_a * (long int) size_b); ++j){ if(plot_array[j] > max_val){ max_val = plot_array[j]; } }
+
+  return max_val;
+
+}
+
+// the outline of the bounding box of object obj in one of the maps, as the five corners of a closed
+// rectangle that follows the edges of the pixels, relative to the pixel min_a, min_b of the map and
+// clipped to the size_a by size_b map. The number of corners is returned, or 0 if the object doesn't
+// contain voxels
+template <typename FlagT, typename PropsT>
+static int BoundsOutline(vector<PropsT *> & detections, int size_a, int size_b, int min_a, int min_b, float * plot_x, float * plot_y, FlagT obj, int obj_limit, int axis_a, int axis_b){
+
+  FlagT obj_batch;
+  float a_min, a_max, b_min, b_max;
+
+  obj_batch = obj / obj_limit;
+  PropsT & object = detections[obj_batch][(obj - (obj_batch * obj_limit))];
+  if(object.ShowVoxels() < 1){ return 0; }
+
+  a_min = max(((float) (object.Get_srep_size((2 * axis_a)) - min_a) - 0.5f),-0.5f);
+  a_max = min(((float) (object.Get_srep_size(((2 * axis_a) + 1)) - min_a) + 0.5f),((float) size_a - 0.5f));
+  b_min = max(((float) (object.Get_srep_size((2 * axis_b)) - min_b) - 0.5f),-0.5f);
+  b_max = min(((float) (object.Get_srep_size(((2 * axis_b) + 1)) - min_b) + 0.5f),((float) size_b - 0.5f));
+
+  plot_x[0] = a_min; plot_y[0] = b_min;
+  plot_x[1] = a_max; plot_y[1] = b_min;
+  plot_x[2] = a_max; plot_y[2] = b_max;
+  plot_x[3] = a_min; plot_y[3] = b_max;
+  plot_x[4] = a_min; plot_y[4] = b_min;
+
+  return 5;
+
+}
+
+// functions that don't depend on the objects
+
+int CreateMomentMaps(float * data_vals, long int * data_metric, unsigned char * flag_vals, long int * flag_metric, int * runs, long int NOruns, int NOx, int NOy, int NOz, float * mom0, float * mom1, float * mom2, float * RAPV, float * DECPV){ return MakeMaps(data_vals,data_metric,flag_vals,flag_metric,runs,NOruns,NOx,NOy,NOz,mom0,mom1,mom2,RAPV,DECPV); }
+
+int CreateMomentMaps(float * data_vals, long int * data_metric, unsigned short * flag_vals, long int * flag_metric, int * runs, long int NOruns, int NOx, int NOy, int NOz, float * mom0, float * mom1, float * mom2, float * RAPV, float * DECPV){ return MakeMaps(data_vals,data_metric,flag_vals,flag_metric,runs,NOruns,NOx,NOy,NOz,mom0,mom1,mom2,RAPV,DECPV); }
+
+int CreateMomentMaps(float * data_vals, long int * data_metric, int * flag_vals, long int * flag_metric, int * runs, long int NOruns, int NOx, int NOy, int NOz, float * mom0, float * mom1, float * mom2, float * RAPV, float * DECPV){ return MakeMaps(data_vals,data_metric,flag_vals,flag_metric,runs,NOruns,NOx,NOy,NOz,mom0,mom1,mom2,RAPV,DECPV); }
+
+int CreateMomentMaps(float * data_vals, long int * data_metric, long int * flag_vals, long int * flag_metric, int * runs, long int NOruns, int NOx, int NOy, int NOz, float * mom0, float * mom1, float * mom2, float * RAPV, float * DECPV){ return MakeMaps(data_vals,data_metric,flag_vals,flag_metric,runs,NOruns,NOx,NOy,NOz,mom0,mom1,mom2,RAPV,DECPV); }
+
+int CreateMomentMaps(double * data_vals, long int * data_metric, unsigned char * flag_vals, long int * flag_metric, int * runs, long int NOruns, int NOx, int NOy, int NOz, float * mom0, float * mom1, float * mom2, float * RAPV, float * DECPV){ return MakeMaps(data_vals,data_metric,flag_vals,flag_metric,runs,NOruns,NOx,NOy,NOz,mom0,mom1,mom2,RAPV,DECPV); }
+
+int CreateMomentMaps(double * data_vals, long int * data_metric, unsigned short * flag_vals, long int * flag_metric, int * runs, long int NOruns, int NOx, int NOy, int NOz, float * mom0, float * mom1, float * mom2, float * RAPV, float * DECPV){ return MakeMaps(data_vals,data_metric,flag_vals,flag_metric,runs,NOruns,NOx,NOy,NOz,mom0,mom1,mom2,RAPV,DECPV); }
+
+int CreateMomentMaps(double * data_vals, long int * data_metric, int * flag_vals, long int * flag_metric, int * runs, long int NOruns, int NOx, int NOy, int NOz, float * mom0, float * mom1, float * mom2, float * RAPV, float * DECPV){ return MakeMaps(data_vals,data_metric,flag_vals,flag_metric,runs,NOruns,NOx,NOy,NOz,mom0,mom1,mom2,RAPV,DECPV); }
+
+int CreateMomentMaps(double * data_vals, long int * data_metric, long int * flag_vals, long int * flag_metric, int * runs, long int NOruns, int NOx, int NOy, int NOz, float * mom0, float * mom1, float * mom2, float * RAPV, float * DECPV){ return MakeMaps(data_vals,data_metric,flag_vals,flag_metric,runs,NOruns,NOx,NOy,NOz,mom0,mom1,mom2,RAPV,DECPV); }
+
+// functions using floats
+
+float CreateMoment0Map(float * plot_array, int NOobj, vector<object_props *> & detections, int NOx, int NOy, int obj_limit){ return AddStamps(plot_array,NOobj,detections,NOx,NOy,obj_limit,0); }
+
+float CreateMoment0Map(float * plot_array, long int NOobj, vector<object_props *> & detections, int NOx, int NOy, int obj_limit){ return AddStamps(plot_array,NOobj,detections,NOx,NOy,obj_limit,0); }
+
+float CreateRAPVPlot(float * plot_array, int NOobj, vector<object_props *> & detections, int NOx, int NOz, int obj_limit){ return AddStamps(plot_array,NOobj,detections,NOx,NOz,obj_limit,1); }
+
+float CreateRAPVPlot(float * plot_array, long int NOobj, vector<object_props *> & detections, int NOx, int NOz, int obj_limit){ return AddStamps(plot_array,NOobj,detections,NOx,NOz,obj_limit,1); }
+
+float CreateDecPVPlot(float * plot_array, int NOobj, vector<object_props *> & detections, int NOy, int NOz, int obj_limit){ return AddStamps(plot_array,NOobj,detections,NOy,NOz,obj_limit,2); }
+
+float CreateDecPVPlot(float * plot_array, long int NOobj, vector<object_props *> & detections, int NOy, int NOz, int obj_limit){ return AddStamps(plot_array,NOobj,detections,NOy,NOz,obj_limit,2); }
+
+int CreateMoment0Bounds(vector<object_props *> & detections, int size_x, int size_y, int min_x, int min_y, float * plot_x, float * plot_y, int obj, int obj_limit){ return BoundsOutline(detections,size_x,size_y,min_x,min_y,plot_x,plot_y,obj,obj_limit,0,1); }
+
+int CreateMoment0Bounds(vector<object_props *> & detections, int size_x, int size_y, int min_x, int min_y, float * plot_x, float * plot_y, long int obj, int obj_limit){ return BoundsOutline(detections,size_x,size_y,min_x,min_y,plot_x,plot_y,obj,obj_limit,0,1); }
+
+int CreateRAPVBounds(vector<object_props *> & detections, int size_x, int size_y, int size_z, int min_x, int min_z, float * plot_x, float * plot_y, int obj, int obj_limit){ return BoundsOutline(detections,size_x,size_z,min_x,min_z,plot_x,plot_y,obj,obj_limit,0,2); }
+
+int CreateRAPVBounds(vector<object_props *> & detections, int size_x, int size_y, int size_z, int min_x, int min_z, float * plot_x, float * plot_y, long int obj, int obj_limit){ return BoundsOutline(detections,size_x,size_z,min_x,min_z,plot_x,plot_y,obj,obj_limit,0,2); }
+
+int CreateDecPVBounds(vector<object_props *> & detections, int size_x, int size_y, int size_z, int min_y, int min_z, float * plot_x, float * plot_y, int obj, int obj_limit){ return BoundsOutline(detections,size_y,size_z,min_y,min_z,plot_x,plot_y,obj,obj_limit,1,2); }
+
+int CreateDecPVBounds(vector<object_props *> & detections, int size_x, int size_y, int size_z, int min_y, int min_z, float * plot_x, float * plot_y, long int obj, int obj_limit){ return BoundsOutline(detections,size_y,size_z,min_y,min_z,plot_x,plot_y,obj,obj_limit,1,2); }
+
+// functions using doubles
+
+float CreateMoment0Map(float * plot_array, int NOobj, vector<object_props_dbl *> & detections, int NOx, int NOy, int obj_limit){ return AddStamps(plot_array,NOobj,detections,NOx,NOy,obj_limit,0); }
+
+float CreateMoment0Map(float * plot_array, long int NOobj, vector<object_props_dbl *> & detections, int NOx, int NOy, int obj_limit){ return AddStamps(plot_array,NOobj,detections,NOx,NOy,obj_limit,0); }
+
+float CreateRAPVPlot(float * plot_array, int NOobj, vector<object_props_dbl *> & detections, int NOx, int NOz, int obj_limit){ return AddStamps(plot_array,NOobj,detections,NOx,NOz,obj_limit,1); }
+
+float CreateRAPVPlot(float * plot_array, long int NOobj, vector<object_props_dbl *> & detections, int NOx, int NOz, int obj_limit){ return AddStamps(plot_array,NOobj,detections,NOx,NOz,obj_limit,1); }
+
+float CreateDecPVPlot(float * plot_array, int NOobj, vector<object_props_dbl *> & detections, int NOy, int NOz, int obj_limit){ return AddStamps(plot_array,NOobj,detections,NOy,NOz,obj_limit,2); }
+
+float CreateDecPVPlot(float * plot_array, long int NOobj, vector<object_props_dbl *> & detections, int NOy, int NOz, int obj_limit){ return AddStamps(plot_array,NOobj,detections,NOy,NOz,obj_limit,2); }
+
+int CreateMoment0Bounds(vector<object_props_dbl *> & detections, int size_x, int size_y, int min_x, int min_y, float * plot_x, float * plot_y, int obj, int obj_limit){ return BoundsOutline(detections,size_x,size_y,min_x,min_y,plot_x,plot_y,obj,obj_limit,0,1); }
+
+int CreateMoment0Bounds(vector<object_props_dbl *> & detections, int size_x, int size_y, int min_x, int min_y, float * plot_x, float * plot_y, long int obj, int obj_limit){ return BoundsOutline(detections,size_x,size_y,min_x,min_y,plot_x,plot_y,obj,obj_limit,0,1); }
+
+int CreateRAPVBounds(vector<object_props_dbl *> & detections, int size_x, int size_y, int size_z, int min_x, int min_z, float * plot_x, float * plot_y, int obj, int obj_limit){ return BoundsOutline(detections,size_x,size_z,min_x,min_z,plot_x,plot_y,obj,obj_limit,0,2); }
+
+int CreateRAPVBounds(vector<object_props_dbl *> & detections, int size_x, int size_y, int size_z, int min_x, int min_z, float * plot_x, float * plot_y, long int obj, int obj_limit){ return BoundsOutline(detections,size_x,size_z,min_x,min_z,plot_x,plot_y,obj,obj_limit,0,2); }
+
+int CreateDecPVBounds(vector<object_props_dbl *> & detections, int size_x, int size_y, int size_z, int min_y, int min_z, float * plot_x, float * plot_y, int obj, int obj_limit){ return BoundsOutline(detections,size_y,size_z,min_y,min_z,plot_x,plot_y,obj,obj_limit,1,2); }
+
+int CreateDecPVBounds(vector<object_props_dbl *> & detections, int size_x, int size_y, int size_z, int min_y, int min_z, float * plot_x, float * plot_y, long int obj, int obj_limit){ return BoundsOutline(detections,size_y,size_z,min_y,min_z,plot_x,plot_y,obj,obj_limit,1,2); }
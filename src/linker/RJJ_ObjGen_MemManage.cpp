@@ -1,102 +1,227 @@
 #include<iostream>
+#include<chrono>
 #include "RJJ_ObjGen.h"
 
 using namespace std;
 
+// set the limits below which objects are demoted to compact records --- a voxel limit of 0 keeps every
+// object in full
+template <typename T, typename PropsT>
+static void SetCompact(vector<PropsT *> & detections, int compact_voxels, T compact_peak){
+
+  srep_arena<T> & arena = *(detections[0][0].GetArena());
+
+  arena.compact_voxels = compact_voxels;
+  arena.compact_peak = compact_peak;
+  arena.compact.resize(0);
+
+}
+
+// copy the total intensity, peak, number of voxels and sign of each compact record to consecutive
+// elements of the vals array, if it isn't NULL, and return the number of records
+template <typename T, typename PropsT>
+static long int CopyCompact(vector<PropsT *> & detections, T * vals){
+
+  srep_arena<T> & arena = *(detections[0][0].GetArena());
+  size_t i;
+
+  if(vals == NULL){ return arena.compact.size(); }
+  for(i = 0; i < arena.compact.size(); ++i){
+
+    vals[(4 * i)] = arena.compact[i].tot_intens;
+    vals[((4 * i) + 1)] = arena.compact[i].peak;
+    vals[((4 * i) + 2)] = (T) arena.compact[i].NOvox;
+    vals[((4 * i) + 3)] = (T) arena.compact[i].sign;
+
+  }
+  return arena.compact.size();
+
+}
+
+// set the function that the linking engines report their progress to, and clear any earlier cancellation
+template <typename PropsT>
+static void SetProgressFunc(vector<PropsT *> & detections, int (* progress_func)(void * context, double fraction), void * progress_context){
+
+  detections[0][0].GetArena()->progress_func = progress_func;
+  detections[0][0].GetArena()->progress_context = progress_context;
+  detections[0][0].GetArena()->cancelled = false;
+
+}
+
+// set the function that the objects are handed to once they can no longer grow
+template <typename PropsT>
+static void SetFinaliseFunc(vector<PropsT *> & detections, int (* finalise_func)(void * context, long int obj_id, int * bbox), void * finalise_context){
+
+  detections[0][0].GetArena()->finalise_func = finalise_func;
+  detections[0][0].GetArena()->finalise_context = finalise_context;
+
+}
+
+// reset the statistics of the linker, and measure the times of its phases if collect is set
+template <typename PropsT>
+static void ResetStats(vector<PropsT *> & detections, bool collect){
+
+  detections[0][0].GetArena()->stats = link_stats();
+  detections[0][0].GetArena()->stats.collect = collect;
+
+}
+
+// return the statistics of the linker, completed with the size of the arena
+template <typename PropsT>
+static link_stats * FillStats(vector<PropsT *> & detections){
+
+  link_stats & stats = detections[0][0].GetArena()->stats;
+
+  stats.arena_bytes = (long int) detections[0][0].GetArena()->ShowBytes();
+  return &stats;
+
+}
+
+// the wall clock time in seconds, from an arbitrary starting point
+double WallTime(){ return chrono::duration<double>(chrono::steady_clock::now().time_since_epoch()).count(); }
+
 // functions using floats
 
-void InitObjGen(vector <object_props *> & detections, int & NOobj, int obj_limit, vector<int> & obj_ids, vector<int> & check_obj_ids, int * & data_metric, int * & xyz_order){
+void InitObjGen(vector <object_props *> & detections, int & NOobj, int obj_limit, vector<int> & obj_ids, vector<int> & check_obj_ids, long int * & data_metric, int * & xyz_order){
+
+  int i;
 
   detections.reserve(1000);
   detections.resize(0);
   detections.push_back(new object_props[obj_limit]);
+  detections[0][0].SetArena(new srep_arena<float>);
+  for(i = 1; i < obj_limit; ++i){ detections[0][i].SetArena(detections[0][0].GetArena()); }
   obj_ids.reserve(static_cast<int>(1.0E6));
   obj_ids.resize(0);
   obj_ids.push_back(0);
   check_obj_ids.reserve(static_cast<int>(1.0E6));
   check_obj_ids.resize(0);
   NOobj = 0;
-  data_metric = new int[3];
+  data_metric = new long int[3];
   xyz_order = new int[3];
   
 }
 
-void InitObjGen(vector <object_props *> & detections, long int & NOobj, int obj_limit, vector<long int> & obj_ids, vector<long int> & check_obj_ids, int * & data_metric, int * & xyz_order){
+void InitObjGen(vector <object_props *> & detections, long int & NOobj, int obj_limit, vector<long int> & obj_ids, vector<long int> & check_obj_ids, long int * & data_metric, int * & xyz_order){
+
+  int i;
 
   detections.reserve(1000);
   detections.resize(0);
   detections.push_back(new object_props[obj_limit]);
+  detections[0][0].SetArena(new srep_arena<float>);
+  for(i = 1; i < obj_limit; ++i){ detections[0][i].SetArena(detections[0][0].GetArena()); }
   obj_ids.reserve(static_cast<int>(1.0E6));
   obj_ids.resize(0);
   obj_ids.push_back(0);
   check_obj_ids.reserve(static_cast<int>(1.0E6));
   check_obj_ids.resize(0);
   NOobj = 0;
-  data_metric = new int[3];
+  data_metric = new long int[3];
   xyz_order = new int[3];
   
 }
 
-void FreeObjGen(vector <object_props *> & detections, int * & data_metric, int * & xyz_order){
+void FreeObjGen(vector <object_props *> & detections, long int * & data_metric, int * & xyz_order){
 
   unsigned int i;
+  srep_arena<float> * arena;
 
+  // the sparse representations and postage stamp images of all the objects are released with the arena
+  arena = (detections.size() > 0) ? detections[0][0].GetArena() : NULL;
   for(i = 0; i < detections.size(); ++i){
 
     delete [] detections[i];
 
   }
+  if(arena != NULL){ delete arena; }
   delete [] data_metric;
   delete [] xyz_order;
 
 }
 
+void SetCompactLimits(vector <object_props *> & detections, int compact_voxels, float compact_peak){ SetCompact(detections,compact_voxels,compact_peak); }
+
+long int CopyCompactObjs(vector <object_props *> & detections, float * vals){ return CopyCompact(detections,vals); }
+
+void SetProgress(vector <object_props *> & detections, int (* progress_func)(void * context, double fraction), void * progress_context){ SetProgressFunc(detections,progress_func,progress_context); }
+
+void SetFinalise(vector <object_props *> & detections, int (* finalise_func)(void * context, long int obj_id, int * bbox), void * finalise_context){ SetFinaliseFunc(detections,finalise_func,finalise_context); }
+
+void SetLinkStats(vector <object_props *> & detections, bool collect){ ResetStats(detections,collect); }
+
+link_stats * GetLinkStats(vector <object_props *> & detections){ return FillStats(detections); }
+
 // functions using doubles
 
-void InitObjGen(vector <object_props_dbl *> & detections, int & NOobj, int obj_limit, vector<int> & obj_ids, vector<int> & check_obj_ids, int * & data_metric, int * & xyz_order){
+void InitObjGen(vector <object_props_dbl *> & detections, int & NOobj, int obj_limit, vector<int> & obj_ids, vector<int> & check_obj_ids, long int * & data_metric, int * & xyz_order){
+
+  int i;
 
   detections.reserve(1000);
   detections.resize(0);
   detections.push_back(new object_props_dbl[obj_limit]);
+  detections[0][0].SetArena(new srep_arena<double>);
+  for(i = 1; i < obj_limit; ++i){ detections[0][i].SetArena(detections[0][0].GetArena()); }
   obj_ids.reserve(static_cast<int>(1.0E6));
   obj_ids.resize(0);
   obj_ids.push_back(0);
   check_obj_ids.reserve(static_cast<int>(1.0E6));
   check_obj_ids.resize(0);
   NOobj = 0;
-  data_metric = new int[3];
+  data_metric = new long int[3];
   xyz_order = new int[3];
   
 }
 
-void InitObjGen(vector <object_props_dbl *> & detections, long int & NOobj, int obj_limit, vector<long int> & obj_ids, vector<long int> & check_obj_ids, int * & data_metric, int * & xyz_order){
+void InitObjGen(vector <object_props_dbl *> & detections, long int & NOobj, int obj_limit, vector<long int> & obj_ids, vector<long int> & check_obj_ids, long int * & data_metric, int * & xyz_order){
+
+  int i;
 
   detections.reserve(1000);
   detections.resize(0);
   detections.push_back(new object_props_dbl[obj_limit]);
+  detections[0][0].SetArena(new srep_arena<double>);
+  for(i = 1; i < obj_limit; ++i){ detections[0][i].SetArena(detections[0][0].GetArena()); }
   obj_ids.reserve(static_cast<int>(1.0E6));
   obj_ids.resize(0);
   obj_ids.push_back(0);
   check_obj_ids.reserve(static_cast<int>(1.0E6));
   check_obj_ids.resize(0);
   NOobj = 0;
-  data_metric = new int[3];
+  data_metric = new long int[3];
   xyz_order = new int[3];
   
 }
 
-void FreeObjGen(vector <object_props_dbl *> & detections, int * & data_metric, int * & xyz_order){
+void FreeObjGen(vector <object_props_dbl *> & detections, long int * & data_metric, int * & xyz_order){
 
   unsigned int i;
+  srep_arena<double> * arena;
 
+  // the sparse representations and postage stamp images of all the objects are released with the arena
+  arena = (detections.size() > 0) ? detections[0][0].GetArena() : NULL;
   for(i = 0; i < detections.size(); ++i){
 
     delete [] detections[i];
 
   }
+  if(arena != NULL){ delete arena; }
   delete [] data_metric;
   delete [] xyz_order;
 
 }
 
+void SetCompactLimits(vector <object_props_dbl *> & detections, int compact_voxels, double compact_peak){ SetCompact(detections,compact_voxels,compact_peak); }
+
+long int CopyCompactObjs(vector <object_props_dbl *> & detections, double * vals){ return CopyCompact(detections,vals); }
+
+void SetProgress(vector <object_props_dbl *> & detections, int (* progress_func)(void * context, double fraction), void * progress_context){ SetProgressFunc(detections,progress_func,progress_context); }
+
+void SetFinalise(vector <object_props_dbl *> & detections, int (* finalise_func)(void * context, long int obj_id, int * bbox), void * finalise_context){ SetFinaliseFunc(detections,finalise_func,finalise_context); }
+
+void SetLinkStats(vector <object_props_dbl *> & detections, bool collect){ ResetStats(detections,collect); }
+
+link_stats * GetLinkStats(vector <object_props_dbl *> & detections){ return FillStats(detections); }
+
 
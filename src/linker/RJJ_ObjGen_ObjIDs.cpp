@@ -0,0 +1,283 @@
+#include<iostream>
+#include<functional>
+#include "RJJ_ObjGen.h"
+
+using namespace std;
+
+// the pool of available object IDs, obj_ids, is kept as a binary min-heap, so that the lowest free ID is
+// always at obj_ids[0] and can be taken or returned in O(log n) steps --- the largest value in the pool
+// is the next new object ID, obj, which is replaced by obj + 1 once it has been taken. The free_ids
+// array flags the IDs that are currently in the pool, so that an ID is never added to it twice.
+
+// the time and number of calls spent in the allocator, the number of freed IDs that have been taken
+// again, and the largest number of IDs in use at once are accumulated in the statistics of the linker.
+// The calls are always counted, but the time is only measured while the statistics are collected.
+
+template <typename FlagT>
+static void HeapObjIDs(vector<FlagT> & obj_ids, vector<char> & free_ids, link_stats & stats){
+
+  double start = stats.collect ? WallTime() : 0.0;
+  unsigned long int i;
+  FlagT max_id;
+
+  make_heap(obj_ids.begin(),obj_ids.end(),greater<FlagT>());
+
+  max_id = 0;
+  for(i = 0; i < obj_ids.size(); ++i){ if(obj_ids[i] > max_id){ max_id = obj_ids[i]; } }
+  free_ids.assign((max_id + 1),0);
+  for(i = 0; i < obj_ids.size(); ++i){ free_ids[obj_ids[i]] = 1; }
+
+  if(stats.collect){ stats.alloc_time+=(WallTime() - start); }
+  ++stats.alloc_calls;
+
+}
+
+template <typename FlagT, typename PropsT>
+static FlagT TakeObjID(vector<FlagT> & obj_ids, vector<char> & free_ids, FlagT & obj, vector<PropsT *> & detections, int obj_limit){
+
+  link_stats & stats = detections[0][0].GetArena()->stats;
+  double start = stats.collect ? WallTime() : 0.0;
+  FlagT obj_id;
+  int i;
+
+  // take the lowest free ID from the top of the heap
+  pop_heap(obj_ids.begin(),obj_ids.end(),greater<FlagT>());
+  obj_id = obj_ids.back();
+  obj_ids.pop_back();
+  free_ids[obj_id] = 0;
+
+  // if this was the next new ID, then replace it with an incremented obj value
+  if(obj_ids.size() > 0){ ++stats.ids_recycled; }
+  if(obj_ids.size() == 0){
+
+    ++obj;
+    obj_ids.push_back(obj);
+    if(obj >= ((FlagT) free_ids.size())){ free_ids.resize((obj + 1),0); }
+    free_ids[obj] = 1;
+
+    // if this obj_id modulo obj_limit == 0, then it's the first obj of a new batch
+    // so create a new batch of objects that share the arena of the first batch
+    if((obj % obj_limit) == 0){
+
+      detections.push_back(new PropsT[obj_limit]);
+      for(i = 0; i < obj_limit; ++i){ detections.back()[i].SetArena(detections[0][0].GetArena()); }
+
+    }
+
+  }
+
+  // the pool holds the free IDs below obj and obj itself
+  if(((long int) obj - (long int) obj_ids.size() + 1) > stats.peak_objects){ stats.peak_objects = (long int) obj - (long int) obj_ids.size() + 1; }
+
+  if(stats.collect){ stats.alloc_time+=(WallTime() - start); }
+  ++stats.alloc_calls;
+
+  return obj_id;
+
+}
+
+template <typename FlagT>
+static void GiveObjID(vector<FlagT> & obj_ids, vector<char> & free_ids, FlagT obj_id, link_stats & stats){
+
+  double start = stats.collect ? WallTime() : 0.0;
+
+  if(obj_id >= ((FlagT) free_ids.size())){ free_ids.resize((obj_id + 1),0); }
+  if(free_ids[obj_id] == 0){
+
+    free_ids[obj_id] = 1;
+    obj_ids.push_back(obj_id);
+    push_heap(obj_ids.begin(),obj_ids.end(),greater<FlagT>());
+
+  }
+
+  if(stats.collect){ stats.alloc_time+=(WallTime() - start); }
+  ++stats.alloc_calls;
+
+}
+
+// the list of objects that can still grow, check_obj_ids, is indexed by check_set.pos, so that an
+// object ID is found, added or removed in O(1) steps. check_set.queue is a min-heap of the objects ordered
+// by their maximum channel, so that only the objects that leave the merging volume need to be visited
+// when it moves on. An object's maximum channel only grows, so the queue entries are updated lazily:
+// check_set.key holds the key of the newest entry of each object, and older entries are skipped.
+
+// the voxel count and maximum channel of an object, taken from the detections array or from an object store
+template <typename PropsT>
+static int CheckVoxels(vector<PropsT *> & detections, int obj_limit, long int obj_id){ return detections[(obj_id / obj_limit)][(obj_id - ((obj_id / obj_limit) * obj_limit))].ShowVoxels(); }
+
+template <typename PropsT>
+static int CheckFreqMax(vector<PropsT *> & detections, int obj_limit, long int obj_id){ return detections[(obj_id / obj_limit)][(obj_id - ((obj_id / obj_limit) * obj_limit))].GetFREQmax(); }
+
+template <typename T>
+static int CheckVoxels(object_store<T> & store, int obj_limit, long int obj_id){ return store.NOvox[obj_id]; }
+
+template <typename T>
+static int CheckFreqMax(object_store<T> & store, int obj_limit, long int obj_id){ return store.freq_max[obj_id]; }
+
+template <typename FlagT>
+static void RemoveCheckID(vector<FlagT> & check_obj_ids, check_id_set & check_set, FlagT obj_id){
+
+  FlagT last;
+
+  last = check_obj_ids.back();
+  check_obj_ids[check_set.pos[obj_id]] = last;
+  check_set.pos[last] = check_set.pos[obj_id];
+  check_obj_ids.pop_back();
+  check_set.pos[obj_id] = -1;
+
+}
+
+template <typename FlagT, typename PropsT>
+static void BuildCheckIDs(vector<FlagT> & check_obj_ids, check_id_set & check_set, vector<PropsT *> & detections, int obj_limit){
+
+  unsigned long int i, NOi;
+  FlagT obj_batch, max_id;
+
+  max_id = 0;
+  for(i = 0; i < check_obj_ids.size(); ++i){ if(check_obj_ids[i] > max_id){ max_id = check_obj_ids[i]; } }
+  check_set.pos.assign((max_id + 1),-1);
+  check_set.key.assign((max_id + 1),0);
+  check_set.queue.resize(0);
+
+  // drop repeated IDs and objects that have been re-initialised
+  NOi = 0;
+  for(i = 0; i < check_obj_ids.size(); ++i){
+
+    obj_batch = check_obj_ids[i] / obj_limit;
+    if((check_set.pos[check_obj_ids[i]] >= 0) || (detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].ShowVoxels() < 1)){ continue; }
+    check_set.pos[check_obj_ids[i]] = NOi;
+    check_set.key[check_obj_ids[i]] = detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].GetFREQmax();
+    check_set.queue.push_back(pair<int, long int>(check_set.key[check_obj_ids[i]],check_obj_ids[i]));
+    check_obj_ids[NOi] = check_obj_ids[i];
+    ++NOi;
+
+  }
+  check_obj_ids.resize(NOi);
+  make_heap(check_set.queue.begin(),check_set.queue.end(),greater< pair<int, long int> >());
+
+}
+
+template <typename FlagT, typename SourceT>
+static void PushCheckID(vector<FlagT> & check_obj_ids, check_id_set & check_set, FlagT obj_id, SourceT & source, int obj_limit){
+
+  if(obj_id >= ((FlagT) check_set.pos.size())){
+
+    check_set.pos.resize((obj_id + 1),-1);
+    check_set.key.resize((obj_id + 1),0);
+
+  }
+  if(check_set.pos[obj_id] >= 0){ return; }
+
+  check_set.pos[obj_id] = check_obj_ids.size();
+  check_obj_ids.push_back(obj_id);
+  check_set.key[obj_id] = -1;
+
+  // an object that hasn't been given any voxels yet is queued first, and re-queued once it has grown
+  if(CheckVoxels(source,obj_limit,obj_id) > 0){ check_set.key[obj_id] = CheckFreqMax(source,obj_limit,obj_id); }
+  check_set.queue.push_back(pair<int, long int>(check_set.key[obj_id],obj_id));
+  push_heap(check_set.queue.begin(),check_set.queue.end(),greater< pair<int, long int> >());
+
+}
+
+template <typename FlagT, typename SourceT>
+static FlagT PopCheckID(vector<FlagT> & check_obj_ids, check_id_set & check_set, SourceT & source, int obj_limit, int freq_limit){
+
+  FlagT obj_id;
+  int key;
+
+  while((check_set.queue.size() > 0) && (check_set.queue.front().first < freq_limit)){
+
+    pop_heap(check_set.queue.begin(),check_set.queue.end(),greater< pair<int, long int> >());
+    key = check_set.queue.back().first;
+    obj_id = check_set.queue.back().second;
+    check_set.queue.pop_back();
+
+    // skip entries of objects that have already been removed, and entries that have been superseded
+    if((check_set.pos[obj_id] < 0) || (check_set.key[obj_id] != key)){ continue; }
+
+    // remove objects that have been re-initialised, i.e. merged into another object
+    if(CheckVoxels(source,obj_limit,obj_id) < 1){
+
+      RemoveCheckID(check_obj_ids,check_set,obj_id);
+      continue;
+
+    }
+
+    // re-queue objects that have grown since they were queued
+    if(CheckFreqMax(source,obj_limit,obj_id) >= freq_limit){
+
+      check_set.key[obj_id] = CheckFreqMax(source,obj_limit,obj_id);
+      check_set.queue.push_back(pair<int, long int>(check_set.key[obj_id],obj_id));
+      push_heap(check_set.queue.begin(),check_set.queue.end(),greater< pair<int, long int> >());
+      continue;
+
+    }
+
+    RemoveCheckID(check_obj_ids,check_set,obj_id);
+    return obj_id;
+
+  }
+
+  return -1;
+
+}
+
+void InitObjIDs(vector<int> & obj_ids, vector<char> & free_ids, link_stats & stats){ HeapObjIDs(obj_ids,free_ids,stats); }
+
+void InitObjIDs(vector<long int> & obj_ids, vector<char> & free_ids, link_stats & stats){ HeapObjIDs(obj_ids,free_ids,stats); }
+
+void FreeObjID(vector<int> & obj_ids, vector<char> & free_ids, int obj_id, link_stats & stats){ GiveObjID(obj_ids,free_ids,obj_id,stats); }
+
+void FreeObjID(vector<long int> & obj_ids, vector<char> & free_ids, long int obj_id, link_stats & stats){ GiveObjID(obj_ids,free_ids,obj_id,stats); }
+
+// functions using floats
+
+int NewObjID(vector<int> & obj_ids, vector<char> & free_ids, int & obj, vector<object_props *> & detections, int obj_limit){ return TakeObjID(obj_ids,free_ids,obj,detections,obj_limit); }
+
+long int NewObjID(vector<long int> & obj_ids, vector<char> & free_ids, long int & obj, vector<object_props *> & detections, int obj_limit){ return TakeObjID(obj_ids,free_ids,obj,detections,obj_limit); }
+
+void InitCheckIDs(vector<int> & check_obj_ids, check_id_set & check_set, vector<object_props *> & detections, int obj_limit){ BuildCheckIDs(check_obj_ids,check_set,detections,obj_limit); }
+
+void InitCheckIDs(vector<long int> & check_obj_ids, check_id_set & check_set, vector<object_props *> & detections, int obj_limit){ BuildCheckIDs(check_obj_ids,check_set,detections,obj_limit); }
+
+void AddCheckID(vector<int> & check_obj_ids, check_id_set & check_set, int obj_id, vector<object_props *> & detections, int obj_limit){ PushCheckID(check_obj_ids,check_set,obj_id,detections,obj_limit); }
+
+void AddCheckID(vector<long int> & check_obj_ids, check_id_set & check_set, long int obj_id, vector<object_props *> & detections, int obj_limit){ PushCheckID(check_obj_ids,check_set,obj_id,detections,obj_limit); }
+
+int NextRetiredID(vector<int> & check_obj_ids, check_id_set & check_set, vector<object_props *> & detections, int obj_limit, int freq_limit){ return PopCheckID(check_obj_ids,check_set,detections,obj_limit,freq_limit); }
+
+long int NextRetiredID(vector<long int> & check_obj_ids, check_id_set & check_set, vector<object_props *> & detections, int obj_limit, int freq_limit){ return PopCheckID(check_obj_ids,check_set,detections,obj_limit,freq_limit); }
+
+void AddCheckID(vector<int> & check_obj_ids, check_id_set & check_set, int obj_id, object_store<float> & store){ PushCheckID(check_obj_ids,check_set,obj_id,store,0); }
+
+void AddCheckID(vector<long int> & check_obj_ids, check_id_set & check_set, long int obj_id, object_store<float> & store){ PushCheckID(check_obj_ids,check_set,obj_id,store,0); }
+
+int NextRetiredID(vector<int> & check_obj_ids, check_id_set & check_set, object_store<float> & store, int freq_limit){ return PopCheckID(check_obj_ids,check_set,store,0,freq_limit); }
+
+long int NextRetiredID(vector<long int> & check_obj_ids, check_id_set & check_set, object_store<float> & store, int freq_limit){ return PopCheckID(check_obj_ids,check_set,store,0,freq_limit); }
+
+// functions using doubles
+
+int NewObjID(vector<int> & obj_ids, vector<char> & free_ids, int & obj, vector<object_props_dbl *> & detections, int obj_limit){ return TakeObjID(obj_ids,free_ids,obj,detections,obj_limit); }
+
+long int NewObjID(vector<long int> & obj_ids, vector<char> & free_ids, long int & obj, vector<object_props_dbl *> & detections, int obj_limit){ return TakeObjID(obj_ids,free_ids,obj,detections,obj_limit); }
+
+void InitCheckIDs(vector<int> & check_obj_ids, check_id_set & check_set, vector<object_props_dbl *> & detections, int obj_limit){ BuildCheckIDs(check_obj_ids,check_set,detections,obj_limit); }
+
+void InitCheckIDs(vector<long int> & check_obj_ids, check_id_set & check_set, vector<object_props_dbl *> & detections, int obj_limit){ BuildCheckIDs(check_obj_ids,check_set,detections,obj_limit); }
+
+void AddCheckID(vector<int> & check_obj_ids, check_id_set & check_set, int obj_id, vector<object_props_dbl *> & detections, int obj_limit){ PushCheckID(check_obj_ids,check_set,obj_id,detections,obj_limit); }
+
+void AddCheckID(vector<long int> & check_obj_ids, check_id_set & check_set, long int obj_id, vector<object_props_dbl *> & detections, int obj_limit){ PushCheckID(check_obj_ids,check_set,obj_id,detections,obj_limit); }
+
+int NextRetiredID(vector<int> & check_obj_ids, check_id_set & check_set, vector<object_props_dbl *> & detections, int obj_limit, int freq_limit){ return PopCheckID(check_obj_ids,check_set,detections,obj_limit,freq_limit); }
+
+long int NextRetiredID(vector<long int> & check_obj_ids, check_id_set & check_set, vector<object_props_dbl *> & detections, int obj_limit, int freq_limit){ return PopCheckID(check_obj_ids,check_set,detections,obj_limit,freq_limit); }
+
+void AddCheckID(vector<int> & check_obj_ids, check_id_set & check_set, int obj_id, object_store<double> & store){ PushCheckID(check_obj_ids,check_set,obj_id,store,0); }
+
+void AddCheckID(vector<long int> & check_obj_ids, check_id_set & check_set, long int obj_id, object_store<double> & store){ PushCheckID(check_obj_ids,check_set,obj_id,store,0); }
+
+int NextRetiredID(vector<int> & check_obj_ids, check_id_set & check_set, object_store<double> & store, int freq_limit){ return PopCheckID(check_obj_ids,check_set,store,0,freq_limit); }
+
+long int NextRetiredID(vector<long int> & check_obj_ids, check_id_set & check_set, object_store<double> & store, int freq_limit){ return PopCheckID(check_obj_ids,check_set,store,0,freq_limit); }
@@ -0,0 +1,155 @@
+#include<iostream>
+#include "RJJ_ObjGen.h"
+
+using namespace std;
+
+// The object_store holds the accumulated properties of the objects as one array per property, so that
+// the per-voxel and per-merge updates touch a handful of contiguous arrays rather than a scattered
+// object_props instance. The member functions follow the corresponding object_props member functions
+// operation for operation, so that the results are the same to the last bit.
+
+template <typename T>
+static void AdjustLimits(T & min_val, T & max_val, T value){
+
+  if(value <= min_val){ min_val = value; }
+  if(value >= max_val){ max_val = value; }
+
+}
+
+template <typename T>
+long int object_store<T>::Size(){ return NOvox.size(); }
+
+template <typename T>
+void object_store<T>::Resize(long int size){
+
+  long int i, old_size;
+
+  old_size = NOvox.size();
+  NOvox.resize(size); ra.resize(size); dec.resize(size); freq.resize(size);
+  ra_min.resize(size); ra_max.resize(size); dec_min.resize(size); dec_max.resize(size); freq_min.resize(size); freq_max.resize(size);
+  ra_i.resize(size); dec_i.resize(size); freq_i.resize(size);
+  p_ra_i.resize(size); p_dec_i.resize(size); p_freq_i.resize(size);
+  n_ra_i.resize(size); n_dec_i.resize(size); n_freq_i.resize(size);
+  tot_intens.resize(size); p_tot_intens.resize(size); n_tot_intens.resize(size);
+  avg_intens.resize(size); sigma_intens.resize(size); rms.resize(size); min_intens.resize(size); max_intens.resize(size);
+  for(i = old_size; i < size; ++i){ ReInit(i); }
+
+}
+
+template <typename T>
+void object_store<T>::ReInit(long int id){
+
+  NOvox[id] = 0;
+  ra[id] = dec[id] = freq[id] = ra_i[id] = dec_i[id] = freq_i[id] = tot_intens[id] = avg_intens[id] = sigma_intens[id] = rms[id] = 0.0;
+  ra_min[id] = dec_min[id] = freq_min[id] = min_intens[id] = 1E10;
+  ra_max[id] = dec_max[id] = freq_max[id] = max_intens[id] = -1E10;
+  p_tot_intens[id] = n_tot_intens[id] = 0.0;
+  p_ra_i[id] = p_dec_i[id] = p_freq_i[id] = 0.0;
+  n_ra_i[id] = n_dec_i[id] = n_freq_i[id] = 0.0;
+
+}
+
+template <typename T>
+void object_store<T>::AddPoint(long int id, T x_pos, T y_pos, T z_pos, T value){
+
+  // update bounding box
+  AdjustLimits(ra_min[id],ra_max[id],x_pos);
+  AdjustLimits(dec_min[id],dec_max[id],y_pos);
+  AdjustLimits(freq_min[id],freq_max[id],z_pos);
+
+  // update voxel count
+  NOvox[id]+=1;
+
+  // update the sums
+  ra[id]+=x_pos;
+  dec[id]+=y_pos;
+  freq[id]+=z_pos;
+  ra_i[id]+=(x_pos * value);
+  dec_i[id]+=(y_pos * value);
+  freq_i[id]+=(z_pos * value);
+  tot_intens[id]+=value;
+  if(value >= 0.0){
+
+    p_ra_i[id]+=(x_pos * value);
+    p_dec_i[id]+=(y_pos * value);
+    p_freq_i[id]+=(z_pos * value);
+    p_tot_intens[id]+=value;
+
+  } else {
+
+    n_ra_i[id]+=(x_pos * value);
+    n_dec_i[id]+=(y_pos * value);
+    n_freq_i[id]+=(z_pos * value);
+    n_tot_intens[id]+=value;
+
+  }
+  avg_intens[id]+=value;
+  sigma_intens[id]+=(value * value);
+  AdjustLimits(min_intens[id],max_intens[id],value);
+
+}
+
+template <typename T>
+void object_store<T>::AddObject(long int id, long int merged){
+
+  if(id == merged){ return; }
+
+  // update the properties of this object with the object being merged in
+  NOvox[id]+=NOvox[merged];
+  AdjustLimits(ra_min[id],ra_max[id],ra_min[merged]);
+  AdjustLimits(ra_min[id],ra_max[id],ra_max[merged]);
+  AdjustLimits(dec_min[id],dec_max[id],dec_min[merged]);
+  AdjustLimits(dec_min[id],dec_max[id],dec_max[merged]);
+  AdjustLimits(freq_min[id],freq_max[id],freq_min[merged]);
+  AdjustLimits(freq_min[id],freq_max[id],freq_max[merged]);
+  ra[id]+=ra[merged];
+  dec[id]+=dec[merged];
+  freq[id]+=freq[merged];
+  ra_i[id]+=ra_i[merged];
+  dec_i[id]+=dec_i[merged];
+  freq_i[id]+=freq_i[merged];
+  p_ra_i[id]+=p_ra_i[merged];
+  p_dec_i[id]+=p_dec_i[merged];
+  p_freq_i[id]+=p_freq_i[merged];
+  n_ra_i[id]+=n_ra_i[merged];
+  n_dec_i[id]+=n_dec_i[merged];
+  n_freq_i[id]+=n_freq_i[merged];
+  tot_intens[id]+=tot_intens[merged];
+  p_tot_intens[id]+=p_tot_intens[merged];
+  n_tot_intens[id]+=n_tot_intens[merged];
+  avg_intens[id]+=avg_intens[merged];
+  sigma_intens[id]+=sigma_intens[merged];
+  AdjustLimits(min_intens[id],max_intens[id],min_intens[merged]);
+  AdjustLimits(min_intens[id],max_intens[id],max_intens[merged]);
+
+}
+
+template struct object_store<float>;
+template struct object_store<double>;
+
+// calculate the properties of every object that contains voxels, in place in the detections array
+template <typename FlagT, typename PropsT>
+static void CalcAllProps(vector<PropsT *> & detections, FlagT NOobj, int obj_limit){
+
+  FlagT i, obj_batch;
+
+  for(i = 0; i < NOobj; ++i){
+
+    obj_batch = i / obj_limit;
+    if(detections[obj_batch][(i - (obj_batch * obj_limit))].ShowVoxels() >= 1){ detections[obj_batch][(i - (obj_batch * obj_limit))].CalcProps(); }
+
+  }
+
+}
+
+// functions using floats
+
+void CalcObjProps(vector<object_props *> & detections, int NOobj, int obj_limit){ CalcAllProps(detections,NOobj,obj_limit); }
+
+void CalcObjProps(vector<object_props *> & detections, long int NOobj, int obj_limit){ CalcAllProps(detections,NOobj,obj_limit); }
+
+// functions using doubles
+
+void CalcObjProps(vector<object_props_dbl *> & detections, int NOobj, int obj_limit){ CalcAllProps(detections,NOobj,obj_limit); }
+
+void CalcObjProps(vector<object_props_dbl *> & detections, long int NOobj, int obj_limit){ CalcAllProps(detections,NOobj,obj_limit); }
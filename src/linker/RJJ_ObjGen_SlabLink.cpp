@@ -0,0 +1,736 @@
+#include<iostream>
+#include<cstdlib>
+#include<limits>
+#include "RJJ_ObjGen.h"
+
+#ifdef _OPENMP
+#include<omp.h>
+#endif
+
+using namespace std;
+
+// Slab-parallel labelling engine. The datacube chunk is split into z-slabs that are labelled
+// concurrently, each slab only linking voxels within its own planes. The links that cross a slab
+// seam are then found by searching the first merge_z + 1 planes of each slab back into the
+// previous slabs, and all of the links are resolved in a shared union-find forest. Finally the
+// objects are created by a single sweep through the chunk in z, y, x order, so that the object IDs
+// and object statistics do not depend on the number of slabs or threads.
+//
+// Dilation labelling engine. The mask is dilated with the merging kernel, the connected components
+// of the dilated mask are found, and each source voxel is given the component of its own position.
+// Two source voxels are linked if their dilated regions overlap or touch, so the dilation uses half
+// of the kernel --- a one-sided run of merge_z + 1 planes along z, and for a box of merge_x + 1 and
+// merge_y + 1 pixels along x and y. As the mask is binary, the running maximum along each axis only
+// needs the position of the last source voxel. The spatial ellipse can't be separated, so in that
+// case the dilated voxels are linked within each plane by sliding the reach of the ellipse along
+// pairs of rows. The cost per voxel doesn't depend on merge_z, or on merge_x and merge_y for a box.
+// The objects are made in the same manner as by the slab-parallel engine.
+
+// return the number of the calling thread within the team of threads, the calling thread being 0
+static int ThreadNumber(){
+
+#ifdef _OPENMP
+  return omp_get_thread_num();
+#else
+  return 0;
+#endif
+
+}
+
+// return the root of a provisional label, and point every label on the way directly at the root
+template <typename FlagT>
+static FlagT SlabFindRoot(vector<FlagT> & uf_parent, FlagT label){
+
+  FlagT root, next;
+
+  root = label;
+  while(uf_parent[root] != root){ root = uf_parent[root]; }
+  while(uf_parent[label] != root){
+
+    next = uf_parent[label];
+    uf_parent[label] = root;
+    label = next;
+
+  }
+
+  return root;
+
+}
+
+// join the trees of two provisional labels --- the lower label always becomes the root, so that
+// object IDs from previous chunks are retained in favour of new provisional labels
+template <typename FlagT>
+static FlagT SlabUnion(vector<FlagT> & uf_parent, FlagT label_1, FlagT label_2){
+
+  label_1 = SlabFindRoot(uf_parent,label_1);
+  label_2 = SlabFindRoot(uf_parent,label_2);
+  if(label_1 < label_2){ uf_parent[label_2] = label_1; return label_1; }
+  uf_parent[label_1] = label_2;
+  return label_2;
+
+}
+
+// create the objects from the provisional labels of a chunk, once every link has been recorded in the
+// union-find forest: objects from previous chunks that have been linked are merged, the new objects are
+// made in z, y, x order, the objects that can no longer grow are size thresholded, and the provisional
+// labels are resolved to object IDs
+template <typename DataT, typename FlagT, typename PropsT>
+static FlagT CreateLinkedObjects(DataT * data_vals, FlagT * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, FlagT start_obj, FlagT obj, vector<PropsT *> & detections, vector<FlagT> & obj_ids, vector<char> & free_ids, vector<FlagT> & check_obj_ids, check_id_set & check_set, int obj_limit, int max_x_val, int max_y_val, int max_z_val, int x_start, int y_start, int x_finish, int y_finish, int z_finish, vector<FlagT> & uf_parent, long int * data_metric, int NOthreads, int products){
+
+  FlagT obj_id,existing,obj_batch,obj_batch_2,label,root,NOlabels;
+  int x,y,z;
+  long int index, NOvox, NOmerges;
+  vector<FlagT> uf_obj, obj_root;
+  srep_arena<DataT> & arena = *(detections[0][0].GetArena());
+  vector<DataT> & temp_mom0 = arena.temp_mom0, & temp_RAPV = arena.temp_RAPV, & temp_DECPV = arena.temp_DECPV, & temp_obj_spec = arena.temp_obj_spec, & temp_ref_spec = arena.temp_ref_spec, & temp_vfield = arena.temp_vfield;
+  vector<int> & temp_sparse_reps_grid = arena.temp_sparse_reps_grid, & temp_sparse_reps_strings = arena.temp_sparse_reps_strings;
+
+  // point every label directly at its root --- the root of a tree is always its lowest label --- and
+  // count the labels that have been merged into another
+  NOlabels = uf_parent.size();
+  NOmerges = 0;
+  for(label = 0; label < NOlabels; ++label){
+
+    uf_parent[label] = uf_parent[uf_parent[label]];
+    if(uf_parent[label] != label){ ++NOmerges; }
+
+  }
+  arena.stats.merges+=NOmerges;
+
+  // merge objects from previous chunks that have been linked by this chunk into the object with
+  // the lowest ID, and make the new objects in z, y, x order
+  uf_obj.resize(NOlabels,-1);
+  obj_root.resize(start_obj);
+  for(label = 0; label < start_obj; ++label){
+
+    uf_obj[label] = label;
+    obj_root[label] = label;
+    root = uf_parent[label];
+    if(root == label){ continue; }
+
+    obj_batch = root / obj_limit;
+    obj_batch_2 = label / obj_limit;
+    PropsT & merged = detections[obj_batch_2][(label - (obj_batch_2 * obj_limit))];
+    if(merged.ShowVoxels() < 1){ continue; }
+
+    detections[obj_batch][(root - (obj_batch * obj_limit))].AddObject(merged,temp_sparse_reps_grid,temp_sparse_reps_strings,temp_mom0,temp_RAPV,temp_DECPV,temp_ref_spec,temp_obj_spec,temp_vfield);
+
+    merged.ReInit();
+    if((merged.Get_srep_update() != 0) && (merged.Get_srep_size(0) >= 0)){
+
+      merged.ReInit_srep();
+      merged.ReInit_mini();
+
+    }
+    merged.ReInit_size();
+    merged.Set_srep_update(0);
+
+    FreeObjID(obj_ids,free_ids,label,arena.stats);
+
+  }
+
+  for(z = 0; z < z_finish; ++z){
+    for(y = y_start; y < y_finish; ++y){
+      for(x = x_start; x < x_finish; ++x){
+
+	index = ((long int) z * data_metric[2]) + ((long int) y * data_metric[1]) + ((long int) x * data_metric[0]);
+	if(flag_vals[index] < start_obj){ continue; }
+
+	root = uf_parent[flag_vals[index]];
+	existing = uf_obj[root];
+	if(existing == -1){
+
+	  // take the lowest free obj value from the pool of obj_ids
+	  existing = NewObjID(obj_ids,free_ids,obj,detections,obj_limit);
+	  uf_obj[root] = existing;
+	  if(existing >= ((FlagT) obj_root.size())){ obj_root.resize((existing + 1)); }
+	  obj_root[existing] = root;
+	  AddCheckID(check_obj_ids,check_set,existing,detections,obj_limit);
+
+	} else if((root < start_obj) && (existing >= 0)){
+
+	  // an object from a previous chunk that is extended by this chunk has to be size thresholded again
+	  AddCheckID(check_obj_ids,check_set,existing,detections,obj_limit);
+	  uf_obj[root] = -2 - existing;
+
+	}
+	if(existing < -1){ existing = -2 - existing; }
+
+	obj_batch = existing / obj_limit;
+	detections[obj_batch][(existing - (obj_batch * obj_limit))].AddPoint(((DataT) (chunk_x_start + x)),((DataT) (chunk_y_start + y)),((DataT) (chunk_z_start + z)),data_vals[index]);
+
+      }
+    }
+  }
+  for(label = 0; label < start_obj; ++label){ if(uf_obj[label] < -1){ uf_obj[label] = -2 - uf_obj[label]; } }
+
+  // apply the size thresholds to the objects that can no longer grow, and demote the small ones to
+  // compact records, in the same manner as CreateObjects does at the end of a chunk
+  while((obj_id = NextRetiredID(check_obj_ids,check_set,detections,obj_limit,(chunk_z_start + size_z - merge_z - 2))) >= 0){
+
+    obj_batch = obj_id / obj_limit;
+    PropsT & checked = detections[obj_batch][(obj_id - (obj_batch * obj_limit))];
+
+    if((((checked.GetRAmin() - chunk_x_start) > merge_x) || (chunk_x_start == 0)) && ((((chunk_x_start + size_x - 1 - checked.GetRAmax()) > merge_x) || ((chunk_x_start + size_x) >= max_x_val)) && (((checked.GetDECmin() - chunk_y_start) > merge_y) || (chunk_y_start == 0)) && (((chunk_y_start + size_y - 1 - checked.GetDECmax()) > merge_y) || ((chunk_y_start + size_y) >= max_y_val)) && (((checked.GetFREQmin() - chunk_z_start) > merge_z) || (chunk_z_start == 0)) && (((chunk_z_start + size_z - 1 - checked.GetFREQmax()) > merge_z) || ((chunk_z_start + size_z) >= max_z_val))) && ((((checked.GetRAmax() - checked.GetRAmin() + 1) < min_x_size) || ((checked.GetDECmax() - checked.GetDECmin() + 1) < min_y_size) || ((checked.GetFREQmax() - checked.GetFREQmin() + 1) < min_z_size) || (checked.ShowVoxels() < min_v_size)) || CompactObj(checked))){
+
+      checked.ReInit();
+      if((checked.Get_srep_update() != 0) && (checked.Get_srep_size(0) >= 0)){
+
+	checked.ReInit_srep();
+	checked.ReInit_mini();
+
+      }
+      checked.ReInit_size();
+      checked.Set_srep_update(0);
+
+      // the voxels of this object are returned to the background when the labels are resolved
+      uf_obj[obj_root[obj_id]] = -1;
+
+      // add object id to list of available ids
+      FreeObjID(obj_ids,free_ids,obj_id,arena.stats);
+
+    }
+
+  }
+
+  // resolve the provisional labels to object IDs, returning the voxels of objects that were removed
+  // by the size threshold to the background
+  NOvox = (long int) size_x * (long int) size_y * (long int) size_z;
+#pragma omp parallel for private(label) schedule(static) num_threads(NOthreads)
+  for(index = 0; index < NOvox; ++index){
+
+    if(flag_vals[index] < 0){ continue; }
+    label = uf_obj[uf_parent[flag_vals[index]]];
+    if(label >= 0){ flag_vals[index] = label; } else { flag_vals[index] = -99; }
+
+  }
+
+  // generate sparse representations of coherent objects that are retained after
+  // this `chunk' of the datacube is processed
+  CreateSparseReps(data_vals,flag_vals,size_x,size_y,size_z,chunk_x_start,chunk_y_start,chunk_z_start,merge_x,merge_y,merge_z,obj,detections,obj_limit,data_metric,products);
+
+  return obj;
+
+}
+
+template <typename DataT, typename FlagT, typename PropsT>
+static FlagT LinkObjectsSlab(DataT * data_vals, FlagT * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, FlagT flag_value, FlagT start_obj, vector<PropsT *> & detections, vector<FlagT> & obj_ids, vector<FlagT> & check_obj_ids, int obj_limit, int max_x_val, int max_y_val, int max_z_val, int ss_mode, long int * data_metric, int * xyz_order, int NOthreads, int products){
+
+  FlagT obj,label,root,NOlabels;
+  int x,y,z,s,NOslabs,planes_done,planes_reported,NOprev,NOstencil;
+  int x_start,y_start,x_finish,y_finish,z_finish;
+  int temp_vals[3];
+  long int index;
+  double sweep_start;
+  vector<link_offset> stencil;
+  vector<int> slab_start;
+  vector<long int> plane_count;
+  vector<FlagT> slab_label, uf_parent;
+  vector< vector<FlagT> > slab_links;
+  vector<char> free_ids;
+  check_id_set check_set;
+  srep_arena<DataT> & arena = *(detections[0][0].GetArena());
+
+  // convert the merging lengths in the same manner as CreateObjects
+  --merge_x;
+  --merge_y;
+  --merge_z;
+
+  // reorder the datacube and subcube limits to be in x,y,z order
+  temp_vals[0] = chunk_x_start; temp_vals[1] = chunk_y_start; temp_vals[2] = chunk_z_start;
+  chunk_x_start = ReorderAxis(temp_vals,xyz_order[0],0);
+  chunk_y_start = ReorderAxis(temp_vals,xyz_order[1],1);
+  chunk_z_start = ReorderAxis(temp_vals,xyz_order[2],2);
+  temp_vals[0] = size_x; temp_vals[1] = size_y; temp_vals[2] = size_z;
+  size_x = ReorderAxis(temp_vals,xyz_order[0],0);
+  size_y = ReorderAxis(temp_vals,xyz_order[1],1);
+  size_z = ReorderAxis(temp_vals,xyz_order[2],2);
+  temp_vals[0] = max_x_val; temp_vals[1] = max_y_val; temp_vals[2] = max_z_val;
+  max_x_val = ReorderAxis(temp_vals,xyz_order[0],0);
+  max_y_val = ReorderAxis(temp_vals,xyz_order[1],1);
+  max_z_val = ReorderAxis(temp_vals,xyz_order[2],2);
+
+  // 0. initialise variables and arrays
+  obj = start_obj;
+  x_start = 0;
+  y_start = 0;
+  if(chunk_x_start > 0){ x_start = merge_x + 1; }
+  if(chunk_y_start > 0){ y_start = merge_y + 1; }
+  x_finish = size_x;
+  if((chunk_x_start + x_finish) > max_x_val){ x_finish = max_x_val - chunk_x_start; }
+  y_finish = size_y;
+  if((chunk_y_start + y_finish) > max_y_val){ y_finish = max_y_val - chunk_y_start; }
+  z_finish = size_z;
+  if((chunk_z_start + z_finish) > max_z_val){ z_finish = max_z_val - chunk_z_start; }
+  if(z_finish < 0){ z_finish = 0; }
+  InitObjIDs(obj_ids,free_ids,arena.stats);
+  InitCheckIDs(check_obj_ids,check_set,detections,obj_limit);
+
+  // list the offsets to be tested within the merging box, in place of testing the spatial ellipse for every voxel
+  NOprev = CreateStencil(stencil,ss_mode,merge_x,merge_y,(long int) data_metric[0],(long int) data_metric[1]);
+  NOstencil = stencil.size();
+
+  // split the chunk into slabs of (nearly) equal numbers of planes
+  if(NOthreads < 1){ NOthreads = 1; }
+  NOslabs = NOthreads;
+  if(NOslabs > z_finish){ NOslabs = z_finish; }
+  if(NOslabs < 1){ NOslabs = 1; }
+  slab_start.resize((NOslabs + 1));
+  for(s = 0; s <= NOslabs; ++s){ slab_start[s] = (int) (((long int) s * (long int) z_finish) / (long int) NOslabs); }
+
+  // count the voxels to be linked in every plane, so that each slab can be given its own range of
+  // provisional labels --- object IDs from previous chunks occupy the labels below start_obj
+  sweep_start = arena.stats.collect ? WallTime() : 0.0;
+  plane_count.resize((z_finish + 1),0);
+#pragma omp parallel for private(x,y,index) schedule(static) num_threads(NOthreads)
+  for(z = 0; z < z_finish; ++z){
+    for(y = y_start; y < y_finish; ++y){
+      for(x = x_start; x < x_finish; ++x){
+
+	index = ((long int) z * data_metric[2]) + ((long int) y * data_metric[1]) + ((long int) x * data_metric[0]);
+	if(flag_vals[index] == flag_value){ ++plane_count[z]; }
+
+      }
+    }
+  }
+  slab_label.resize((NOslabs + 1));
+  slab_label[0] = start_obj;
+  for(s = 0; s < NOslabs; ++s){
+
+    index = 0;
+    for(z = slab_start[s]; z < slab_start[(s + 1)]; ++z){ index+=plane_count[z]; }
+    if((index + (long int) slab_label[s]) > (long int) numeric_limits<FlagT>::max()){
+
+      std::cerr << "ERROR: The number of voxels to be linked exceeds the range of the object labels." << std::endl;
+      return obj;
+
+    }
+    slab_label[(s + 1)] = slab_label[s] + (FlagT) index;
+
+  }
+  NOlabels = slab_label[NOslabs];
+  arena.stats.voxels_scanned+=(long int) (NOlabels - start_obj);
+  uf_parent.resize(NOlabels);
+  for(label = 0; label < start_obj; ++label){ uf_parent[label] = label; }
+  slab_links.resize(NOslabs);
+
+  // 1. label each slab independently, recording the links to object IDs from previous chunks --- there
+  // is a slab per thread, and the static schedule gives the first slab to the calling thread
+  planes_done = 0;
+  planes_reported = 0;
+#pragma omp parallel for private(s,x,y,z,index,label,root) schedule(static) num_threads(NOthreads)
+  for(s = 0; s < NOslabs; ++s){
+
+    int sz, sz_start, o, NOsearch;
+    long int offset;
+    FlagT next_label, neighbour, prev_link;
+    bool stop, interior;
+
+    // skip the remaining slabs once the linking has been cancelled
+#pragma omp critical
+    { stop = arena.cancelled; }
+    if(stop){ continue; }
+
+    next_label = slab_label[s];
+    for(z = slab_start[s]; z < slab_start[(s + 1)]; ++z){
+
+      for(y = y_start; y < y_finish; ++y){
+
+	for(x = x_start; x < x_finish; ++x){
+
+	  index = ((long int) z * data_metric[2]) + ((long int) y * data_metric[1]) + ((long int) x * data_metric[0]);
+	  if(flag_vals[index] != flag_value){ continue; }
+
+	  root = -1;
+	  prev_link = -1;
+	  sz_start = z - merge_z - 1;
+	  if(sz_start < slab_start[s]){ sz_start = slab_start[s]; }
+	  interior = (x > merge_x) && ((x + merge_x + 1) < size_x) && (y > merge_y) && ((y + merge_y + 1) < size_y);
+
+	  // search the region in front of this voxel that lies within the slab, using the same stencil
+	  // as CreateObjects
+	  for(sz = sz_start; sz <= z; ++sz){
+
+	    offset = index + ((long int) (sz - z) * data_metric[2]);
+	    NOsearch = (sz < z) ? NOstencil : NOprev;
+	    for(o = 0; o < NOsearch; ++o){
+
+	      if(!interior && (((x + stencil[o].dx) < 0) || ((x + stencil[o].dx) >= size_x) || ((y + stencil[o].dy) < 0) || ((y + stencil[o].dy) >= size_y))){ continue; }
+	      neighbour = flag_vals[(offset + stencil[o].index)];
+	      if(neighbour < 0){ continue; }
+
+	      // links to objects from previous chunks are resolved once all of the slabs are done
+	      if(neighbour < start_obj){
+
+		if(neighbour != prev_link){ slab_links[s].push_back(neighbour); slab_links[s].push_back(-1); prev_link = neighbour; }
+		continue;
+
+	      }
+
+	      if(root == -1){ root = SlabFindRoot(uf_parent,neighbour); } else { root = SlabUnion(uf_parent,root,neighbour); }
+
+	    }
+
+	  }
+
+	  if(root == -1){
+
+	    root = next_label;
+	    uf_parent[root] = root;
+	    ++next_label;
+
+	  }
+	  flag_vals[index] = root;
+
+	  // complete the links to objects from previous chunks with this voxel's label
+	  for(label = slab_links[s].size() - 1; (label >= 0) && (slab_links[s][label] == -1); label-=2){ slab_links[s][label] = root; }
+
+	  // for(x = x_start; x < x_finish; ++x)
+	}
+
+	// for(y = y_start; y < y_finish; ++y)
+      }
+
+      // report the progress once per plane from the thread that called the linker, as the progress
+      // function may not be called from any other thread, and stop if the linking has been cancelled
+#pragma omp critical
+      {
+	++planes_done;
+	if(ThreadNumber() == 0){ planes_reported = planes_done; arena.Progress(planes_done,z_finish); }
+	stop = arena.cancelled;
+      }
+      if(stop){ break; }
+
+      // for(z = slab_start[s]; z < slab_start[(s + 1)]; ++z)
+    }
+
+    // for(s = 0; s < NOslabs; ++s)
+  }
+  if(planes_reported < planes_done){ arena.Progress(planes_done,z_finish); }
+
+  // a cancelled linking is abandoned, and the caller releases the objects
+  if(arena.cancelled){ return obj; }
+
+  // 2. search the first merge_z + 1 planes of each slab back into the previous slabs, to find the
+  // links that cross the slab seams
+#pragma omp parallel for private(s,x,y,z,index) schedule(dynamic,1) num_threads(NOthreads)
+  for(s = 1; s < NOslabs; ++s){
+
+    int sz, sz_start, o;
+    long int offset;
+    FlagT neighbour;
+    bool interior;
+
+    for(z = slab_start[s]; (z < slab_start[(s + 1)]) && (z <= (slab_start[s] + merge_z)); ++z){
+      for(y = y_start; y < y_finish; ++y){
+	for(x = x_start; x < x_finish; ++x){
+
+	  index = ((long int) z * data_metric[2]) + ((long int) y * data_metric[1]) + ((long int) x * data_metric[0]);
+	  if(flag_vals[index] < start_obj){ continue; }
+
+	  sz_start = z - merge_z - 1;
+	  if(sz_start < 0){ sz_start = 0; }
+	  interior = (x > merge_x) && ((x + merge_x + 1) < size_x) && (y > merge_y) && ((y + merge_y + 1) < size_y);
+
+	  for(sz = sz_start; sz < slab_start[s]; ++sz){
+
+	    offset = index + ((long int) (sz - z) * data_metric[2]);
+	    for(o = 0; o < NOstencil; ++o){
+
+	      if(!interior && (((x + stencil[o].dx) < 0) || ((x + stencil[o].dx) >= size_x) || ((y + stencil[o].dy) < 0) || ((y + stencil[o].dy) >= size_y))){ continue; }
+	      neighbour = flag_vals[(offset + stencil[o].index)];
+	      if(neighbour < 0){ continue; }
+	      slab_links[s].push_back(neighbour);
+	      slab_links[s].push_back(flag_vals[index]);
+
+	    }
+
+	  }
+
+	}
+      }
+    }
+
+    // for(s = 1; s < NOslabs; ++s)
+  }
+
+  // resolve all of the links
+  for(s = 0; s < NOslabs; ++s){
+
+    for(index = 0; index < ((long int) slab_links[s].size()); index+=2){ SlabUnion(uf_parent,slab_links[s][index],slab_links[s][(index + 1)]); }
+    vector<FlagT>().swap(slab_links[s]);
+
+  }
+  if(arena.stats.collect){ arena.stats.sweep_time+=(WallTime() - sweep_start); }
+
+  // 3. create, size threshold and label the objects, and generate their sparse representations
+  obj = CreateLinkedObjects(data_vals,flag_vals,size_x,size_y,size_z,chunk_x_start,chunk_y_start,chunk_z_start,merge_x,merge_y,merge_z,min_x_size,min_y_size,min_z_size,min_v_size,start_obj,obj,detections,obj_ids,free_ids,check_obj_ids,check_set,obj_limit,max_x_val,max_y_val,max_z_val,x_start,y_start,x_finish,y_finish,z_finish,uf_parent,data_metric,NOthreads,products);
+
+  // 4. return the number of coherent objects
+  return obj;
+
+}
+
+// link every voxel of row a to every voxel of row b that lies within the reach along x; the rows
+// are lists of increasing x positions and their provisional labels
+template <typename FlagT>
+static void LinkRows(vector<FlagT> & uf_parent, vector<int> & pos_a, vector<FlagT> & label_a, long int a_start, long int a_finish, vector<int> & pos_b, vector<FlagT> & label_b, long int b_start, long int b_finish, int reach){
+
+  long int a, lo, hi, joined, linked;
+
+  lo = b_start;
+  hi = b_start;
+  joined = b_start;
+  linked = -1;
+  for(a = a_start; a < a_finish; ++a){
+
+    // the window of voxels within reach only ever moves forwards along row b
+    while((lo < b_finish) && (pos_b[lo] < (pos_a[a] - reach))){ ++lo; }
+    if(hi < lo){ hi = lo; }
+    while((hi < b_finish) && (pos_b[hi] <= (pos_a[a] + reach))){ ++hi; }
+    if(lo >= hi){ continue; }
+
+    // link this voxel to the window, unless the previous voxel with the same label already has been, and
+    // join the voxels of the window that haven't been joined already
+    if((linked != lo) || (label_a[a] != label_a[(a - 1)])){ SlabUnion(uf_parent,label_a[a],label_b[lo]); linked = lo; }
+    if(joined < lo){ joined = lo; }
+    for(; (joined + 1) < hi; ++joined){ if(label_b[joined] != label_b[(joined + 1)]){ SlabUnion(uf_parent,label_b[joined],label_b[(joined + 1)]); } }
+
+  }
+
+}
+
+template <typename DataT, typename FlagT, typename PropsT>
+static FlagT LinkObjectsDilate(DataT * data_vals, FlagT * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, FlagT flag_value, FlagT start_obj, vector<PropsT *> & detections, vector<FlagT> & obj_ids, vector<FlagT> & check_obj_ids, int obj_limit, int max_x_val, int max_y_val, int max_z_val, int ss_mode, long int * data_metric, int * xyz_order, int products){
+
+  FlagT obj,label;
+  int x,y,z,k,size_kx,size_ky,size_kz,reach_y,last_x,cur,prev;
+  int x_start,y_start,x_finish,y_finish,z_finish;
+  int temp_vals[3];
+  long int index, plane, NOscanned;
+  double sweep_start;
+  bool source;
+  vector<int> reach, last_y, last_z, row_pos[2];
+  vector<link_offset> stencil;
+  vector<long int> row_start[2];
+  vector<FlagT> row_label[2], uf_parent;
+  vector<char> free_ids;
+  check_id_set check_set;
+  srep_arena<DataT> & arena = *(detections[0][0].GetArena());
+
+  // convert the merging lengths in the same manner as CreateObjects
+  --merge_x;
+  --merge_y;
+  --merge_z;
+
+  // reorder the datacube and subcube limits to be in x,y,z order
+  temp_vals[0] = chunk_x_start; temp_vals[1] = chunk_y_start; temp_vals[2] = chunk_z_start;
+  chunk_x_start = ReorderAxis(temp_vals,xyz_order[0],0);
+  chunk_y_start = ReorderAxis(temp_vals,xyz_order[1],1);
+  chunk_z_start = ReorderAxis(temp_vals,xyz_order[2],2);
+  temp_vals[0] = size_x; temp_vals[1] = size_y; temp_vals[2] = size_z;
+  size_x = ReorderAxis(temp_vals,xyz_order[0],0);
+  size_y = ReorderAxis(temp_vals,xyz_order[1],1);
+  size_z = ReorderAxis(temp_vals,xyz_order[2],2);
+  temp_vals[0] = max_x_val; temp_vals[1] = max_y_val; temp_vals[2] = max_z_val;
+  max_x_val = ReorderAxis(temp_vals,xyz_order[0],0);
+  max_y_val = ReorderAxis(temp_vals,xyz_order[1],1);
+  max_z_val = ReorderAxis(temp_vals,xyz_order[2],2);
+
+  // 0. initialise variables and arrays
+  obj = start_obj;
+  x_start = 0;
+  y_start = 0;
+  if(chunk_x_start > 0){ x_start = merge_x + 1; }
+  if(chunk_y_start > 0){ y_start = merge_y + 1; }
+  x_finish = size_x;
+  if((chunk_x_start + x_finish) > max_x_val){ x_finish = max_x_val - chunk_x_start; }
+  y_finish = size_y;
+  if((chunk_y_start + y_finish) > max_y_val){ y_finish = max_y_val - chunk_y_start; }
+  z_finish = size_z;
+  if((chunk_z_start + z_finish) > max_z_val){ z_finish = max_z_val - chunk_z_start; }
+  if(z_finish < 0){ z_finish = 0; }
+  InitObjIDs(obj_ids,free_ids,arena.stats);
+  InitCheckIDs(check_obj_ids,check_set,detections,obj_limit);
+
+  // object IDs from previous chunks occupy the labels below start_obj
+  uf_parent.reserve((start_obj + 100000));
+  for(label = 0; label < start_obj; ++label){ uf_parent.push_back(label); }
+
+  // set up the dilation kernel, and the reach along x of the links between dilated voxels for each
+  // offset along y --- a merging length of 0 only links voxels on the same line
+  size_kz = (merge_z >= 0) ? (merge_z + 1) : 1;
+  if(ss_mode == 1){
+
+    size_kx = (merge_x >= 0) ? (merge_x + 1) : 1;
+    size_ky = (merge_y >= 0) ? (merge_y + 1) : 1;
+    reach_y = (merge_y >= 0) ? 1 : 0;
+    reach.resize((reach_y + 1),((merge_x >= 0) ? 1 : 0));
+
+  } else {
+
+    // the reach along x for each offset along y is the half-width of the stencil of CreateObjects
+    size_kx = 1;
+    size_ky = 1;
+    reach_y = merge_y + 1;
+    reach.resize((reach_y + 1),-1);
+    CreateStencil(stencil,ss_mode,merge_x,merge_y,(long int) data_metric[0],(long int) data_metric[1]);
+    for(k = 0; k < ((int) stencil.size()); ++k){
+
+      if((stencil[k].dy >= 0) && (stencil[k].dx > reach[stencil[k].dy])){ reach[stencil[k].dy] = stencil[k].dx; }
+
+    }
+
+  }
+  last_y.resize(size_x);
+  last_z.resize(((long int) size_x * (long int) size_y),-size_kz);
+
+  // 1. dilate the mask one plane at a time, and label the dilated voxels of the plane by linking them
+  // to the dilated voxels of the same plane and of the previous plane
+  NOscanned = 0;
+  sweep_start = arena.stats.collect ? WallTime() : 0.0;
+  for(z = 0; z < z_finish; ++z){
+
+    cur = z % 2;
+    prev = 1 - cur;
+    row_start[cur].resize(0);
+    row_pos[cur].resize(0);
+    row_label[cur].resize(0);
+    for(x = 0; x < size_x; ++x){ last_y[x] = -size_ky; }
+
+    for(y = 0; y < size_y; ++y){
+
+      row_start[cur].push_back(row_pos[cur].size());
+      last_x = -size_kx;
+      for(x = 0; x < size_x; ++x){
+
+	index = ((long int) z * data_metric[2]) + ((long int) y * data_metric[1]) + ((long int) x * data_metric[0]);
+	plane = ((long int) y * (long int) size_x) + (long int) x;
+
+	// objects from previous chunks are linked wherever they are, new source voxels only within the
+	// region that is linked by this chunk
+	source = ((flag_vals[index] >= 0) && (flag_vals[index] < start_obj)) || ((flag_vals[index] == flag_value) && (x >= x_start) && (x < x_finish) && (y >= y_start) && (y < y_finish));
+
+	// dilate along x, y and z in turn
+	if(source){ last_x = x; }
+	if((x - last_x) < size_kx){ last_y[x] = y; }
+	if((y - last_y[x]) < size_ky){ last_z[plane] = z; }
+	if((z - last_z[plane]) >= size_kz){ continue; }
+
+	// dilated voxels along a row that are within reach of each other share a label
+	if((((long int) row_pos[cur].size()) > row_start[cur].back()) && ((x - row_pos[cur].back()) <= reach[0])){
+
+	  label = row_label[cur].back();
+
+	} else {
+
+	  if(((long int) uf_parent.size()) >= ((long int) numeric_limits<FlagT>::max())){
+
+	    std::cerr << "ERROR: The number of voxels to be linked exceeds the range of the object labels." << std::endl;
+	    return obj;
+
+	  }
+	  label = uf_parent.size();
+	  uf_parent.push_back(label);
+
+	}
+	row_pos[cur].push_back(x);
+	row_label[cur].push_back(label);
+
+	// give each source voxel the label of the dilated voxel at its own position
+	if(source){ if(flag_vals[index] == flag_value){ flag_vals[index] = label; ++NOscanned; } else { SlabUnion(uf_parent,flag_vals[index],label); } }
+
+	// for(x = 0; x < size_x; ++x)
+      }
+
+      // link the row to the rows before it within this plane, and to the rows of the previous plane
+      for(k = 1; (k <= reach_y) && (k <= y); ++k){
+
+	if(reach[k] >= 0){ LinkRows(uf_parent,row_pos[cur],row_label[cur],row_start[cur][y],row_pos[cur].size(),row_pos[cur],row_label[cur],row_start[cur][(y - k)],row_start[cur][(y - k + 1)],reach[k]); }
+
+      }
+      if((z > 0) && (merge_z >= 0)){
+
+	for(k = -reach_y; k <= reach_y; ++k){
+
+	  if(((y + k) < 0) || ((y + k) >= size_y) || (reach[abs(k)] < 0)){ continue; }
+	  LinkRows(uf_parent,row_pos[cur],row_label[cur],row_start[cur][y],row_pos[cur].size(),row_pos[prev],row_label[prev],row_start[prev][(y + k)],row_start[prev][(y + k + 1)],reach[abs(k)]);
+
+	}
+
+      }
+
+      // for(y = 0; y < size_y; ++y)
+    }
+    row_start[cur].push_back(row_pos[cur].size());
+
+    // report the progress once per plane, and stop if the linking has been cancelled
+    if(arena.Progress((z + 1),z_finish)){ break; }
+
+    // for(z = 0; z < z_finish; ++z)
+  }
+  arena.stats.voxels_scanned+=NOscanned;
+  if(arena.stats.collect){ arena.stats.sweep_time+=(WallTime() - sweep_start); }
+
+  // a cancelled linking is abandoned, and the caller releases the objects
+  if(arena.cancelled){ return obj; }
+
+  // 2. create, size threshold and label the objects, and generate their sparse representations
+  obj = CreateLinkedObjects(data_vals,flag_vals,size_x,size_y,size_z,chunk_x_start,chunk_y_start,chunk_z_start,merge_x,merge_y,merge_z,min_x_size,min_y_size,min_z_size,min_v_size,start_obj,obj,detections,obj_ids,free_ids,check_obj_ids,check_set,obj_limit,max_x_val,max_y_val,max_z_val,x_start,y_start,x_finish,y_finish,z_finish,uf_parent,data_metric,1,products);
+
+  // 3. return the number of coherent objects
+  return obj;
+
+}
+
+// functions using floats
+
+int CreateObjectsMT(float * data_vals, int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, float intens_thresh_min, float intens_thresh_max, int flag_value, int start_obj, vector<object_props *> & detections, vector<int> & obj_ids, vector<int> & check_obj_ids, int obj_limit, int max_x_val, int max_y_val, int max_z_val, int ss_mode, long int * data_metric, int * xyz_order, int NOthreads, int products){
+
+  return LinkObjectsSlab(data_vals,flag_vals,size_x,size_y,size_z,chunk_x_start,chunk_y_start,chunk_z_start,merge_x,merge_y,merge_z,min_x_size,min_y_size,min_z_size,min_v_size,flag_value,start_obj,detections,obj_ids,check_obj_ids,obj_limit,max_x_val,max_y_val,max_z_val,ss_mode,data_metric,xyz_order,NOthreads,products);
+
+}
+
+int CreateObjectsDil(float * data_vals, int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, float intens_thresh_min, float intens_thresh_max, int flag_value, int start_obj, vector<object_props *> & detections, vector<int> & obj_ids, vector<int> & check_obj_ids, int obj_limit, int max_x_val, int max_y_val, int max_z_val, int ss_mode, long int * data_metric, int * xyz_order, int products){
+
+  return LinkObjectsDilate(data_vals,flag_vals,size_x,size_y,size_z,chunk_x_start,chunk_y_start,chunk_z_start,merge_x,merge_y,merge_z,min_x_size,min_y_size,min_z_size,min_v_size,flag_value,start_obj,detections,obj_ids,check_obj_ids,obj_limit,max_x_val,max_y_val,max_z_val,ss_mode,data_metric,xyz_order,products);
+
+}
+
+long int CreateObjectsMT(float * data_vals, long int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, float intens_thresh_min, float intens_thresh_max, long int flag_value, long int start_obj, vector<object_props *> & detections, vector<long int> & obj_ids, vector<long int> & check_obj_ids, int obj_limit, int max_x_val, int max_y_val, int max_z_val, int ss_mode, long int * data_metric, int * xyz_order, int NOthreads, int products){
+
+  return LinkObjectsSlab(data_vals,flag_vals,size_x,size_y,size_z,chunk_x_start,chunk_y_start,chunk_z_start,merge_x,merge_y,merge_z,min_x_size,min_y_size,min_z_size,min_v_size,flag_value,start_obj,detections,obj_ids,check_obj_ids,obj_limit,max_x_val,max_y_val,max_z_val,ss_mode,data_metric,xyz_order,NOthreads,products);
+
+}
+
+long int CreateObjectsDil(float * data_vals, long int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, float intens_thresh_min, float intens_thresh_max, long int flag_value, long int start_obj, vector<object_props *> & detections, vector<long int> & obj_ids, vector<long int> & check_obj_ids, int obj_limit, int max_x_val, int max_y_val, int max_z_val, int ss_mode, long int * data_metric, int * xyz_order, int products){
+
+  return LinkObjectsDilate(data_vals,flag_vals,size_x,size_y,size_z,chunk_x_start,chunk_y_start,chunk_z_start,merge_x,merge_y,merge_z,min_x_size,min_y_size,min_z_size,min_v_size,flag_value,start_obj,detections,obj_ids,check_obj_ids,obj_limit,max_x_val,max_y_val,max_z_val,ss_mode,data_metric,xyz_order,products);
+
+}
+
+// functions using doubles
+
+int CreateObjectsMT(double * data_vals, int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, double intens_thresh_min, double intens_thresh_max, int flag_value, int start_obj, vector<object_props_dbl *> & detections, vector<int> & obj_ids, vector<int> & check_obj_ids, int obj_limit, int max_x_val, int max_y_val, int max_z_val, int ss_mode, long int * data_metric, int * xyz_order, int NOthreads, int products){
+
+  return LinkObjectsSlab(data_vals,flag_vals,size_x,size_y,size_z,chunk_x_start,chunk_y_start,chunk_z_start,merge_x,merge_y,merge_z,min_x_size,min_y_size,min_z_size,min_v_size,flag_value,start_obj,detections,obj_ids,check_obj_ids,obj_limit,max_x_val,max_y_val,max_z_val,ss_mode,data_metric,xyz_order,NOthreads,products);
+
+}
+
+int CreateObjectsDil(double * data_vals, int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, double intens_thresh_min, double intens_thresh_max, int flag_value, int start_obj, vector<object_props_dbl *> & detections, vector<int> & obj_ids, vector<int> & check_obj_ids, int obj_limit, int max_x_val, int max_y_val, int max_z_val, int ss_mode, long int * data_metric, int * xyz_order, int products){
+
+  return LinkObjectsDilate(data_vals,flag_vals,size_x,size_y,size_z,chunk_x_start,chunk_y_start,chunk_z_start,merge_x,merge_y,merge_z,min_x_size,min_y_size,min_z_size,min_v_size,flag_value,start_obj,detections,obj_ids,check_obj_ids,obj_limit,max_x_val,max_y_val,max_z_val,ss_mode,data_metric,xyz_order,products);
+
+}
+
+long int CreateObjectsMT(double * data_vals, long int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, double intens_thresh_min, double intens_thresh_max, long int flag_value, long int start_obj, vector<object_props_dbl *> & detections, vector<long int> & obj_ids, vector<long int> & check_obj_ids, int obj_limit, int max_x_val, int max_y_val, int max_z_val, int ss_mode, long int * data_metric, int * xyz_order, int NOthreads, int products){
+
+  return LinkObjectsSlab(data_vals,flag_vals,size_x,size_y,size_z,chunk_x_start,chunk_y_start,chunk_z_start,merge_x,merge_y,merge_z,min_x_size,min_y_size,min_z_size,min_v_size,flag_value,start_obj,detections,obj_ids,check_obj_ids,obj_limit,max_x_val,max_y_val,max_z_val,ss_mode,data_metric,xyz_order,NOthreads,products);
+
+}
+
+long int CreateObjectsDil(double * data_vals, long int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, double intens_thresh_min, double intens_thresh_max, long int flag_value, long int start_obj, vector<object_props_dbl *> & detections, vector<long int> & obj_ids, vector<long int> & check_obj_ids, int obj_limit, int max_x_val, int max_y_val, int max_z_val, int ss_mode, long int * data_metric, int * xyz_order, int products){
+
+  return LinkObjectsDilate(data_vals,flag_vals,size_x,size_y,size_z,chunk_x_start,chunk_y_start,chunk_z_start,merge_x,merge_y,merge_z,min_x_size,min_y_size,min_z_size,min_v_size,flag_value,start_obj,detections,obj_ids,check_obj_ids,obj_limit,max_x_val,max_y_val,max_z_val,ss_mode,data_metric,xyz_order,products);
+
+}
@@ -0,0 +1,914 @@
+#include<iostream>
+#include "RJJ_ObjGen.h"
+
+using namespace std;
+
+// retrieve the range of object strings that the existing sparse representation of an object holds
+// along the line of sight (x,y), which is empty if the line of sight is outside of its grid
+template <typename PropsT>
+static void ExistingStrings(PropsT & obj, int x, int y, int & g_start, int & g_finish){
+
+  g_start = 0;
+  g_finish = 0;
+  if((x < obj.Get_srep_size(0)) || (x > obj.Get_srep_size(1)) || (y < obj.Get_srep_size(2)) || (y > obj.Get_srep_size(3))){ return; }
+  g_start = obj.Get_srep_grid((((y - obj.Get_srep_size(2)) * (obj.Get_srep_size(1) - obj.Get_srep_size(0) + 1)) + x - obj.Get_srep_size(0)));
+  g_finish = obj.Get_srep_grid((((y - obj.Get_srep_size(2)) * (obj.Get_srep_size(1) - obj.Get_srep_size(0) + 1)) + x - obj.Get_srep_size(0) + 1));
+
+}
+
+// generate or update the sparse representations and postage stamp images of every object that
+// overlaps the current chunk, using the object IDs written to the flag_vals array by the linker
+// --- the chunk limits and merging lengths are those already re-ordered and decremented by the caller.
+// When chunk_z_start > 0, the first merge_z + 1 planes of the chunk overlap the previous chunk, and
+// the object strings and postage stamp values from those planes are taken from the existing sparse
+// representations rather than from the flag_vals and data_vals arrays.
+template <typename DataT, typename FlagT, typename PropsT>
+static void UpdateSparseReps(DataT * data_vals, FlagT * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, FlagT obj, vector<PropsT *> & detections, int obj_limit, long int * data_metric, int products){
+
+  FlagT i,obj_batch;
+  int sx,sy,sz,sx_start,sy_start,sz_start,sx_finish,sy_finish,sz_finish,sz_new,z_halo;
+  int g,g_start,g_finish,j,k,NOi,kept_products;
+  double srep_start;
+  srep_arena<DataT> & arena = *(detections[0][0].GetArena());
+  vector<DataT> & temp_mom0 = arena.temp_mom0, & temp_RAPV = arena.temp_RAPV, & temp_DECPV = arena.temp_DECPV, & temp_obj_spec = arena.temp_obj_spec, & temp_ref_spec = arena.temp_ref_spec, & temp_vfield = arena.temp_vfield;
+  vector<int> & temp_sparse_reps_grid = arena.temp_sparse_reps_grid, & temp_sparse_reps_strings = arena.temp_sparse_reps_strings;
+
+  srep_start = arena.stats.collect ? WallTime() : 0.0;
+  z_halo = 0;
+  if(chunk_z_start > 0){ z_halo = merge_z + 1; }
+  for(i = 0; i < obj; ++i){
+    
+    // calculate the obj_batch value for this object
+    obj_batch = i / obj_limit;
+    
+    // move on if this object has been re-initialised
+    if(detections[obj_batch][(i - (obj_batch * obj_limit))].ShowVoxels() < 1){ 
+      continue; 
+      
+    }
+    
+    // move on if this object is not within the boundaries of the current chunk, in other words,
+    // move on if this object doesn't need to have it's sparse representation and postage stamp images updated
+    if((detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmax() < chunk_x_start) || (detections[obj_batch][(i - (obj_batch * obj_limit))].GetDECmax() < chunk_y_start) || (detections[obj_batch][(i - (obj_batch * obj_limit))].GetFREQmax() < chunk_z_start) || (detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmin() >= (chunk_x_start + size_x)) || (detections[obj_batch][(i - (obj_batch * obj_limit))].GetDECmin() >= (chunk_y_start + size_y)) || (detections[obj_batch][(i - (obj_batch * obj_limit))].GetFREQmin() >= (chunk_z_start + size_z))){ 
+      continue; 
+      
+    }
+    
+    // move on if this object's sparse representation and postage stamp images don't need updating
+    if((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) >= 0) && (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_update() == -1)){
+      continue; 
+	
+    }
+          
+    // update the sparse representation for this object
+    
+    // 0. if there is no existing sparse representation and postage stamp images, create them from scratch, 
+    // otherwise concatenate the existing sparse representation and postage stamp images with the updates
+    if((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) < 0) && (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_update() >= 0)){
+      
+      // branch for creating a brand new sparse representation
+      
+      // update the sparse_reps_update array
+      detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_update(-1);
+
+      // initialise the number of object sections that make up this object
+      NOi = 0;   
+      
+      // calculate the edge of the bounding box in `chunk' co-ordinates
+      sx_start = detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmin() - chunk_x_start;
+      if(sx_start < 0){ sx_start = 0; }
+      sx_finish = detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmax() - chunk_x_start;
+      sy_start = detections[obj_batch][(i - (obj_batch * obj_limit))].GetDECmin() - chunk_y_start;
+      if(sy_start < 0){ sy_start = 0; }
+      sy_finish = detections[obj_batch][(i - (obj_batch * obj_limit))].GetDECmax() - chunk_y_start;
+      sz_start = detections[obj_batch][(i - (obj_batch * obj_limit))].GetFREQmin() - chunk_z_start;
+      if(sz_start < 0){ sz_start = 0; }
+      sz_finish = detections[obj_batch][(i - (obj_batch * obj_limit))].GetFREQmax() - chunk_z_start;
+      
+      // count the number of object sections that make up this object
+      for(sy = sy_start; (sy <= sy_finish) && (sy < size_y); ++sy){
+	
+	for(sx = sx_start; (sx <= sx_finish) && (sx < size_x); ++sx){
+	  
+	  // initialise the dummy integer j
+	  j = -1;
+	  
+	  for(sz = sz_start; (sz <= sz_finish) && (sz < size_z); ++sz){
+	    
+	    // change j to reflect if this voxel in the flag_vals array belongs to the source
+	    if(flag_vals[((sz * data_metric[2]) + (sy * data_metric[1]) + (sx * data_metric[0]))] == i){ 
+	      
+	      // if previously this was not part of an object string, j == -1, then increment the number of object strings and
+	      // adjust the value of j
+	      if(j == -1){ ++NOi; }
+	      
+	      // change j to reflect that this voxel belongs to the object
+	      j = 1; 
+	      
+	    } else { j = -1; }
+	    
+	    // for(sz = detections[obj_batch][(obj - (obj_batch * obj_limit))].GetFREQmin() - chunk_z_size; sz <= (detections[obj_batch][(obj - (obj_batch * obj_limit))].GetFREQmax() - chunk_z_size); ++sz)
+	  }
+	  
+	  // for(sx = detections[obj_batch][(obj - (obj_batch * obj_limit))].GetRAmin() - chunk_x_size; sx <= (detections[obj_batch][(obj - (obj_batch * obj_limit))].GetRAmax() - chunk_x_size); ++sx)
+	}
+	
+	// for(sy = detections[obj_batch][(obj - (obj_batch * obj_limit))].GetDECmin() - chunk_y_size; sy <= (detections[obj_batch][(obj - (obj_batch * obj_limit))].GetDECmax() - chunk_y_size); ++sy)
+      }
+
+      // create an array element to store this sparse representation
+      detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_size(0,detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmin());
+      detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_size(1,detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmax());
+      detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_size(2,detections[obj_batch][(i - (obj_batch * obj_limit))].GetDECmin());
+      detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_size(3,detections[obj_batch][(i - (obj_batch * obj_limit))].GetDECmax());
+      detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_size(4,detections[obj_batch][(i - (obj_batch * obj_limit))].GetFREQmin());
+      detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_size(5,detections[obj_batch][(i - (obj_batch * obj_limit))].GetFREQmax());
+      detections[obj_batch][(i - (obj_batch * obj_limit))].Create_srep_grid((((detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmax() - detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmin() + 1) * (detections[obj_batch][(i - (obj_batch * obj_limit))].GetDECmax() - detections[obj_batch][(i - (obj_batch * obj_limit))].GetDECmin() + 1)) + 1));
+      detections[obj_batch][(i - (obj_batch * obj_limit))].Create_srep_strings((2 * NOi));
+      
+      // calculate the extent of the sparse_rep volume
+      sx_finish = detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmax() - detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmin() + 1;
+      sy_finish = detections[obj_batch][(i - (obj_batch * obj_limit))].GetDECmax() - detections[obj_batch][(i - (obj_batch * obj_limit))].GetDECmin() + 1;
+      sz_finish = detections[obj_batch][(i - (obj_batch * obj_limit))].GetFREQmax() - detections[obj_batch][(i - (obj_batch * obj_limit))].GetFREQmin() + 1;
+      
+      // create arrays to store the postage stamp images and initialise them
+      if(products & SREP_MOM0){ detections[obj_batch][(i - (obj_batch * obj_limit))].Create_mom0((sx_finish * sy_finish)); }
+      if(products & SREP_RAPV){ detections[obj_batch][(i - (obj_batch * obj_limit))].Create_RAPV((sx_finish * sz_finish)); }
+      if(products & SREP_DECPV){ detections[obj_batch][(i - (obj_batch * obj_limit))].Create_DECPV((sy_finish * sz_finish)); }
+      if(products & SREP_OSPEC){ detections[obj_batch][(i - (obj_batch * obj_limit))].Create_ospec(sz_finish); }
+      if(products & SREP_RSPEC){
+	if(sz_finish >= 10){
+
+	  detections[obj_batch][(i - (obj_batch * obj_limit))].Create_rspec((2 * sz_finish));
+
+	} else {
+
+	  detections[obj_batch][(i - (obj_batch * obj_limit))].Create_rspec((10 + sz_finish));
+
+	}
+      }
+      if(products & SREP_VFIELD){ detections[obj_batch][(i - (obj_batch * obj_limit))].Create_vfield((sx_finish * sy_finish)); }
+      
+      // initialise the mini_mom0 values
+      if(products & SREP_MOM0){
+	for(sy = 0; sy < sy_finish; ++sy){
+	  for(sx = 0; sx < sx_finish; ++sx){
+	    detections[obj_batch][(i - (obj_batch * obj_limit))].Set_mom0(((sy * sx_finish) + sx),0.0);
+	  }
+	}
+      }
+
+      // initialise the mini_RAPV values
+      if(products & SREP_RAPV){
+	for(sz = 0; sz < sz_finish; ++sz){
+	  for(sx = 0; sx < sx_finish; ++sx){
+	    detections[obj_batch][(i - (obj_batch * obj_limit))].Set_RAPV(((sz * sx_finish) + sx),0.0);
+	  }
+	}
+      }
+      
+      // initialise the mini_DECPV values
+      if(products & SREP_DECPV){
+	for(sz = 0; sz < sz_finish; ++sz){
+	  for(sy = 0; sy < sy_finish; ++sy){
+	    detections[obj_batch][(i - (obj_batch * obj_limit))].Set_DECPV(((sz * sy_finish) + sy),0.0);
+	  }
+	}
+      }
+      
+      // initialise the mini_spec values
+      if(products & SREP_OSPEC){ for(sz = 0; sz < sz_finish; ++sz){ detections[obj_batch][(i - (obj_batch * obj_limit))].Set_ospec(sz,0.0); } }
+      if(products & SREP_RSPEC){
+	if(sz_finish >= 10){
+
+	  for(sz = 0; sz < (2 * sz_finish); ++sz){ detections[obj_batch][(i - (obj_batch * obj_limit))].Set_rspec(sz,0.0); }
+
+	} else {
+
+	  for(sz = 0; sz < (10 + sz_finish); ++sz){ detections[obj_batch][(i - (obj_batch * obj_limit))].Set_rspec(sz,0.0); }
+
+	}
+      }
+            
+      // initialise the mini_vfield values
+      if(products & SREP_VFIELD){
+	for(sy = 0; sy < sy_finish; ++sy){
+	  for(sx = 0; sx < sx_finish; ++sx){
+	    detections[obj_batch][(i - (obj_batch * obj_limit))].Set_vfield(((sy * sx_finish) + sx),0.0);
+	  }
+	}
+      }
+
+      // populate the sparse array representation and postage stamp images
+      NOi = 0;
+      for(sy = 0; sy < sy_finish; ++sy){
+	
+	for(sx = 0; sx < sx_finish; ++sx){
+	  
+	  // write the current number of object strings to the grid
+	  detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_grid(((sy * sx_finish) + sx),NOi);
+	  
+	  // initialise the dummy integer j 
+	  j = -1;
+	  
+	  for(sz = 0; sz < sz_finish; ++sz){
+	    
+	    // change j to reflect if this voxel in the flag_vals array belongs to the source
+	    if(flag_vals[(((sz + sz_start) * data_metric[2]) + ((sy + sy_start) * data_metric[1]) + ((sx + sx_start) * data_metric[0]))] == i){ 
+	      
+	      // update mini_mom0
+	      if(products & SREP_MOM0){ detections[obj_batch][(i - (obj_batch * obj_limit))].Add_mom0(((sy * sx_finish) + sx),data_vals[(((sz + sz_start) * data_metric[2]) + ((sy + sy_start) * data_metric[1]) + ((sx + sx_start) * data_metric[0]))]); }
+	      
+	      // update mini_RAPV
+	      if(products & SREP_RAPV){ detections[obj_batch][(i - (obj_batch * obj_limit))].Add_RAPV(((sz * sx_finish) + sx),data_vals[(((sz + sz_start) * data_metric[2]) + ((sy + sy_start) * data_metric[1]) + ((sx + sx_start) * data_metric[0]))]); }
+	      
+	      // update mini_DECPV
+	      if(products & SREP_DECPV){ detections[obj_batch][(i - (obj_batch * obj_limit))].Add_DECPV(((sz * sy_finish) + sy),data_vals[(((sz + sz_start) * data_metric[2]) + ((sy + sy_start) * data_metric[1]) + ((sx + sx_start) * data_metric[0]))]); }
+	      
+	      // update mini_obj_spec
+	      if(products & SREP_OSPEC){ detections[obj_batch][(i - (obj_batch * obj_limit))].Add_ospec(sz,data_vals[(((sz + sz_start) * data_metric[2]) + ((sy + sy_start) * data_metric[1]) + ((sx + sx_start) * data_metric[0]))]); }
+  
+	      // update mini_vfield
+	      if(products & SREP_VFIELD){ detections[obj_batch][(i - (obj_batch * obj_limit))].Add_vfield(((sy * sx_finish) + sx),(((DataT) (sz + sz_start + chunk_z_start)) * data_vals[(((sz + sz_start) * data_metric[2]) + ((sy + sy_start) * data_metric[1]) + ((sx + sx_start) * data_metric[0]))])); }
+	      
+	      // if previously this was not part of an object string, j == -1, then increment the number of object strings and
+	      // write the position to the sparse_reps array
+	      if(j == -1){ 
+		
+		// write the beginning of the object string to sparse_reps
+		detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_strings((2 * NOi),(sz_start + chunk_z_start + sz));
+		
+		// increment NOi
+		++NOi; 
+		
+		// initialise the end of the object string in sparse_reps
+		detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_strings(((2 * NOi) - 1),(sz_start + chunk_z_start + sz));
+
+	      } else {
+		
+		// update the end of the object string in sparse_reps
+		detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_strings(((2 * NOi) - 1),(sz_start + chunk_z_start + sz));
+		
+	      }
+	      
+	      // change j to reflect that this voxel belongs to the object
+	      j = 1; 
+	      
+	    } else { 
+	      
+	      // change j to reflect that this voxel doesn't belong to the object
+	      j = -1; 
+	      
+	    }
+	    
+	    // for(sz = detections[obj_batch][(obj - (obj_batch * obj_limit))].GetFREmin() - chunk_z_start + 1; sz <= (detections[obj_batch][(obj - (obj_batch * obj_limit))].GetFREQmax() - chunk_z_start + 1); ++sz)
+	  }
+	  
+	  // for(sx = detections[obj_batch][(obj - (obj_batch * obj_limit))].GetRAmin() - chunk_x_start + 1; sx <= (detections[obj_batch][(obj - (obj_batch * obj_limit))].GetRAmax() - chunk_x_start + 1); ++sx)
+	}
+	
+	//for(sy = detections[obj_batch][(obj - (obj_batch * obj_limit))].GetDECmin() - chunk_y_start + 1; sy <= (detections[obj_batch][(obj - (obj_batch * obj_limit))].GetDECmax() - chunk_y_start + 1); ++sy)
+      }
+            
+      // update sparse_reps with the final value of NOi
+      detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_grid((sx_finish * sy_finish),NOi);
+            
+      // create the reference spectrum
+      if(products & SREP_RSPEC){
+	if(sz_finish >= 10){
+	
+	  for(sz = -1 * (int) floorf((0.5 * (float) sz_finish)); sz < (sz_finish + ((int) floorf((0.5 * (float) sz_finish)))); ++sz){
+	  
+	    for(sy = 0; sy < sy_finish; ++sy){
+	  
+	      for(sx = 0; sx < sx_finish; ++sx){
+	    
+		if(((sz + sz_start) >= 0) && ((sz + sz_start) < size_z)){
+		
+		  // update mini_ref_spec	
+		  detections[obj_batch][(i - (obj_batch * obj_limit))].Add_rspec((sz + ((int) floorf((0.5 * (float) sz_finish)))),data_vals[(((sz + sz_start) * data_metric[2]) + ((sy + sy_start) * data_metric[1]) + ((sx + sx_start) * data_metric[0]))]);	
+		
+		}
+	      
+	      }
+	    
+	    }
+      
+	  }
+
+	  // if(sz_finish >= 10)
+	} else {
+
+	  for(sz = -5; sz < (sz_finish + 5); ++sz){
+	  
+	    for(sy = 0; sy < sy_finish; ++sy){
+	  
+	      for(sx = 0; sx < sx_finish; ++sx){
+	    
+		if(((sz + sz_start) >= 0) && ((sz + sz_start) < size_z)){
+		
+		  // update mini_ref_spec
+		  detections[obj_batch][(i - (obj_batch * obj_limit))].Add_rspec((sz + 5),data_vals[(((sz + sz_start) * data_metric[2]) + ((sy + sy_start) * data_metric[1]) + ((sx + sx_start) * data_metric[0]))]);	
+		
+		}
+	      
+	      }
+	    
+	    }
+      
+	  }
+
+	  // else . . . if(sz_finish >= 10)
+	}
+      }
+      
+     // if(sparse_reps[obj_batch][(obj - (obj_batch * obj_limit))][0] < 0) . . . else
+    } else {
+            
+      // branch for updating an existing sparse representation
+      
+      // count the number of object strings comprising the object
+      
+      // 1. initialise the number of object strings
+      NOi = 0;
+
+      // only the postage stamp images that are requested and held by the existing representation are carried over
+      kept_products = products & detections[obj_batch][(i - (obj_batch * obj_limit))].Get_products();
+      
+      // 2. convert the new bounding box of the object into `chunk' co-ordinates
+      sx_start = detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmin() - chunk_x_start;
+      sx_finish = detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmax() - chunk_x_start;
+      sy_start = detections[obj_batch][(i - (obj_batch * obj_limit))].GetDECmin() - chunk_y_start;
+      sy_finish = detections[obj_batch][(i - (obj_batch * obj_limit))].GetDECmax() - chunk_y_start;
+      sz_start = detections[obj_batch][(i - (obj_batch * obj_limit))].GetFREQmin() - chunk_z_start;
+      sz_finish = detections[obj_batch][(i - (obj_batch * obj_limit))].GetFREQmax() - chunk_z_start;
+
+      // only the planes that haven't been processed by a previous chunk are read from the flag_vals array
+      sz_new = sz_start;
+      if(sz_new < z_halo){ sz_new = z_halo; }
+      
+      // 3. search through the bounding box, and do one of the following
+      // 3.a if inside the chunk and outside the existing sparse rep grid, run the routine to count the number
+      //     of object strings along the current line of sight
+      // 3.b otherwise use the grid value to increment NOi
+      for(sy = sy_start; sy <= sy_finish; ++sy){
+	
+	for(sx = sx_start; sx <= sx_finish; ++sx){
+	  	  
+	  // case 3.a triggered
+	  if(((sx > merge_x) || (chunk_x_start == 0)) && ((sy > merge_y) || (chunk_y_start == 0))){
+	    	    
+	    // initialise the dummy integer j 
+	    j = -1;
+
+	    // count the object strings from the planes processed by previous chunks, and continue the last
+	    // of them if it reaches the first new plane
+	    if(z_halo > 0){
+
+	      ExistingStrings(detections[obj_batch][(i - (obj_batch * obj_limit))],(sx + chunk_x_start),(sy + chunk_y_start),g_start,g_finish);
+	      NOi+=(g_finish - g_start);
+	      if((g_finish > g_start) && (sz_new == z_halo) && (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_strings(((2 * g_finish) - 1)) == (chunk_z_start + z_halo - 1))){ j = 1; }
+
+	    }
+	    
+	    for(sz = sz_new; sz <= sz_finish; ++sz){
+	      
+	      // change i to reflect if this voxel in the flag_vals array belongs to the source
+	      if(flag_vals[((sz * data_metric[2]) + (sy * data_metric[1]) + (sx * data_metric[0]))] == i){ 
+		
+		// if previously this was not part of an object string, i == -1, then increment the number of object strings and
+		// write the position to the sparse_reps array
+		if(j == -1){ 
+		  
+		  // increment NOi
+		  ++NOi; 
+		  
+		} 
+		
+		// change j to reflect that this voxel belongs to the object
+		j = 1; 
+		
+	      } else { j = -1; }
+	      
+	      // for(sz = sz_start; sz <= sz_finish; ++sz)
+	    }
+	    
+	  } else {
+	    
+	    // case 3.b triggered  
+	    NOi+=(detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_grid((((sy + chunk_y_start - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2)) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) + sx + chunk_x_start - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_grid((((sy + chunk_y_start - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2)) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) + sx + chunk_x_start - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0))));
+	    
+	  }     
+	  
+	  // for(sx = sx_start; sx <= sx_finish; ++sx)
+	}
+	
+	// for(sy = sy_start; sy <= sy_finish; ++sy)
+      }
+      
+      // 4. allocate memory to store temporary sparse representation and postage stamp images, then
+      //    initialise the postage stamp image arrays
+      temp_sparse_reps_grid.resize((((sx_finish - sx_start + 1) * (sy_finish - sy_start + 1)) + 1));
+      temp_sparse_reps_strings.resize((2 * NOi));
+      if(products & SREP_MOM0){
+	temp_mom0.resize(0);
+	for(sy = 0; sy < (sy_finish - sy_start + 1); ++sy){
+	  for(sx = 0; sx < (sx_finish - sx_start + 1); ++sx){
+	    temp_mom0.push_back(0.0);
+	  }
+	}
+      }
+      if(products & SREP_RAPV){
+	temp_RAPV.resize(0);
+	for(sz = 0; sz < (sz_finish - sz_start + 1); ++sz){
+	  for(sx = 0; sx < (sx_finish - sx_start + 1); ++sx){
+	    temp_RAPV.push_back(0.0);
+	  }
+	}
+      }
+      if(products & SREP_DECPV){
+	temp_DECPV.resize(0);
+	for(sz = 0; sz < (sz_finish - sz_start + 1); ++sz){
+	  for(sy = 0; sy < (sy_finish - sy_start + 1); ++sy){
+	    temp_DECPV.push_back(0.0);
+	  }
+	}
+      }
+      if(products & SREP_OSPEC){
+	temp_obj_spec.resize(0);
+	for(sz = 0; sz < (sz_finish - sz_start + 1); ++sz){ temp_obj_spec.push_back(0.0); }
+      }
+      if(products & SREP_RSPEC){
+	if((sz_finish - sz_start + 1) >= 10){
+
+	  temp_ref_spec.resize(0);
+	  for(sz = 0; sz < (2 * (sz_finish - sz_start + 1)); ++sz){ temp_ref_spec.push_back(0.0); }
+
+	} else {
+
+	  temp_ref_spec.resize(0);
+	  for(sz = 0; sz < (sz_finish - sz_start + 11); ++sz){ temp_ref_spec.push_back(0.0); }
+
+	}
+      }
+      if(products & SREP_VFIELD){
+	temp_vfield.resize(0);
+	for(sy = 0; sy < (sy_finish - sy_start + 1); ++sy){
+	  for(sx = 0; sx < (sx_finish - sx_start + 1); ++sx){
+	    temp_vfield.push_back(0.0);
+	  }
+	}
+      }
+     
+      // 5. populate temp_sparse_rep arrays
+      // 5.a if inside the chunk and outside the existing sparse rep grid, run the routine to count the number
+      //     of object strings along the current line of sight, populate new strings array and add values to new 
+      //     postage stamp images
+      // 5.b if outside of the chunk, use the grid value to increment NOi, populate strings array from previous version and 
+      //     fill in valuese for postage stamp images
+
+      // initialise number of object strings
+      NOi = 0;
+      
+      // initialise RA PV image
+      if(kept_products & SREP_RAPV){
+	for(sz = 0; sz < (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1); ++sz){
+
+	  for(sx = 0; sx < (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1); ++sx){
+	
+	    temp_RAPV[(((sz + detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) - sz_start - chunk_z_start) * (sx_finish - sx_start + 1)) + sx + detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) - sx_start - chunk_x_start)]+=detections[obj_batch][(i - (obj_batch * obj_limit))].Get_RAPV(((sz * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) + sx));
+	  
+	  }
+
+	}
+      }
+
+      // initialise Dec PV image
+      if(kept_products & SREP_DECPV){
+	for(sz = 0; sz < (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1); ++sz){
+
+	  for(sy = 0; sy < (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2) + 1); ++sy){
+	
+	    temp_DECPV[(((sz + detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) - sz_start - chunk_z_start) * (sy_finish - sy_start + 1)) + sy + detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2) - sy_start - chunk_y_start)]+=detections[obj_batch][(i - (obj_batch * obj_limit))].Get_DECPV(((sz * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2) + 1)) + sy));
+	  
+	  }
+
+	}
+      }
+
+      // initialise mini spec's
+      if(kept_products & SREP_OSPEC){ for(sz = 0; sz < (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1); ++sz){ temp_obj_spec[(sz + detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) - sz_start - chunk_z_start)]+=detections[obj_batch][(i - (obj_batch * obj_limit))].Get_ospec(sz); } }
+
+      if(kept_products & SREP_RSPEC){
+	if((sz_finish - sz_start + 1) >= 10){
+
+	  j = sz_start + chunk_z_start - ((int) floorf((0.5 * (float) (sz_finish - sz_start + 1))));
+
+	  if((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1) >= 10){
+
+	    k = detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) - ((int) floorf((0.5 * (float) (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1))));
+
+	    for(sz = 0; sz < (2 * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1)); ++sz){
+
+	      temp_ref_spec[(sz + k - j)]+=detections[obj_batch][(i - (obj_batch * obj_limit))].Get_rspec(sz);
+
+	    }
+
+	  } else {
+	  
+	    k = detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) - 5;
+
+	    for(sz = 0; sz < (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 11); ++sz){
+	    
+	      temp_ref_spec[(sz + k - j)]+=detections[obj_batch][(i - (obj_batch * obj_limit))].Get_rspec(sz);
+
+	    }
+	  
+	  }
+
+	} else {
+
+	  j = sz_start + chunk_z_start - 5;
+
+	  if((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1) >= 10){
+
+	    k = detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) - ((int) floorf((0.5 * (float) (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1))));
+
+	    for(sz = 0; sz < (2 * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1)); ++sz){
+
+	      temp_ref_spec[(sz + k - j)]+=detections[obj_batch][(i - (obj_batch * obj_limit))].Get_rspec(sz);
+
+	    }
+
+	  } else {
+	  
+	    k = detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) - 5;
+
+	    for(sz = 0; sz < (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 11); ++sz){
+	    
+	      temp_ref_spec[(sz + k - j)]+=detections[obj_batch][(i - (obj_batch * obj_limit))].Get_rspec(sz);
+
+	    }
+	  
+	  }
+
+	}
+      }
+      
+      // search through LoS's of updated bounding box and take action as dictated by case 5.a or 5.b
+      for(sy = sy_start; sy <= sy_finish; ++sy){
+	
+	for(sx = sx_start; sx <= sx_finish; ++sx){
+	  	  
+	  // add value to temp_sparse_rep_grid
+	  temp_sparse_reps_grid[(((sy - sy_start) * (sx_finish - sx_start + 1)) + sx - sx_start)] = NOi;
+	  
+	  // case 5.a triggered for moment-0 image and sparse representation
+	  if(((sx > merge_x) || (chunk_x_start == 0)) && ((sy > merge_y) || (chunk_y_start == 0))){
+	    
+	    // initialise the dummy integer j 
+	    j = -1;
+
+	    // copy the object strings and postage stamp values from the planes processed by previous chunks
+	    if(z_halo > 0){
+
+	      ExistingStrings(detections[obj_batch][(i - (obj_batch * obj_limit))],(sx + chunk_x_start),(sy + chunk_y_start),g_start,g_finish);
+	      for(g = g_start; g < g_finish; ++g){
+
+		temp_sparse_reps_strings[(2 * NOi)] = detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_strings((2 * g));
+		temp_sparse_reps_strings[((2 * NOi) + 1)] = detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_strings(((2 * g) + 1));
+		++NOi;
+
+	      }
+	      if((g_finish > g_start) && (sz_new == z_halo) && (temp_sparse_reps_strings[((2 * NOi) - 1)] == (chunk_z_start + z_halo - 1))){ j = 1; }
+
+	      if(((sx + chunk_x_start) >= detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0)) && ((sx + chunk_x_start) <= detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1)) && ((sy + chunk_y_start) >= detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2)) && ((sy + chunk_y_start) <= detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(3))){
+
+		if(kept_products & SREP_MOM0){ temp_mom0[(((sy - sy_start) * (sx_finish - sx_start + 1)) + sx - sx_start)] = detections[obj_batch][(i - (obj_batch * obj_limit))].Get_mom0((((sy + chunk_y_start - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2)) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) + sx + chunk_x_start - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0))); }
+		if(kept_products & SREP_VFIELD){ temp_vfield[(((sy - sy_start) * (sx_finish - sx_start + 1)) + sx - sx_start)] = detections[obj_batch][(i - (obj_batch * obj_limit))].Get_vfield((((sy + chunk_y_start - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2)) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) + sx + chunk_x_start - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0))); }
+
+	      }
+
+	    }
+	    
+	    for(sz = sz_new; sz <= sz_finish; ++sz){
+	      
+	      // change j to reflect if this voxel in the flag_vals array belongs to the source
+	      if(flag_vals[((sz * data_metric[2]) + (sy * data_metric[1]) + (sx * data_metric[0]))] == i){ 
+		
+		// update mini_mom0
+		if(products & SREP_MOM0){ temp_mom0[(((sy - sy_start) * (sx_finish - sx_start + 1)) + sx - sx_start)]+=data_vals[((sz * data_metric[2]) + (sy * data_metric[1]) + (sx * data_metric[0]))]; }
+		
+		// update mini_RAPV
+		if(products & SREP_RAPV){ temp_RAPV[(((sz - sz_start) * (sx_finish - sx_start + 1)) + sx - sx_start)]+=data_vals[((sz * data_metric[2]) + (sy * data_metric[1]) + (sx * data_metric[0]))]; }
+		
+		// update mini_DECPV
+		if(products & SREP_DECPV){ temp_DECPV[(((sz - sz_start) * (sy_finish - sy_start + 1)) + sy - sy_start)]+=data_vals[((sz * data_metric[2]) + (sy * data_metric[1]) + (sx * data_metric[0]))]; }
+		
+		// update mini_obj_spec
+		if(products & SREP_OSPEC){ temp_obj_spec[(sz - sz_start)]+=data_vals[((sz * data_metric[2]) + (sy * data_metric[1]) + (sx * data_metric[0]))]; }
+		
+		// update mini_vfield
+		if(products & SREP_VFIELD){ temp_vfield[(((sy - sy_start) * (sx_finish - sx_start + 1)) + sx - sx_start)]+=(((DataT) (sz + chunk_z_start)) * data_vals[((sz * data_metric[2]) + (sy * data_metric[1]) + (sx * data_metric[0]))]); }
+		
+		// if previously this was not part of an object string, j == -1, then increment the number of object strings and
+		// write the position to the sparse_reps array
+		if(j == -1){ 
+		  
+		  // write the beginning of the object string to sparse_reps
+		  temp_sparse_reps_strings[(2 * NOi)] = chunk_z_start + sz;
+		  
+		  // increment NOi
+		  ++NOi; 
+		  		  
+		  // initialise the end of the object string in sparse_reps
+		  temp_sparse_reps_strings[((2 * NOi) - 1)] = chunk_z_start + sz;
+		  
+		} else {
+		  
+		  // update the end of the object string in sparse_reps
+		  temp_sparse_reps_strings[((2 * NOi) - 1)] = chunk_z_start + sz;
+		  
+		}
+		
+		// change j to reflect that this voxel belongs to the object
+		j = 1; 
+		
+	      } else { 
+		
+		// change j to reflect that this voxel doesn't belong to the object
+		j = -1; 
+		
+	      }
+	      
+	      // for(sz = sz_start; sz <= sz_finish; ++sz)
+	    }
+	    
+	    // add values to temp_ref_spec
+	    if(products & SREP_RSPEC){
+	      if((sz_finish - sz_start + 1) >= 10){
+	      
+		k = (int) floorf((0.5 * (float) (sz_finish - sz_start + 1)));
+	      
+		for(sz = 0; sz < (2 * (sz_finish - sz_start + 1)); ++sz){
+	  	
+		  if(((sz + sz_start - k) >= z_halo) && ((sz + sz_start - k) < size_z)){
+		  
+		    // update mini_ref_spec
+		    temp_ref_spec[sz]+=data_vals[(((sz + sz_start - k) * data_metric[2]) + (sy * data_metric[1]) + (sx * data_metric[0]))];	
+		  
+		  }
+		
+		}
+	      
+		// if(sz_finish >= 10)
+	      } else {
+	      
+		for(sz = 0; sz < (sz_finish - sz_start + 11); ++sz){
+		
+		  if(((sz + sz_start - 5) >= z_halo) && ((sz + sz_start - 5) < size_z)){
+		  
+		    // update mini_ref_spec
+		    temp_ref_spec[sz]+=data_vals[(((sz + sz_start - 5) * data_metric[2]) + (sy * data_metric[1]) + (sx * data_metric[0]))];	
+		  
+		  }
+		
+		}
+	      
+		// else . . . if(sz_finish >= 10)
+	      }
+	    }
+	    
+	  } else {
+	    // case 5.b triggered  
+	    	    
+	    // update temp_sparse_rep_strings
+	    j = 0;
+	    if(((sx + chunk_x_start) >= detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0)) && ((sx + chunk_x_start) <= (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) + 1)) && ((sy + chunk_y_start) >= detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2)) && ((sy + chunk_y_start) <= (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(3) + 1))){
+	      
+	      for(g = detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_grid((((sy + chunk_y_start - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2)) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) + sx + chunk_x_start - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0))); g < detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_grid((((sy + chunk_y_start - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2)) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) + sx + chunk_x_start - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1)); ++g){
+		
+		temp_sparse_reps_strings[(2 * (NOi + j))] = detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_strings((2 * g));
+		temp_sparse_reps_strings[((2 * (NOi + j)) + 1)] = detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_strings(((2 * g) + 1));
+		++j;
+		
+	      }
+	      
+	      // update moment 0 postage stamp image
+	      if(kept_products & SREP_MOM0){ temp_mom0[(((sy - sy_start) * (detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmax() - detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmin() + 1)) + sx - sx_start)] = detections[obj_batch][(i - (obj_batch * obj_limit))].Get_mom0((((sy + chunk_y_start - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2)) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) + sx + chunk_x_start - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0))); }
+	      
+	      // update vfield postage stamp image
+	      if(kept_products & SREP_VFIELD){ temp_vfield[(((sy - sy_start) * (detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmax() - detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmin() + 1)) + sx - sx_start)] = detections[obj_batch][(i - (obj_batch * obj_limit))].Get_vfield((((sy + chunk_y_start - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2)) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) + sx + chunk_x_start - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0))); }
+
+	      // update NOi
+	      NOi+=(detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_grid((((sy + chunk_y_start - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2)) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) + sx + chunk_x_start - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_grid((((sy + chunk_y_start - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2)) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1)) + sx + chunk_x_start - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0))));
+	      	      
+	    }
+	    
+	    // else . . . case 5.b
+	  }
+	    
+	  // for(sx = sx_start; sx <= sx_finish; ++sx)
+	}
+		
+	// for(sy = sy_start; sy <= sy_finish; ++sy)
+      }
+            
+      temp_sparse_reps_grid[((sx_finish - sx_start + 1) * (sy_finish - sy_start + 1))] = NOi;
+
+      // 6. replace the current sparse representation with the new sparse representation
+      detections[obj_batch][(i - (obj_batch * obj_limit))].ReInit_srep();
+      detections[obj_batch][(i - (obj_batch * obj_limit))].ReInit_mini();
+ 
+      // update the sparse_reps_size array with the new bounding box
+      detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_size(0,detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmin());
+      detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_size(1,detections[obj_batch][(i - (obj_batch * obj_limit))].GetRAmax());
+      detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_size(2,detections[obj_batch][(i - (obj_batch * obj_limit))].GetDECmin());
+      detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_size(3,detections[obj_batch][(i - (obj_batch * obj_limit))].GetDECmax());
+      detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_size(4,detections[obj_batch][(i - (obj_batch * obj_limit))].GetFREQmin());
+      detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_size(5,detections[obj_batch][(i - (obj_batch * obj_limit))].GetFREQmax());
+
+      // update the sparse_reps_update array
+      detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_update(-1);
+          
+      // populate the new sparse_reps and postage stamps
+      detections[obj_batch][(i - (obj_batch * obj_limit))].Create_srep_grid((1 + ((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2) + 1))));
+      detections[obj_batch][(i - (obj_batch * obj_limit))].Create_srep_strings((2 * NOi));
+      if(products & SREP_MOM0){ detections[obj_batch][(i - (obj_batch * obj_limit))].Create_mom0(((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2) + 1))); }
+      if(products & SREP_RAPV){ detections[obj_batch][(i - (obj_batch * obj_limit))].Create_RAPV(((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1))); }
+      if(products & SREP_DECPV){ detections[obj_batch][(i - (obj_batch * obj_limit))].Create_DECPV(((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2) + 1) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1))); }
+      if(products & SREP_VFIELD){ detections[obj_batch][(i - (obj_batch * obj_limit))].Create_vfield(((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2) + 1))); }
+  
+      if(products & SREP_OSPEC){ detections[obj_batch][(i - (obj_batch * obj_limit))].Create_ospec((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1)); }
+      if(products & SREP_RSPEC){
+	if((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1) >= 10){
+       
+	  detections[obj_batch][(i - (obj_batch * obj_limit))].Create_rspec((2 * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1)));
+	
+	} else {
+	
+	  detections[obj_batch][(i - (obj_batch * obj_limit))].Create_rspec((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 11));
+
+	}
+      }
+   
+      for(j = 0; j < (1 + ((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2) + 1))); ++j){ detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_grid(j,temp_sparse_reps_grid[j]); }
+      for(j = 0; j < (2 * NOi); ++j){ detections[obj_batch][(i - (obj_batch * obj_limit))].Set_srep_strings(j,temp_sparse_reps_strings[j]); }
+      if(products & SREP_MOM0){ for(j = 0; j < ((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2) + 1)); ++j){ detections[obj_batch][(i - (obj_batch * obj_limit))].Set_mom0(j,temp_mom0[j]); } }
+      if(products & SREP_RAPV){ for(j = 0; j < ((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1)); ++j){ detections[obj_batch][(i - (obj_batch * obj_limit))].Set_RAPV(j,temp_RAPV[j]); } }
+      if(products & SREP_DECPV){ for(j = 0; j < ((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2) + 1) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1)); ++j){ detections[obj_batch][(i - (obj_batch * obj_limit))].Set_DECPV(j,temp_DECPV[j]); } }
+      if(products & SREP_VFIELD){ for(j = 0; j < ((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(0) + 1) * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(2) + 1)); ++j){ detections[obj_batch][(i - (obj_batch * obj_limit))].Set_vfield(j,temp_vfield[j]); } }
+
+      if(products & SREP_OSPEC){ for(j = 0; j < (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1); ++j){ detections[obj_batch][(i - (obj_batch * obj_limit))].Set_ospec(j,temp_obj_spec[j]); } }
+      if(products & SREP_RSPEC){
+	if((detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1) >= 10){
+
+	  for(j = 0; j < (2 * (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 1)); ++j){ detections[obj_batch][(i - (obj_batch * obj_limit))].Set_rspec(j,temp_ref_spec[j]); }
+	
+	} else {
+
+	  for(j = 0; j < (detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(i - (obj_batch * obj_limit))].Get_srep_size(4) + 11); ++j){ detections[obj_batch][(i - (obj_batch * obj_limit))].Set_rspec(j,temp_ref_spec[j]); }
+
+	}
+      }
+      
+      // else . . . if(sparse_reps[obj_batch][(obj - (obj_batch * obj_limit))][0] < 0)
+    }
+   
+    // for(i = 0; i < obj; ++i)
+  }
+  if(arena.stats.collect){ arena.stats.srep_time+=(WallTime() - srep_start); }
+
+}
+
+// build the requested postage stamp images of the listed objects from their sparse representations,
+// after the linking has finished --- data_vals must cover every voxel of these objects, and the
+// images are accumulated in the same order as UpdateSparseReps does for a single chunk
+template <typename DataT, typename FlagT, typename PropsT>
+static void BuildStamps(DataT * data_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, vector<FlagT> & obj_ids, vector<PropsT *> & detections, int obj_limit, long int * data_metric, int products){
+
+  FlagT obj_batch;
+  size_t n;
+  int x,y,z,g,j,k,nx,ny,nz,NOref;
+  DataT value;
+
+  for(n = 0; n < obj_ids.size(); ++n){
+
+    obj_batch = obj_ids[n] / obj_limit;
+    PropsT & obj = detections[obj_batch][(obj_ids[n] - (obj_batch * obj_limit))];
+    if((obj.ShowVoxels() < 1) || (obj.Get_srep_update() == 0) || (obj.Get_srep_size(0) < 0)){ continue; }
+
+    nx = obj.Get_srep_size(1) - obj.Get_srep_size(0) + 1;
+    ny = obj.Get_srep_size(3) - obj.Get_srep_size(2) + 1;
+    nz = obj.Get_srep_size(5) - obj.Get_srep_size(4) + 1;
+    if(nz >= 10){ k = (int) floorf((0.5 * (float) nz)); NOref = 2 * nz; } else { k = 5; NOref = nz + 10; }
+
+    // replace any existing copies of the requested images with zeroed ones
+    if(products & SREP_MOM0){ obj.Free_mom0(); obj.Create_mom0((nx * ny)); for(j = 0; j < (nx * ny); ++j){ obj.Set_mom0(j,0.0); } }
+    if(products & SREP_RAPV){ obj.Free_RAPV(); obj.Create_RAPV((nx * nz)); for(j = 0; j < (nx * nz); ++j){ obj.Set_RAPV(j,0.0); } }
+    if(products & SREP_DECPV){ obj.Free_DECPV(); obj.Create_DECPV((ny * nz)); for(j = 0; j < (ny * nz); ++j){ obj.Set_DECPV(j,0.0); } }
+    if(products & SREP_OSPEC){ obj.Free_ospec(); obj.Create_ospec(nz); for(j = 0; j < nz; ++j){ obj.Set_ospec(j,0.0); } }
+    if(products & SREP_RSPEC){ obj.Free_rspec(); obj.Create_rspec(NOref); for(j = 0; j < NOref; ++j){ obj.Set_rspec(j,0.0); } }
+    if(products & SREP_VFIELD){ obj.Free_vfield(); obj.Create_vfield((nx * ny)); for(j = 0; j < (nx * ny); ++j){ obj.Set_vfield(j,0.0); } }
+
+    // add the voxels of each object string to the images
+    for(y = 0; y < ny; ++y){
+
+      for(x = 0; x < nx; ++x){
+
+	for(g = obj.Get_srep_grid(((y * nx) + x)); g < obj.Get_srep_grid(((y * nx) + x + 1)); ++g){
+
+	  for(z = obj.Get_srep_strings((2 * g)); z <= obj.Get_srep_strings(((2 * g) + 1)); ++z){
+
+	    value = data_vals[(((z - chunk_z_start) * data_metric[2]) + ((y + obj.Get_srep_size(2) - chunk_y_start) * data_metric[1]) + ((x + obj.Get_srep_size(0) - chunk_x_start) * data_metric[0]))];
+	    if(products & SREP_MOM0){ obj.Add_mom0(((y * nx) + x),value); }
+	    if(products & SREP_RAPV){ obj.Add_RAPV((((z - obj.Get_srep_size(4)) * nx) + x),value); }
+	    if(products & SREP_DECPV){ obj.Add_DECPV((((z - obj.Get_srep_size(4)) * ny) + y),value); }
+	    if(products & SREP_OSPEC){ obj.Add_ospec((z - obj.Get_srep_size(4)),value); }
+	    if(products & SREP_VFIELD){ obj.Add_vfield(((y * nx) + x),(((DataT) z) * value)); }
+
+	  }
+
+	}
+
+      }
+
+    }
+
+    // the reference spectrum sums every line of sight through the bounding box, over a window that
+    // extends beyond the object's frequency range
+    if(products & SREP_RSPEC){
+
+      for(y = 0; y < ny; ++y){
+
+	for(x = 0; x < nx; ++x){
+
+	  for(j = 0; j < (nz + (2 * k)); ++j){
+
+	    z = obj.Get_srep_size(4) - k + j - chunk_z_start;
+	    if((z >= 0) && (z < size_z)){ obj.Add_rspec(j,data_vals[((z * data_metric[2]) + ((y + obj.Get_srep_size(2) - chunk_y_start) * data_metric[1]) + ((x + obj.Get_srep_size(0) - chunk_x_start) * data_metric[0]))]); }
+
+	  }
+
+	}
+
+      }
+
+    }
+
+    // for(n = 0; n < obj_ids.size(); ++n)
+  }
+
+}
+
+// functions using floats
+
+void CreateSparseReps(float * data_vals, int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int obj, vector<object_props *> & detections, int obj_limit, long int * data_metric, int products){
+
+  UpdateSparseReps(data_vals,flag_vals,size_x,size_y,size_z,chunk_x_start,chunk_y_start,chunk_z_start,merge_x,merge_y,merge_z,obj,detections,obj_limit,data_metric,products);
+
+}
+
+void CreateSparseReps(float * data_vals, long int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, long int obj, vector<object_props *> & detections, int obj_limit, long int * data_metric, int products){
+
+  UpdateSparseReps(data_vals,flag_vals,size_x,size_y,size_z,chunk_x_start,chunk_y_start,chunk_z_start,merge_x,merge_y,merge_z,obj,detections,obj_limit,data_metric,products);
+
+}
+
+void BuildPostageStamps(float * data_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, vector<int> & obj_ids, vector<object_props *> & detections, int obj_limit, long int * data_metric, int products){
+
+  BuildStamps(data_vals,size_x,size_y,size_z,chunk_x_start,chunk_y_start,chunk_z_start,obj_ids,detections,obj_limit,data_metric,products);
+
+}
+
+void BuildPostageStamps(float * data_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, vector<long int> & obj_ids, vector<object_props *> & detections, int obj_limit, long int * data_metric, int products){
+
+  BuildStamps(data_vals,size_x,size_y,size_z,chunk_x_start,chunk_y_start,chunk_z_start,obj_ids,detections,obj_limit,data_metric,products);
+
+}
+
+// functions using doubles
+
+void CreateSparseReps(double * data_vals, int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int obj, vector<object_props_dbl *> & detections, int obj_limit, long int * data_metric, int products){
+
+  UpdateSparseReps(data_vals,flag_vals,size_x,size_y,size_z,chunk_x_start,chunk_y_start,chunk_z_start,merge_x,merge_y,merge_z,obj,detections,obj_limit,data_metric,products);
+
+}
+
+void CreateSparseReps(double * data_vals, long int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, long int obj, vector<object_props_dbl *> & detections, int obj_limit, long int * data_metric, int products){
+
+  UpdateSparseReps(data_vals,flag_vals,size_x,size_y,size_z,chunk_x_start,chunk_y_start,chunk_z_start,merge_x,merge_y,merge_z,obj,detections,obj_limit,data_metric,products);
+
+}
+
+void BuildPostageStamps(double * data_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, vector<int> & obj_ids, vector<object_props_dbl *> & detections, int obj_limit, long int * data_metric, int products){
+
+  BuildStamps(data_vals,size_x,size_y,size_z,chunk_x_start,chunk_y_start,chunk_z_start,obj_ids,detections,obj_limit,data_metric,products);
+
+}
+
+void BuildPostageStamps(double * data_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, vector<long int> & obj_ids, vector<object_props_dbl *> & detections, int obj_limit, long int * data_metric, int products){
+
+  BuildStamps(data_vals,size_x,size_y,size_z,chunk_x_start,chunk_y_start,chunk_z_start,obj_ids,detections,obj_limit,data_metric,products);
+
+}
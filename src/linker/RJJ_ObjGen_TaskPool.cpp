@@ -0,0 +1,69 @@
+#include<iostream>
+#include "RJJ_ObjGen.h"
+
+using namespace std;
+
+// start the worker threads of the pool, at least one
+task_pool::task_pool(int NOthreads){
+
+  int i;
+
+  stopping = false;
+  for(i = 0; i < max(NOthreads,1); ++i){ workers.push_back(thread(Work,this)); }
+
+}
+
+// run the tasks that are still queued, and wait for the worker threads to finish
+task_pool::~task_pool(){
+
+  unsigned long int i;
+
+  {
+    lock_guard<mutex> guard(tasks_lock);
+    stopping = true;
+  }
+  tasks_ready.notify_all();
+  for(i = 0; i < workers.size(); ++i){ workers[i].join(); }
+
+}
+
+// the loop of a worker thread: take the first task from the queue and run it, or wait for a task to be
+// submitted, until the pool is stopped and the queue is empty
+void task_pool::Work(task_pool * pool){
+
+  pair<void (*)(void *), void *> task;
+
+  while(true){
+
+    {
+      unique_lock<mutex> guard(pool->tasks_lock);
+      while(!pool->stopping && pool->tasks.empty()){ pool->tasks_ready.wait(guard); }
+      if(pool->tasks.empty()){ return; }
+      task = pool->tasks.front();
+      pool->tasks.pop_front();
+    }
+    task.first(task.second);
+
+  }
+
+}
+
+// queue a task, which is run by the first worker thread that is free
+void task_pool::Submit(void (* task)(void * context), void * context){
+
+  {
+    lock_guard<mutex> guard(tasks_lock);
+    tasks.push_back(pair<void (*)(void *), void *>(task,context));
+  }
+  tasks_ready.notify_one();
+
+}
+
+int task_pool::ShowThreads(){ return (int) workers.size(); }
+
+long int task_pool::ShowQueued(){
+
+  lock_guard<mutex> guard(tasks_lock);
+  return (long int) tasks.size();
+
+}
@@ -1,219 +1,117 @@
 #include<iostream>
+#include<cmath>
 #include "RJJ_ObjGen.h"
 
 using namespace std;
 
-// functions using floats
+// demote an object to a compact record held by the arena, if it has fewer voxels and a fainter peak than
+// the arena's limits. The caller then removes the object, as for an object that fails the thresholds.
+template <typename T>
+static bool CompactObject(srep_arena<T> & arena, T tot_intens, T min_intens, T max_intens, int NOvox){
 
-void ThresholdObjs(vector< object_props *> & detections, int NOobj, int obj_limit, int min_x_size, int min_y_size, int min_z_size, int min_v_size, float intens_thresh_min, float intens_thresh_max, int min_LoS_count){
-  
-  float progress;
-  int i, j, k, obj_batch;
-  
-  progress = 0.0;
-  std::cout << "0 | |:| | : | |:| | 100% complete" << std::endl;
-  for(k = 0; k < NOobj; ++k){
-	
-    // calculate the obj_batch value for the existing object
-    obj_batch = (int) floorf(((float) k / (float) obj_limit));
-	
-    // move to the next object if this one has been re-initialised
-    if(detections[obj_batch][(k - (obj_batch * obj_limit))].ShowVoxels() < 1){ 
+  compact_props<T> record;
 
-      while(progress <= (((float) (k + 1)) / ((float) NOobj))){ std::cout << "*"; std::cout.flush(); progress+=0.05; }
-      continue; 
+  if(NOvox >= arena.compact_voxels){ return false; }
+  record.peak = (tot_intens > 0) ? max_intens : min_intens;
+  if(fabs(record.peak) >= arena.compact_peak){ return false; }
+  record.tot_intens = tot_intens;
+  record.NOvox = NOvox;
+  record.sign = (tot_intens > 0) ? 1 : -1;
+  arena.compact.push_back(record);
+  return true;
 
-    }    
+}
 
-    // count the number of LOSs through this object that contain an object section
-    i = 0;
-    for(j = 0; j < ((detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_size(0) + 1) * (detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_size(2) + 1)); ++j){
+// apply the size, voxel count, intensity and line of sight thresholds to all of the objects. Every
+// threshold is applied to statistics that the objects already hold --- the number of lines of sight
+// that contain object strings is counted while the sparse representations are written --- so the
+// objects are checked concurrently in a single pass. The objects that fail are re-initialised
+// afterwards, one at a time, as their arrays are given back to a shared arena, and so are the objects
+// that pass all but the line of sight threshold and are demoted to compact records.
+template <typename T, typename FlagT, typename PropsT>
+static void ThresholdObjects(vector<PropsT *> & detections, FlagT NOobj, int obj_limit, int min_x_size, int min_y_size, int min_z_size, int min_v_size, T intens_thresh_min, T intens_thresh_max, int min_LoS_count, int NOthreads){
+
+  FlagT k, obj_batch;
+  double start;
+  vector<char> passed, compact;
+  link_stats & stats = detections[0][0].GetArena()->stats;
+
+  if(NOthreads < 1){ NOthreads = 1; }
+  start = stats.collect ? WallTime() : 0.0;
+
+  // 1. check every object that contains voxels against the thresholds
+  passed.assign(NOobj,1);
+  compact.assign(NOobj,0);
+#pragma omp parallel for private(k,obj_batch) schedule(static,1024) num_threads(NOthreads)
+  for(k = 0; k < NOobj; ++k){
 
-      if(detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_grid((j + 1)) > detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_grid(j)){ ++i; }
+    obj_batch = k / obj_limit;
+    PropsT & checked = detections[obj_batch][(k - (obj_batch * obj_limit))];
 
-    }
+    // move to the next object if this one has been re-initialised
+    if(checked.ShowVoxels() < 1){ continue; }
 
-    // apply the thresholds, and if it fails re-initialise the object
-    if(((detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_size(0) + 1) < min_x_size)  || ((detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_size(2) + 1) < min_y_size) || ((detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_size(4) + 1) < min_z_size) || (detections[obj_batch][(k - (obj_batch * obj_limit))].ShowVoxels() < min_v_size) || (detections[obj_batch][(k - (obj_batch * obj_limit))].GetTI() < intens_thresh_min) || (detections[obj_batch][(k - (obj_batch * obj_limit))].GetTI() > intens_thresh_max) || (i < min_LoS_count)){
-
-      // re-initialise object
-      detections[obj_batch][(k - (obj_batch * obj_limit))].ReInit();
-      if((detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_update() != 0) && (detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_size(0) >= 0)){
-	
-	detections[obj_batch][(k - (obj_batch * obj_limit))].ReInit_srep();
-	detections[obj_batch][(k - (obj_batch * obj_limit))].ReInit_mini();
-	
-      }
-      detections[obj_batch][(k - (obj_batch * obj_limit))].ReInit_size();
-      detections[obj_batch][(k - (obj_batch * obj_limit))].Set_srep_update(0);
-
-    } 
-    
-    while(progress <= (((float) (k + 1)) / ((float) NOobj))){ std::cout << "*"; std::cout.flush(); progress+=0.05; }
-      
-    // for(i = 0; i < NO_check_obj_ids; ++i)
-  }
-  std::cout << "* done." << std::endl;
+    passed[k] = !((checked.ShowVoxels() < min_v_size) | (checked.GetTI() < intens_thresh_min) | (checked.GetTI() > intens_thresh_max) | ((checked.Get_srep_size(1) - checked.Get_srep_size(0) + 1) < min_x_size) | ((checked.Get_srep_size(3) - checked.Get_srep_size(2) + 1) < min_y_size) | ((checked.Get_srep_size(5) - checked.Get_srep_size(4) + 1) < min_z_size));
+    compact[k] = passed[k] & (checked.ShowVoxels() < checked.GetArena()->compact_voxels);
+    passed[k] = passed[k] & (checked.Get_srep_NOlos() >= min_LoS_count);
 
-}
-
-void ThresholdObjs(vector< object_props *> & detections, long int NOobj, int obj_limit, int min_x_size, int min_y_size, int min_z_size, int min_v_size, float intens_thresh_min, float intens_thresh_max, int min_LoS_count){
-  
-  float progress;
-  int i, j;
-  long int k, obj_batch;
+    // for(k = 0; k < NOobj; ++k)
+  }
 
-  progress = 0.0;
-  std::cout << "0 | |:| | : | |:| | 100% complete" << std::endl;
+  // 2. re-initialise the objects that fail the thresholds or are demoted
   for(k = 0; k < NOobj; ++k){
-	
-    // calculate the obj_batch value for the existing object
-    obj_batch = (long int) floor(((double) k / (double) obj_limit));
-	
-    // move to the next object if this one has been re-initialised
-    if(detections[obj_batch][(k - (obj_batch * obj_limit))].ShowVoxels() < 1){ 
-
-      while(progress <= (((double) (k + 1)) / ((double) NOobj))){ std::cout << "*"; std::cout.flush(); progress+=0.05; }
-      continue; 
 
-    }
-	
-    // count the number of LOSs through this object that contain an object section
-    i = 0;
-    for(j = 0; j < ((detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_size(0) + 1) * (detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_size(2) + 1)); ++j){
+    if(!compact[k] && passed[k]){ continue; }
+    obj_batch = k / obj_limit;
+    PropsT & checked = detections[obj_batch][(k - (obj_batch * obj_limit))];
+    if(compact[k] && !CompactObj(checked) && passed[k]){ continue; }
+    checked.ReInit();
+    if((checked.Get_srep_update() != 0) && (checked.Get_srep_size(0) >= 0)){
 
-      if(detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_grid((j + 1)) > detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_grid(j)){ ++i; }
+      checked.ReInit_srep();
+      checked.ReInit_mini();
 
     }
+    checked.ReInit_size();
+    checked.Set_srep_update(0);
 
-    // apply the thresholds, and if it fails re-initialise the object 
-    if(((detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_size(0) + 1) < min_x_size)  || ((detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_size(2) + 1) < min_y_size) || ((detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_size(4) + 1) < min_z_size) || (detections[obj_batch][(k - (obj_batch * obj_limit))].ShowVoxels() < min_v_size) || (detections[obj_batch][(k - (obj_batch * obj_limit))].GetTI() < intens_thresh_min) || (detections[obj_batch][(k - (obj_batch * obj_limit))].GetTI() > intens_thresh_max) || (i < min_LoS_count)){
-
-      // re-initialise object
-      detections[obj_batch][(k - (obj_batch * obj_limit))].ReInit();
-      if((detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_update() != 0) && (detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_size(0) >= 0)){
-	
-	detections[obj_batch][(k - (obj_batch * obj_limit))].ReInit_srep();
-	detections[obj_batch][(k - (obj_batch * obj_limit))].ReInit_mini();
-	
-      }
-      detections[obj_batch][(k - (obj_batch * obj_limit))].ReInit_size();
-      detections[obj_batch][(k - (obj_batch * obj_limit))].Set_srep_update(0);
-
-    }
-    
-    while(progress <= (((float) (k + 1)) / ((float) NOobj))){ std::cout << "*"; std::cout.flush(); progress+=0.05; }
-      
-    // for(k = 0; k < NOobj; ++k)
   }
-  std::cout << "* done." << std::endl;
+  if(stats.collect){ stats.threshold_time+=(WallTime() - start); }
 
 }
 
-// functions using doubles
-
-void ThresholdObjs(vector< object_props_dbl *> & detections, int NOobj, int obj_limit, int min_x_size, int min_y_size, int min_z_size, int min_v_size, double intens_thresh_min, double intens_thresh_max, int min_LoS_count){
-  
-  float progress;
-  int i, j, k, obj_batch;
-
-  progress = 0.0;
-  std::cout << "0 | |:| | : | |:| | 100% complete" << std::endl;
-  for(k = 0; k < NOobj; ++k){
-	
-    // calculate the obj_batch value for the existing object
-    obj_batch = (int) floorf(((float) k / (float) obj_limit));
-	
-    // move to the next object if this one has been re-initialised
-    if(detections[obj_batch][(k - (obj_batch * obj_limit))].ShowVoxels() < 1){ 
-
-      while(progress <= (((float) (k + 1)) / ((float) NOobj))){ std::cout << "*"; std::cout.flush(); progress+=0.05; }
-      continue; 
+// functions using floats
 
-    }
-	
-    // count the number of LOSs through this object that contain an object section
-    i = 0;
-    for(j = 0; j < ((detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_size(0) + 1) * (detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_size(2) + 1)); ++j){
+void ThresholdObjs(vector< object_props *> & detections, int NOobj, int obj_limit, int min_x_size, int min_y_size, int min_z_size, int min_v_size, float intens_thresh_min, float intens_thresh_max, int min_LoS_count, int NOthreads){
 
-      if(detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_grid((j + 1)) > detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_grid(j)){ ++i; }
+  ThresholdObjects(detections,NOobj,obj_limit,min_x_size,min_y_size,min_z_size,min_v_size,intens_thresh_min,intens_thresh_max,min_LoS_count,NOthreads);
 
-    }
+}
 
-    // apply the thresholds, and if it fails re-initialise the object
-    if(((detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_size(0) + 1) < min_x_size)  || ((detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_size(2) + 1) < min_y_size) || ((detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_size(4) + 1) < min_z_size) || (detections[obj_batch][(k - (obj_batch * obj_limit))].ShowVoxels() < min_v_size) || (detections[obj_batch][(k - (obj_batch * obj_limit))].GetTI() < intens_thresh_min) || (detections[obj_batch][(k - (obj_batch * obj_limit))].GetTI() > intens_thresh_max) || (i < min_LoS_count)){
+void ThresholdObjs(vector< object_props *> & detections, long int NOobj, int obj_limit, int min_x_size, int min_y_size, int min_z_size, int min_v_size, float intens_thresh_min, float intens_thresh_max, int min_LoS_count, int NOthreads){
 
-      // re-initialise object
-      detections[obj_batch][(k - (obj_batch * obj_limit))].ReInit();
-      if((detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_update() != 0) && (detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_size(0) >= 0)){
-	
-	detections[obj_batch][(k - (obj_batch * obj_limit))].ReInit_srep();
-	detections[obj_batch][(k - (obj_batch * obj_limit))].ReInit_mini();
-	
-      }
-      detections[obj_batch][(k - (obj_batch * obj_limit))].ReInit_size();
-      detections[obj_batch][(k - (obj_batch * obj_limit))].Set_srep_update(0);
-
-    }
-    
-    while(progress <= (((float) (k + 1)) / ((float) NOobj))){ std::cout << "*"; std::cout.flush(); progress+=0.05; }
-      
-    // for(i = 0; i < NO_check_obj_ids; ++i)
-  }
-  std::cout << "* done." << std::endl;
+  ThresholdObjects(detections,NOobj,obj_limit,min_x_size,min_y_size,min_z_size,min_v_size,intens_thresh_min,intens_thresh_max,min_LoS_count,NOthreads);
 
 }
 
-void ThresholdObjs(vector< object_props_dbl *> & detections, long int NOobj, int obj_limit, int min_x_size, int min_y_size, int min_z_size, int min_v_size, double intens_thresh_min, double intens_thresh_max, int min_LoS_count){
-  
-  float progress;
-  int i, j;
-  long int k, obj_batch;
+bool CompactObj(object_props & obj){ return CompactObject(*(obj.GetArena()),obj.GetTI(),obj.GetMinI(),obj.GetMaxI(),obj.ShowVoxels()); }
 
-  progress = 0.0;
-  std::cout << "0 | |:| | : | |:| | 100% complete" << std::endl;
-  for(k = 0; k < NOobj; ++k){
-	
-    // calculate the obj_batch value for the existing object
-    obj_batch = (long int) floor(((double) k / (double) obj_limit));
-	
-    // move to the next object if this one has been re-initialised
-    if(detections[obj_batch][(k - (obj_batch * obj_limit))].ShowVoxels() < 1){ 
-
-      while(progress <= (((float) (k + 1)) / ((float) NOobj))){ std::cout << "*"; std::cout.flush(); progress+=0.05; }
-      continue; 
+bool CompactObj(object_store<float> & store, long int obj_id, srep_arena<float> & arena){ return CompactObject(arena,store.tot_intens[obj_id],store.min_intens[obj_id],store.max_intens[obj_id],store.NOvox[obj_id]); }
 
-    }
-	
-    // count the number of LOSs through this object that contain an object section
-    i = 0;
-    for(j = 0; j < ((detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_size(0) + 1) * (detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_size(2) + 1)); ++j){
+// functions using doubles
 
-      if(detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_grid((j + 1)) > detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_grid(j)){ ++i; }
+void ThresholdObjs(vector< object_props_dbl *> & detections, int NOobj, int obj_limit, int min_x_size, int min_y_size, int min_z_size, int min_v_size, double intens_thresh_min, double intens_thresh_max, int min_LoS_count, int NOthreads){
 
-    }
+  ThresholdObjects(detections,NOobj,obj_limit,min_x_size,min_y_size,min_z_size,min_v_size,intens_thresh_min,intens_thresh_max,min_LoS_count,NOthreads);
 
-    // apply the thresholds, and if it fails re-initialise the object
-    if(((detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_size(1) - detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_size(0) + 1) < min_x_size)  || ((detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_size(3) - detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_size(2) + 1) < min_y_size) || ((detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_size(5) - detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_size(4) + 1) < min_z_size) || (detections[obj_batch][(k - (obj_batch * obj_limit))].ShowVoxels() < min_v_size) || (detections[obj_batch][(k - (obj_batch * obj_limit))].GetTI() < intens_thresh_min) || (detections[obj_batch][(k - (obj_batch * obj_limit))].GetTI() > intens_thresh_max) || (i < min_LoS_count)){
+}
 
-      // re-initialise object
-      detections[obj_batch][(k - (obj_batch * obj_limit))].ReInit();
-      if((detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_update() != 0) && (detections[obj_batch][(k - (obj_batch * obj_limit))].Get_srep_size(0) >= 0)){
-	
-	detections[obj_batch][(k - (obj_batch * obj_limit))].ReInit_srep();
-	detections[obj_batch][(k - (obj_batch * obj_limit))].ReInit_mini();
-	
-      }
-      detections[obj_batch][(k - (obj_batch * obj_limit))].ReInit_size();
-      detections[obj_batch][(k - (obj_batch * obj_limit))].Set_srep_update(0);
+void ThresholdObjs(vector< object_props_dbl *> & detections, long int NOobj, int obj_limit, int min_x_size, int min_y_size, int min_z_size, int min_v_size, double intens_thresh_min, double intens_thresh_max, int min_LoS_count, int NOthreads){
 
-    }
-    
-    while(progress <= (((float) (k + 1)) / ((float) NOobj))){ std::cout << "*"; std::cout.flush(); progress+=0.05; }
-      
-    // for(k = 0; k < NOobj; ++k)
-  }
-  std::cout << "* done." << std::endl;
+  ThresholdObjects(detections,NOobj,obj_limit,min_x_size,min_y_size,min_z_size,min_v_size,intens_thresh_min,intens_thresh_max,min_LoS_count,NOthreads);
 
 }
 
+bool CompactObj(object_props_dbl & obj){ return CompactObject(*(obj.GetArena()),obj.GetTI(),obj.GetMinI(),obj.GetMaxI(),obj.ShowVoxels()); }
+
+bool CompactObj(object_store<double> & store, long int obj_id, srep_arena<double> & arena){ return CompactObject(arena,store.tot_intens[obj_id],store.min_intens[obj_id],store.max_intens[obj_id],store.NOvox[obj_id]); }
@@ -0,0 +1,385 @@
+#include<iostream>
+#include "RJJ_ObjGen.h"
+
+using namespace std;
+
+// Union-find labelling engine. The sweep is identical to CreateObjects, but each detected voxel is
+// given a provisional label and label equivalences are recorded in a path-compressed union-find
+// forest, rather than rewriting the flag_vals array within the bounding box of every merged object.
+// The object IDs, object statistics and thresholding follow CreateObjects exactly, so that the final
+// catalogue is the same. The provisional labels are resolved to object IDs in a single pass at the end.
+// The voxels are accumulated in a columnar object store, indexed by object ID, and the detections array
+// only receives the accumulated properties once the chunk has been linked --- or when the sparse
+// representation of an object from a previous chunk has to be merged.
+
+// return the root of a provisional label, and point every label on the way directly at the root
+template <typename FlagT>
+static FlagT FindRoot(vector<FlagT> & uf_parent, FlagT label){
+
+  FlagT root, next;
+
+  root = label;
+  while(uf_parent[root] != root){ root = uf_parent[root]; }
+  while(uf_parent[label] != root){
+
+    next = uf_parent[label];
+    uf_parent[label] = root;
+    label = next;
+
+  }
+
+  return root;
+
+}
+
+template <typename FlagT>
+static void LinkNeighbour(FlagT * flag_vals, long int index, vector<FlagT> & uf_parent, vector<FlagT> & uf_obj, vector<FlagT> & match_init, FlagT & existing, FlagT flag_value){
+
+  FlagT root, obj_id;
+  unsigned int i;
+
+  // provisional labels are always >= 0; un-processed source voxels and empty voxels are ignored
+  if(flag_vals[index] < 0){ return; }
+
+  root = FindRoot(uf_parent,flag_vals[index]);
+  obj_id = uf_obj[root];
+
+  // check if this is a new object ID
+  for(i = 0; i < match_init.size(); ++i){ if(match_init[i] == obj_id){ return; } }
+  match_init.push_back(obj_id);
+
+  // update existing flag
+  if((existing == flag_value) || (obj_id < existing)){ existing = obj_id; }
+
+}
+
+// copy the accumulated properties of an object from the object store to the detections array, flagging
+// its sparse representation for an update if it has gained voxels, as object_props::AddPoint does
+template <typename T, typename PropsT>
+static void SyncObject(object_store<T> & store, PropsT & obj, long int obj_id){
+
+  if(store.NOvox[obj_id] != obj.ShowVoxels()){ obj.Set_srep_update(1); }
+  obj.FromStore(store,obj_id);
+
+}
+
+template <typename DataT, typename FlagT, typename PropsT>
+static FlagT LinkObjectsUF(DataT * data_vals, FlagT * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, FlagT flag_value, FlagT start_obj, vector<PropsT *> & detections, vector<FlagT> & obj_ids, vector<FlagT> & check_obj_ids, int obj_limit, int max_x_val, int max_y_val, int max_z_val, int ss_mode, long int * data_metric, int * xyz_order, int products){
+
+  FlagT obj,obj_id,existing,obj_batch,obj_batch_2,label,root;
+  int x,y,z,sz,sz_start,x_start,y_start,s,NOprev,NOstencil,NOsearch;
+  int i;
+  int temp_vals[3], bbox[6];
+  long int index, plane, NOvox, NOscanned, NOmerges;
+  double sweep_start, merge_start;
+  bool interior;
+  vector<char> free_ids;
+  vector<link_offset> stencil;
+  check_id_set check_set;
+  object_store<DataT> store;
+  srep_arena<DataT> & arena = *(detections[0][0].GetArena());
+  vector<DataT> & temp_mom0 = arena.temp_mom0, & temp_RAPV = arena.temp_RAPV, & temp_DECPV = arena.temp_DECPV, & temp_obj_spec = arena.temp_obj_spec, & temp_ref_spec = arena.temp_ref_spec, & temp_vfield = arena.temp_vfield;
+  vector<int> & temp_sparse_reps_grid = arena.temp_sparse_reps_grid, & temp_sparse_reps_strings = arena.temp_sparse_reps_strings;
+  vector<FlagT> match_init, uf_parent, uf_obj, obj_root;
+
+  // convert the merging lengths in the same manner as CreateObjects
+  --merge_x;
+  --merge_y;
+  --merge_z;
+
+  // reorder the datacube and subcube limits to be in x,y,z order
+  temp_vals[0] = chunk_x_start; temp_vals[1] = chunk_y_start; temp_vals[2] = chunk_z_start;
+  chunk_x_start = ReorderAxis(temp_vals,xyz_order[0],0);
+  chunk_y_start = ReorderAxis(temp_vals,xyz_order[1],1);
+  chunk_z_start = ReorderAxis(temp_vals,xyz_order[2],2);
+  temp_vals[0] = size_x; temp_vals[1] = size_y; temp_vals[2] = size_z;
+  size_x = ReorderAxis(temp_vals,xyz_order[0],0);
+  size_y = ReorderAxis(temp_vals,xyz_order[1],1);
+  size_z = ReorderAxis(temp_vals,xyz_order[2],2);
+  temp_vals[0] = max_x_val; temp_vals[1] = max_y_val; temp_vals[2] = max_z_val;
+  max_x_val = ReorderAxis(temp_vals,xyz_order[0],0);
+  max_y_val = ReorderAxis(temp_vals,xyz_order[1],1);
+  max_z_val = ReorderAxis(temp_vals,xyz_order[2],2);
+
+  // create temporary arrays
+  match_init.reserve(1000);
+
+  // list the offsets to be tested within the merging box, in place of testing the spatial ellipse for every voxel
+  NOprev = CreateStencil(stencil,ss_mode,merge_x,merge_y,(long int) data_metric[0],(long int) data_metric[1]);
+  NOstencil = stencil.size();
+
+  // 0. initialise variables and arrays
+  obj = start_obj;
+  x_start = 0;
+  y_start = 0;
+  if(chunk_x_start > 0){ x_start = merge_x + 1; }
+  if(chunk_y_start > 0){ y_start = merge_y + 1; }
+  InitObjIDs(obj_ids,free_ids,arena.stats);
+  InitCheckIDs(check_obj_ids,check_set,detections,obj_limit);
+
+  // the objects carried over from previous chunks are the only existing objects that can grow, so
+  // only they have to be loaded into the object store
+  store.Resize(start_obj);
+  for(i = 0; i < ((int) check_obj_ids.size()); ++i){
+
+    obj_batch = check_obj_ids[i] / obj_limit;
+    detections[obj_batch][(check_obj_ids[i] - (obj_batch * obj_limit))].ToStore(store,check_obj_ids[i]);
+
+  }
+
+  // object IDs written to flag_vals by previous chunks are used directly as provisional labels,
+  // so that the labels created by this chunk start at start_obj
+  uf_parent.reserve((start_obj + 100000));
+  uf_obj.reserve((start_obj + 100000));
+  obj_root.reserve((start_obj + 100000));
+  for(label = 0; label < start_obj; ++label){
+
+    uf_parent.push_back(label);
+    uf_obj.push_back(label);
+    obj_root.push_back(label);
+
+  }
+
+  // 1. Create list of `coherent' objects from neighbouring voxels
+  NOscanned = 0;
+  NOmerges = 0;
+  sweep_start = arena.stats.collect ? WallTime() : 0.0;
+  for(z = 0; ((z < size_z) && ((z + chunk_z_start) < max_z_val)); ++z){
+
+    // if the z value is sufficiently large that objects have started to pop out of the merging box,
+    // then check if the objects outside of the merging box are sufficiently large
+    if(z > (merge_z + 1)){
+
+      // apply the size threshold to the objects that have moved outside of the merging box available to
+      // the next plane, taking them from the queue of objects ordered by their last channel
+      while((obj_id = NextRetiredID(check_obj_ids,check_set,store,(chunk_z_start + z - merge_z - 1))) >= 0){
+
+	obj_batch = obj_id / obj_limit;
+	PropsT & checked = detections[obj_batch][(obj_id - (obj_batch * obj_limit))];
+	bbox[0] = store.ra_min[obj_id];
+	bbox[1] = store.ra_max[obj_id];
+	bbox[2] = store.dec_min[obj_id];
+	bbox[3] = store.dec_max[obj_id];
+	bbox[4] = store.freq_min[obj_id];
+	bbox[5] = store.freq_max[obj_id];
+
+	// apply the size threshold, and if it fails, or the object is demoted to a compact record,
+	// re-initialise the object, retire its provisional labels and pop its id to the list of available obj_ids
+	if((((bbox[0] - chunk_x_start) > merge_x) || (chunk_x_start == 0)) && ((((chunk_x_start + size_x - 1 - bbox[1]) > merge_x) || ((chunk_x_start + size_x) >= max_x_val)) && (((bbox[2] - chunk_y_start) > merge_y) || (chunk_y_start == 0)) && (((chunk_y_start + size_y - 1 - bbox[3]) > merge_y) || ((chunk_y_start + size_y) >= max_y_val)) && (((bbox[4] - chunk_z_start) > merge_z) || (chunk_z_start == 0)) && (((chunk_z_start + size_z - 1 - bbox[5]) > merge_z) || ((chunk_z_start + size_z) >= max_z_val))) && ((((bbox[1] - bbox[0] + 1) < min_x_size) || ((bbox[3] - bbox[2] + 1) < min_y_size) || ((bbox[5] - bbox[4] + 1) < min_z_size) || (store.NOvox[obj_id] < min_v_size)) || CompactObj(store,obj_id,*(checked.GetArena())))){
+
+	  store.ReInit(obj_id);
+	  checked.ReInit();
+	  if((checked.Get_srep_update() != 0) && (checked.Get_srep_size(0) >= 0)){
+
+	    checked.ReInit_srep();
+	    checked.ReInit_mini();
+
+	  }
+	  checked.ReInit_size();
+	  checked.Set_srep_update(0);
+
+	  // the voxels of this object are returned to the background when the labels are resolved
+	  uf_obj[obj_root[obj_id]] = -1;
+
+	  // add object id to list of available ids
+	  FreeObjID(obj_ids,free_ids,obj_id,arena.stats);
+
+	}
+
+	// while((obj_id = NextRetiredID(check_obj_ids,check_set,store,(chunk_z_start + z - merge_z - 1))) >= 0)
+      }
+
+      // if(z > (merge_z + 1))
+    }
+
+    for(y = y_start; (y < size_y) && ((chunk_y_start + y) < max_y_val); ++y){
+
+      for(x = x_start; (x < size_x) && ((chunk_x_start + x) < max_x_val); ++x){
+
+	index = ((long int) z * data_metric[2]) + ((long int) y * data_metric[1]) + ((long int) x * data_metric[0]);
+
+	if(flag_vals[index] == flag_value){
+
+	  // 1.  initialise variables
+	  existing = flag_value;
+	  match_init.resize(0);
+	  ++NOscanned;
+
+	  // 2. set the first plane of the region to be searched --- the bounds of the merging box only need
+	  // to be tested for the voxels near the edges of the chunk
+	  sz_start = z - merge_z - 1;
+	  if(sz_start < 0){ sz_start = 0; }
+	  interior = (x > merge_x) && ((x + merge_x + 1) < size_x) && (y > merge_y) && ((y + merge_y + 1) < size_y);
+
+	  // 3. search through the previous planes, and then the previous rows and voxels of this plane, in the
+	  // same order as CreateObjects, and collect the object IDs of the provisional labels found there
+	  for(sz = sz_start; sz <= z; ++sz){
+
+	    plane = index + ((long int) (sz - z) * data_metric[2]);
+	    NOsearch = (sz < z) ? NOstencil : NOprev;
+	    for(s = 0; s < NOsearch; ++s){
+
+	      if(!interior && (((x + stencil[s].dx) < 0) || ((x + stencil[s].dx) >= size_x) || ((y + stencil[s].dy) < 0) || ((y + stencil[s].dy) >= size_y))){ continue; }
+	      LinkNeighbour(flag_vals,(plane + stencil[s].index),uf_parent,uf_obj,match_init,existing,flag_value);
+
+	    }
+
+	  }
+
+	  // 4. assign a provisional label to this voxel, and if this is part of an existing object or objects,
+	  // record the equivalence of their labels
+	  if(existing == flag_value){
+
+	    // take the lowest free obj value from the pool of obj_ids
+	    existing = NewObjID(obj_ids,free_ids,obj,detections,obj_limit);
+
+	    // grow the object store geometrically, resizing every property array per object is expensive
+	    if(existing >= store.Size()){ store.Resize((2 * (existing + 1))); }
+
+	    // create a new provisional label for this object
+	    label = uf_parent.size();
+	    uf_parent.push_back(label);
+	    uf_obj.push_back(existing);
+	    if(existing >= ((FlagT) obj_root.size())){ obj_root.resize((existing + 1)); }
+	    obj_root[existing] = label;
+	    flag_vals[index] = label;
+
+	    store.AddPoint(existing,((DataT) (chunk_x_start + x)),((DataT) (chunk_y_start + y)),((DataT) (chunk_z_start + z)),data_vals[index]);
+
+	    // push id to list of objects that need to be size thresholded
+	    AddCheckID(check_obj_ids,check_set,existing,store);
+
+	    // if(existing == flag_value)
+	  } else {
+
+	    // add object to list of objects within the merging box, provided that it hasn't been added already
+	    AddCheckID(check_obj_ids,check_set,existing,store);
+
+	    root = obj_root[existing];
+	    flag_vals[index] = root;
+
+	    store.AddPoint(existing,((DataT) (chunk_x_start + x)),((DataT) (chunk_y_start + y)),((DataT) (chunk_z_start + z)),data_vals[index]);
+
+	    // merge every other object found within the merging volume into the existing object --- only
+	    // the union-find forest is updated, the flag_vals array is left untouched
+	    merge_start = (arena.stats.collect && (match_init.size() > 1)) ? WallTime() : 0.0;
+	    for(i = 0; i < ((int) match_init.size()); ++i){
+
+	      if(match_init[i] == existing){ continue; }
+
+	      obj_batch_2 = match_init[i] / obj_limit;
+	      PropsT & merged = detections[obj_batch_2][(match_init[i] - (obj_batch_2 * obj_limit))];
+
+	      store.AddObject(existing,match_init[i]);
+
+	      // objects from previous chunks bring their sparse representations with them, which are combined
+	      // using the merged bounding box
+	      if((merged.Get_srep_update() != 0) && (merged.Get_srep_size(0) >= 0)){
+
+		obj_batch = existing / obj_limit;
+		SyncObject(store,detections[obj_batch][(existing - (obj_batch * obj_limit))],existing);
+		detections[obj_batch][(existing - (obj_batch * obj_limit))].MergeSreps(merged,temp_sparse_reps_grid,temp_sparse_reps_strings,temp_mom0,temp_RAPV,temp_DECPV,temp_ref_spec,temp_obj_spec,temp_vfield);
+
+	      }
+
+	      uf_parent[obj_root[match_init[i]]] = root;
+
+	      store.ReInit(match_init[i]);
+	      merged.ReInit();
+	      if((merged.Get_srep_update() != 0) && (merged.Get_srep_size(0) >= 0)){
+
+		merged.ReInit_srep();
+		merged.ReInit_mini();
+
+	      }
+	      merged.ReInit_size();
+	      merged.Set_srep_update(0);
+
+	      FreeObjID(obj_ids,free_ids,match_init[i],arena.stats);
+	      ++NOmerges;
+
+	      // for(i = 0; i < match_init.size(); ++i)
+	    }
+	    if(arena.stats.collect && (match_init.size() > 1)){ arena.stats.merge_time+=(WallTime() - merge_start); }
+
+	    // else . . . if(existing == flag_value)
+	  }
+
+	  // if(flag_vals[index] == flag_value)
+	}
+
+	// for(x = x_start; x < size_x; ++x)
+      }
+
+      // for(y = y_start; y < size_y; ++y)
+    }
+
+    // report the progress once per plane, and stop if the linking has been cancelled
+    if(arena.Progress((z + 1),size_z)){ break; }
+
+    // for(z = 0; z < size_z; ++z)
+  }
+
+  arena.stats.voxels_scanned+=NOscanned;
+  arena.stats.merges+=NOmerges;
+  if(arena.stats.collect){ arena.stats.sweep_time+=(WallTime() - sweep_start); }
+
+  // a cancelled linking is abandoned, and the caller releases the objects
+  if(arena.cancelled){ return obj; }
+
+  // 5. copy the accumulated properties of the objects that still contain voxels to the detections array
+  for(obj_id = 0; obj_id < store.Size(); ++obj_id){
+
+    if(store.NOvox[obj_id] < 1){ continue; }
+    obj_batch = obj_id / obj_limit;
+    SyncObject(store,detections[obj_batch][(obj_id - (obj_batch * obj_limit))],obj_id);
+
+  }
+
+  // 6. resolve the provisional labels to object IDs, returning the voxels of objects that were removed
+  // by the size threshold to the background
+  NOvox = (long int) size_x * (long int) size_y * (long int) size_z;
+  for(index = 0; index < NOvox; ++index){
+
+    if(flag_vals[index] < 0){ continue; }
+    root = FindRoot(uf_parent,flag_vals[index]);
+    if(uf_obj[root] >= 0){ flag_vals[index] = uf_obj[root]; } else { flag_vals[index] = -99; }
+
+  }
+
+  // 7. generate sparse representations of coherent objects that are retained after
+  // this `chunk' of the datacube is processed
+  CreateSparseReps(data_vals,flag_vals,size_x,size_y,size_z,chunk_x_start,chunk_y_start,chunk_z_start,merge_x,merge_y,merge_z,obj,detections,obj_limit,data_metric,products);
+
+  // 8. return the number of coherent objects
+  return obj;
+
+}
+
+// functions using floats
+
+int CreateObjectsUF(float * data_vals, int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, float intens_thresh_min, float intens_thresh_max, int flag_value, int start_obj, vector<object_props *> & detections, vector<int> & obj_ids, vector<int> & check_obj_ids, int obj_limit, int max_x_val, int max_y_val, int max_z_val, int ss_mode, long int * data_metric, int * xyz_order, int products){
+
+  return LinkObjectsUF(data_vals,flag_vals,size_x,size_y,size_z,chunk_x_start,chunk_y_start,chunk_z_start,merge_x,merge_y,merge_z,min_x_size,min_y_size,min_z_size,min_v_size,flag_value,start_obj,detections,obj_ids,check_obj_ids,obj_limit,max_x_val,max_y_val,max_z_val,ss_mode,data_metric,xyz_order,products);
+
+}
+
+long int CreateObjectsUF(float * data_vals, long int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, float intens_thresh_min, float intens_thresh_max, long int flag_value, long int start_obj, vector<object_props *> & detections, vector<long int> & obj_ids, vector<long int> & check_obj_ids, int obj_limit, int max_x_val, int max_y_val, int max_z_val, int ss_mode, long int * data_metric, int * xyz_order, int products){
+
+  return LinkObjectsUF(data_vals,flag_vals,size_x,size_y,size_z,chunk_x_start,chunk_y_start,chunk_z_start,merge_x,merge_y,merge_z,min_x_size,min_y_size,min_z_size,min_v_size,flag_value,start_obj,detections,obj_ids,check_obj_ids,obj_limit,max_x_val,max_y_val,max_z_val,ss_mode,data_metric,xyz_order,products);
+
+}
+
+// functions using doubles
+
+int CreateObjectsUF(double * data_vals, int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, double intens_thresh_min, double intens_thresh_max, int flag_value, int start_obj, vector<object_props_dbl *> & detections, vector<int> & obj_ids, vector<int> & check_obj_ids, int obj_limit, int max_x_val, int max_y_val, int max_z_val, int ss_mode, long int * data_metric, int * xyz_order, int products){
+
+  return LinkObjectsUF(data_vals,flag_vals,size_x,size_y,size_z,chunk_x_start,chunk_y_start,chunk_z_start,merge_x,merge_y,merge_z,min_x_size,min_y_size,min_z_size,min_v_size,flag_value,start_obj,detections,obj_ids,check_obj_ids,obj_limit,max_x_val,max_y_val,max_z_val,ss_mode,data_metric,xyz_order,products);
+
+}
+
+long int CreateObjectsUF(double * data_vals, long int * flag_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, int merge_x, int merge_y, int merge_z, int min_x_size, int min_y_size, int min_z_size, int min_v_size, double intens_thresh_min, double intens_thresh_max, long int flag_value, long int start_obj, vector<object_props_dbl *> & detections, vector<long int> & obj_ids, vector<long int> & check_obj_ids, int obj_limit, int max_x_val, int max_y_val, int max_z_val, int ss_mode, long int * data_metric, int * xyz_order, int products){
+
+  return LinkObjectsUF(data_vals,flag_vals,size_x,size_y,size_z,chunk_x_start,chunk_y_start,chunk_z_start,merge_x,merge_y,merge_z,min_x_size,min_y_size,min_z_size,min_v_size,flag_value,start_obj,detections,obj_ids,check_obj_ids,obj_limit,max_x_val,max_y_val,max_z_val,ss_mode,data_metric,xyz_order,products);
+
+}
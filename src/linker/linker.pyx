@@ -1,5 +1,4 @@
 # distutils: language = c++
-# distutils: sources = RJJ_ObjGen_CreateObjs.cpp RJJ_ObjGen_MemManage.cpp RJJ_ObjGen_DetectDefn.cpp RJJ_ObjGen_ThreshObjs.cpp RJJ_ObjGen_Dmetric.cpp
 
 # cython: boundscheck = False
 # cython: wraparound = False
@@ -7,9 +6,19 @@
 
 cimport numpy as np
 import numpy as np
+import atexit
+import threading
+import multiprocessing
+from cpython.ref cimport Py_INCREF, Py_DECREF
 from libcpp.vector cimport vector
+from libcpp.string cimport string
 
-cdef extern from "RJJ_ObjGen.h":
+# Object IDs and labels are ints, or longs for masks of type numpy.int64
+ctypedef fused label_t:
+	int
+	long
+
+cdef extern from "RJJ_ObjGen.h" nogil:
 	cdef int CreateObjects( float * data_vals, int * flag_vals, 
 							int size_x, int size_y, int size_z, 
 							int chunk_x_start, int chunk_y_start, int chunk_z_start, 
@@ -21,12 +30,192 @@ cdef extern from "RJJ_ObjGen.h":
 							int start_obj, vector[object_props *] & detections, vector[int] & obj_ids, vector[int] & check_obj_ids, int obj_limit, 
 							int max_x_val, int max_y_val, int max_z_val, 
 							int ss_mode,
-							int * data_metric, int * xyz_order)
+							long * data_metric, int * xyz_order, int products)
+
+	cdef int CreateObjectsUF( float * data_vals, int * flag_vals, 
+							int size_x, int size_y, int size_z, 
+							int chunk_x_start, int chunk_y_start, int chunk_z_start, 
+							int mergeX, int mergeY, int mergeZ, 
+							int minSizeX, int minSizeY, int minSizeZ, 
+							int min_v_size, 
+							float intens_thresh_min, float intens_thresh_max, 
+							int flag_value, 
+							int start_obj, vector[object_props *] & detections, vector[int] & obj_ids, vector[int] & check_obj_ids, int obj_limit, 
+							int max_x_val, int max_y_val, int max_z_val, 
+							int ss_mode,
+							long * data_metric, int * xyz_order, int products)
+
+	cdef int CreateObjectsMT( float * data_vals, int * flag_vals, 
+							int size_x, int size_y, int size_z, 
+							int chunk_x_start, int chunk_y_start, int chunk_z_start, 
+							int mergeX, int mergeY, int mergeZ, 
+							int minSizeX, int minSizeY, int minSizeZ, 
+							int min_v_size, 
+							float intens_thresh_min, float intens_thresh_max, 
+							int flag_value, 
+							int start_obj, vector[object_props *] & detections, vector[int] & obj_ids, vector[int] & check_obj_ids, int obj_limit, 
+							int max_x_val, int max_y_val, int max_z_val, 
+							int ss_mode,
+							long * data_metric, int * xyz_order, int NOthreads, int products)
+
+	cdef int CreateObjectsDil( float * data_vals, int * flag_vals, 
+							int size_x, int size_y, int size_z, 
+							int chunk_x_start, int chunk_y_start, int chunk_z_start, 
+							int mergeX, int mergeY, int mergeZ, 
+							int minSizeX, int minSizeY, int minSizeZ, 
+							int min_v_size, 
+							float intens_thresh_min, float intens_thresh_max, 
+							int flag_value, 
+							int start_obj, vector[object_props *] & detections, vector[int] & obj_ids, vector[int] & check_obj_ids, int obj_limit, 
+							int max_x_val, int max_y_val, int max_z_val, 
+							int ss_mode,
+							long * data_metric, int * xyz_order, int products)
+
+	cdef long CreateObjects( float * data_vals, long * flag_vals, 
+							int size_x, int size_y, int size_z, 
+							int chunk_x_start, int chunk_y_start, int chunk_z_start, 
+							int mergeX, int mergeY, int mergeZ, 
+							int minSizeX, int minSizeY, int minSizeZ, 
+							int min_v_size, 
+							float intens_thresh_min, float intens_thresh_max, 
+							long flag_value, 
+							long start_obj, vector[object_props *] & detections, vector[long] & obj_ids, vector[long] & check_obj_ids, int obj_limit, 
+							int max_x_val, int max_y_val, int max_z_val, 
+							int ss_mode,
+							long * data_metric, int * xyz_order, int products)
+
+	cdef long CreateObjectsUF( float * data_vals, long * flag_vals, 
+							int size_x, int size_y, int size_z, 
+							int chunk_x_start, int chunk_y_start, int chunk_z_start, 
+							int mergeX, int mergeY, int mergeZ, 
+							int minSizeX, int minSizeY, int minSizeZ, 
+							int min_v_size, 
+							float intens_thresh_min, float intens_thresh_max, 
+							long flag_value, 
+							long start_obj, vector[object_props *] & detections, vector[long] & obj_ids, vector[long] & check_obj_ids, int obj_limit, 
+							int max_x_val, int max_y_val, int max_z_val, 
+							int ss_mode,
+							long * data_metric, int * xyz_order, int products)
+
+	cdef long CreateObjectsMT( float * data_vals, long * flag_vals, 
+							int size_x, int size_y, int size_z, 
+							int chunk_x_start, int chunk_y_start, int chunk_z_start, 
+							int mergeX, int mergeY, int mergeZ, 
+							int minSizeX, int minSizeY, int minSizeZ, 
+							int min_v_size, 
+							float intens_thresh_min, float intens_thresh_max, 
+							long flag_value, 
+							long start_obj, vector[object_props *] & detections, vector[long] & obj_ids, vector[long] & check_obj_ids, int obj_limit, 
+							int max_x_val, int max_y_val, int max_z_val, 
+							int ss_mode,
+							long * data_metric, int * xyz_order, int NOthreads, int products)
+
+	cdef long CreateObjectsDil( float * data_vals, long * flag_vals, 
+							int size_x, int size_y, int size_z, 
+							int chunk_x_start, int chunk_y_start, int chunk_z_start, 
+							int mergeX, int mergeY, int mergeZ, 
+							int minSizeX, int minSizeY, int minSizeZ, 
+							int min_v_size, 
+							float intens_thresh_min, float intens_thresh_max, 
+							long flag_value, 
+							long start_obj, vector[object_props *] & detections, vector[long] & obj_ids, vector[long] & check_obj_ids, int obj_limit, 
+							int max_x_val, int max_y_val, int max_z_val, 
+							int ss_mode,
+							long * data_metric, int * xyz_order, int products)
+
+	cdef int CreateObjectsRuns( float * data_vals, int * flag_vals, 
+							int size_x, int size_y, int size_z, 
+							int chunk_x_start, int chunk_y_start, int chunk_z_start, 
+							int mergeX, int mergeY, int mergeZ, 
+							int minSizeX, int minSizeY, int minSizeZ, 
+							int min_v_size, 
+							float intens_thresh_min, float intens_thresh_max, 
+							int flag_value, 
+							int start_obj, vector[object_props *] & detections, vector[int] & obj_ids, vector[int] & check_obj_ids, int obj_limit, 
+							int max_x_val, int max_y_val, int max_z_val, 
+							int ss_mode,
+							long * data_metric, int * xyz_order, int products, const int * runs, long NOruns)
+
+	cdef long CreateObjectsRuns( float * data_vals, long * flag_vals, 
+							int size_x, int size_y, int size_z, 
+							int chunk_x_start, int chunk_y_start, int chunk_z_start, 
+							int mergeX, int mergeY, int mergeZ, 
+							int minSizeX, int minSizeY, int minSizeZ, 
+							int min_v_size, 
+							float intens_thresh_min, float intens_thresh_max, 
+							long flag_value, 
+							long start_obj, vector[object_props *] & detections, vector[long] & obj_ids, vector[long] & check_obj_ids, int obj_limit, 
+							int max_x_val, int max_y_val, int max_z_val, 
+							int ss_mode,
+							long * data_metric, int * xyz_order, int products, const int * runs, long NOruns)
 
-	cdef void InitObjGen(vector[object_props *] & detections, int & NOobj, int obj_limit, vector[int] & obj_ids, vector[int] & check_obj_ids, int *& data_metric, int *& xyz_order)
-	cdef void FreeObjGen(vector[object_props *] & detections, int *& data_metric, int *& xyz_order)
-	cdef void ThresholdObjs(vector[object_props *] & detections, int NOobj, int obj_limit, int minSizeX, int minSizeY, int minSizeZ, int min_v_size, float intens_thresh_min, float intens_thresh_max, int min_LoS_count)
-	cdef void CreateMetric( int * data_metric, int * xyz_order, int size_x, int size_y, int size_z)
+	cdef int AddObjsToChunk(int * flag_vals, vector[object_props *] & detections, int NOobj, int obj_limit, int chunk_x_start, int chunk_y_start, int chunk_z_start, int chunk_x_size, int chunk_y_size, int chunk_z_size, vector[int] & check_obj_ids, long * data_metric, int * xyz_order)
+	cdef int AddObjsToChunk(long * flag_vals, vector[object_props *] & detections, long NOobj, int obj_limit, int chunk_x_start, int chunk_y_start, int chunk_z_start, int chunk_x_size, int chunk_y_size, int chunk_z_size, vector[long] & check_obj_ids, long * data_metric, int * xyz_order)
+
+	cdef void InitObjGen(vector[object_props *] & detections, int & NOobj, int obj_limit, vector[int] & obj_ids, vector[int] & check_obj_ids, long *& data_metric, int *& xyz_order)
+	cdef void InitObjGen(vector[object_props *] & detections, long & NOobj, int obj_limit, vector[long] & obj_ids, vector[long] & check_obj_ids, long *& data_metric, int *& xyz_order)
+	cdef void FreeObjGen(vector[object_props *] & detections, long *& data_metric, int *& xyz_order)
+	cdef void ThresholdObjs(vector[object_props *] & detections, int NOobj, int obj_limit, int minSizeX, int minSizeY, int minSizeZ, int min_v_size, float intens_thresh_min, float intens_thresh_max, int min_LoS_count, int NOthreads)
+	cdef void ThresholdObjs(vector[object_props *] & detections, long NOobj, int obj_limit, int minSizeX, int minSizeY, int minSizeZ, int min_v_size, float intens_thresh_min, float intens_thresh_max, int min_LoS_count, int NOthreads)
+	cdef void SetCompactLimits(vector[object_props *] & detections, int compact_voxels, float compact_peak)
+	cdef long CopyCompactObjs(vector[object_props *] & detections, float * vals)
+	cdef void SetProgress(vector[object_props *] & detections, int (* progress_func)(void *, double) noexcept, void * progress_context)
+	cdef void SetFinalise(vector[object_props *] & detections, int (* finalise_func)(void *, long, int *) noexcept, void * finalise_context)
+	cdef struct link_stats:
+		bint collect
+		double sweep_time, merge_time, srep_time, threshold_time, alloc_time
+		long voxels_scanned, merges, voxels_rewritten, ids_recycled, peak_objects, arena_bytes, alloc_calls
+	cdef void SetLinkStats(vector[object_props *] & detections, bint collect)
+	cdef link_stats * GetLinkStats(vector[object_props *] & detections)
+	cdef double WallTime()
+	cdef int CreateFitsMask(string output_file, string header_cards, int NOx, int NOy, int NOf, vector[object_props *] & detections, int NOobj, int obj_limit)
+	cdef long CreateFitsMask(string output_file, string header_cards, int NOx, int NOy, int NOf, vector[object_props *] & detections, long NOobj, int obj_limit)
+	cdef int CreateCatalogue(string output_file, string flux_unit, vector[object_props *] & detections, int NOobj, int obj_limit, int * columns, int NOcolumns, int cat_mode)
+	cdef long CreateCatalogue(string output_file, string flux_unit, vector[object_props *] & detections, long NOobj, int obj_limit, int * columns, int NOcolumns, int cat_mode)
+	cdef int CreateMomentMaps(float * data_vals, long * data_metric, unsigned char * flag_vals, long * flag_metric, int * runs, long NOruns, int NOx, int NOy, int NOz, float * mom0, float * mom1, float * mom2, float * RAPV, float * DECPV)
+	cdef int CreateMomentMaps(float * data_vals, long * data_metric, unsigned short * flag_vals, long * flag_metric, int * runs, long NOruns, int NOx, int NOy, int NOz, float * mom0, float * mom1, float * mom2, float * RAPV, float * DECPV)
+	cdef int CreateMomentMaps(float * data_vals, long * data_metric, int * flag_vals, long * flag_metric, int * runs, long NOruns, int NOx, int NOy, int NOz, float * mom0, float * mom1, float * mom2, float * RAPV, float * DECPV)
+	cdef int CreateMomentMaps(float * data_vals, long * data_metric, long * flag_vals, long * flag_metric, int * runs, long NOruns, int NOx, int NOy, int NOz, float * mom0, float * mom1, float * mom2, float * RAPV, float * DECPV)
+	cdef int CreateMomentMaps(double * data_vals, long * data_metric, unsigned char * flag_vals, long * flag_metric, int * runs, long NOruns, int NOx, int NOy, int NOz, float * mom0, float * mom1, float * mom2, float * RAPV, float * DECPV)
+	cdef int CreateMomentMaps(double * data_vals, long * data_metric, unsigned short * flag_vals, long * flag_metric, int * runs, long NOruns, int NOx, int NOy, int NOz, float * mom0, float * mom1, float * mom2, float * RAPV, float * DECPV)
+	cdef int CreateMomentMaps(double * data_vals, long * data_metric, int * flag_vals, long * flag_metric, int * runs, long NOruns, int NOx, int NOy, int NOz, float * mom0, float * mom1, float * mom2, float * RAPV, float * DECPV)
+	cdef int CreateMomentMaps(double * data_vals, long * data_metric, long * flag_vals, long * flag_metric, int * runs, long NOruns, int NOx, int NOy, int NOz, float * mom0, float * mom1, float * mom2, float * RAPV, float * DECPV)
+	cdef void CalcObjProps(vector[object_props *] & detections, int NOobj, int obj_limit)
+	cdef void CalcObjProps(vector[object_props *] & detections, long NOobj, int obj_limit)
+	cdef int LabelObjs(vector[object_props *] & detections, int NOobj, int obj_limit, int * label_vals, long * data_metric, vector[int] & new_ids, int NOthreads)
+	cdef long LabelObjs(vector[object_props *] & detections, long NOobj, int obj_limit, long * label_vals, long * data_metric, vector[long] & new_ids, int NOthreads)
+	cdef int LabelObjs(vector[object_props *] & detections, int NOobj, int obj_limit, unsigned short * label_vals, long * data_metric, vector[int] & new_ids, int NOthreads)
+	cdef long LabelObjs(vector[object_props *] & detections, long NOobj, int obj_limit, unsigned short * label_vals, long * data_metric, vector[long] & new_ids, int NOthreads)
+	cdef int LabelObjs(vector[object_props *] & detections, int NOobj, int obj_limit, unsigned int * label_vals, long * data_metric, vector[int] & new_ids, int NOthreads)
+	cdef long LabelObjs(vector[object_props *] & detections, long NOobj, int obj_limit, unsigned int * label_vals, long * data_metric, vector[long] & new_ids, int NOthreads)
+	cdef int LabelObjs(vector[object_props *] & detections, int NOobj, int obj_limit, unsigned long * label_vals, long * data_metric, vector[int] & new_ids, int NOthreads)
+	cdef long LabelObjs(vector[object_props *] & detections, long NOobj, int obj_limit, unsigned long * label_vals, long * data_metric, vector[long] & new_ids, int NOthreads)
+	cdef struct catalogue_record:
+		long ID
+		double Xg, Yg, Zg, Xm, Ym, Zm
+		long Xmin, Xmax, Ymin, Ymax, Zmin, Zmax, NRvox
+		double Fmin, Fmax, Ftot
+	cdef void CopyCatalogue(vector[object_props *] & detections, int NOobj, int obj_limit, vector[int] & new_ids, catalogue_record * records, int NOthreads)
+	cdef void CopyCatalogue(vector[object_props *] & detections, long NOobj, int obj_limit, vector[long] & new_ids, catalogue_record * records, int NOthreads)
+	cdef long CopyRuns(vector[object_props *] & detections, int NOobj, int obj_limit, vector[int] & new_ids, long * offsets, int * runs, int NOthreads)
+	cdef long CopyRuns(vector[object_props *] & detections, long NOobj, int obj_limit, vector[long] & new_ids, long * offsets, int * runs, int NOthreads)
+	cdef void BuildPostageStamps(float * data_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, vector[int] & obj_ids, vector[object_props *] & detections, int obj_limit, long * data_metric, int products)
+	cdef void BuildPostageStamps(float * data_vals, int size_x, int size_y, int size_z, int chunk_x_start, int chunk_y_start, int chunk_z_start, vector[long] & obj_ids, vector[object_props *] & detections, int obj_limit, long * data_metric, int products)
+	cdef void CreateMetric(long * data_metric, int * xyz_order, int size_x, int size_y, int size_z)
+	cdef cppclass task_pool:
+		task_pool(int NOthreads) except +
+		void Submit(void (* task)(void * context), void * context)
+		int ShowThreads()
+		long ShowQueued()
+	
+	enum:
+		SREP_MOM0
+		SREP_RAPV
+		SREP_DECPV
+		SREP_OSPEC
+		SREP_RSPEC
+		SREP_VFIELD
+		SREP_ALL
 
 	cdef cppclass object_props:
 		
@@ -64,8 +253,190 @@ cdef extern from "RJJ_ObjGen.h":
 		int Get_srep_size(int index)
 		int Get_srep_grid(int index)
 		int Get_srep_strings(int index)
+		
+		# Postage stamp images
+		int Get_products()
+		float Get_mom0(int index)
+		float Get_RAPV(int index)
+		float Get_DECPV(int index)
+		float Get_ospec(int index)
+		float Get_rspec(int index)
+		float Get_vfield(int index)
+
+# Postage stamp products that can be requested from link_objects and link_objects_chunked
+PRODUCT_MOM0 = SREP_MOM0
+PRODUCT_RAPV = SREP_RAPV
+PRODUCT_DECPV = SREP_DECPV
+PRODUCT_SPEC = SREP_OSPEC
+PRODUCT_REF_SPEC = SREP_RSPEC
+PRODUCT_VFIELD = SREP_VFIELD
+PRODUCT_ALL = SREP_ALL
+
+# Columns of the structured catalogue returned by link_objects and link_objects_chunked
+CATALOGUE_DTYPE = np.dtype([('ID', np.int64), ('Xg', np.float64), ('Yg', np.float64), ('Zg', np.float64),
+							('Xm', np.float64), ('Ym', np.float64), ('Zm', np.float64),
+							('Xmin', np.int64), ('Xmax', np.int64), ('Ymin', np.int64), ('Ymax', np.int64),
+							('Zmin', np.int64), ('Zmax', np.int64), ('NRvox', np.int64),
+							('Fmin', np.float64), ('Fmax', np.float64), ('Ftot', np.float64)])
+assert CATALOGUE_DTYPE.itemsize == sizeof(catalogue_record)
+
+# Types of the labelled mask; the unsigned types are only written once the objects have been
+# linked, while the signed types can be linked in place
+LABEL_TYPES = (np.dtype(np.intc), np.dtype(np.int64), np.dtype(np.uint16), np.dtype(np.uint32), np.dtype(np.uint64))
+
+# Number of channels of a mask that link_objects can't label in place that are expanded to labels
+# at a time
+_SOURCE_CHUNK_Z = 64
+
+class LinkingCancelled(Exception):
+	"""
+	Raised by the linking functions when their progress function returns a true value.
+	"""
+	pass
+
+# Progress function of a call to the linker; each chunk of the out-of-core linker maps the
+# fraction of its own planes that have been linked onto its share of the whole cube
+cdef class _Progress:
+	cdef object callback
+	cdef double offset, scale
+	cdef bint cancelled
+	cdef object error
+	
+	def __init__(self, callback):
+		self.callback = callback
+		self.offset = 0.0
+		self.scale = 1.0
+		self.cancelled = False
+		self.error = None
+	
+	cdef _raise(self):
+		if self.error is not None:
+			raise self.error
+		raise LinkingCancelled('The linking has been cancelled by the progress function.')
+
+# Called by the linking engines once per plane, only ever from the thread that called the
+# linker; an exception raised by the progress function cancels the linking and is re-raised
+cdef int _report_progress(void * context, double fraction) noexcept with gil:
+	cdef _Progress progress = <_Progress> context
+	try:
+		if progress.callback(progress.offset + progress.scale * fraction):
+			progress.cancelled = True
+	except BaseException as error:
+		progress.error = error
+		progress.cancelled = True
+	return progress.cancelled
+
+# Stream of the objects of a call to the linker to a function that is run by a pool of worker threads
+# of its own; at most queue objects are held by the pool at once, so that the linking waits for the
+# workers rather than copying the whole cube into the queue. The calls don't refer to the stream, so
+# that it is always released, and its workers stopped, by the thread that called the linker
+cdef class _Stream:
+	cdef object function
+	cdef object slots
+	cdef task_pool * pool
+	cdef object data, mask
+	cdef int z_start, min_LOS
+	cdef object results, errors
+	cdef object streamed
+	
+	def __cinit__(self):
+		self.pool = NULL
+	
+	def __init__(self, function, workers, queue, min_LOS):
+		if workers < 1 or queue < 1:
+			raise ValueError('The stream needs at least one worker and one queued object.')
+		self.function = function
+		self.slots = threading.BoundedSemaphore(queue)
+		self.pool = new task_pool(workers)
+		self.min_LOS = min_LOS
+		self.results = {}
+		self.errors = []
+		self.streamed = set()
+	
+	def __dealloc__(self):
+		self._stop()
+	
+	cdef _stop(self):
+		cdef task_pool * pool = self.pool
+		
+		self.pool = NULL
+		if pool != NULL:
+			with nogil:
+				del pool
+	
+	cdef _submit(self, obj_id, data, mask, bbox):
+		# the object is copied before it is queued, as the labels of the chunk are overwritten as
+		# the linking continues
+		self.slots.acquire()
+		future = Future(_stream_object, (self.function, self.results, self.errors, self.slots, obj_id, data, mask, bbox), {})
+		Py_INCREF(future)
+		self.pool.Submit(_run_future, <void *> future)
+	
+	cdef _finish(self, ids):
+		# wait for the workers, and number the results with the final IDs of the objects; the objects
+		# that were dropped by the thresholds at the end of the linking are discarded
+		self._stop()
+		if self.errors:
+			raise self.errors[0]
+		return {ids[obj_id]: result for obj_id, result in self.results.items() if obj_id in ids}
+
+def _stream_object(function, results, errors, slots, obj_id, data, mask, bbox):
+	# the first exception raised by the stream function is passed on, and the remaining objects
+	# are skipped
+	try:
+		if not errors:
+			results[obj_id] = function(data, mask, bbox)
+	except BaseException as error:
+		errors.append(error)
+	finally:
+		slots.release()
+
+# Called by the 'scan' engine for every object that can no longer grow and has passed the size
+# thresholds; the object is labelled with its ID in the mask of the chunk that is being linked. An
+# exception raised while the object is queued, or by an earlier call of the stream function,
+# cancels the linking
+cdef int _finalise_object(void * context, long obj_id, int * bbox) noexcept with gil:
+	cdef _Stream stream = <_Stream> context
+	cdef int z0 = bbox[4] - stream.z_start, z1 = bbox[5] + 1 - stream.z_start
+	try:
+		if stream.errors:
+			return 1
+		if obj_id in stream.streamed:
+			return 0
+		mask = np.asarray(stream.mask[z0:z1, bbox[2]:bbox[3] + 1, bbox[0]:bbox[1] + 1]) == obj_id
+		if np.count_nonzero(mask.any(axis = 0)) < stream.min_LOS:
+			return 0
+		stream.streamed.add(obj_id)
+		stream._submit(obj_id, np.array(stream.data[z0:z1, bbox[2]:bbox[3] + 1, bbox[0]:bbox[1] + 1]), mask, (bbox[0], bbox[1] + 1, bbox[2], bbox[3] + 1, bbox[4], bbox[5] + 1))
+	except BaseException as error:
+		stream.errors.append(error)
+		return 1
+	return 0
 
-def link_objects(data, mask, mergeX = 0, mergeY = 0, mergeZ = 0, minSizeX = 1, minSizeY = 1, minSizeZ = 1, min_LOS = 1):
+cdef _stream_rest(_Stream stream, vector[object_props *] & detections, label_t NOobj, int obj_limit, data, labels):
+	
+	cdef label_t i, obj_batch, NOkept = 0
+	cdef object_props * obj
+	
+	# Number the objects that passed the thresholds, and stream the objects that were still in the
+	# merging box at the end of the linking, or were linked by the other engines, from the labelled
+	# mask; their data are read from the whole cube
+	ids = {}
+	for i in range(NOobj):
+		obj_batch = i / obj_limit
+		obj = &detections[obj_batch][i - (obj_batch * obj_limit)]
+		if obj.ShowVoxels() < 1:
+			continue
+		NOkept += 1
+		ids[i] = NOkept
+		if i in stream.streamed or stream.errors:
+			continue
+		bbox = (obj.Get_srep_size(0), obj.Get_srep_size(1) + 1, obj.Get_srep_size(2), obj.Get_srep_size(3) + 1, obj.Get_srep_size(4), obj.Get_srep_size(5) + 1)
+		mask = np.asarray(labels[bbox[4]:bbox[5], bbox[2]:bbox[3], bbox[0]:bbox[1]]) == NOkept
+		stream._submit(i, np.array(data[bbox[4]:bbox[5], bbox[2]:bbox[3], bbox[0]:bbox[1]], dtype = np.single), mask, bbox)
+	return ids
+
+def link_objects(data, mask, mergeX = 0, mergeY = 0, mergeZ = 0, minSizeX = 1, minSizeY = 1, minSizeZ = 1, min_LOS = 1, engine = 'scan', threads = 1, products = 0, compactVoxels = 0, compactPeak = np.inf, progress = None, stats = False, structured = False, objectRuns = False, labelType = None, packed = False, maskFile = None, maskHeader = '', catalogueFile = None, catalogueColumns = None, catalogueBinary = False, fluxUnit = '-', stream = None, streamWorkers = 1, streamQueue = 16):
 	"""
 	Given a data cube and a binary mask, create a labeled version of the mask.
 	In addition, close groups of objects can be linked together, so they have the same label.
@@ -78,7 +449,45 @@ def link_objects(data, mask, mergeX = 0, mergeY = 0, mergeZ = 0, minSizeX = 1, m
 		The data
 	
 	mask : array
-		The binary mask
+		The binary mask. It is turned into the labelled mask in place if it is of type
+		numpy.intc, or of type numpy.int64 --- which uses 64-bit object IDs and labels, for
+		more objects than a 32-bit integer can number. The data and mask may be memory-mapped.
+		A mask of any other type, e.g. bool or numpy.uint8, a packed mask, and any mask if
+		labelType is given, is only read, and linked chunk by chunk as by link_objects_chunked,
+		so that only 64 channels of it are expanded to labels at a time. For a mask of more
+		channels, the objects are the same as for a numpy.intc mask, but may be numbered
+		differently.
+		
+	labelType : numpy type or str, optional
+		Type of a separate labelled mask, one of LABEL_TYPES, or 'auto' for the narrowest of
+		numpy.uint16, numpy.uint32 and numpy.uint64 that can number the objects. The labelled
+		mask is only allocated once the objects have been linked and thresholded.
+		
+	packed : bool
+		If True, the mask holds one bit per voxel, packed along the x axis as by
+		numpy.packbits(mask, axis = 2).
+		
+	maskFile : str, optional
+		Name of a FITS file that receives the labelled mask as well. It is written one
+		channel at a time, straight from the objects, with the narrowest BITPIX that can
+		number them.
+		
+	maskHeader : str
+		Header cards of 80 characters each, e.g. from writemask.maskCards, that are added
+		to the header of maskFile after its mandatory cards.
+		
+	catalogueFile : str, optional
+		Name of a file that receives the catalogue of the objects as well, written in one
+		pass without going through Python objects. The ASCII catalogue has the header and
+		number formats of the pipeline's catalogues, with the flux columns in fluxUnit.
+		
+	catalogueColumns : list of str, optional
+		The columns of the ASCII catalogue, from the fields of CATALOGUE_DTYPE; all of them
+		by default.
+		
+	catalogueBinary : bool
+		If True, catalogueFile holds a little-endian record of type CATALOGUE_DTYPE per
+		object instead, which numpy.fromfile can read back.
 		
 	mergeX, mergeY, mergeZ : int
 		The merging length in all three dimensions
@@ -92,6 +501,49 @@ def link_objects(data, mask, mergeX = 0, mergeY = 0, mergeZ = 0, minSizeX = 1, m
 	ss_mode : int
 		The linking method. A value of 1 uses a cuboid and all other values use an elliptical cylinder.
 		
+	engine : str
+		The labelling engine. 'scan' re-labels the mask every time two objects are merged, while
+		'unionfind' records merges in a union-find forest and resolves the labels in a single pass
+		at the end. Both engines produce the same objects and mask. 'parallel' splits the cube into
+		z-slabs that are linked concurrently, and numbers the objects in the order of their first
+		voxel; its objects and mask do not depend on the number of threads. 'dilate' dilates the
+		mask with the merging kernel and labels the connected regions of the dilated mask, so that
+		its run time doesn't depend on mergeZ; it produces the same objects and mask as 'parallel'.
+		
+	threads : int
+		The number of threads used to threshold and label the objects, with every engine.
+		The 'parallel' engine also links its z-slabs on this number of threads.
+		
+	products : int
+		Bitmask of the postage stamp products to build for each object, combined from
+		PRODUCT_MOM0, PRODUCT_RAPV, PRODUCT_DECPV, PRODUCT_SPEC, PRODUCT_REF_SPEC and
+		PRODUCT_VFIELD, or PRODUCT_ALL. The products are built after the objects have been
+		linked and thresholded, and only for the objects that are kept. The velocity field
+		is normalised by the moment-0 map, so it needs PRODUCT_MOM0 as well. By default,
+		no products are built.
+		
+	compactVoxels, compactPeak : int, float
+		Objects with fewer than compactVoxels voxels and an absolute peak flux below
+		compactPeak are demoted to compact records once they can no longer grow. They are
+		removed from the objects and the mask, and only their total flux, peak flux, number
+		of voxels and sign are kept, e.g. for the reliability calculation. The line of sight
+		threshold doesn't apply to them. By default, no objects are demoted.
+		
+	structured : bool
+		If True, the objects are returned as a structured array rather than as a list.
+		
+	objectRuns : bool
+		If True, the voxels of the objects are returned as well, as runs along the
+		spectral axis.
+		
+	stream : callable, optional
+		Function that is called with each object that is kept, in worker threads while
+		the linking continues; see Streaming below.
+		
+	streamWorkers, streamQueue : int
+		The number of worker threads that call stream, and the largest number of objects
+		that are copied for them but haven't been handled yet.
+		
 		
 	Returns
 	-------
@@ -105,69 +557,149 @@ def link_objects(data, mask, mergeX = 0, mergeY = 0, mergeZ = 0, minSizeX = 1, m
 		
 		The Bounding box are defined is such a way that they can be
 		used as slices, i.e. data[Zmin:Zmax]
+		
+		If structured is True, a structured array of type CATALOGUE_DTYPE with one row
+		per object and the same columns, named ID, Xg, Yg, Zg, Xm, Ym, Zm, Xmin, Xmax,
+		Ymin, Ymax, Zmin, Zmax, NRvox, Fmin, Fmax and Ftot.
 			
 	
 	mask : array
 		The labeled and linked integer mask
+	
+	stamps : list
+		Only returned if products is not 0. One dictionary per object, in the order of
+		objects, holding the requested products as arrays: 'mom0' (y,x), 'rapv' (z,x),
+		'decpv' (z,y), 'spec' (z), 'ref_spec' and 'vfield' (y,x), over the object's
+		bounding box. 'ref_spec' is the summed spectrum of every line of sight through the
+		bounding box, over a window that extends beyond the object's channel range.
+	
+	compact : array
+		Only returned if compactVoxels is larger than 0. Array of shape (N, 4) holding the
+		total flux, peak flux, number of voxels and sign (1 or -1) of each compact record.
+	
+	runs, offsets : array
+		Only returned if objectRuns is True. An array of shape (N, 4) holding the x and y
+		position and the first and last channel of every run of voxels along the spectral
+		axis, and an array holding the index of the first run of each object followed by
+		the number of runs. runs[offsets[k - 1]:offsets[k]] is a view of the runs of the
+		object with ID k, without copying them.
+	
+	streamed : dict
+		Only returned if stream is given. The results of stream, by the IDs of the objects.
+	
+	stats : dict
+		Only returned if stats is True. The wall times in seconds of the phases of the
+		linker, 'sweep_time' (linking the voxels, which includes 'merge_time', spent on
+		merging objects), 'sparse_reps_time', 'threshold_time', 'stamps_time' and
+		'catalogue_time' (making the catalogue and labelling the mask), and 'total_time'.
+		In addition, the number of source voxels linked by the sweep, 'voxels_scanned', the
+		number of merges, 'merges' --- of provisional labels for the 'parallel' and
+		'dilate' engines --- the number of mask voxels re-written when objects are merged
+		by the 'scan' engine, 'voxels_rewritten', the number of object IDs that were
+		re-used, 'ids_recycled', the largest number of object IDs in use at once,
+		'peak_objects', the time spent in the object ID allocator and the number of calls
+		to it, 'allocator_time' and 'allocator_calls', and the memory held by the sparse
+		representations and postage stamp images of the objects, 'arena_bytes'.
+	
+	
+	Progress
+	--------
+	
+	If progress is given, it is called with the fraction of the cube that has been linked,
+	from 0 to 1, once per channel. If it returns a true value, the linking stops and
+	LinkingCancelled is raised; an exception raised by progress stops the linking in the
+	same manner and is passed on. The mask is then left partially labelled. The 'parallel'
+	engine only reports the channels linked by the calling thread, so its fractions may
+	advance in larger steps.
+	
+	
+	Streaming
+	---------
+	
+	If stream is given, it is called as stream(data, mask, bbox) for every object that is
+	kept, e.g. to parametrise it with parametrisation.parametrise_object, where data and
+	mask are copies of the data and of a boolean mask of the object over its bounding box,
+	and bbox holds Xmin, Xmax, Ymin, Ymax, Zmin and Zmax as for objects. The 'scan' engine
+	hands each object over as soon as it can no longer grow and has passed the thresholds,
+	so that the objects are handled while the rest of the cube is linked; the objects that
+	are still in the merging box at the end of the cube, and the objects of the other
+	engines, are handed over once the labelled mask has been made. The calls run in worker
+	threads, so that the linker and stream run at the same time while stream releases the
+	GIL, as the parametriser does. An exception raised by stream cancels the linking and is
+	passed on.
 	"""
-	return _link_objects(data.astype(np.single, copy = False), mask.astype(np.intc, copy = False), mergeX, mergeY, mergeZ, minSizeX, minSizeY, minSizeZ, min_LOS)
+	if engine not in ('scan', 'unionfind', 'parallel', 'dilate'):
+		raise ValueError('Unknown linking engine: ' + str(engine))
+	if threads < 1:
+		raise ValueError('At least one thread is needed.')
+	_check_products(products)
+	streamer = _Stream(stream, streamWorkers, streamQueue, min_LOS) if stream is not None else None
+	labelType = _check_label_type(labelType)
+	catalogue = _catalogue_output(catalogueFile, catalogueColumns, catalogueBinary, fluxUnit)
+	if mask.shape != _mask_shape(data.shape, packed):
+		raise ValueError('The mask doesn\'t match the shape of the data.')
+	
+	# Masks of type numpy.intc or numpy.int64 are labelled in place, unless a separate labelled
+	# mask is requested; all other masks are linked chunk by chunk, as by link_objects_chunked,
+	# so that only one chunk of them is ever expanded to labels
+	if labelType is None and not packed and mask.dtype == np.int64:
+		return _link_objects[long](data.astype(np.single, copy = False), mask, mergeX, mergeY, mergeZ, minSizeX, minSizeY, minSizeZ, min_LOS, engine, threads, products, compactVoxels, compactPeak, progress, stats, structured, objectRuns, None, maskFile, maskHeader, catalogue, streamer)
+	if labelType is None and not packed and mask.dtype == np.intc:
+		return _link_objects[int](data.astype(np.single, copy = False), mask, mergeX, mergeY, mergeZ, minSizeX, minSizeY, minSizeZ, min_LOS, engine, threads, products, compactVoxels, compactPeak, progress, stats, structured, objectRuns, None, maskFile, maskHeader, catalogue, streamer)
+	chunkZ = max(_SOURCE_CHUNK_Z, mergeZ + 1)
+	if _wide_labels(labelType, mask.dtype):
+		objects, labels, stamps, compact, object_runs, streamed, info = _link_objects_chunked[long](data.astype(np.single, copy = False), mask, None, labelType, packed, 0, chunkZ, mergeX, mergeY, mergeZ, minSizeX, minSizeY, minSizeZ, min_LOS, engine, threads, products, compactVoxels, compactPeak, progress, stats, structured, objectRuns, maskFile, maskHeader, catalogue, streamer, True)
+	else:
+		objects, labels, stamps, compact, object_runs, streamed, info = _link_objects_chunked[int](data.astype(np.single, copy = False), mask, None, labelType, packed, 0, chunkZ, mergeX, mergeY, mergeZ, minSizeX, minSizeY, minSizeZ, min_LOS, engine, threads, products, compactVoxels, compactPeak, progress, stats, structured, objectRuns, maskFile, maskHeader, catalogue, streamer, True)
+	return _chunked_result(objects, labels, stamps, compact, object_runs, streamed, info, products, compactVoxels, objectRuns, streamer, stats)
 
-cdef _link_objects(np.ndarray[dtype = float, ndim = 3] data, np.ndarray[dtype = int, ndim = 3] mask,
+cdef _link_objects(np.ndarray[dtype = float, ndim = 3] data, np.ndarray[dtype = label_t, ndim = 3] mask,
 				   int mergeX = 3, int mergeY = 3, int mergeZ = 5,
 				   int minSizeX = 1, int minSizeY = 1, int minSizeZ = 1,
-				   int min_LOS = 1):
+				   int min_LOS = 1, engine = 'scan', int threads = 1, int products = 0,
+				   int compactVoxels = 0, float compactPeak = np.inf, progress = None, bint stats = False, bint structured = False, bint objectRuns = False,
+				   np.ndarray runs = None, maskFile = None, maskHeader = '', catalogue = None, _Stream streamer = None):
 		
-	cdef int i, x, y, z, g, g_start, g_end
-	cdef int obj_id = 0
-	cdef int obj_batch
-	
 	cdef int size_x = data.shape[2]
 	cdef int size_y = data.shape[1]
 	cdef int size_z = data.shape[0]
+	cdef int z
 			
-	# Convert binary mask to conform with the object code
-	for z in range(size_z):
-		for y in range(size_y):
-			for x in range(size_x):
-				if mask[z,y,x] > 0:
-					mask[z,y,x] = -1
-				else:
-					mask[z,y,x] = -99
+	# Convert binary mask to conform with the object code, one channel at a time, so that
+	# no temporary arrays of the size of the whole cube are created; a mask that has been
+	# built from runs of source voxels is already in this form
+	if runs is None:
+		for z in range(size_z):
+			mask[z] = np.where(mask[z] > 0, -1, -99)
 	
 	# Define arrays storing datacube geometry metric
-	cdef int * data_metric
+	cdef long * data_metric
 	cdef int * xyz_order	
 
-	# Chunking is disabled for this interface
-	cdef int chunk_x_start = 0
-	cdef int chunk_y_start = 0
-	cdef int chunk_z_start = 0
-	
-	# Define min_v_size; does not seem to be used
-	cdef int min_v_size = 0
-	
-	# Define intensity thresholds
-	cdef float intens_thresh_min = -1E10
-	cdef float intens_thresh_max = 1E10
-	
-	# Define value that is used to mark sources in the mask
-	cdef int flag_val = -1
-	
 	# Specify size of allocated object groups 
 	cdef int obj_limit = 1000
 	
 	# Object and ID arrays; will be written to by the function
 	cdef vector[object_props *] detections
-	cdef vector[int] obj_ids
-	cdef int NO_obj_ids
-	cdef vector[int] check_obj_ids
-	cdef int NOobj = 0
-	
-	# Define linking style: 1 for Rectangle, else ellipse
-	cdef int ss_mode = 0
+	cdef vector[label_t] obj_ids
+	cdef vector[label_t] check_obj_ids
+	cdef vector[label_t] kept_ids
+	cdef label_t NOobj = 0
+	cdef label_t i, obj_batch
+	cdef _Progress reporter = _Progress(progress) if progress is not None else None
+	cdef double start_time = _clock(stats), stamps_time = 0.0, catalogue_time
 	
 	# Inititalize object pointers
 	InitObjGen(detections, NOobj, obj_limit, obj_ids, check_obj_ids, data_metric, xyz_order)
+	SetCompactLimits(detections, compactVoxels, compactPeak)
+	SetLinkStats(detections, stats)
+	if reporter is not None:
+		SetProgress(detections, _report_progress, <void *> reporter)
+	if streamer is not None:
+		streamer.data = data
+		streamer.mask = mask
+		streamer.z_start = 0
+		SetFinalise(detections, _finalise_object, <void *> streamer)
 
 	# Define the mapping of RA, Dec and frequency to the datacube's first three axes. RA, Dec and freq. --> 1, 2, 3: use the default values of x=RA=1 y=Dec=2 z=freq.=3
 	xyz_order[0] = 1
@@ -177,81 +709,848 @@ cdef _link_objects(np.ndarray[dtype = float, ndim = 3] data, np.ndarray[dtype =
 	# create metric for accessing this data chunk in arbitrary x,y,z order
 	CreateMetric(data_metric, xyz_order, size_x, size_y, size_z)
 		
-	# Create and threshold objects
-	NOobj = CreateObjects(<float *> data.data, <int *> mask.data, size_x, size_y, size_z, chunk_x_start, chunk_y_start, chunk_z_start, mergeX, mergeY, mergeZ, minSizeX, minSizeY, minSizeZ, min_v_size, intens_thresh_min, intens_thresh_max, flag_val, NOobj, detections, obj_ids, check_obj_ids, obj_limit, size_x, size_y, size_z, ss_mode, data_metric, xyz_order)
-	ThresholdObjs(detections, NOobj, obj_limit, minSizeX, minSizeY, minSizeZ, min_v_size, intens_thresh_min, intens_thresh_max, min_LOS)
+	# Create and threshold objects; chunking is disabled for this interface
+	NOobj = _create_objects(data, mask, 0, size_z, mergeX, mergeY, mergeZ, minSizeX, minSizeY, minSizeZ, engine, threads, detections, obj_ids, check_obj_ids, NOobj, obj_limit, data_metric, xyz_order, 0, runs)
+	if reporter is not None and reporter.cancelled:
+		FreeObjGen(detections, data_metric, xyz_order)
+		reporter._raise()
+	if streamer is not None and streamer.errors:
+		FreeObjGen(detections, data_metric, xyz_order)
+		streamer._finish(None)
+	with nogil:
+		ThresholdObjs(detections, NOobj, obj_limit, minSizeX, minSizeY, minSizeZ, 0, -1E10, 1E10, min_LOS, threads)
+	
+	# Build the requested postage stamp products of the objects that passed the thresholds only;
+	# the whole cube is in memory, so they are built from the final sparse representations
+	if products != 0:
+		stamps_time = _clock(stats)
+		for i in range(NOobj):
+			obj_batch = i / obj_limit
+			if detections[obj_batch][i - (obj_batch * obj_limit)].ShowVoxels() >= 1:
+				kept_ids.push_back(i)
+		with nogil:
+			BuildPostageStamps(<float *> data.data, size_x, size_y, size_z, 0, 0, 0, kept_ids, detections, obj_limit, data_metric, products)
+		stamps_time = _clock(stats) - stamps_time
+	if maskFile is not None:
+		_write_fits_mask(detections, NOobj, obj_limit, maskFile, maskHeader, size_x, size_y, size_z, data_metric, xyz_order)
 
-	# Reset output mask
-	for z in range(size_z):
-		for y in range(size_y):
-			for x in range(size_x):
-				mask[z,y,x] = 0
+	catalogue_time = _clock(stats)
+	objects, stamps, object_runs = _create_catalogue(detections, NOobj, obj_limit, mask, products, data_metric, threads, structured, objectRuns)
+	if catalogue is not None:
+		_write_catalogue(detections, NOobj, obj_limit, catalogue, data_metric, xyz_order)
+	compact = _compact_records(detections)
+	catalogue_time = _clock(stats) - catalogue_time
+	info = _link_stats(detections, stamps_time, catalogue_time, _clock(stats) - start_time) if stats else None
+	ids = _stream_rest(streamer, detections, NOobj, obj_limit, data, mask) if streamer is not None else None
 	
-	# Create Python list `objects' from C++ vector `detections' and re-label mask with final, sequential IDs
-	objects = []
+	# Free memory for object pointers
+	FreeObjGen(detections, data_metric, xyz_order)
+
+	result = (objects, mask)
+	if products != 0:
+		result += (stamps,)
+	if compactVoxels > 0:
+		result += (compact,)
+	if objectRuns:
+		result += object_runs
+	if streamer is not None:
+		result += (streamer._finish(ids),)
+	if stats:
+		result += (info,)
+	return result
+
+def link_objects_sparse(data, voxels, mergeX = 0, mergeY = 0, mergeZ = 0, minSizeX = 1, minSizeY = 1, minSizeZ = 1, min_LOS = 1, engine = 'scan', threads = 1, products = 0, compactVoxels = 0, compactPeak = np.inf, progress = None, stats = False, structured = False, objectRuns = False):
+	"""
+	Version of link_objects for sparse masks, that takes the coordinates of the detected
+	voxels instead of a binary mask. The coordinates are turned into runs of voxels along
+	the x axis, and the 'scan' engine only visits the voxels of these runs, rather than
+	every voxel of the cube. The objects and labelled mask are the same as those of
+	link_objects.
+	
+	Only the sweep of the linker is sparse: the engines still label a full cube of intc
+	values, which is allocated here from the voxels and returned as the labelled mask, so
+	the memory used is the same as for link_objects.
+	
+	
+	Parameters
+	----------
+	
+	data : array
+		The data
+	
+	voxels : tuple of arrays or array
+		The z, y and x coordinates of the detected voxels, e.g. as returned by
+		numpy.nonzero(mask), or an array of shape (N, 3) holding the z, y and x
+		coordinate of each voxel
+	
+	All other parameters and the returned objects are the same as for link_objects.
+	"""
+	if engine not in ('scan', 'unionfind', 'parallel', 'dilate'):
+		raise ValueError('Unknown linking engine: ' + str(engine))
+	if threads < 1:
+		raise ValueError('At least one thread is needed.')
+	_check_products(products)
+	
+	if not isinstance(voxels, tuple):
+		voxels = tuple(np.asarray(voxels).reshape(-1, 3).T)
+	size_x = data.shape[2]
+	
+	# Sort the voxels by their offset in the cube, and split them into runs wherever the
+	# offset jumps or a new row starts
+	index = np.unique(np.ravel_multi_index(voxels, data.shape))
+	mask = np.full(data.shape, -99, dtype = np.intc)
+	mask.reshape(-1)[index] = -1
+	breaks = np.flatnonzero((np.diff(index) != 1) | (np.diff(index // size_x) != 0)) + 1
+	starts = index[np.concatenate(([0], breaks))] if index.size > 0 else index
+	ends = index[np.concatenate((breaks - 1, [index.size - 1]))] if index.size > 0 else index
+	runs = np.empty((starts.size, 4), dtype = np.intc)
+	runs[:, 0] = starts // (size_x * data.shape[1])
+	runs[:, 1] = (starts // size_x) % data.shape[1]
+	runs[:, 2] = starts % size_x
+	runs[:, 3] = ends % size_x
+	
+	return _link_objects[int](data.astype(np.single, copy = False), mask, mergeX, mergeY, mergeZ, minSizeX, minSizeY, minSizeZ, min_LOS, engine, threads, products, compactVoxels, compactPeak, progress, stats, structured, objectRuns, runs)
+
+def link_objects_chunked(data, mask, labels = None, chunkZ = 64, mergeX = 0, mergeY = 0, mergeZ = 0, minSizeX = 1, minSizeY = 1, minSizeZ = 1, min_LOS = 1, engine = 'scan', threads = 1, products = 0, compactVoxels = 0, compactPeak = np.inf, progress = None, stats = False, structured = False, objectRuns = False, labelType = None, packed = False, maskFile = None, maskHeader = '', catalogueFile = None, catalogueColumns = None, catalogueBinary = False, fluxUnit = '-', stream = None, streamWorkers = 1, streamQueue = 16):
+	"""
+	Out-of-core version of link_objects, for cubes that don't fit into memory.
+	The data cube and binary mask are read in chunks of chunkZ channels, plus the
+	mergeZ channels before each chunk that are needed to link objects across the
+	chunk borders. Objects that can still grow are carried over to the next chunk
+	through their sparse representations, so only one chunk is held in memory at
+	a time.
+	
+	
+	Parameters
+	----------
+	
+	data, mask : array
+		The data and binary mask, e.g. numpy.memmap arrays or the data of a
+		FITS file opened with memmap = True; they are only read chunk by chunk. The
+		mask may be of any type, e.g. bool or numpy.uint8, or hold one bit per voxel
+		if packed is True
+		
+	labels : array, optional
+		Writable array of one of LABEL_TYPES and of the same shape, e.g. a numpy.memmap,
+		that receives the labelled mask; numpy.int64 and numpy.uint64 labels use 64-bit
+		object IDs. If it isn't given, a new array of type labelType is created once the
+		objects have been linked, or of type numpy.intc if labelType isn't given either
+	
+	chunkZ : int
+		The number of channels in each chunk; must be larger than mergeZ
+	
+	maskFile, maskHeader, catalogueFile, catalogueColumns, catalogueBinary, fluxUnit : optional
+		As for link_objects; the labelled mask is written to maskFile without reading
+		the labels back
+	
+	All other parameters and the returned objects are the same as for link_objects. The
+	postage stamp products are built alongside the sparse representations as each chunk
+	is linked, as the data of earlier chunks are no longer available at the end. The
+	reference spectrum of an object that spans several chunks therefore only covers the
+	lines of sight of its bounding box as it was when each chunk was linked. If the linking
+	is cancelled, the labels are left partially written. The 'scan' engine streams the
+	objects that are finished with as each chunk is linked; the rest are read back from
+	the data and labels at the end.
+	"""
+	if engine not in ('scan', 'unionfind', 'parallel', 'dilate'):
+		raise ValueError('Unknown linking engine: ' + str(engine))
+	if threads < 1:
+		raise ValueError('At least one thread is needed.')
+	if chunkZ <= mergeZ:
+		raise ValueError('The chunk size must be larger than the merging length in z.')
+	_check_products(products)
+	if mask.shape != _mask_shape(data.shape, packed) or (labels is not None and labels.shape != data.shape):
+		raise ValueError('The data, mask and labels must have the same shape.')
+	if labels is not None and labels.dtype not in LABEL_TYPES:
+		raise ValueError('The labels array must be of one of the types in LABEL_TYPES.')
+	labelType = labels.dtype if labels is not None else _check_label_type(labelType)
+	catalogue = _catalogue_output(catalogueFile, catalogueColumns, catalogueBinary, fluxUnit)
+	streamer = _Stream(stream, streamWorkers, streamQueue, min_LOS) if stream is not None else None
+	
+	# The objects are linked with IDs of the type of NOobj, which starts at 0
+	if _wide_labels(labelType, None):
+		objects, labels, stamps, compact, object_runs, streamed, info = _link_objects_chunked[long](data, mask, labels, labelType, packed, 0, chunkZ, mergeX, mergeY, mergeZ, minSizeX, minSizeY, minSizeZ, min_LOS, engine, threads, products, compactVoxels, compactPeak, progress, stats, structured, objectRuns, maskFile, maskHeader, catalogue, streamer)
+	else:
+		objects, labels, stamps, compact, object_runs, streamed, info = _link_objects_chunked[int](data, mask, labels, labelType, packed, 0, chunkZ, mergeX, mergeY, mergeZ, minSizeX, minSizeY, minSizeZ, min_LOS, engine, threads, products, compactVoxels, compactPeak, progress, stats, structured, objectRuns, maskFile, maskHeader, catalogue, streamer)
+	
+	return _chunked_result(objects, labels, stamps, compact, object_runs, streamed, info, products, compactVoxels, objectRuns, streamer, stats)
+
+def _chunked_result(objects, labels, stamps, compact, object_runs, streamed, info, products, compactVoxels, objectRuns, streamer, stats):
+	# Assemble the returned tuple of the linkers that go chunk by chunk
+	result = (objects, labels)
+	if products != 0:
+		result += (stamps,)
+	if compactVoxels > 0:
+		result += (compact,)
+	if objectRuns:
+		result += object_runs
+	if streamer is not None:
+		result += (streamed,)
+	if stats:
+		result += (info,)
+	return result
+
+cdef _link_objects_chunked(data, mask, labels, labelType, bint packed, label_t NOobj, int chunkZ, int mergeX, int mergeY, int mergeZ,
+						   int minSizeX, int minSizeY, int minSizeZ, int min_LOS, engine, int threads, int products,
+						   int compactVoxels, float compactPeak, progress, bint stats, bint structured, bint objectRuns, maskFile, maskHeader, catalogue, _Stream streamer,
+						   bint inMemory = False):
+	
+	cdef int size_x = data.shape[2]
+	cdef int size_y = data.shape[1]
+	cdef int size_z = data.shape[0]
+	cdef int halo = max(mergeZ, 0)
+	cdef int z_core, z_start, z_end
+	
+	cdef np.ndarray[dtype = float, ndim = 3] chunk_data
+	cdef np.ndarray[dtype = label_t, ndim = 3] chunk_mask
+	
+	cdef long * data_metric
+	cdef int * xyz_order
+	cdef int obj_limit = 1000
+	cdef vector[object_props *] detections
+	cdef vector[label_t] obj_ids
+	cdef vector[label_t] check_obj_ids
+	cdef vector[label_t] kept_ids
+	cdef label_t i, obj_batch
+	cdef _Progress reporter = _Progress(progress) if progress is not None else None
+	cdef double start_time = _clock(stats), stamps_time = 0.0, catalogue_time
+	
+	InitObjGen(detections, NOobj, obj_limit, obj_ids, check_obj_ids, data_metric, xyz_order)
+	SetCompactLimits(detections, compactVoxels, compactPeak)
+	SetLinkStats(detections, stats)
+	if reporter is not None:
+		SetProgress(detections, _report_progress, <void *> reporter)
+	if streamer is not None:
+		SetFinalise(detections, _finalise_object, <void *> streamer)
+	xyz_order[0] = 1
+	xyz_order[1] = 2
+	xyz_order[2] = 3
+	
+	for z_core in range(0, size_z, chunkZ):
+		
+		# Read the chunk and the preceding halo; the halo has already been linked, so it only
+		# receives the objects that may still grow into this chunk
+		z_start = max(z_core - halo, 0)
+		z_end = min(z_core + chunkZ, size_z)
+		chunk_data = np.ascontiguousarray(data[z_start:z_end], dtype = np.single)
+		chunk_mask = np.where(_read_mask(mask, z_start, z_end, packed, size_x) > 0, -1, -99).astype(np.int64 if label_t is long else np.intc)
+		chunk_mask[:z_core - z_start] = -99
 		
-	for i in range(NOobj):		
+		CreateMetric(data_metric, xyz_order, size_x, size_y, z_end - z_start)
+		with nogil:
+			AddObjsToChunk(<label_t *> chunk_mask.data, detections, NOobj, obj_limit, 0, 0, z_start, size_x, size_y, z_end - z_start, check_obj_ids, data_metric, xyz_order)
 		
-		# calculate batch number for this object --- which group of objects does it belong to
+		# The engines report the fraction of the chunk, halo included, that has been linked
+		if reporter is not None:
+			reporter.offset = <double> z_core / size_z
+			reporter.scale = <double> (z_end - z_core) / size_z
+		if streamer is not None:
+			streamer.data = chunk_data
+			streamer.mask = chunk_mask
+			streamer.z_start = z_start
+		NOobj = _create_objects(chunk_data, chunk_mask, z_start, size_z, mergeX, mergeY, mergeZ, minSizeX, minSizeY, minSizeZ, engine, threads, detections, obj_ids, check_obj_ids, NOobj, obj_limit, data_metric, xyz_order, 0 if inMemory else products)
+		if reporter is not None and reporter.cancelled:
+			FreeObjGen(detections, data_metric, xyz_order)
+			reporter._raise()
+		if streamer is not None and streamer.errors:
+			FreeObjGen(detections, data_metric, xyz_order)
+			streamer._finish(None)
+	
+	with nogil:
+		ThresholdObjs(detections, NOobj, obj_limit, minSizeX, minSizeY, minSizeZ, 0, -1E10, 1E10, min_LOS, threads)
+	CreateMetric(data_metric, xyz_order, size_x, size_y, size_z)
+	
+	# If the whole data cube is in memory, as for link_objects, the postage stamp images of the
+	# objects that passed the thresholds are built from their final sparse representations
+	if inMemory and products != 0:
+		stamps_time = _clock(stats)
+		chunk_data = np.ascontiguousarray(data, dtype = np.single)
+		for i in range(NOobj):
+			obj_batch = i / obj_limit
+			if detections[obj_batch][i - (obj_batch * obj_limit)].ShowVoxels() >= 1:
+				kept_ids.push_back(i)
+		with nogil:
+			BuildPostageStamps(<float *> chunk_data.data, size_x, size_y, size_z, 0, 0, 0, kept_ids, detections, obj_limit, data_metric, products)
+		stamps_time = _clock(stats) - stamps_time
+	if maskFile is not None:
+		_write_fits_mask(detections, NOobj, obj_limit, maskFile, maskHeader, size_x, size_y, size_z, data_metric, xyz_order)
+	
+	# The labelled mask covers the whole cube, and is only allocated once the number of objects
+	# is known; otherwise the postage stamp images are built with the sparse representations
+	catalogue_time = _clock(stats)
+	labels = _label_array(labels, labelType, _count_kept(detections, NOobj, obj_limit), (size_z, size_y, size_x))
+	if labels is None:
+		FreeObjGen(detections, data_metric, xyz_order)
+		raise ValueError('The labels can\'t number all objects.')
+	objects, stamps, object_runs = _create_catalogue(detections, NOobj, obj_limit, labels, products, data_metric, threads, structured, objectRuns)
+	if catalogue is not None:
+		_write_catalogue(detections, NOobj, obj_limit, catalogue, data_metric, xyz_order)
+	compact = _compact_records(detections)
+	catalogue_time = _clock(stats) - catalogue_time
+	info = _link_stats(detections, stamps_time, catalogue_time, _clock(stats) - start_time) if stats else None
+	ids = _stream_rest(streamer, detections, NOobj, obj_limit, data, labels) if streamer is not None else None
+	
+	FreeObjGen(detections, data_metric, xyz_order)
+	streamed = streamer._finish(ids) if streamer is not None else None
+	
+	return objects, labels, stamps, compact, object_runs, streamed, info
+
+cdef _compact_records(vector[object_props *] & detections):
+	
+	cdef np.ndarray[dtype = float, ndim = 2] records = np.empty((CopyCompactObjs(detections, NULL), 4), dtype = np.single)
+	
+	if records.shape[0] > 0:
+		CopyCompactObjs(detections, <float *> records.data)
+	return records
+
+cdef inline double _clock(bint stats):
+	# the phases are only timed, with the clock of the linker, if the statistics are collected
+	return WallTime() if stats else 0.0
+
+cdef _link_stats(vector[object_props *] & detections, double stamps_time, double catalogue_time, double total_time):
+	
+	cdef link_stats * stats = GetLinkStats(detections)
+	
+	return {'sweep_time': stats.sweep_time, 'merge_time': stats.merge_time, 'sparse_reps_time': stats.srep_time,
+			'threshold_time': stats.threshold_time, 'stamps_time': stamps_time, 'catalogue_time': catalogue_time,
+			'total_time': total_time, 'voxels_scanned': stats.voxels_scanned, 'merges': stats.merges,
+			'voxels_rewritten': stats.voxels_rewritten, 'ids_recycled': stats.ids_recycled,
+			'peak_objects': stats.peak_objects, 'arena_bytes': stats.arena_bytes,
+			'allocator_time': stats.alloc_time, 'allocator_calls': stats.alloc_calls}
+
+def _check_products(products):
+	if products < 0 or (products & ~SREP_ALL) != 0:
+		raise ValueError('Unknown postage stamp products: ' + str(products))
+	if (products & SREP_VFIELD) and not (products & SREP_MOM0):
+		raise ValueError('The velocity field product requires the moment-0 product.')
+
+def _check_label_type(labelType):
+	if labelType is None or (isinstance(labelType, str) and labelType == 'auto'):
+		return labelType
+	if np.dtype(labelType) not in LABEL_TYPES:
+		raise ValueError('Unknown label type: ' + str(labelType))
+	return np.dtype(labelType)
+
+def _wide_labels(labelType, mask_type):
+	# Whether the labels are linked with 64-bit object IDs; 'auto' only picks a 64-bit type for
+	# masks of type numpy.int64
+	if labelType is None or isinstance(labelType, str):
+		return mask_type == np.int64
+	return labelType.itemsize == 8
+
+def _mask_shape(shape, packed):
+	# A packed mask holds eight voxels along the x axis in every byte
+	return (shape[0], shape[1], (shape[2] + 7) // 8) if packed else tuple(shape)
+
+def _read_mask(mask, int z_start, int z_end, bint packed, int size_x):
+	# Read the channels z_start to z_end of a binary mask, unpacking a mask of one bit per voxel
+	planes = np.asarray(mask[z_start:z_end])
+	if packed:
+		return np.unpackbits(planes, axis = 2)[:, :, :size_x]
+	return planes
+
+def _aligned(array):
+	# Whether the strides of an array are whole multiples of its item size, so that it can be
+	# read through a metric of items
+	return all(stride % array.itemsize == 0 for stride in array.strides)
+
+def _label_array(labels, labelType, NOkept, shape):
+	# Allocate the labelled mask, of the narrowest unsigned type that can number the objects for
+	# labelType 'auto'; None is returned if the labels can't number the objects
+	if labels is None:
+		if labelType is None:
+			labelType = np.dtype(np.intc)
+		elif isinstance(labelType, str):
+			labelType = np.dtype(np.uint16) if NOkept <= np.iinfo(np.uint16).max else np.dtype(np.uint32) if NOkept <= np.iinfo(np.uint32).max else np.dtype(np.uint64)
+		if NOkept > np.iinfo(labelType).max:
+			return None
+		return np.zeros(shape, dtype = labelType)
+	if NOkept > np.iinfo(labels.dtype).max:
+		return None
+	return labels
+
+cdef label_t _count_kept(vector[object_props *] & detections, label_t NOobj, int obj_limit):
+	
+	cdef label_t i, obj_batch, NOkept = 0
+	
+	# The objects that passed the thresholds receive the final IDs
+	for i in range(NOobj):
 		obj_batch = i / obj_limit
+		if detections[obj_batch][i - (obj_batch * obj_limit)].ShowVoxels() >= 1:
+			NOkept += 1
+	return NOkept
 
-		if detections[obj_batch][i - (obj_batch * obj_limit)].ShowVoxels() >= 1:		
+def _catalogue_output(catalogueFile, catalogueColumns, catalogueBinary, fluxUnit):
+	# The catalogue file written by the linker, as its name, the indices of its columns in
+	# CATALOGUE_DTYPE, whether it is binary and the flux unit
+	if catalogueFile is None:
+		return None
+	names = CATALOGUE_DTYPE.names if catalogueColumns is None else tuple(catalogueColumns)
+	for name in names:
+		if name not in CATALOGUE_DTYPE.names:
+			raise ValueError('Unknown catalogue column: ' + str(name))
+	if len(set(names)) != len(names):
+		raise ValueError('The catalogue columns must not be repeated.')
+	return (catalogueFile, [CATALOGUE_DTYPE.names.index(name) for name in names], bool(catalogueBinary), fluxUnit)
+
+cdef _write_catalogue(vector[object_props *] & detections, label_t NOobj, int obj_limit, catalogue, long * data_metric, int * xyz_order):
 	
-			obj_id += 1
-			
-			obj = []
-			obj.append(obj_id)
+	cdef string output_file = catalogue[0].encode()
+	cdef string flux_unit = catalogue[3].encode()
+	cdef np.ndarray[dtype = int, ndim = 1] columns = np.array(catalogue[1], dtype = np.intc)
+	cdef int * column_vals = <int *> columns.data
+	cdef int NOcolumns = columns.shape[0]
+	cdef int cat_mode = 1 if catalogue[2] else 0
+	cdef label_t written
+	
+	# The rows are formatted natively from the properties of the objects, which have been calculated
+	# for the catalogue already
+	with nogil:
+		written = CreateCatalogue(output_file, flux_unit, detections, NOobj, obj_limit, column_vals, NOcolumns, cat_mode)
+	if written < 0:
+		FreeObjGen(detections, data_metric, xyz_order)
+		raise IOError('Could not write the catalogue file ' + catalogue[0])
+
+cdef _write_fits_mask(vector[object_props *] & detections, label_t NOobj, int obj_limit, maskFile, maskHeader, int size_x, int size_y, int size_z, long * data_metric, int * xyz_order):
+	
+	cdef string output_file = maskFile.encode()
+	cdef string header_cards = maskHeader.encode('ascii')
+	
+	cdef label_t written
+	
+	# The mask is written plane by plane from the sparse representations, so that the labelled mask
+	# never has to be held in memory as a whole
+	with nogil:
+		written = CreateFitsMask(output_file, header_cards, size_x, size_y, size_z, detections, NOobj, obj_limit)
+	if written < 0:
+		FreeObjGen(detections, data_metric, xyz_order)
+		raise IOError('Could not write the mask file ' + maskFile)
+
+MOMENT_MAPS = ('mom0', 'mom1', 'mom2', 'rapv', 'decpv')
+
+def moment_maps(data, runs = None, offsets = None, ids = None, mask = None, maps = MOMENT_MAPS):
+	"""
+	Create moment maps and position-velocity images of objects, visiting only their voxels.
+	
+	
+	Parameters
+	----------
+	
+	data : array
+		The data cube, as an array of shape (z, y, x). Blank voxels are treated as 0.
 		
-			detections[obj_batch][i - (obj_batch * obj_limit)].CalcProps()
-			
-			# Geometric center
-			obj.append(detections[obj_batch][i - (obj_batch * obj_limit)].GetRA())
-			obj.append(detections[obj_batch][i - (obj_batch * obj_limit)].GetDEC())
-			obj.append(detections[obj_batch][i - (obj_batch * obj_limit)].GetFREQ())
-			
-			# Center of mass
-			obj.append(detections[obj_batch][i - (obj_batch * obj_limit)].GetRAi())
-			obj.append(detections[obj_batch][i - (obj_batch * obj_limit)].GetDECi())
-			obj.append(detections[obj_batch][i - (obj_batch * obj_limit)].GetFREQi())
-			
-			# Adding 1 to the maxima to aid slicing/iteration
-			obj.append(detections[obj_batch][i - (obj_batch * obj_limit)].GetRAmin())
-			obj.append(detections[obj_batch][i - (obj_batch * obj_limit)].GetRAmax() + 1)
-			obj.append(detections[obj_batch][i - (obj_batch * obj_limit)].GetDECmin())
-			obj.append(detections[obj_batch][i - (obj_batch * obj_limit)].GetDECmax() + 1)
-			obj.append(detections[obj_batch][i - (obj_batch * obj_limit)].GetFREQmin())
-			obj.append(detections[obj_batch][i - (obj_batch * obj_limit)].GetFREQmax() + 1)
-			
-			# Number of voxels
-			obj.append(detections[obj_batch][i - (obj_batch * obj_limit)].ShowVoxels())
-			
-			# Min/Max/Total flux
-			obj.append(detections[obj_batch][i - (obj_batch * obj_limit)].GetMinI())
-			obj.append(detections[obj_batch][i - (obj_batch * obj_limit)].GetMaxI())
-			obj.append(detections[obj_batch][i - (obj_batch * obj_limit)].GetTI())
+	runs : array
+		The runs of voxels along the spectral axis of the objects, as returned by link_objects
+		with objectRuns set. Either runs or mask must be given.
 		
-			objects.append(obj)
-			
-			for y in range(detections[obj_batch][i - (obj_batch * obj_limit)].Get_srep_size(2), detections[obj_batch][i - (obj_batch * obj_limit)].Get_srep_size(3) + 1):
-				for x in range(detections[obj_batch][i - (obj_batch * obj_limit)].Get_srep_size(0), detections[obj_batch][i - (obj_batch * obj_limit)].Get_srep_size(1) + 1):
-					
-					g_start = detections[obj_batch][i - (obj_batch * obj_limit)].Get_srep_grid(((((y - detections[obj_batch][i - (obj_batch * obj_limit)].Get_srep_size(2)) * (detections[obj_batch][i - (obj_batch * obj_limit)].Get_srep_size(1) - detections[obj_batch][i - (obj_batch * obj_limit)].Get_srep_size(0) + 1)) + x - detections[obj_batch][i - (obj_batch * obj_limit)].Get_srep_size(0))))
-					g_end = detections[obj_batch][i - (obj_batch * obj_limit)].Get_srep_grid(((((y - detections[obj_batch][i - (obj_batch * obj_limit)].Get_srep_size(2)) * (detections[obj_batch][i - (obj_batch * obj_limit)].Get_srep_size(1) - detections[obj_batch][i - (obj_batch * obj_limit)].Get_srep_size(0) + 1)) + x - detections[obj_batch][i - (obj_batch * obj_limit)].Get_srep_size(0) + 1)))
-					
-					for g in range(g_start, g_end):
-						mask[detections[obj_batch][i - (obj_batch * obj_limit)].Get_srep_strings((2 * g)) : detections[obj_batch][i - (obj_batch * obj_limit)].Get_srep_strings((2 * g) + 1) + 1, y, x] = obj_id
-						
-	# Free memory for object pointers
-	FreeObjGen(detections, data_metric, xyz_order)
+	offsets : array
+		The offsets of the runs of each object, as returned by link_objects with objectRuns
+		set. Only needed if ids is given.
+		
+	ids : list
+		The IDs of the objects to include. If None, all of the runs are included.
+		
+	mask : array
+		A mask of the same shape as the data cube, whose voxels that aren't 0 are included.
+		It may be of any integer type, e.g. bool, numpy.uint8 or the labels of link_objects.
+		
+	maps : tuple
+		The maps to create, any of 'mom0', 'mom1', 'mom2', 'rapv' and 'decpv'.
+		
+		
+	Returns
+	-------
+	
+	maps : dict
+		The requested maps, as single precision arrays: 'mom0', 'mom1' and 'mom2' (y,x),
+		'rapv' (z,x), summed over y, and 'decpv' (z,y), summed over x. The moment-1 and
+		moment-2 maps are in channels, and are NaN where the moment-0 map is 0.
+	
+	
+	Only the output maps and the sums they are made from are held in memory, besides the
+	selected runs, rather than any arrays of the size of the data cube. The data and mask
+	are read where they are, e.g. from a numpy.memmap, and are only copied if the data
+	aren't of type numpy.single or numpy.double in native byte order, or the mask isn't of
+	an integer type.
+	"""
+	
+	cdef np.ndarray selected, flags
+	cdef long data_metric[3]
+	cdef long flag_metric[3]
+	cdef float * planes[5]
+	cdef int error, size_x, size_y, size_z, i
+	
+	for name in maps:
+		if name not in MOMENT_MAPS:
+			raise ValueError('Unknown moment map: ' + str(name))
+	if (runs is None) == (mask is None):
+		raise ValueError('Exactly one of runs and mask must be given.')
+	
+	# The data and mask are read through their own strides, so that they aren't copied; only data
+	# that aren't of a native floating-point type, and masks that aren't of an integer type, are
+	# converted. The mask voxels are only compared with 0, so its byte order doesn't matter
+	data = np.asarray(data)
+	if data.ndim != 3:
+		raise ValueError('The data cube must have 3 dimensions.')
+	if data.dtype not in (np.dtype(np.single), np.dtype(np.double)) or not _aligned(data):
+		data = np.ascontiguousarray(data, dtype = np.single)
+	size_z, size_y, size_x = data.shape[0], data.shape[1], data.shape[2]
+	for i in range(3):
+		data_metric[i] = data.strides[2 - i] // data.itemsize
+	
+	# The runs of the selected objects are gathered from the slices of the runs array
+	selected = None
+	flags = None
+	if runs is not None:
+		selected = np.ascontiguousarray(runs, dtype = np.intc).reshape(-1, 4)
+		if ids is not None:
+			if offsets is None:
+				raise ValueError('The offsets of the runs are needed to select objects.')
+			selected = np.concatenate([selected[offsets[k - 1]:offsets[k]] for k in ids] + [np.empty((0, 4), dtype = np.intc)])
+	else:
+		if mask.shape != data.shape:
+			raise ValueError('The mask must have the same shape as the data cube.')
+		flags = np.asarray(mask)
+		if flags.dtype.kind not in 'biu' or flags.dtype.itemsize not in (1, 2, 4, 8) or not _aligned(flags):
+			flags = np.not_equal(flags, 0)
+		for i in range(3):
+			flag_metric[i] = flags.strides[2 - i] // flags.itemsize
+	
+	result = {}
+	for i, name in enumerate(MOMENT_MAPS):
+		planes[i] = NULL
+		if name in maps:
+			result[name] = np.empty(((size_y, size_x), (size_y, size_x), (size_y, size_x), (size_z, size_x), (size_z, size_y))[i], dtype = np.single)
+			planes[i] = <float *> np.PyArray_DATA(result[name])
+	
+	cdef void * data_vals = np.PyArray_DATA(data)
+	cdef void * flag_vals = np.PyArray_DATA(flags) if flags is not None else NULL
+	cdef int * run_vals = <int *> np.PyArray_DATA(selected) if selected is not None else NULL
+	cdef long NOruns = selected.shape[0] if selected is not None else 0
+	cdef int flag_size = flags.itemsize if flags is not None else 0
+	cdef bint double_data = data.dtype == np.double
+	
+	with nogil:
+		if double_data:
+			if flag_size == 1:
+				error = CreateMomentMaps(<double *> data_vals, data_metric, <unsigned char *> flag_vals, flag_metric, NULL, 0, size_x, size_y, size_z, planes[0], planes[1], planes[2], planes[3], planes[4])
+			elif flag_size == 2:
+				error = CreateMomentMaps(<double *> data_vals, data_metric, <unsigned short *> flag_vals, flag_metric, NULL, 0, size_x, size_y, size_z, planes[0], planes[1], planes[2], planes[3], planes[4])
+			elif flag_size == 4:
+				error = CreateMomentMaps(<double *> data_vals, data_metric, <int *> flag_vals, flag_metric, NULL, 0, size_x, size_y, size_z, planes[0], planes[1], planes[2], planes[3], planes[4])
+			elif flag_size == 8:
+				error = CreateMomentMaps(<double *> data_vals, data_metric, <long *> flag_vals, flag_metric, NULL, 0, size_x, size_y, size_z, planes[0], planes[1], planes[2], planes[3], planes[4])
+			else:
+				error = CreateMomentMaps(<double *> data_vals, data_metric, <int *> NULL, NULL, run_vals, NOruns, size_x, size_y, size_z, planes[0], planes[1], planes[2], planes[3], planes[4])
+		else:
+			if flag_size == 1:
+				error = CreateMomentMaps(<float *> data_vals, data_metric, <unsigned char *> flag_vals, flag_metric, NULL, 0, size_x, size_y, size_z, planes[0], planes[1], planes[2], planes[3], planes[4])
+			elif flag_size == 2:
+				error = CreateMomentMaps(<float *> data_vals, data_metric, <unsigned short *> flag_vals, flag_metric, NULL, 0, size_x, size_y, size_z, planes[0], planes[1], planes[2], planes[3], planes[4])
+			elif flag_size == 4:
+				error = CreateMomentMaps(<float *> data_vals, data_metric, <int *> flag_vals, flag_metric, NULL, 0, size_x, size_y, size_z, planes[0], planes[1], planes[2], planes[3], planes[4])
+			elif flag_size == 8:
+				error = CreateMomentMaps(<float *> data_vals, data_metric, <long *> flag_vals, flag_metric, NULL, 0, size_x, size_y, size_z, planes[0], planes[1], planes[2], planes[3], planes[4])
+			else:
+				error = CreateMomentMaps(<float *> data_vals, data_metric, <int *> NULL, NULL, run_vals, NOruns, size_x, size_y, size_z, planes[0], planes[1], planes[2], planes[3], planes[4])
+	if error < 0:
+		raise ValueError('The runs must lie inside the data cube.')
+	
+	return result
+
+# The pool of native worker threads that runs the calls submitted by submit; it is started by the
+# first call of submit, or by start_pool, and is stopped when the interpreter exits
+cdef task_pool * _pool = NULL
 
-	return objects, mask
+class Future(object):
+	"""
+	The result of a call that has been submitted to the pool of worker threads by submit.
+	"""
 	
+	def __init__(self, function, args, kwargs):
+		self._call = (function, args, kwargs)
+		self._finished = threading.Event()
+		self._result = None
+		self._error = None
 	
+	def _run(self):
+		function, args, kwargs = self._call
+		self._call = None
+		try:
+			self._result = function(*args, **kwargs)
+		except BaseException as error:
+			self._error = error
+		self._finished.set()
+	
+	def done(self):
+		"""
+		Return True if the call has finished.
+		"""
+		return self._finished.is_set()
+	
+	def exception(self, timeout = None):
+		"""
+		Wait for the call to finish, for at most timeout seconds if timeout isn't None, and
+		return the exception that it raised, or None.
+		"""
+		if not self._finished.wait(timeout):
+			raise RuntimeError('The call has not finished.')
+		return self._error
+	
+	def result(self, timeout = None):
+		"""
+		Wait for the call to finish, for at most timeout seconds if timeout isn't None, and
+		return its result, or raise the exception that it raised.
+		"""
+		if self.exception(timeout) is not None:
+			raise self._error
+		return self._result
+
+# Called by the worker threads of the pool, which take the GIL for the Python parts of the call
+# only; the linking functions release it while the native code runs
+cdef void _run_future(void * context) noexcept with gil:
+	future = <object> context
+	Py_DECREF(future)
+	future._run()
+
+def start_pool(workers = None):
+	"""
+	Start the pool of native worker threads used by submit, with the given number of workers,
+	or one per CPU if workers is None. A pool that is already running finishes the calls that
+	have been submitted to it first.
+	"""
+	global _pool
+	
+	cdef int NOthreads = multiprocessing.cpu_count() if workers is None else workers
+	
+	if NOthreads < 1:
+		raise ValueError('The pool needs at least one worker.')
+	_stop_pool()
+	_pool = new task_pool(NOthreads)
+
+@atexit.register
+def _stop_pool():
+	global _pool
+	
+	cdef task_pool * pool = _pool
+	
+	_pool = NULL
+	if pool != NULL:
+		with nogil:
+			del pool
+
+def submit(function, *args, **kwargs):
+	"""
+	Call function(*args, **kwargs) in one of the native worker threads of the pool, starting the
+	pool if it isn't running, and return a Future that holds the result of the call.
+	
+	The linking functions, moment_maps and the parametriser release the GIL while their native
+	code runs, so that calls on different cubes run at the same time, e.g.
+	
+		futures = [submit(link_objects, data, mask, threads = 1) for data, mask in cubes]
+		results = [future.result() for future in futures]
+	
+	The calls mustn't share arrays that any of them writes to, and mustn't restart the pool.
+	"""
+	
+	if _pool == NULL:
+		start_pool()
+	future = Future(function, args, kwargs)
+	Py_INCREF(future)
+	_pool.Submit(_run_future, <void *> future)
+	return future
+
+def pool_workers():
+	"""
+	Return the number of worker threads of the pool, or 0 if it isn't running, and the number
+	of calls that are waiting for a worker.
+	"""
+	if _pool == NULL:
+		return 0, 0
+	return _pool.ShowThreads(), _pool.ShowQueued()
+
+cdef label_t _create_objects(np.ndarray[dtype = float, ndim = 3] data, np.ndarray[dtype = label_t, ndim = 3] mask, int chunk_z_start, int max_z_val,
+						 int mergeX, int mergeY, int mergeZ, int minSizeX, int minSizeY, int minSizeZ, engine, int threads,
+						 vector[object_props *] & detections, vector[label_t] & obj_ids, vector[label_t] & check_obj_ids, label_t NOobj, int obj_limit,
+						 long * data_metric, int * xyz_order, int products, np.ndarray runs = None):
+	
+	cdef int size_x = data.shape[2]
+	cdef int size_y = data.shape[1]
+	cdef int size_z = data.shape[0]
+	
+	# Chunking is only done along the z axis
+	cdef int chunk_x_start = 0
+	cdef int chunk_y_start = 0
+	
+	# Define min_v_size; does not seem to be used
+	cdef int min_v_size = 0
+	
+	# Define intensity thresholds
+	cdef float intens_thresh_min = -1E10
+	cdef float intens_thresh_max = 1E10
+	
+	# Define value that is used to mark sources in the mask
+	cdef label_t flag_val = -1
+	
+	# Define linking style: 1 for Rectangle, else ellipse
+	cdef int ss_mode = 0
+	
+	# The engines run without the GIL, so that other Python threads can run while the objects
+	# are linked
+	cdef float * data_vals = <float *> data.data
+	cdef label_t * flag_vals = <label_t *> mask.data
+	cdef int * run_vals = <int *> runs.data if runs is not None else NULL
+	cdef long NOruns = runs.shape[0] if runs is not None else 0
+	cdef int engine_mode = 0
+	
+	if engine == 'parallel':
+		engine_mode = 1
+	elif engine == 'unionfind':
+		engine_mode = 2
+	elif engine == 'dilate':
+		engine_mode = 3
+	elif runs is not None:
+		engine_mode = 4
+	
+	with nogil:
+		if engine_mode == 1:
+			NOobj = CreateObjectsMT(data_vals, flag_vals, size_x, size_y, size_z, chunk_x_start, chunk_y_start, chunk_z_start, mergeX, mergeY, mergeZ, minSizeX, minSizeY, minSizeZ, min_v_size, intens_thresh_min, intens_thresh_max, flag_val, NOobj, detections, obj_ids, check_obj_ids, obj_limit, size_x, size_y, max_z_val, ss_mode, data_metric, xyz_order, threads, products)
+		elif engine_mode == 2:
+			NOobj = CreateObjectsUF(data_vals, flag_vals, size_x, size_y, size_z, chunk_x_start, chunk_y_start, chunk_z_start, mergeX, mergeY, mergeZ, minSizeX, minSizeY, minSizeZ, min_v_size, intens_thresh_min, intens_thresh_max, flag_val, NOobj, detections, obj_ids, check_obj_ids, obj_limit, size_x, size_y, max_z_val, ss_mode, data_metric, xyz_order, products)
+		elif engine_mode == 3:
+			NOobj = CreateObjectsDil(data_vals, flag_vals, size_x, size_y, size_z, chunk_x_start, chunk_y_start, chunk_z_start, mergeX, mergeY, mergeZ, minSizeX, minSizeY, minSizeZ, min_v_size, intens_thresh_min, intens_thresh_max, flag_val, NOobj, detections, obj_ids, check_obj_ids, obj_limit, size_x, size_y, max_z_val, ss_mode, data_metric, xyz_order, products)
+		elif engine_mode == 4:
+			NOobj = CreateObjectsRuns(data_vals, flag_vals, size_x, size_y, size_z, chunk_x_start, chunk_y_start, chunk_z_start, mergeX, mergeY, mergeZ, minSizeX, minSizeY, minSizeZ, min_v_size, intens_thresh_min, intens_thresh_max, flag_val, NOobj, detections, obj_ids, check_obj_ids, obj_limit, size_x, size_y, max_z_val, ss_mode, data_metric, xyz_order, products, run_vals, NOruns)
+		else:
+			NOobj = CreateObjects(data_vals, flag_vals, size_x, size_y, size_z, chunk_x_start, chunk_y_start, chunk_z_start, mergeX, mergeY, mergeZ, minSizeX, minSizeY, minSizeZ, min_v_size, intens_thresh_min, intens_thresh_max, flag_val, NOobj, detections, obj_ids, check_obj_ids, obj_limit, size_x, size_y, max_z_val, ss_mode, data_metric, xyz_order, products)
+	
+	return NOobj
+
+cdef _stamps(object_props * obj, int products):
+	
+	cdef int j
+	cdef int nx = obj.Get_srep_size(1) - obj.Get_srep_size(0) + 1
+	cdef int ny = obj.Get_srep_size(3) - obj.Get_srep_size(2) + 1
+	cdef int nz = obj.Get_srep_size(5) - obj.Get_srep_size(4) + 1
+	cdef int nref = 2 * nz if nz >= 10 else nz + 10
+	cdef np.ndarray[dtype = float, ndim = 1] values
+	
+	# Copy the postage stamp images that the object holds into arrays of the requested products
+	products &= obj.Get_products()
+	stamps = {}
+	if products & SREP_MOM0:
+		values = np.empty(nx * ny, dtype = np.single)
+		for j in range(nx * ny):
+			values[j] = obj.Get_mom0(j)
+		stamps['mom0'] = values.reshape((ny, nx))
+	if products & SREP_RAPV:
+		values = np.empty(nx * nz, dtype = np.single)
+		for j in range(nx * nz):
+			values[j] = obj.Get_RAPV(j)
+		stamps['rapv'] = values.reshape((nz, nx))
+	if products & SREP_DECPV:
+		values = np.empty(ny * nz, dtype = np.single)
+		for j in range(ny * nz):
+			values[j] = obj.Get_DECPV(j)
+		stamps['decpv'] = values.reshape((nz, ny))
+	if products & SREP_OSPEC:
+		values = np.empty(nz, dtype = np.single)
+		for j in range(nz):
+			values[j] = obj.Get_ospec(j)
+		stamps['spec'] = values
+	if products & SREP_RSPEC:
+		values = np.empty(nref, dtype = np.single)
+		for j in range(nref):
+			values[j] = obj.Get_rspec(j)
+		stamps['ref_spec'] = values
+	if products & SREP_VFIELD:
+		values = np.empty(nx * ny, dtype = np.single)
+		for j in range(nx * ny):
+			values[j] = obj.Get_vfield(j)
+		stamps['vfield'] = values.reshape((ny, nx))
+	
+	return stamps
+
+cdef _create_catalogue(vector[object_props *] & detections, label_t NOobj, int obj_limit, mask, int products, long * data_metric, int threads,
+					   bint structured = False, bint objectRuns = False):
 	
+	cdef label_t i
+	cdef label_t obj_batch
+	cdef label_t NOlabels
+	cdef object_props * obj
+	cdef vector[label_t] new_ids
+	cdef np.ndarray labels = np.ascontiguousarray(mask)
+	cdef void * label_vals = np.PyArray_DATA(labels)
+	cdef np.ndarray[dtype = long, ndim = 1] offsets
+	cdef np.ndarray[dtype = int, ndim = 2] runs
+	cdef catalogue_record * records
+	cdef long NOruns
+	cdef int label_size
 	
+	# Calculate the properties of all objects in one go
+	CalcObjProps(detections, NOobj, obj_limit)
 	
+	# Re-label the mask with final, sequential IDs, straight from the objects' sparse representations
+	labels.fill(0)
+	label_size = labels.dtype.itemsize if labels.dtype.kind == 'u' else 0
+	with nogil:
+		if label_size == 2:
+			NOlabels = LabelObjs(detections, NOobj, obj_limit, <unsigned short *> label_vals, data_metric, new_ids, threads)
+		elif label_size == 4:
+			NOlabels = LabelObjs(detections, NOobj, obj_limit, <unsigned int *> label_vals, data_metric, new_ids, threads)
+		elif label_size == 8:
+			NOlabels = LabelObjs(detections, NOobj, obj_limit, <unsigned long *> label_vals, data_metric, new_ids, threads)
+		else:
+			NOlabels = LabelObjs(detections, NOobj, obj_limit, <label_t *> label_vals, data_metric, new_ids, threads)
+	if not mask.flags.c_contiguous:
+		mask[...] = labels
 	
+	# Copy the properties of the objects to a structured array in one go, or create a Python list
+	# `objects' from C++ vector `detections', in the order of the final IDs
+	if structured:
+		objects = np.empty(NOlabels, dtype = CATALOGUE_DTYPE)
+		records = <catalogue_record *> np.PyArray_DATA(objects)
+		if NOlabels > 0:
+			with nogil:
+				CopyCatalogue(detections, NOobj, obj_limit, new_ids, records, threads)
+	else:
+		objects = []
+		for i in range(NOobj):
+			if new_ids[i] < 1:
+				continue
+			obj_batch = i / obj_limit
+			obj = &detections[obj_batch][i - (obj_batch * obj_limit)]
+			objects.append([new_ids[i],
+				# Geometric center
+				obj.GetRA(), obj.GetDEC(), obj.GetFREQ(),
+				# Center of mass
+				obj.GetRAi(), obj.GetDECi(), obj.GetFREQi(),
+				# Bounding box, adding 1 to the maxima to aid slicing/iteration
+				obj.GetRAmin(), obj.GetRAmax() + 1, obj.GetDECmin(), obj.GetDECmax() + 1, obj.GetFREQmin(), obj.GetFREQmax() + 1,
+				# Number of voxels
+				obj.ShowVoxels(),
+				# Min/Max/Total flux
+				obj.GetMinI(), obj.GetMaxI(), obj.GetTI()])
 	
+	# Copy the runs of voxels of the objects to a single array, so that the runs of each object are a
+	# slice of it
+	object_runs = None
+	if objectRuns:
+		offsets = np.zeros(NOlabels + 1, dtype = np.int_)
+		with nogil:
+			NOruns = CopyRuns(detections, NOobj, obj_limit, new_ids, <long *> offsets.data, NULL, threads)
+		runs = np.empty((NOruns, 4), dtype = np.intc)
+		if NOruns > 0:
+			with nogil:
+				CopyRuns(detections, NOobj, obj_limit, new_ids, <long *> offsets.data, <int *> runs.data, threads)
+		object_runs = (runs, offsets)
 	
+	stamps = []
+	if products != 0:
+		for i in range(NOobj):
+			if new_ids[i] < 1:
+				continue
+			obj_batch = i / obj_limit
+			stamps.append(_stamps(&detections[obj_batch][i - (obj_batch * obj_limit)], products))
 	
-	
\ No newline at end of file
+	return objects, stamps, object_runs
@@ -7,28 +7,28 @@ cimport cython
 
 
 cdef extern from "Unit.h":
-    cpdef int UNIT_STD
-    cpdef int UNIT_EXP
-    cpdef int UNIT_NONE
-    cpdef int UNIT_JY
-    cpdef int UNIT_MJY
-    cpdef int UNIT_DEG
-    cpdef int UNIT_ARCMIN
-    cpdef int UNIT_ARCSEC
-    cpdef int UNIT_MAS
-    cpdef int UNIT_G
-    cpdef int UNIT_PC
-    cpdef int UNIT_KPC
-    cpdef int UNIT_MPC
-    cpdef int UNIT_AU
-    cpdef int UNIT_LY
-    cpdef int UNIT_MIN
-    cpdef int UNIT_H
-    cpdef int UNIT_A
-    cpdef int UNIT_ERG
-    cpdef int UNIT_DYN
-    cpdef int UNIT_C
-    cpdef int UNIT_E
+    cdef int UNIT_STD
+    cdef int UNIT_EXP
+    cdef int UNIT_NONE
+    cdef int UNIT_JY
+    cdef int UNIT_MJY
+    cdef int UNIT_DEG
+    cdef int UNIT_ARCMIN
+    cdef int UNIT_ARCSEC
+    cdef int UNIT_MAS
+    cdef int UNIT_G
+    cdef int UNIT_PC
+    cdef int UNIT_KPC
+    cdef int UNIT_MPC
+    cdef int UNIT_AU
+    cdef int UNIT_LY
+    cdef int UNIT_MIN
+    cdef int UNIT_H
+    cdef int UNIT_A
+    cdef int UNIT_ERG
+    cdef int UNIT_DYN
+    cdef int UNIT_C
+    cdef int UNIT_E
     cdef cppclass Unit:
         Unit() except +
         Unit(Unit &) except +
@@ -54,10 +54,10 @@ cdef class PyUnit:
 
 
 cdef extern from "Measurement.h":
-    cpdef int MEASUREMENT_DEFAULT
-    cpdef int MEASUREMENT_COMPACT
-    cpdef int MEASUREMENT_FULL
-    cpdef int MEASUREMENT_UNIT
+    cdef int MEASUREMENT_DEFAULT
+    cdef int MEASUREMENT_COMPACT
+    cdef int MEASUREMENT_FULL
+    cdef int MEASUREMENT_UNIT
     cdef cppclass Measurement[T]:
         Measurement() except +
         Measurement(Measurement[T] &) except +
@@ -155,7 +155,7 @@ cdef extern from "ModuleParametrisation.h":
             long dy,
             long dz,
             SourceCatalog &initCatalog
-            )
+            ) nogil
 
         SourceCatalog getCatalog()
         void setFlags(bool doMO, bool doBF)
@@ -1,5 +1,5 @@
 # distutils: language = c++
-# distutils: sources = ModuleParametrisation.cpp Unit.cpp Measurement.cpp Source.cpp SourceCatalog.cpp helperFunctions.cpp MaskOptimization.cpp BusyFit.cpp DataCube.cpp MetaData.cpp Parametrization.cpp WorldCoordinateSystem.cpp
+# cython: language_level = 2
 
 
 from cparametrizer cimport *
@@ -615,14 +615,16 @@ cdef class PyModuleParametrisation:
         cdef long dx = datacube.shape[2]
 
         initCatalogPtr = new SourceCatalog(deref((<PySourceCatalog> initCatalog).thisptr))
-        self.thisptr.run(
-            <float*> datacube.data,
-            <short*> maskcube.data,
-            dx,
-            dy,
-            dz,
-            deref(initCatalogPtr)
-            )
+        # the GIL is released while the sources are parametrised, so that other threads can run
+        with nogil:
+            self.thisptr.run(
+                <float*> datacube.data,
+                <short*> maskcube.data,
+                dx,
+                dy,
+                dz,
+                deref(initCatalogPtr)
+                )
 
     def getCatalog(self):
         c = PySourceCatalog()